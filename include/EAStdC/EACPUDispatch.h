@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// This module provides control over the runtime CPU dispatch used by some
+// EAStdC functions. Functions such as Memcmp, Memchr, Memcheck, Strlen and
+// CRC32Reverse have multiple implementations (e.g. SSE2 and AVX2) and the
+// best one that the executing CPU supports is selected the first time any
+// of them is used. This lets a library built for the baseline instruction
+// set take advantage of newer hardware.
+//
+// The selection can be overridden for testing, either with the
+// EASTDC_CPU_FEATURE_LEVEL environment variable (e.g. "scalar", "sse2",
+// "sse42", "avx2", "avx512"), which is read when the level is first resolved,
+// or at any time with SetCPUFeatureLevel.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTDC_EACPUDISPATCH_H
+#define EASTDC_EACPUDISPATCH_H
+
+
+#include <EABase/eabase.h>
+#include <EAStdC/internal/Config.h>
+
+
+namespace EA
+{
+	namespace StdC
+	{
+		/// CPUFeatureLevel
+		///
+		/// Identifies a set of instruction set extensions. Each level implies the
+		/// ones before it.
+		///
+		enum CPUFeatureLevel
+		{
+			kCPUFeatureLevelScalar,     /// Portable C implementations only.
+			kCPUFeatureLevelSSE2,       /// SSE2.
+			kCPUFeatureLevelSSE42,      /// SSE4.2, POPCNT and PCLMULQDQ.
+			kCPUFeatureLevelAVX2,       /// AVX2, BMI1 and BMI2, with OS support for the YMM registers.
+			kCPUFeatureLevelAVX512,     /// AVX-512 F, BW and VL, with OS support for the ZMM registers. There are no AVX-512 kernels yet, so this is currently an alias of kCPUFeatureLevelAVX2.
+			kCPUFeatureLevelCount
+		};
+
+
+		/// GetCPUFeatureLevelSupported
+		///
+		/// Returns the highest level that both the executing CPU and this build of
+		/// EAStdC support. Returns kCPUFeatureLevelScalar if EASTDC_CPU_DISPATCH_ENABLED
+		/// is disabled. The result is not affected by SetCPUFeatureLevel or by the
+		/// EASTDC_CPU_FEATURE_LEVEL environment variable.
+		///
+		EASTDC_API CPUFeatureLevel GetCPUFeatureLevelSupported();
+
+
+		/// GetCPUFeatureLevel
+		///
+		/// Returns the level currently in use by the dispatched functions.
+		///
+		EASTDC_API CPUFeatureLevel GetCPUFeatureLevel();
+
+
+		/// SetCPUFeatureLevel
+		///
+		/// Sets the level to be used by the dispatched functions. The level is clamped
+		/// to GetCPUFeatureLevelSupported, and the level actually selected is returned.
+		/// This is primarily useful for testing the lower level implementations on
+		/// hardware which supports higher levels.
+		/// This function can be called at any time, but calls to dispatched functions
+		/// that are concurrently executing in other threads may use either level.
+		///
+		/// Example usage:
+		///     for(int i = kCPUFeatureLevelScalar; i <= GetCPUFeatureLevelSupported(); i++)
+		///     {
+		///         SetCPUFeatureLevel((CPUFeatureLevel)i);
+		///         RunTests();
+		///     }
+		///     SetCPUFeatureLevel(kCPUFeatureLevelCount); // Restore the best available level.
+		///
+		EASTDC_API CPUFeatureLevel SetCPUFeatureLevel(CPUFeatureLevel level);
+
+
+		/// GetCPUFeatureLevelName
+		///
+		/// Returns the name of the level as accepted by the EASTDC_CPU_FEATURE_LEVEL
+		/// environment variable (e.g. "avx2").
+		///
+		EASTDC_API const char* GetCPUFeatureLevelName(CPUFeatureLevel level);
+
+	}
+}
+
+
+#endif // Header include guard
@@ -20,14 +20,20 @@
 //      char*    Memcpy     (void* pDestination, const void* pSource, size_t n);
 //      char*    MemcpyC    (void* pDestination, const void* pSource, size_t n);     // Faster version for cacheable memory (and not video memory).
 //      char*    MemcpyS    (void* pDestination, const void* pSource, size_t n);     // Streaming memory copy, doesn't invalidate the cache.
+//      void     MemcpyBatch(const MemcpyDesc* pDescArray, size_t descCount);     // Many small scattered copies.
 //      char*    Memcpy128  (void* pDestination, const void* pSource, size_t n);
 //      char*    Memcpy128C (void* pDestination, const void* pSource, size_t n);     // Faster version for cacheable memory (and not video memory).
 //      char*    Memmove    (void* pDestination, const void* pSource, size_t n);
 //      char*    MemmoveC   (void* pDestination, const void* pSource, size_t n);     // Faster version for cacheable memory (and not video memory).
 //
 //      const void* Memchr(const void* p, char c, size_t n);
+//      const char* Memrchr(const char* p, char c, size_t n);
+//      const char* MemchrAny(const char* p, size_t n, const char* pSet, size_t setCount);
 //      int         Memcmp(const void* p1, const void* p2, size_t n);
+//      size_t      MemFindDifference(const void* p1, const void* p2, size_t n);
+//      size_t      MemDiffRanges(const void* p1, const void* p2, size_t n, MemDiffRange* pRangeArray, size_t rangeCapacity, size_t mergeGranularity);
 //      void*       Memmem(const void* pMemory, size_t memorySize, const void* pFind, size_t findSize);
+//      class       MemmemSearcher;
 //
 //      uint8_t*    Memset8      (void* pDestination, uint8_t  c, size_t uint8Count);
 //      uint8_t*    Memset8C     (void* pDestination, uint8_t  c, size_t uint8Count);   // Faster version for cacheable memory (and not video memory).
@@ -53,6 +59,17 @@
 //      uint32_t*   Memcheck32     (void* pDestination, uint32_t c, size_t byteCount);
 //      uint64_t*   Memcheck64     (void* pDestination, uint64_t c, size_t byteCount);
 //
+//      char*       MemcpyParallel(void* pDestination, const void* pSource, size_t n);   // Multi-threaded for very large blocks.
+//      uint8_t*    MemsetParallel(void* pDestination, uint8_t c, size_t uint8Count);
+//
+//      void        PrefetchRange(const void* p, size_t n, bool bForWrite, int locality);
+//      void        MemTouch(void* p, size_t n);                                      // Faults in pages ahead of use.
+//      void        MemTouchParallel(void* p, size_t n);
+//      bool        MemAdviseSequential(const void* p, size_t n);
+//      bool        MemAdviseWillNeed(const void* p, size_t n);
+//      void*       AllocLargeBuffer(size_t n, size_t alignment, int flags, LargeBufferInfo* pInfo); // Huge page backed.
+//      void        FreeLargeBuffer(void* p, size_t n);
+//
 //      bool        TimingSafeMemEqual(const void* p1, const void* p2, size_t n);
 //      int         TimingSafeMemcmp(const void* p1, const void* p2, size_t n);
 //      int         TimingSafeMemIsClear(const void* p, size_t n);
@@ -297,6 +314,35 @@ namespace StdC
 	EASTDC_API char* MemcpyS(void* EA_RESTRICT pDestination, const void* EA_RESTRICT pSource, size_t nByteCount);
 
 
+	///////////////////////////////////////////////////////////////////////////
+	/// MemcpyBatch
+	///
+	/// Does the copies described by descCount MemcpyDesc entries, in order. 
+	/// This is equivalent to calling MemcpyC for each entry, but is faster for 
+	/// large numbers of small scattered copies (e.g. serializing the fields of 
+	/// many objects). The memory of upcoming entries is prefetched while the 
+	/// current entry is copied, and small copies are done with a few fixed-width 
+	/// moves instead of a general purpose memcpy call.
+	/// The source and destination ranges of an entry must not overlap, though
+	/// the ranges of different entries may.
+	/// Works only with cacheable memory (i.e. conventional system memory).
+	///
+	/// Example usage:
+	///     MemcpyDesc descArray[3] = { { &pOut[0], &entity.mPosition, sizeof(entity.mPosition) },
+	///                                 { &pOut[12], &entity.mVelocity, sizeof(entity.mVelocity) },
+	///                                 { &pOut[24], entity.mName, nameLength } };
+	///     MemcpyBatch(descArray, 3);
+	///
+	struct MemcpyDesc
+	{
+		void*       mpDestination;
+		const void* mpSource;
+		size_t      mnByteCount;
+	};
+
+	EASTDC_API void MemcpyBatch(const MemcpyDesc* pDescArray, size_t descCount);
+
+
 	///////////////////////////////////////////////////////////////////////////
 	/// Memcpy128
 	///
@@ -365,6 +411,48 @@ namespace StdC
 	#endif
 
 
+	///////////////////////////////////////////////////////////////////////////
+	/// Memrchr
+	///
+	/// Same as the GNU memrchr function.
+	/// Searches the first n characters (not necessarily bytes) of the memory block 
+	/// pointed to by p for the last occurrence of character c.
+	/// Returns a pointer to the character or NULL if not found.
+	/// There are no restrictions about the type of memory p refers
+	/// to except that it be readable.
+	///
+	EASTDC_API const char*     Memrchr  (const char*  p,    char c,     size_t n);
+	EASTDC_API const char16_t* Memrchr16(const char16_t* p, char16_t c, size_t n);
+	EASTDC_API const char32_t* Memrchr32(const char32_t* p, char32_t c, size_t n);
+	#if EA_WCHAR_UNIQUE
+		inline const wchar_t* MemrchrW(const wchar_t* p, wchar_t c, size_t n)
+		{
+			#if (EA_WCHAR_SIZE == 2)
+				return reinterpret_cast<const wchar_t*>(Memrchr16(reinterpret_cast<const char16_t*>(p), (char16_t)c, n));
+			#else
+				return reinterpret_cast<const wchar_t*>(Memrchr32(reinterpret_cast<const char32_t*>(p), (char32_t)c, n));
+			#endif
+		}
+	#endif
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// MemchrAny
+	///
+	/// Searches the first n bytes of the memory block pointed to by p for any 
+	/// of the setCount bytes at pSet. This is like Strpbrk, except that neither
+	/// the memory nor the set is 0-terminated, and so a 0 byte can be searched
+	/// for as well. 
+	/// Returns a pointer to the first matching byte or NULL if there is none.
+	/// Returns NULL if setCount is 0.
+	///
+	/// Example usage:
+	///     const char  delimiters[] = { '\0', '\n', '|' };
+	///     const char* pDelimiter   = MemchrAny(pBuffer, bufferSize, delimiters, sizeof(delimiters));
+	///
+	EASTDC_API const char* MemchrAny(const char* p, size_t n, const char* pSet, size_t setCount);
+
+
 	///////////////////////////////////////////////////////////////////////////
 	/// Memcmp
 	///
@@ -380,6 +468,44 @@ namespace StdC
 	EASTDC_API int Memcmp(const void* p1, const void* p2, size_t n);
 
 
+	///////////////////////////////////////////////////////////////////////////
+	/// MemFindDifference
+	///
+	/// Returns the offset of the first byte that differs between p1 and p2,
+	/// or n if the first n bytes are equal. This is like Memcmp, but tells where
+	/// the memory differs instead of how.
+	///
+	EASTDC_API size_t MemFindDifference(const void* p1, const void* p2, size_t n);
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// MemDiffRanges
+	///
+	/// Finds the runs of bytes which differ between the first n bytes of p1 and p2,
+	/// and writes them to pRangeArray as [mBegin, mEnd) offsets, in increasing order.
+	/// Runs which are separated by fewer than mergeGranularity equal bytes are merged 
+	/// into a single range, which is useful when each range has a fixed overhead 
+	/// (e.g. a delta packet header). A mergeGranularity of 0 or 1 yields the exact runs.
+	/// Returns the number of ranges found, which may be greater than rangeCapacity, in 
+	/// which case only the first rangeCapacity ranges are written. Thus pRangeArray can 
+	/// be NULL with a rangeCapacity of 0 to just count the ranges.
+	///
+	/// Example usage:
+	///     MemDiffRange rangeArray[32];
+	///     size_t       rangeCount = MemDiffRanges(pSnapshotPrev, pSnapshot, snapshotSize, rangeArray, 32, 8);
+	///
+	///     for(size_t i = 0; (i < rangeCount) && (i < 32); i++)
+	///         WriteDelta(pSnapshot + rangeArray[i].mBegin, rangeArray[i].mEnd - rangeArray[i].mBegin);
+	///
+	struct MemDiffRange
+	{
+		size_t mBegin;
+		size_t mEnd;
+	};
+
+	EASTDC_API size_t MemDiffRanges(const void* p1, const void* p2, size_t n, MemDiffRange* pRangeArray, size_t rangeCapacity, size_t mergeGranularity = 0);
+
+
 	///////////////////////////////////////////////////////////////////////////
 	/// Memmem
 	///
@@ -396,6 +522,61 @@ namespace StdC
 	EASTDC_API void* Memmem(const void* pMemory, size_t memorySize, const void* pFind, size_t findSize);
 
 
+	///////////////////////////////////////////////////////////////////////////
+	/// MemmemSearcher
+	///
+	/// Implements Memmem for a pattern (pFind/findSize) which is preprocessed once
+	/// and can then be searched for within any number of memory blocks. This is
+	/// useful for searching many buffers for the same signature, as the search
+	/// tables aren't recomputed for each search. Search returns the same results
+	/// as Memmem would for the same arguments.
+	///
+	/// Candidate positions are found by matching the first and last byte of the
+	/// pattern a vector at a time. If verification of candidates becomes expensive
+	/// relative to the memory scanned (e.g. highly repetitive data), the search
+	/// switches to the two-way algorithm, so the search time is linear in
+	/// memorySize + findSize in all cases.
+	///
+	/// The searcher refers to pFind but doesn't copy it, so the pattern memory
+	/// must remain valid and unchanged while the searcher is used.
+	///
+	/// Example usage:
+	///     MemmemSearcher searcher(pSignature, signatureSize);
+	///
+	///     for(size_t i = 0; i < fileCount; i++)
+	///     {
+	///         if(searcher.Search(files[i].mpData, files[i].mSize))
+	///             printf("Signature found in %s\n", files[i].mpName);
+	///     }
+	///
+	class EASTDC_API MemmemSearcher
+	{
+	public:
+		MemmemSearcher();
+		MemmemSearcher(const void* pFind, size_t findSize);
+
+		/// Sets the pattern to search for, replacing any previous pattern.
+		void Init(const void* pFind, size_t findSize);
+
+		/// Returns the first location of the pattern within pMemory/memorySize, or NULL if not found.
+		/// The return value follows the same rules as Memmem.
+		void* Search(const void* pMemory, size_t memorySize) const;
+
+		const void* GetFind() const     { return mpFind; }
+		size_t      GetFindSize() const { return mFindSize; }
+
+	protected:
+		const uint8_t* SearchTwoWay(const uint8_t* pMemory, size_t memorySize, size_t position) const;
+
+	protected:
+		const uint8_t* mpFind;          // The pattern to search for. Not owned by this class.
+		size_t         mFindSize;
+		size_t         mCriticalPos;    // Critical factorization position of the pattern, as used by the two-way algorithm.
+		size_t         mPeriod;         // Period of the pattern if mbPeriodic, else the shift to use after a mismatch in the left half.
+		bool           mbPeriodic;      // True if the pattern's left half is a repetition of the period.
+	};
+
+
 	///////////////////////////////////////////////////////////////////////////
 	/// Memclear
 	///
@@ -540,8 +721,9 @@ namespace StdC
 
 	/// TimingSafeMemcmp
 	///
-	/// Behaves the same as Memcmp, but executes in a constant time for any given n value. 
-	/// The primary use case for this is for security in the presence of possible timing attacks.
+	/// Behaves the same as Memcmp (including returning -1, 0, or 1), but executes in a constant 
+	/// time for any given n value. The primary use case for this is for security in the presence 
+	/// of possible timing attacks.
 	///
 	EASTDC_API int TimingSafeMemcmp(const void* p1, const void* p2, size_t n);
 
@@ -557,6 +739,199 @@ namespace StdC
 	EASTDC_API bool TimingSafeMemIsClear(const void* p, size_t n);
 
 
+
+	///////////////////////////////////////////////////////////////////////////
+	/// MemcpyParallel / MemsetParallel
+	///
+	/// Same as Memcpy and Memset8, but blocks of at least EASTDC_MEMORY_PARALLEL_THRESHOLD 
+	/// bytes are split into chunks which are processed by multiple threads. This is 
+	/// useful for blocks much larger than the last-level cache, as a single thread
+	/// usually can't saturate the memory bandwidth of a multi-core system.
+	/// Chunk boundaries are page-aligned in the destination, so no two threads write
+	/// to the same page. The calling thread processes chunks as well and the function 
+	/// returns only when all chunks are complete. The source and destination must not overlap.
+	///
+	/// By default the chunks are processed by an internal pool of EAThread threads,
+	/// which is created on first use and destroyed by EA::StdC::Shutdown. If the pool
+	/// is already in use by another thread then the calling thread does all the work
+	/// itself, rather than wait. SetParallelJobRunner can be used to instead process 
+	/// the chunks with an external job system.
+	///
+	EASTDC_API char*    MemcpyParallel(void* pDestination, const void* pSource, size_t nByteCount);
+	EASTDC_API uint8_t* MemsetParallel(void* pDestination, uint8_t c, size_t uint8Count);
+
+
+	/// ParallelJobFunction
+	///
+	/// Processes job jobIndex of a set of jobs that were passed to a ParallelJobRunner.
+	///
+	typedef void (*ParallelJobFunction)(void* pJobContext, size_t jobIndex);
+
+	/// ParallelJobRunner
+	///
+	/// Calls pJobFunction(pJobContext, i) for each i in [0, jobCount), possibly concurrently, 
+	/// and returns when all the calls have returned. The calls may be made in any order and 
+	/// by any threads, including the calling thread.
+	/// pRunnerContext is the value that was passed to SetParallelJobRunner.
+	///
+	typedef void (*ParallelJobRunner)(ParallelJobFunction pJobFunction, void* pJobContext, size_t jobCount, void* pRunnerContext);
+
+	/// SetParallelJobRunner
+	///
+	/// Sets the function which MemcpyParallel, MemsetParallel and MemTouchParallel use to run their jobs.
+	/// concurrency is the number of threads that are expected to process the jobs, and 
+	/// determines how finely the work is divided. 
+	/// If pRunner is NULL, the internal thread pool is used with concurrency threads 
+	/// (including the calling thread). A concurrency of 0 selects the default, which is 
+	/// the processor count but at most EASTDC_MEMORY_PARALLEL_THREAD_MAX. A concurrency
+	/// of 1 disables the parallel processing.
+	/// This function must not be called while any of those functions are executing.
+	///
+	/// Example usage:
+	///     void MyRunner(EA::StdC::ParallelJobFunction pJobFunction, void* pJobContext, size_t jobCount, void* pRunnerContext)
+	///     {
+	///         MyJobSystem* pJobSystem = static_cast<MyJobSystem*>(pRunnerContext);
+	///         pJobSystem->ParallelFor(jobCount, [=](size_t i){ pJobFunction(pJobContext, i); });
+	///     }
+	///
+	///     SetParallelJobRunner(MyRunner, &jobSystem, jobSystem.GetWorkerCount());
+	///
+	EASTDC_API void SetParallelJobRunner(ParallelJobRunner pRunner, void* pRunnerContext, size_t concurrency);
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// PrefetchRange
+	///
+	/// Issues a cache prefetch for each cache line of the n bytes at p, so that the 
+	/// memory is likely to be in the cache by the time it's used. Prefetches are only
+	/// hints; they don't fault in pages and never generate exceptions, so p doesn't
+	/// need to refer to valid memory.
+	/// If bForWrite is true then the lines are prefetched with the intention to write
+	/// to them, on platforms which distinguish this. locality is the same as the 
+	/// __builtin_prefetch locality argument: 3 (the default) keeps the memory in all
+	/// cache levels, 2 and 1 progressively fewer, and 0 requests minimal cache pollution
+	/// for memory that will be used only once. 
+	/// The range should be no larger than the cache level it's intended for; prefetching 
+	/// more just evicts what was prefetched earlier.
+	///
+	/// Example usage:
+	///     PrefetchRange(pNextEntity, sizeof(Entity));
+	///     PrefetchRange(pOutput, outputSize, true, 0);
+	///
+	EASTDC_API void PrefetchRange(const void* p, size_t n, bool bForWrite = false, int locality = 3);
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// MemTouch / MemTouchParallel
+	///
+	/// Faults in the pages of the n bytes at p ahead of their use, by writing one byte
+	/// of each page (with the value it already has). This avoids taking a page fault 
+	/// storm on the first use of a large freshly mapped block, and moves the cost to a 
+	/// point of the caller's choosing. The memory contents are unchanged, but the memory 
+	/// must be writable and must not be written by another thread during the call. 
+	///
+	/// MemTouchParallel is the same as MemTouch, but blocks of at least 
+	/// EASTDC_MEMORY_PARALLEL_THRESHOLD bytes are divided between multiple threads, in the 
+	/// same way as MemcpyParallel. Most operating systems can handle page faults from 
+	/// different threads concurrently.
+	///
+	/// Example usage:
+	///     void* pArena = mmap(NULL, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	///     MemTouchParallel(pArena, arenaSize);
+	///
+	EASTDC_API void MemTouch(void* p, size_t n);
+	EASTDC_API void MemTouchParallel(void* p, size_t n);
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// MemAdviseSequential / MemAdviseWillNeed
+	///
+	/// Wrap madvise with MADV_SEQUENTIAL and MADV_WILLNEED respectively, for the pages
+	/// which contain any of the n bytes at p. p doesn't need to be page-aligned.
+	/// MemAdviseSequential tells the OS that the memory will be accessed sequentially,
+	/// so that it can read ahead aggressively and free pages soon after they're used.
+	/// MemAdviseWillNeed tells the OS that the memory will be used soon, so that it can
+	/// start reading it in. Both mostly benefit memory mapped files; use MemTouch to fault 
+	/// in anonymous memory. 
+	/// Returns true if the advice was accepted. Returns false on failure and on platforms 
+	/// which don't support madvise, in which case there is no other effect.
+	///
+	EASTDC_API bool MemAdviseSequential(const void* p, size_t n);
+	EASTDC_API bool MemAdviseWillNeed(const void* p, size_t n);
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// AllocLargeBuffer / FreeLargeBuffer
+	///
+	/// Allocates a large buffer directly from the OS, backed by huge pages where
+	/// possible in order to reduce TLB misses. The buffer is zero-filled.
+	/// The allocation is done with mmap (VirtualAlloc on Microsoft platforms). It tries
+	/// the following in order, as allowed by flags:
+	///     kLargeBufferHugePages            - Explicit huge pages (MAP_HUGETLB or MEM_LARGE_PAGES). 
+	///                                        These usually must have been reserved or permitted by 
+	///                                        the system administrator, so this often fails.
+	///     kLargeBufferTransparentHugePages - Regular pages with madvise(MADV_HUGEPAGE), which lets 
+	///                                        Linux back the buffer with huge pages if it can find them.
+	///     Neither                          - Regular pages.
+	/// kLargeBufferNUMALocal additionally asks that the memory be placed on the NUMA node of 
+	/// the calling thread (with mbind and MPOL_PREFERRED on Linux). kLargeBufferPopulate faults 
+	/// in the memory before returning, as with MemTouch.
+	///
+	/// alignment must be 0 or a power of two. The buffer is always aligned to at least the 
+	/// size of the pages that back it, and when huge pages are requested to the huge page size.
+	/// Returns NULL if the memory couldn't be allocated or nSize is 0.
+	/// If pInfo is non-NULL, it receives a description of what was actually obtained.
+	///
+	/// The buffer must be freed with FreeLargeBuffer, with the same nSize that was passed to 
+	/// AllocLargeBuffer.
+	///
+	/// Example usage:
+	///     LargeBufferInfo info;
+	///     void* pHeap = AllocLargeBuffer(heapSize, 0, kLargeBufferDefault | kLargeBufferNUMALocal, &info);
+	///     printf("Heap page size: %u\n", (unsigned)info.mPageSize);
+	///     ...
+	///     FreeLargeBuffer(pHeap, heapSize);
+	///
+	enum LargeBufferFlags
+	{
+		kLargeBufferHugePages            = 0x01,
+		kLargeBufferTransparentHugePages = 0x02,
+		kLargeBufferNUMALocal            = 0x04,
+		kLargeBufferPopulate             = 0x08,
+		kLargeBufferDefault              = kLargeBufferHugePages | kLargeBufferTransparentHugePages
+	};
+
+	struct LargeBufferInfo
+	{
+		size_t mPageSize;                   // The size of the pages which are guaranteed to back the buffer. This is the huge page size if explicit huge pages were obtained and the regular page size otherwise.
+		bool   mbTransparentHugePages;      // True if the OS accepted the request for transparent huge pages. It may still use regular pages for some or all of the buffer.
+		bool   mbNUMALocal;                 // True if the memory was bound to the NUMA node of the calling thread.
+	};
+
+	EASTDC_API void* AllocLargeBuffer(size_t nSize, size_t alignment = 0, int flags = kLargeBufferDefault, LargeBufferInfo* pInfo = NULL);
+	EASTDC_API void  FreeLargeBuffer(void* p, size_t nSize);
+
+
+	namespace Internal
+	{
+		/// MemcpyNonTemporal / MemsetNonTemporal
+		///
+		/// Implement the streaming pathways of MemcpyS, Memcpy128 and Memset8_128. The destination
+		/// is written with non-temporal stores (e.g. movntdq) which bypass the cache, followed by
+		/// a store fence. There are no alignment requirements, though the bulk of the operation
+		/// is done in 64 byte blocks on 16 byte aligned destination addresses. On platforms without
+		/// non-temporal store support these fall back to memcpy and memset.
+		/// These aren't intended to be called directly by users.
+		///
+		EASTDC_API void MemcpyNonTemporal(void* EA_RESTRICT pDestination, const void* EA_RESTRICT pSource, size_t nByteCount);
+		EASTDC_API void MemsetNonTemporal(void* pDestination, uint8_t c, size_t uint8Count);
+
+		/// Destroys the MemcpyParallel / MemsetParallel thread pool, if it was created.
+		/// If another thread is running a parallel operation on the pool, this waits for it to finish.
+		/// Called by EA::StdC::Shutdown.
+		EASTDC_API void MemoryParallelShutdown();
+	}
+
 } // namespace StdC
 } // namespace EA
 
@@ -222,6 +222,8 @@ namespace StdC
 	/// Additionally, extra functionality such as the following field types and 
 	/// modifiers are supported:
 	///     b      Binary output field type (joins d, i, x, o, etc.). Example: printf("%b", 255) prints "11111111"
+	///     r      Shortest round-trip double field type (joins e, f, g), in the notation of FtoaShortest. R uses E for the exponent. 
+	///            The precision is ignored. Example: printf("%r", 0.1) prints "0.1", whereas printf("%.17g", 0.1) prints "0.10000000000000001"
 	///     I8     8 bit integer field modifier. Example: printf("%I8d", 0xff) prints "-1"
 	///     I16    16 bit integer field modifier. Example: printf("%I16d", 0xffff) prints "-1"
 	///     I32    32 bit integer field modifier. Example: printf("%I32d", 0xffffffff) prints "-1"
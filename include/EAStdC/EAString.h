@@ -27,10 +27,12 @@
 //    char_t*  Strmix(char_t* pDestination, const char_t* pSource, const char_t* pDelimiters);
 //    char_t*  Strchr(const char_t* pString, char_t c);
 //    char_t*  Strnchr(const char_t* pString, char_t c, size_t n);
+//    class    CharSet;
 //    size_t   Strcspn(const char_t* pString1, const char_t* pString2);
 //    char_t*  Strpbrk(const char_t* pString1, const char_t* pString2);
 //    char_t*  Strrchr(const char_t* pString, char_t c);
 //    size_t   Strspn(const char_t* pString, const char_t* pSubString);
+//    size_t   Strspn(const char_t* pString, const CharSet& charSet);          // Also Strcspn, Strpbrk, Strtok and Strtok2 with a CharSet.
 //    char_t*  Strstr(const char_t* pString, const char_t* pSubString);
 //    char_t*  Stristr(const char_t* pString, const char_t* pSubString);
 //    bool     Strstart(const char_t* pString, const char_t* pPrefix);
@@ -71,15 +73,19 @@
 //    uint64_t StrtoU64(const char_t* pString, char_t** ppStringEnd, int nBase);
 //    int32_t  StrtoI32(const char_t* pString, char_t** ppStringEnd, int nBase);
 //    uint32_t StrtoU32(const char_t* pString, char_t** ppStringEnd, int nBase);
+//    int64_t  StrtoI64(const char_t* pString, size_t nLength, char_t** ppStringEnd, int nBase); // Also StrtoU64, StrtoI32, StrtoU32.
 //    int32_t  AtoI32(const char_t* pString);
 //    uint32_t AtoU32(const char_t* pString);
 //    int64_t  AtoI64(const char_t* pString);
 //    uint64_t AtoU64(const char_t* pString);
+//    int64_t  AtoI64(const char_t* pString, size_t nLength);                                  // Also AtoU64, AtoI32, AtoU32.
 //    double   Atof(const char_t* pString);
 //    double   AtofEnglish(const char_t* pString);
+//    size_t   ParseDoubleArray(const char* pText, size_t nTextLength, const char* pDelimiters, double* pValues, size_t nValueCapacity, size_t& nTextPosition); // Also ParseInt32Array, ParseInt64Array, ParseFloatArray.
 //
 //    char_t*  Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
 //    char_t*  FtoaEnglish(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
+//    char_t*  FtoaShortest(double dValue, char_t* pResult, int nResultCapacity);
 //
 //    size_t   ReduceFloatString(char_t* pString, size_t length);
 ///////////////////////////////////////////////////////////////////////////////
@@ -296,6 +302,8 @@ EASTDC_API size_t Strlcpy(char32_t* pDestination, const char32_t* pSource, size_
 /// The destination needs to have nSourceLength + 1 bytes of capacity. Recall that 
 /// nSourceLength is the strlen of the source and thus doesn't include the source's
 /// own trailing 0 byte.
+/// If nSourceLength is specified then the source must have at least that many
+/// readable chars, as runs of the source may be read a vector at a time. 
 ///
 EASTDC_API int Strlcpy(char16_t* pDestination, const char*  pSource, size_t nDestCapacity, size_t nSourceLength = kSizeTypeUnset);
 EASTDC_API int Strlcpy(char*  pDestination, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength = kSizeTypeUnset);
@@ -965,6 +973,88 @@ EASTDC_API char32_t* Strnchr(const char32_t* pString, char32_t c, size_t n);
 #endif
 
 
+/// CharSet
+///
+/// A set of chars, built once from a 0-terminated string of them, which can be passed 
+/// to the CharSet versions of Strcspn, Strpbrk, Strspn, Strtok and Strtok2 instead of 
+/// the string. Testing a char against a CharSet takes constant time, whereas the string 
+/// versions of those functions build a CharSet on each call. So a tokenizer which scans 
+/// many strings with the same delimiters should build its CharSet once and reuse it.
+///
+/// Chars below 256 are looked up in a bitmap, which is laid out as two 16 byte tables 
+/// indexed by the low nibble of the char, one for each value of its top bit, as with 
+/// MemchrAny. This lets SIMD code test 16 or 32 chars at a time with byte shuffles.
+/// Chars of 256 and above are first tested against a 32 bit hash and then looked for 
+/// with a binary search in a sorted array of them within the set. The set doesn't refer 
+/// to the string it was built from. It holds up to kWideCharCapacity distinct chars of 
+/// 256 and above, which is plenty for delimiter sets. Any more are left out of the set, 
+/// which IsComplete reports. The string versions of Strcspn and the others handle such 
+/// strings themselves, so it's only a limit for users of CharSet.
+///
+/// Example usage:
+///     const CharSet delimiters(" \t,;");
+///     char*         pContext = NULL;
+///
+///     for(char* pToken = Strtok(pText, delimiters, &pContext); pToken; pToken = Strtok(NULL, delimiters, &pContext))
+///         ProcessToken(pToken);
+///
+class EASTDC_API CharSet
+{
+public:
+	static const uint32_t kWideCharCapacity = 16;
+
+	CharSet();
+	explicit CharSet(const char*     pChars);
+	explicit CharSet(const char16_t* pChars);
+	explicit CharSet(const char32_t* pChars);
+	#if EA_WCHAR_UNIQUE
+		explicit CharSet(const wchar_t* pChars);
+	#endif
+
+	/// Sets the set to the chars of the 0-terminated pChars, replacing any previous chars.
+	void Init(const char*     pChars);
+	void Init(const char16_t* pChars);
+	void Init(const char32_t* pChars);
+	#if EA_WCHAR_UNIQUE
+		void Init(const wchar_t* pChars);
+	#endif
+
+	/// Returns true if c is in the set. A 0 char is never in the set.
+	/// The uint32_t version takes the value of the char as an unsigned number (e.g. (uint8_t)c for a char).
+	bool Contains(uint32_t c) const
+	{
+		if(c < 256)
+			return ((mByteTable[c >> 7][c & 15] >> ((c >> 4) & 7)) & 1) != 0;
+		return ((mWideHash >> (c & 31)) & 1) && ContainsWide(c);
+	}
+
+	bool Contains(char     c) const { return Contains((uint32_t)(uint8_t)c); }
+	bool Contains(char16_t c) const { return Contains((uint32_t)c); }
+	bool Contains(char32_t c) const { return Contains((uint32_t)c); }
+	#if EA_WCHAR_UNIQUE
+		bool Contains(wchar_t c) const { return Contains((uint32_t)c); }
+	#endif
+
+	/// Returns false if the set was built from more than kWideCharCapacity distinct chars of 256 
+	/// and above, in which case only the first kWideCharCapacity of them are in the set.
+	bool IsComplete() const { return !mbWideOverflow; }
+
+	/// Returns the 32 bytes of the bitmap described above: the table for chars 0-127 followed by that for chars 128-255.
+	const uint8_t* GetByteTable() const { return mByteTable[0]; }
+
+protected:
+	void Add(uint32_t c);
+	bool ContainsWide(uint32_t c) const;
+
+protected:
+	uint8_t  mByteTable[2][16];                 // Bit (c >> 4) & 7 of mByteTable[c >> 7][c & 15] is set if c (< 256) is in the set.
+	uint32_t mWideHash;                         // Bit (c & 31) is set for each c >= 256 in the set.
+	uint32_t mWideCharCount;                    // The number of chars in mWideChars.
+	bool     mbWideOverflow;                    // True if some chars >= 256 didn't fit in mWideChars.
+	uint32_t mWideChars[kWideCharCapacity];     // The chars >= 256 in the set, in increasing order.
+};
+
+
 /// Strcspn
 ///
 /// Scans pString1 character by character, returning the number of chars read 
@@ -972,6 +1062,7 @@ EASTDC_API char32_t* Strnchr(const char32_t* pString, char32_t c, size_t n);
 /// The search includes terminating null-characters, so the function will return 
 /// the length of pString1 if none of the characters included in pString2 is in pString1.
 /// This is similar to the strcspn C function.
+/// The CharSet versions take a prebuilt set of the chars instead of pString2. See CharSet.
 ///
 EASTDC_API size_t  Strcspn(const char*  pString1, const char*  pString2);
 EASTDC_API size_t  Strcspn(const char16_t* pString1, const char16_t* pString2);
@@ -980,6 +1071,13 @@ EASTDC_API size_t  Strcspn(const char32_t* pString1, const char32_t* pString2);
 	EASTDC_API size_t  Strcspn(const wchar_t* pString1, const wchar_t* pString2);
 #endif
 
+EASTDC_API size_t  Strcspn(const char*     pString, const CharSet& charSet);
+EASTDC_API size_t  Strcspn(const char16_t* pString, const CharSet& charSet);
+EASTDC_API size_t  Strcspn(const char32_t* pString, const CharSet& charSet);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API size_t  Strcspn(const wchar_t* pString, const CharSet& charSet);
+#endif
+
 
 /// Strpbrk
 ///
@@ -987,6 +1085,7 @@ EASTDC_API size_t  Strcspn(const char32_t* pString1, const char32_t* pString2);
 /// character that matches with any of the characters in pString2. The search 
 /// does not includes the terminating null characters.
 /// This is similar to the strpbrk C function.
+/// The CharSet versions take a prebuilt set of the chars instead of pString2. See CharSet.
 ///
 EASTDC_API char*  Strpbrk(const char*  pString1, const char*  pString2);
 EASTDC_API char16_t* Strpbrk(const char16_t* pString1, const char16_t* pString2);
@@ -995,6 +1094,13 @@ EASTDC_API char32_t* Strpbrk(const char32_t* pString1, const char32_t* pString2)
 	EASTDC_API wchar_t* Strpbrk(const wchar_t* pString1, const wchar_t* pString2);
 #endif
 
+EASTDC_API char*     Strpbrk(const char*     pString, const CharSet& charSet);
+EASTDC_API char16_t* Strpbrk(const char16_t* pString, const CharSet& charSet);
+EASTDC_API char32_t* Strpbrk(const char32_t* pString, const CharSet& charSet);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API wchar_t* Strpbrk(const wchar_t* pString, const CharSet& charSet);
+#endif
+
 
 /// Strrchr
 ///
@@ -1012,7 +1118,9 @@ EASTDC_API char32_t* Strrchr(const char32_t* pString, char32_t c);
 
 /// Strspn
 ///
+/// Returns the number of chars at the beginning of pString which are all in pSubString.
 /// This is similar to the strspn C function.
+/// The CharSet versions take a prebuilt set of the chars instead of pSubString. See CharSet.
 ///
 EASTDC_API size_t Strspn(const char*  pString, const char*  pSubString);
 EASTDC_API size_t Strspn(const char16_t* pString, const char16_t* pSubString);
@@ -1021,6 +1129,13 @@ EASTDC_API size_t Strspn(const char32_t* pString, const char32_t* pSubString);
 	EASTDC_API size_t Strspn(const wchar_t* pString, const wchar_t* pSubString);
 #endif
 
+EASTDC_API size_t Strspn(const char*     pString, const CharSet& charSet);
+EASTDC_API size_t Strspn(const char16_t* pString, const CharSet& charSet);
+EASTDC_API size_t Strspn(const char32_t* pString, const CharSet& charSet);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API size_t Strspn(const wchar_t* pString, const CharSet& charSet);
+#endif
+
 
 /// Strstr
 ///
@@ -1050,6 +1165,7 @@ EASTDC_API char32_t* Strstr(const char32_t* pString, const char32_t* pSubString)
 /// standard wcsstr works.
 /// This is similar to the stristr and wcsstr C functions. See the notes for
 /// those functions for some additional info.
+/// Only the ASCII letters are case-folded, as with Tolower.
 ///
 EASTDC_API char*  Stristr(const char*  pString, const char*  pSubString);
 EASTDC_API char16_t* Stristr(const char16_t* pString, const char16_t* pSubString);
@@ -1080,6 +1196,7 @@ EASTDC_API char32_t* Strrstr(const char32_t* pString, const char32_t* pSubString
 /// exclusive of the terminating null character.
 /// This is similar to the strirstr C function. See the notes for
 /// Strstr for some additional info.
+/// Only the ASCII letters are case-folded, as with Tolower.
 ///
 EASTDC_API char*  Strirstr(const char*  pString, const char*  pSubString);
 EASTDC_API char16_t* Strirstr(const char16_t* pString, const char16_t* pSubString);
@@ -1166,6 +1283,9 @@ EASTDC_API bool Striend(const char32_t* pString, const char32_t* pSuffix, size_t
 /// This is similar to wcstok and to the sometimes seen strtok_r 
 /// function (as opposed to the strtok function).
 ///
+/// The CharSet versions take a prebuilt set of the delimiters instead of 
+/// pDelimiters, which saves building one on each call. See CharSet.
+///
 /// Detailed specification:
 /// The first call in the sequence has pString as its first argument, and is followed 
 /// by calls with a null pointer as their first argument. The separator string pointed 
@@ -1209,6 +1329,13 @@ EASTDC_API char32_t* Strtok(char32_t* pString, const char32_t* pDelimiters, char
 	EASTDC_API wchar_t* Strtok(wchar_t* pString, const wchar_t* pDelimiters, wchar_t** pContext);
 #endif
 
+EASTDC_API char*     Strtok(char*     pString, const CharSet& delimiters, char**     pContext);
+EASTDC_API char16_t* Strtok(char16_t* pString, const CharSet& delimiters, char16_t** pContext);
+EASTDC_API char32_t* Strtok(char32_t* pString, const CharSet& delimiters, char32_t** pContext);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API wchar_t* Strtok(wchar_t* pString, const CharSet& delimiters, wchar_t** pContext);
+#endif
+
 
 /// Strtok2
 ///
@@ -1225,6 +1352,9 @@ EASTDC_API char32_t* Strtok(char32_t* pString, const char32_t* pDelimiters, char
 /// This function has the potentially undesirable effect of skipping empty fields 
 /// in the string; you may want to try using the parsing functions in EATextUtil.h 
 /// in order to avoid this.
+///
+/// The CharSet versions take a prebuilt set of the delimiters instead of 
+/// pDelimiters, which saves building one on each call. See CharSet.
 /// 
 EASTDC_API const char*  Strtok2(const char*  pString, const char*  pDelimiters, size_t* pResultLength, bool bFirst);
 EASTDC_API const char16_t* Strtok2(const char16_t* pString, const char16_t* pDelimiters, size_t* pResultLength, bool bFirst);
@@ -1233,6 +1363,13 @@ EASTDC_API const char32_t* Strtok2(const char32_t* pString, const char32_t* pDel
 	EASTDC_API const wchar_t* Strtok2(const wchar_t* pString, const wchar_t* pDelimiters, size_t* pResultLength, bool bFirst);
 #endif
 
+EASTDC_API const char*     Strtok2(const char*     pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst);
+EASTDC_API const char16_t* Strtok2(const char16_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst);
+EASTDC_API const char32_t* Strtok2(const char32_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API const wchar_t* Strtok2(const wchar_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst);
+#endif
+
 
 /// Strset
 ///
@@ -1325,6 +1462,7 @@ EASTDC_API int Strncmp(const char32_t* pString1, const char32_t* pString2, size_
 /// Stricmp
 ///
 /// This is similar to the sometimes seen _stricmp or strcasecmp C function.
+/// Only the ASCII letters are case-folded, as with Tolower.
 ///
 EASTDC_API int Stricmp(const char*  pString1, const char*  pString2);
 EASTDC_API int Stricmp(const char16_t* pString1, const char16_t* pString2);
@@ -1337,6 +1475,7 @@ EASTDC_API int Stricmp(const char32_t* pString1, const char32_t* pString2);
 /// Strnicmp
 ///
 /// This is similar to the sometimes seen _strnicmp or strncasecmp C function.
+/// Only the ASCII letters are case-folded, as with Tolower.
 ///
 EASTDC_API int Strnicmp(const char*  pString1, const char*  pString2, size_t n);
 EASTDC_API int Strnicmp(const char16_t* pString1, const char16_t* pString2, size_t n);
@@ -1684,6 +1823,13 @@ EASTDC_API float StrtoF32(const char32_t* pString, char32_t** ppStringEnd);
 /// setting is. This is useful for being able to interpret numbers
 /// in a constant way with respect to decimal point usage, etc.
 ///
+/// The result is the double nearest to the decimal value, with ties rounded 
+/// to even, so that any double written with FtoaShortest or with 17 significant 
+/// digits reads back exactly. As with Strtod, *ppStringEnd is set to pString 
+/// if there are no digits, an 'e' that isn't followed by exponent digits isn't
+/// consumed, and errno is set to ERANGE if the value overflows to HUGE_VAL or
+/// underflows to zero.
+///
 EASTDC_API double StrtodEnglish(const char*  pString, char**  ppStringEnd);
 EASTDC_API double StrtodEnglish(const char16_t* pString, char16_t** ppStringEnd);
 EASTDC_API double StrtodEnglish(const char32_t* pString, char32_t** ppStringEnd);
@@ -1710,6 +1856,13 @@ EASTDC_API int32_t StrtoI32(const char32_t* pString, char32_t** ppStringEnd, int
 	EASTDC_API int32_t StrtoI32(const wchar_t* pString, wchar_t** ppStringEnd, int nBase);
 #endif
 
+EASTDC_API int32_t StrtoI32(const char*  pString, size_t nLength, char**  ppStringEnd, int nBase);
+EASTDC_API int32_t StrtoI32(const char16_t* pString, size_t nLength, char16_t** ppStringEnd, int nBase);
+EASTDC_API int32_t StrtoI32(const char32_t* pString, size_t nLength, char32_t** ppStringEnd, int nBase);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API int32_t StrtoI32(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase);
+#endif
+
 
 /// StrtoU32
 ///
@@ -1722,6 +1875,13 @@ EASTDC_API uint32_t StrtoU32(const char32_t* pString, char32_t** ppStringEnd, in
 	EASTDC_API uint32_t StrtoU32(const wchar_t* pString, wchar_t** ppStringEnd, int nBase);
 #endif
 
+EASTDC_API uint32_t StrtoU32(const char*  pString, size_t nLength, char**  ppStringEnd, int nBase);
+EASTDC_API uint32_t StrtoU32(const char16_t* pString, size_t nLength, char16_t** ppStringEnd, int nBase);
+EASTDC_API uint32_t StrtoU32(const char32_t* pString, size_t nLength, char32_t** ppStringEnd, int nBase);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API uint32_t StrtoU32(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase);
+#endif
+
 
 /// StrtoI64
 ///
@@ -1744,6 +1904,18 @@ EASTDC_API uint32_t StrtoU32(const char32_t* pString, char32_t** ppStringEnd, in
 /// StrtoI64 allows a plus (+) or minus (-) sign prefix; a leading minus sign indicates 
 /// that the return value is negated.
 ///
+/// If the value doesn't fit in the return type, the return value is the nearest value 
+/// that does and errno is set to ERANGE. If there are no digits, the return value is 0
+/// and *ppStringEnd is set to pString.
+///
+/// The versions of StrtoI32, StrtoU32, StrtoI64 and StrtoU64 that take an nLength argument 
+/// read at most nLength chars, and pString doesn't need to be 0-terminated. They are
+/// useful for parsing numbers directly within a larger buffer, such as a memory mapped
+/// file. A 0 char within the nLength chars ends the string as well.
+///
+/// Base 10 and base 16 digits in char strings are converted eight at a time, which is 
+/// much faster than converting them one by one for numbers with many digits.
+///
 EASTDC_API int64_t StrtoI64(const char*  pString, char**  ppStringEnd, int nBase);
 EASTDC_API int64_t StrtoI64(const char16_t* pString, char16_t** ppStringEnd, int nBase);
 EASTDC_API int64_t StrtoI64(const char32_t* pString, char32_t** ppStringEnd, int nBase);
@@ -1751,6 +1923,13 @@ EASTDC_API int64_t StrtoI64(const char32_t* pString, char32_t** ppStringEnd, int
 	EASTDC_API int64_t StrtoI64(const wchar_t* pString, wchar_t** ppStringEnd, int nBase);
 #endif
 
+EASTDC_API int64_t StrtoI64(const char*  pString, size_t nLength, char**  ppStringEnd, int nBase);
+EASTDC_API int64_t StrtoI64(const char16_t* pString, size_t nLength, char16_t** ppStringEnd, int nBase);
+EASTDC_API int64_t StrtoI64(const char32_t* pString, size_t nLength, char32_t** ppStringEnd, int nBase);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API int64_t StrtoI64(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase);
+#endif
+
 
 /// StrtoU64
 ///
@@ -1763,10 +1942,18 @@ EASTDC_API uint64_t StrtoU64(const char32_t* pString, char32_t** ppStringEnd, in
 	EASTDC_API uint64_t StrtoU64(const wchar_t* pString, wchar_t** ppStringEnd, int nBase);
 #endif
 
+EASTDC_API uint64_t StrtoU64(const char*  pString, size_t nLength, char**  ppStringEnd, int nBase);
+EASTDC_API uint64_t StrtoU64(const char16_t* pString, size_t nLength, char16_t** ppStringEnd, int nBase);
+EASTDC_API uint64_t StrtoU64(const char32_t* pString, size_t nLength, char32_t** ppStringEnd, int nBase);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API uint64_t StrtoU64(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase);
+#endif
+
 
 /// AtoI32
 ///
 /// This function has the same effect as StrtoI32(pString, NULL, 10);
+/// The version with an nLength argument has the same effect as StrtoI32(pString, nLength, NULL, 10).
 /// It is similar to the C atoll function.
 /// 
 EASTDC_API int32_t AtoI32(const char*  pString);
@@ -1776,10 +1963,18 @@ EASTDC_API int32_t AtoI32(const char32_t* pString);
 	EASTDC_API int32_t AtoI32(const wchar_t* pString);
 #endif
 
+EASTDC_API int32_t AtoI32(const char*  pString, size_t nLength);
+EASTDC_API int32_t AtoI32(const char16_t* pString, size_t nLength);
+EASTDC_API int32_t AtoI32(const char32_t* pString, size_t nLength);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API int32_t AtoI32(const wchar_t* pString, size_t nLength);
+#endif
+
 
 /// AtoU32
 ///
 /// This function has the same effect as StrtoU32(pString, NULL, 10);
+/// The version with an nLength argument has the same effect as StrtoU32(pString, nLength, NULL, 10).
 /// It is similar to the C atoul function.
 /// 
 EASTDC_API uint32_t AtoU32(const char*  pString);
@@ -1789,9 +1984,17 @@ EASTDC_API uint32_t AtoU32(const char32_t* pString);
 	EASTDC_API uint32_t AtoU32(const wchar_t* pString);
 #endif
 
+EASTDC_API uint32_t AtoU32(const char*  pString, size_t nLength);
+EASTDC_API uint32_t AtoU32(const char16_t* pString, size_t nLength);
+EASTDC_API uint32_t AtoU32(const char32_t* pString, size_t nLength);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API uint32_t AtoU32(const wchar_t* pString, size_t nLength);
+#endif
+
 /// AtoI64
 ///
 /// This function has the same effect as StrtoI64(pString, NULL, 10);
+/// The version with an nLength argument has the same effect as StrtoI64(pString, nLength, NULL, 10).
 /// It is similar to the C atoll function.
 /// 
 EASTDC_API int64_t AtoI64(const char*  pString);
@@ -1801,10 +2004,18 @@ EASTDC_API int64_t AtoI64(const char32_t* pString);
 	EASTDC_API int64_t AtoI64(const wchar_t* pString);
 #endif
 
+EASTDC_API int64_t AtoI64(const char*  pString, size_t nLength);
+EASTDC_API int64_t AtoI64(const char16_t* pString, size_t nLength);
+EASTDC_API int64_t AtoI64(const char32_t* pString, size_t nLength);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API int64_t AtoI64(const wchar_t* pString, size_t nLength);
+#endif
+
 
 /// AtoU64
 ///
 /// This function has the same effect as StrtoU64(pString, NULL, 10);
+/// The version with an nLength argument has the same effect as StrtoU64(pString, nLength, NULL, 10).
 /// It is similar to the C atoull function.
 /// 
 EASTDC_API uint64_t AtoU64(const char*  pString);
@@ -1814,6 +2025,13 @@ EASTDC_API uint64_t AtoU64(const char32_t* pString);
 	EASTDC_API uint64_t AtoU64(const wchar_t* pString);
 #endif
 
+EASTDC_API uint64_t AtoU64(const char*  pString, size_t nLength);
+EASTDC_API uint64_t AtoU64(const char16_t* pString, size_t nLength);
+EASTDC_API uint64_t AtoU64(const char32_t* pString, size_t nLength);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API uint64_t AtoU64(const wchar_t* pString, size_t nLength);
+#endif
+
 
 
 /// Atof
@@ -1886,6 +2104,42 @@ EASTDC_API float  AtoF32English(const char32_t* pString);
 #endif
 
 
+/// ParseInt32Array / ParseInt64Array / ParseFloatArray / ParseDoubleArray
+///
+/// Converts a list of numbers separated by delimiters, such as a line of comma-separated 
+/// values or a whitespace-separated column, to an array of values. This replaces a loop of 
+/// StrtoI32 or StrtodEnglish calls, and does the delimiter and error checking that such a loop 
+/// would need. Numbers are read as with StrtoI64 with a base of 10 and as with StrtodEnglish, 
+/// regardless of the C runtime library locale.
+///
+/// pText doesn't need to be 0-terminated; nTextLength may be kSizeTypeUnset if it is.
+/// pDelimiters is a 0-terminated string of the chars which separate the numbers (e.g. ",").
+/// Whitespace before and after each number is ignored. If pDelimiters has any whitespace 
+/// chars, then whitespace alone separates numbers as well. A delimiter at the end of the 
+/// text is ignored.
+///
+/// Returns the number of values written to pValues, which is at most nValueCapacity.
+/// nTextPosition is set to the position in pText where the conversion stopped, which is:
+///     nTextLength, if all of the text was converted.
+///     The start of the next number, if nValueCapacity values were written first. You can 
+///         continue by calling the function again with the text from this position.
+///     The start of the first field which isn't a valid number, otherwise. A field is invalid 
+///         if it's empty, has other chars after the number, or the number is out of the range 
+///         of the type. Values too small for a float or double are not errors and are 
+///         converted to zero or a denormalized value.
+///
+/// Example usage:
+///     double values[16];
+///     size_t nPosition;
+///     size_t nCount = ParseDoubleArray("1.5, 2, 3.25", kSizeTypeUnset, ",", values, 16, nPosition); // nCount = 3, nPosition = 12
+///     nCount = ParseDoubleArray("1.5, x, 3.25", kSizeTypeUnset, ",", values, 16, nPosition);        // nCount = 1, nPosition = 5
+///
+EASTDC_API size_t ParseInt32Array (const char* pText, size_t nTextLength, const char* pDelimiters, int32_t* pValues, size_t nValueCapacity, size_t& nTextPosition);
+EASTDC_API size_t ParseInt64Array (const char* pText, size_t nTextLength, const char* pDelimiters, int64_t* pValues, size_t nValueCapacity, size_t& nTextPosition);
+EASTDC_API size_t ParseFloatArray (const char* pText, size_t nTextLength, const char* pDelimiters, float*   pValues, size_t nValueCapacity, size_t& nTextPosition);
+EASTDC_API size_t ParseDoubleArray(const char* pText, size_t nTextLength, const char* pDelimiters, double*  pValues, size_t nValueCapacity, size_t& nTextPosition);
+
+
 /// Ftoa
 ///
 /// Same as FtoaEnglish.
@@ -1965,6 +2219,44 @@ EASTDC_API char32_t* FtoaEnglish(double dValue, char32_t* pResult, int nResultCa
 #endif
 
 
+/// FtoaShortest
+///
+/// Writes dValue with the fewest significant digits that convert back to exactly 
+/// dValue, using English numeric representation regardless of the C runtime library
+/// language setting. When there are several such strings, the one closest to dValue 
+/// is chosen. This is the representation to use for serializing doubles as text 
+/// (e.g. JSON or CSV), as it is as short as possible and is lossless, unlike fixed 
+/// precision formats, which either lose precision (e.g. %g) or write more digits 
+/// than needed (e.g. %.17g writes 0.1 as 0.10000000000000001). 
+/// It is also much faster than Ftoa or Sprintf with a large precision.
+///
+/// The notation is that of the JavaScript number to string conversion: decimal notation
+/// for magnitudes in [1e-6, 1e21) and exponential notation otherwise. Negative zero is 
+/// written as "-0", infinity as "inf" or "-inf" and NaN as "nan" or "-nan".
+///
+/// The nResultCapacity argument is number of characters in the destination, 
+/// including the char that will hold the terminating 0 char. A capacity of 26 
+/// is enough for all values.
+///
+/// Returns pResult, or NULL if nResultCapacity is insufficient, in which case
+/// pResult is left unmodified.
+///
+/// Examples:
+///     FtoaShortest(0.1, pResult, 32)        returns pResult and "0.1"
+///     FtoaShortest(-1234.5, pResult, 32)    returns pResult and "-1234.5"
+///     FtoaShortest(1e21, pResult, 32)       returns pResult and "1e+21"
+///     FtoaShortest(1.5e-7, pResult, 32)     returns pResult and "1.5e-7"
+///     FtoaShortest(1.0 / 3, pResult, 32)    returns pResult and "0.3333333333333333"
+///     FtoaShortest(1e21, pResult, 5)        returns NULL
+///
+EASTDC_API char*     FtoaShortest(double dValue, char*  pResult, int nResultCapacity);
+EASTDC_API char16_t* FtoaShortest(double dValue, char16_t* pResult, int nResultCapacity);
+EASTDC_API char32_t* FtoaShortest(double dValue, char32_t* pResult, int nResultCapacity);
+#if EA_WCHAR_UNIQUE
+	EASTDC_API wchar_t* FtoaShortest(double dValue, wchar_t* pResult, int nResultCapacity);
+#endif
+
+
 /// ReduceFloatString
 ///
 /// This function removes unnecessary floating point digits from a string.
@@ -2035,6 +2327,21 @@ namespace StdC
 		return StrtoI32(pString, NULL, 10);
 	}
 
+	inline EASTDC_API int32_t AtoI32(const char* pString, size_t nLength)
+	{
+		return StrtoI32(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API int32_t AtoI32(const char16_t* pString, size_t nLength)
+	{
+		return StrtoI32(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API int32_t AtoI32(const char32_t* pString, size_t nLength)
+	{
+		return StrtoI32(pString, nLength, NULL, 10);
+	}
+
 
 
 	inline EASTDC_API uint32_t AtoU32(const char* pString)
@@ -2052,6 +2359,21 @@ namespace StdC
 		return StrtoU32(pString, NULL, 10);
 	}
 
+	inline EASTDC_API uint32_t AtoU32(const char* pString, size_t nLength)
+	{
+		return StrtoU32(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API uint32_t AtoU32(const char16_t* pString, size_t nLength)
+	{
+		return StrtoU32(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API uint32_t AtoU32(const char32_t* pString, size_t nLength)
+	{
+		return StrtoU32(pString, nLength, NULL, 10);
+	}
+
 
 
 	inline EASTDC_API int64_t AtoI64(const char* pString)
@@ -2069,6 +2391,21 @@ namespace StdC
 		return StrtoI64(pString, NULL, 10);
 	}
 
+	inline EASTDC_API int64_t AtoI64(const char* pString, size_t nLength)
+	{
+		return StrtoI64(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API int64_t AtoI64(const char16_t* pString, size_t nLength)
+	{
+		return StrtoI64(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API int64_t AtoI64(const char32_t* pString, size_t nLength)
+	{
+		return StrtoI64(pString, nLength, NULL, 10);
+	}
+
 
 
 	inline EASTDC_API uint64_t AtoU64(const char*  pString)
@@ -2086,6 +2423,21 @@ namespace StdC
 		return StrtoU64(pString, NULL, 10);
 	}
 
+	inline EASTDC_API uint64_t AtoU64(const char* pString, size_t nLength)
+	{
+		return StrtoU64(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API uint64_t AtoU64(const char16_t* pString, size_t nLength)
+	{
+		return StrtoU64(pString, nLength, NULL, 10);
+	}
+
+	inline EASTDC_API uint64_t AtoU64(const char32_t* pString, size_t nLength)
+	{
+		return StrtoU64(pString, nLength, NULL, 10);
+	}
+
 
 
 	inline EASTDC_API double Strtod(const char* pString, char** ppStringEnd)
@@ -2545,16 +2897,36 @@ namespace StdC
 		return reinterpret_cast<wchar_t *>(Strnchr(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CHAR_CAST(c), n));
 	}
 
+	inline CharSet::CharSet(const wchar_t* pChars)
+	{
+		Init(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pChars));
+	}
+
+	inline void CharSet::Init(const wchar_t* pChars)
+	{
+		Init(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pChars));
+	}
+
 	inline size_t  Strcspn(const wchar_t* pString1, const wchar_t* pString2)
 	{
 		return Strcspn(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString1), EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString2));
 	}
 
+	inline size_t  Strcspn(const wchar_t* pString, const CharSet& charSet)
+	{
+		return Strcspn(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), charSet);
+	}
+
 	inline wchar_t* Strpbrk(const wchar_t* pString1, const wchar_t* pString2)
 	{
 		return reinterpret_cast<wchar_t *>(Strpbrk(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString1), EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString2)));
 	}
 
+	inline wchar_t* Strpbrk(const wchar_t* pString, const CharSet& charSet)
+	{
+		return reinterpret_cast<wchar_t *>(Strpbrk(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), charSet));
+	}
+
 	inline wchar_t* Strrchr(const wchar_t* pString, wchar_t c)
 	{
 		return reinterpret_cast<wchar_t *>(Strrchr(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CHAR_CAST(c)));
@@ -2565,6 +2937,11 @@ namespace StdC
 		return Strspn(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pSubString));
 	}
 
+	inline size_t Strspn(const wchar_t* pString, const CharSet& charSet)
+	{
+		return Strspn(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), charSet);
+	}
+
 	inline wchar_t* Strstr(const wchar_t* pString, const wchar_t* pSubString)
 	{
 		return reinterpret_cast<wchar_t *>(Strstr(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pSubString)));
@@ -2615,6 +2992,16 @@ namespace StdC
 		return reinterpret_cast<const wchar_t *>(Strtok2(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pDelimiters), pResultLength, bFirst));
 	}
 
+	inline wchar_t* Strtok(wchar_t* pString, const CharSet& delimiters, wchar_t** pContext)
+	{
+		return reinterpret_cast<wchar_t *>(Strtok(EASTDC_UNICODE_CHAR_PTR_CAST(pString), delimiters, EASTDC_UNICODE_CHAR_PTR_PTR_CAST(pContext)));
+	}
+
+	inline const wchar_t* Strtok2(const wchar_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst)
+	{
+		return reinterpret_cast<const wchar_t *>(Strtok2(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), delimiters, pResultLength, bFirst));
+	}
+
 	inline wchar_t* Strset(wchar_t* pString, wchar_t c)
 	{
 		return reinterpret_cast<wchar_t *>(Strset(EASTDC_UNICODE_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CHAR_CAST(c)));
@@ -2736,48 +3123,96 @@ namespace StdC
 	}
 
 
+	inline int32_t StrtoI32(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase)
+	{
+		return StrtoI32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength, EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
+	}
+
+
 	inline uint32_t StrtoU32(const wchar_t* pString, wchar_t** ppStringEnd, int nBase)
 	{
 		return StrtoU32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
 	}
 
 
+	inline uint32_t StrtoU32(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase)
+	{
+		return StrtoU32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength, EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
+	}
+
+
 	inline int64_t StrtoI64(const wchar_t* pString, wchar_t** ppStringEnd, int nBase)
 	{
 		return StrtoI64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
 	}
 
 
+	inline int64_t StrtoI64(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase)
+	{
+		return StrtoI64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength, EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
+	}
+
+
 	inline uint64_t StrtoU64(const wchar_t* pString, wchar_t** ppStringEnd, int nBase)
 	{
 		return StrtoU64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
 	}
 
 
+	inline uint64_t StrtoU64(const wchar_t* pString, size_t nLength, wchar_t** ppStringEnd, int nBase)
+	{
+		return StrtoU64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength, EASTDC_UNICODE_CHAR_PTR_PTR_CAST(ppStringEnd), nBase);
+	}
+
+
 	inline int32_t AtoI32(const wchar_t* pString)
 	{
 		return AtoI32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString));
 	}
 
 
+	inline int32_t AtoI32(const wchar_t* pString, size_t nLength)
+	{
+		return AtoI32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength);
+	}
+
+
 	inline uint32_t AtoU32(const wchar_t* pString)
 	{
 		return AtoU32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString));
 	}
 
 
+	inline uint32_t AtoU32(const wchar_t* pString, size_t nLength)
+	{
+		return AtoU32(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength);
+	}
+
+
 	inline int64_t AtoI64(const wchar_t* pString)
 	{
 		return AtoI64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString));
 	}
 
 
+	inline int64_t AtoI64(const wchar_t* pString, size_t nLength)
+	{
+		return AtoI64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength);
+	}
+
+
 	inline uint64_t AtoU64(const wchar_t* pString)
 	{
 		return AtoU64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString));
 	}
 
 
+	inline uint64_t AtoU64(const wchar_t* pString, size_t nLength)
+	{
+		return AtoU64(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString), nLength);
+	}
+
+
 	inline double Atof(const wchar_t* pString)
 	{
 		return Atof(EASTDC_UNICODE_CONST_CHAR_PTR_CAST(pString));
@@ -2814,6 +3249,12 @@ namespace StdC
 	}
 
 
+	inline wchar_t* FtoaShortest(double dValue, wchar_t* pResult, int nResultCapacity)
+	{
+		return reinterpret_cast<wchar_t *>(FtoaShortest(dValue, EASTDC_UNICODE_CHAR_PTR_CAST(pResult), nResultCapacity));
+	}
+
+
 	inline size_t ReduceFloatString(wchar_t* pString, size_t nLength)
 	{
 		return ReduceFloatString(EASTDC_UNICODE_CHAR_PTR_CAST(pString), nLength);
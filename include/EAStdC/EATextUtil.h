@@ -29,9 +29,11 @@ namespace StdC
 	/// UTF8 utilities
 	/// 
 	EASTDC_API bool      UTF8Validate(const char* p, size_t nLength);
+	EASTDC_API bool      UTF8ValidateEx(const char* p, size_t nLength, size_t& nInvalidOffset, size_t& nCodePointCount); // Also returns the offset of the first invalid char (or nLength) and the number of valid chars before it.
 	EASTDC_API char*     UTF8Increment(const char* p, size_t n);
 	EASTDC_API char*     UTF8Decrement(const char* p, size_t n);
 	EASTDC_API size_t    UTF8Length(const char* p);
+	EASTDC_API size_t    UTF8Length(const char* p, size_t nLength); // Counts the chars in the first nLength bytes, which needn't be 0-terminated. nLength may be kLengthNull.
 	EASTDC_API size_t    UTF8Length(const char16_t* p);
 	EASTDC_API size_t    UTF8Length(const char32_t* p);
 	EASTDC_API size_t    UTF8CharSize(const char* p);
@@ -0,0 +1,270 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Internal runtime CPU dispatch support. Each dispatched function has a
+// slot in CPUDispatchTable, and there is one immutable table per
+// CPUFeatureLevel. The active table is published through a single pointer,
+// so switching levels is a single store and a table is always seen in a
+// consistent state. See EACPUDispatch.h for the public interface.
+//
+// Kernels above the baseline instruction set are compiled with the
+// EASTDC_TARGET_XXX attributes, which allow the use of the corresponding
+// intrinsics in a translation unit that is compiled for the baseline.
+// They must only ever be called through the dispatch table.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTDC_INTERNAL_CPUDISPATCH_H
+#define EASTDC_INTERNAL_CPUDISPATCH_H
+
+
+#include <EABase/eabase.h>
+#include <EAStdC/internal/Config.h>
+#include <EAStdC/EACPUDispatch.h>
+
+#if !defined(__GNUC__) && !defined(__clang__) && !(defined(_MSC_VER) && (defined(EA_PROCESSOR_X86) || defined(EA_PROCESSOR_X86_64)))
+	#include <eathread/eathread_sync.h> // EAReadBarrier, EAWriteBarrier
+#endif
+
+#if EASTDC_CPU_DISPATCH_ENABLED
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+	#include <immintrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTDC_TARGET_SSE2 / EASTDC_TARGET_SSE42 / EASTDC_TARGET_AVX2
+//
+// VC++ allows the use of any intrinsic regardless of the /arch setting,
+// whereas GCC and Clang require the function to be declared as targeting
+// the instruction set.
+//
+#if EASTDC_CPU_DISPATCH_ENABLED && (defined(__GNUC__) || defined(__clang__))
+	#define EASTDC_TARGET_SSE2  __attribute__((target("sse2")))
+	#define EASTDC_TARGET_SSE42 __attribute__((target("sse4.2,popcnt,pclmul")))
+	#define EASTDC_TARGET_AVX2  __attribute__((target("avx2,bmi,bmi2,popcnt")))
+#else
+	#define EASTDC_TARGET_SSE2
+	#define EASTDC_TARGET_SSE42
+	#define EASTDC_TARGET_AVX2
+#endif
+
+
+namespace EA
+{
+	namespace StdC
+	{
+		namespace Internal
+		{
+			struct CPUDispatchTable
+			{
+				CPUFeatureLevel mLevel;
+
+				// EAMemory
+				size_t          (*mpMemcmpFindDifference)(const void* p1, const void* p2, size_t byteCount); // Returns the offset of the first difference, or byteCount.
+				const uint8_t*  (*mpMemcheck)(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32); // pPattern32 is 32 byte aligned and holds the byte expected at (address % 32).
+				const char*     (*mpMemchr)(const char* p, char c, size_t nCharCount);
+				size_t          (*mpMemmemFindCandidate)(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos); // Returns the next position >= j where the first and last bytes match, or positionCount.
+				void            (*mpMemfillPattern)(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount);
+				const char16_t* (*mpMemchr16)(const char16_t* p, char16_t c, size_t nCharCount);
+				const char32_t* (*mpMemchr32)(const char32_t* p, char32_t c, size_t nCharCount);
+				const char*     (*mpMemrchr)(const char* p, char c, size_t nCharCount);
+				const char16_t* (*mpMemrchr16)(const char16_t* p, char16_t c, size_t nCharCount);
+				const char32_t* (*mpMemrchr32)(const char32_t* p, char32_t c, size_t nCharCount);
+				const char*     (*mpMemchrAny)(const char* p, size_t nCharCount, const char* pSet, size_t setCount);
+				size_t          (*mpMemFindEqual)(const void* p1, const void* p2, size_t byteCount); // Returns the offset of the first equal byte, or byteCount.
+				bool            (*mpTimingSafeMemEqual)(const void* p1, const void* p2, size_t byteCount);
+				int             (*mpTimingSafeMemcmp)(const void* p1, const void* p2, size_t byteCount);     // Returns -1, 0 or 1.
+				bool            (*mpTimingSafeMemIsClear)(const void* p, size_t byteCount);
+
+				// EAString
+				size_t          (*mpStrlen16)(const char16_t* pString);
+				size_t          (*mpStrlen32)(const char32_t* pString);
+				size_t          (*mpUTF8ToUTF16)(char16_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed); // Returns the number of source chars converted. NULL at the scalar level. See StrlcpyFastForward.
+				size_t          (*mpUTF8ToUTF32)(char32_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          (*mpUTF16ToUTF8)(char* pDest, size_t nDestCapacity, const char16_t* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          (*mpUTF32ToUTF8)(char* pDest, size_t nDestCapacity, const char32_t* pSource, size_t nSourceLength, size_t& nDestUsed);
+				int             (*mpStrnicmp)(const char* pString1, const char* pString2, size_t n);
+				int             (*mpStrnicmp16)(const char16_t* pString1, const char16_t* pString2, size_t n);
+				int             (*mpStrnicmp32)(const char32_t* pString1, const char32_t* pString2, size_t n);
+				const char*     (*mpStrstrFindCandidate)(const char* p, const char* pSubString, size_t lastPos, bool bFold); // Returns the first position >= p where the first and last chars match, or NULL at the end of the string. See Strstr.
+				const char16_t* (*mpStrstrFindCandidate16)(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold);
+				const char32_t* (*mpStrstrFindCandidate32)(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold);
+				size_t          (*mpStrrstrFindCandidate)(const char* pString, size_t j, const char* pSubString, size_t lastPos, bool bFold); // Returns the last position < j where the first and last chars match, or (size_t)-1.
+				size_t          (*mpStrrstrFindCandidate16)(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold);
+				size_t          (*mpStrrstrFindCandidate32)(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold);
+				const char*     (*mpCharSetFind)(const char* p, const uint8_t* pByteTable, bool bInSet); // Returns the first char at p which is (if bInSet) or isn't in the set, or the terminating 0. See CharSet.
+
+				// EATextUtil
+				size_t          (*mpUTF8Validate)(const char* p, size_t nLength, size_t& nCodePointCount); // Returns the length of the valid prefix it checked, which ends on a char boundary.
+				size_t          (*mpUTF8CountChars)(const char* p, size_t nLength);
+				const char*     (*mpUTF8Increment)(const char* p, size_t& n); // Reduces n by the number of chars it advanced p over.
+
+				// EAHashCRC
+				uint32_t        (*mpCRC32Reverse)(const void* pData, size_t nLength, uint32_t nInitialValue); // Doesn't finalize.
+			};
+
+			// Points to the table for the active level, or NULL if it hasn't been resolved yet.
+			// It may be set by one thread while others are calling dispatched functions, so it
+			// must only be accessed with LoadCPUDispatchTable and StoreCPUDispatchTable.
+			extern EASTDC_API const CPUDispatchTable* gpCPUDispatchTable;
+
+			// Atomic load-acquire and store-release of a table pointer. The table contents are
+			// written before the pointer is published, so acquire/release ordering is enough for
+			// a thread which sees the pointer to also see the table.
+			inline const CPUDispatchTable* LoadCPUDispatchTable(const CPUDispatchTable* const* ppTable)
+			{
+				#if defined(__GNUC__) || defined(__clang__)
+					return __atomic_load_n(ppTable, __ATOMIC_ACQUIRE);
+				#elif defined(_MSC_VER) && (defined(EA_PROCESSOR_X86) || defined(EA_PROCESSOR_X86_64))
+					return *static_cast<const CPUDispatchTable* const volatile*>(ppTable); // VC++ gives volatile reads acquire semantics on x86 and x64.
+				#else
+					const CPUDispatchTable* pTable = *static_cast<const CPUDispatchTable* const volatile*>(ppTable);
+					EAReadBarrier();
+					return pTable;
+				#endif
+			}
+
+			inline void StoreCPUDispatchTable(const CPUDispatchTable** ppTable, const CPUDispatchTable* pTable)
+			{
+				#if defined(__GNUC__) || defined(__clang__)
+					__atomic_store_n(ppTable, pTable, __ATOMIC_RELEASE);
+				#elif defined(_MSC_VER) && (defined(EA_PROCESSOR_X86) || defined(EA_PROCESSOR_X86_64))
+					*static_cast<const CPUDispatchTable* volatile*>(ppTable) = pTable; // VC++ gives volatile writes release semantics on x86 and x64.
+				#else
+					EAWriteBarrier();
+					*static_cast<const CPUDispatchTable* volatile*>(ppTable) = pTable;
+				#endif
+			}
+
+			EASTDC_API const CPUDispatchTable* ResolveCPUDispatchTable();
+
+			inline const CPUDispatchTable& GetCPUDispatchTable()
+			{
+				const CPUDispatchTable* pTable = LoadCPUDispatchTable(&gpCPUDispatchTable);
+
+				if(EA_UNLIKELY(pTable == NULL))
+					pTable = ResolveCPUDispatchTable();
+
+				return *pTable;
+			}
+
+
+			// Kernels, defined alongside the public functions that use them.
+			size_t          MemcmpFindDifferenceScalar(const void* p1, const void* p2, size_t byteCount);
+			const uint8_t*  MemcheckScalar(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32);
+			const char*     MemchrScalar(const char* p, char c, size_t nCharCount);
+			const char16_t* Memchr16Scalar(const char16_t* p, char16_t c, size_t nCharCount);
+			const char32_t* Memchr32Scalar(const char32_t* p, char32_t c, size_t nCharCount);
+			const char*     MemrchrScalar(const char* p, char c, size_t nCharCount);
+			const char16_t* Memrchr16Scalar(const char16_t* p, char16_t c, size_t nCharCount);
+			const char32_t* Memrchr32Scalar(const char32_t* p, char32_t c, size_t nCharCount);
+			const char*     MemchrAnyScalar(const char* p, size_t nCharCount, const char* pSet, size_t setCount);
+			size_t          MemFindEqualScalar(const void* p1, const void* p2, size_t byteCount);
+			bool            TimingSafeMemEqualScalar(const void* p1, const void* p2, size_t byteCount);
+			int             TimingSafeMemcmpScalar(const void* p1, const void* p2, size_t byteCount);
+			bool            TimingSafeMemIsClearScalar(const void* p, size_t byteCount);
+			size_t          MemmemFindCandidateScalar(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos);
+			void            MemfillPatternScalar(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount);
+			size_t          Strlen16Scalar(const char16_t* pString);
+			size_t          Strlen32Scalar(const char32_t* pString);
+			int             StrnicmpScalar(const char* pString1, const char* pString2, size_t n);
+			int             Strnicmp16Scalar(const char16_t* pString1, const char16_t* pString2, size_t n);
+			int             Strnicmp32Scalar(const char32_t* pString1, const char32_t* pString2, size_t n);
+			const char*     StrstrFindCandidateScalar(const char* p, const char* pSubString, size_t lastPos, bool bFold);
+			const char16_t* StrstrFindCandidate16Scalar(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold);
+			const char32_t* StrstrFindCandidate32Scalar(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold);
+			size_t          StrrstrFindCandidateScalar(const char* pString, size_t j, const char* pSubString, size_t lastPos, bool bFold);
+			size_t          StrrstrFindCandidate16Scalar(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold);
+			size_t          StrrstrFindCandidate32Scalar(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold);
+			const char*     CharSetFindScalar(const char* p, const uint8_t* pByteTable, bool bInSet);
+			size_t          UTF8ValidateScalar(const char* p, size_t nLength, size_t& nCodePointCount);
+			size_t          UTF8CountCharsScalar(const char* p, size_t nLength);
+			const char*     UTF8IncrementScalar(const char* p, size_t& n);
+			uint32_t        CRC32ReverseScalar(const void* pData, size_t nLength, uint32_t nInitialValue);
+
+			#if EASTDC_CPU_DISPATCH_ENABLED
+				size_t          MemcmpFindDifferenceSSE2(const void* p1, const void* p2, size_t byteCount);
+				const uint8_t*  MemcheckSSE2(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32);
+				const char*     MemchrSSE2(const char* p, char c, size_t nCharCount);
+				const char16_t* Memchr16SSE2(const char16_t* p, char16_t c, size_t nCharCount);
+				const char32_t* Memchr32SSE2(const char32_t* p, char32_t c, size_t nCharCount);
+				const char*     MemrchrSSE2(const char* p, char c, size_t nCharCount);
+				const char16_t* Memrchr16SSE2(const char16_t* p, char16_t c, size_t nCharCount);
+				const char32_t* Memrchr32SSE2(const char32_t* p, char32_t c, size_t nCharCount);
+				const char*     MemchrAnySSE2(const char* p, size_t nCharCount, const char* pSet, size_t setCount);
+				size_t          MemFindEqualSSE2(const void* p1, const void* p2, size_t byteCount);
+				bool            TimingSafeMemEqualSSE2(const void* p1, const void* p2, size_t byteCount);
+				int             TimingSafeMemcmpSSE2(const void* p1, const void* p2, size_t byteCount);
+				bool            TimingSafeMemIsClearSSE2(const void* p, size_t byteCount);
+				const char*     MemchrAnySSE42(const char* p, size_t nCharCount, const char* pSet, size_t setCount);
+				size_t          MemmemFindCandidateSSE2(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos);
+				void            MemfillPatternSSE2(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount);
+				size_t          Strlen16SSE2(const char16_t* pString);
+				size_t          Strlen32SSE2(const char32_t* pString);
+				size_t          UTF8ToUTF16SSE2(char16_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          UTF8ToUTF32SSE2(char32_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          UTF16ToUTF8SSE2(char* pDest, size_t nDestCapacity, const char16_t* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          UTF32ToUTF8SSE2(char* pDest, size_t nDestCapacity, const char32_t* pSource, size_t nSourceLength, size_t& nDestUsed);
+				int             StrnicmpSSE2(const char* pString1, const char* pString2, size_t n);
+				int             Strnicmp16SSE2(const char16_t* pString1, const char16_t* pString2, size_t n);
+				int             Strnicmp32SSE2(const char32_t* pString1, const char32_t* pString2, size_t n);
+				const char*     StrstrFindCandidateSSE2(const char* p, const char* pSubString, size_t lastPos, bool bFold);
+				const char16_t* StrstrFindCandidate16SSE2(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold);
+				const char32_t* StrstrFindCandidate32SSE2(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold);
+				size_t          StrrstrFindCandidateSSE2(const char* pString, size_t j, const char* pSubString, size_t lastPos, bool bFold);
+				size_t          StrrstrFindCandidate16SSE2(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold);
+				size_t          StrrstrFindCandidate32SSE2(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold);
+				const char*     CharSetFindSSE42(const char* p, const uint8_t* pByteTable, bool bInSet);
+				size_t          UTF8ValidateSSE2(const char* p, size_t nLength, size_t& nCodePointCount);
+				size_t          UTF8CountCharsSSE2(const char* p, size_t nLength);
+				const char*     UTF8IncrementSSE2(const char* p, size_t& n);
+				uint32_t        CRC32ReverseSSE42(const void* pData, size_t nLength, uint32_t nInitialValue);
+
+				size_t          MemcmpFindDifferenceAVX2(const void* p1, const void* p2, size_t byteCount);
+				const uint8_t*  MemcheckAVX2(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32);
+				const char*     MemchrAVX2(const char* p, char c, size_t nCharCount);
+				const char16_t* Memchr16AVX2(const char16_t* p, char16_t c, size_t nCharCount);
+				const char32_t* Memchr32AVX2(const char32_t* p, char32_t c, size_t nCharCount);
+				const char*     MemrchrAVX2(const char* p, char c, size_t nCharCount);
+				const char16_t* Memrchr16AVX2(const char16_t* p, char16_t c, size_t nCharCount);
+				const char32_t* Memrchr32AVX2(const char32_t* p, char32_t c, size_t nCharCount);
+				const char*     MemchrAnyAVX2(const char* p, size_t nCharCount, const char* pSet, size_t setCount);
+				size_t          MemFindEqualAVX2(const void* p1, const void* p2, size_t byteCount);
+				bool            TimingSafeMemEqualAVX2(const void* p1, const void* p2, size_t byteCount);
+				int             TimingSafeMemcmpAVX2(const void* p1, const void* p2, size_t byteCount);
+				bool            TimingSafeMemIsClearAVX2(const void* p, size_t byteCount);
+				size_t          MemmemFindCandidateAVX2(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos);
+				void            MemfillPatternAVX2(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount);
+				size_t          Strlen16AVX2(const char16_t* pString);
+				size_t          Strlen32AVX2(const char32_t* pString);
+				size_t          UTF8ToUTF16AVX2(char16_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          UTF8ToUTF32AVX2(char32_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          UTF16ToUTF8AVX2(char* pDest, size_t nDestCapacity, const char16_t* pSource, size_t nSourceLength, size_t& nDestUsed);
+				size_t          UTF32ToUTF8AVX2(char* pDest, size_t nDestCapacity, const char32_t* pSource, size_t nSourceLength, size_t& nDestUsed);
+				int             StrnicmpAVX2(const char* pString1, const char* pString2, size_t n);
+				int             Strnicmp16AVX2(const char16_t* pString1, const char16_t* pString2, size_t n);
+				int             Strnicmp32AVX2(const char32_t* pString1, const char32_t* pString2, size_t n);
+				const char*     StrstrFindCandidateAVX2(const char* p, const char* pSubString, size_t lastPos, bool bFold);
+				const char16_t* StrstrFindCandidate16AVX2(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold);
+				const char32_t* StrstrFindCandidate32AVX2(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold);
+				size_t          StrrstrFindCandidateAVX2(const char* pString, size_t j, const char* pSubString, size_t lastPos, bool bFold);
+				size_t          StrrstrFindCandidate16AVX2(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold);
+				size_t          StrrstrFindCandidate32AVX2(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold);
+				const char*     CharSetFindAVX2(const char* p, const uint8_t* pByteTable, bool bInSet);
+				size_t          UTF8ValidateAVX2(const char* p, size_t nLength, size_t& nCodePointCount);
+				size_t          UTF8CountCharsAVX2(const char* p, size_t nLength);
+				const char*     UTF8IncrementAVX2(const char* p, size_t& n);
+			#endif
+		}
+	}
+}
+
+
+#endif // Header include guard
@@ -184,6 +184,66 @@
 #endif
 
 
+///////////////////////////////////////////////////////////////////////////////
+// EASTDC_MEMORY_STREAMING_THRESHOLD
+//
+// Defined as a byte count. Default is 4 MiB.
+// Memcpy128 and Memset8_128 switch to non-temporal (cache-bypassing) stores
+// for blocks of at least this many bytes. The value should be somewhere near
+// the size of the target's last-level cache, as writing blocks larger than
+// that through the cache evicts the working set of other threads while
+// providing no benefit to the writer. MemcpyS always uses non-temporal stores
+// for anything but tiny copies, as that is its documented purpose.
+//
+#if !defined(EASTDC_MEMORY_STREAMING_THRESHOLD)
+	#define EASTDC_MEMORY_STREAMING_THRESHOLD 4194304
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTDC_MEMORY_PARALLEL_THRESHOLD
+//
+// Defined as a byte count. Default is 16 MiB.
+// MemcpyParallel and MemsetParallel split blocks of at least this many bytes 
+// across multiple threads. Smaller blocks are processed by the calling thread
+// alone, as the cost of waking other threads would outweigh the benefit.
+//
+#if !defined(EASTDC_MEMORY_PARALLEL_THRESHOLD)
+	#define EASTDC_MEMORY_PARALLEL_THRESHOLD 16777216
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTDC_MEMORY_PARALLEL_THREAD_MAX
+//
+// Defined as a thread count. Default is 8.
+// The maximum number of threads, including the calling thread, that 
+// MemcpyParallel and MemsetParallel use by default. A few threads are usually
+// enough to saturate memory bandwidth, so using every core isn't worthwhile.
+//
+#if !defined(EASTDC_MEMORY_PARALLEL_THREAD_MAX)
+	#define EASTDC_MEMORY_PARALLEL_THREAD_MAX 8
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTDC_CPU_DISPATCH_ENABLED
+//
+// Defined as 0 or 1. Default is 1 for x86 and x64 with VC++, GCC and Clang.
+// If enabled then some EAMemory, EAString and EAHashCRC functions select
+// SSE2, SSE4.2 or AVX2 implementations at runtime based on cpuid, regardless
+// of the instruction set the library itself was compiled for. If disabled
+// then portable C implementations are used. See EACPUDispatch.h.
+//
+#if !defined(EASTDC_CPU_DISPATCH_ENABLED)
+	#if (defined(EA_PROCESSOR_X86) || defined(EA_PROCESSOR_X86_64)) && (defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__))
+		#define EASTDC_CPU_DISPATCH_ENABLED 1
+	#else
+		#define EASTDC_CPU_DISPATCH_ENABLED 0
+	#endif
+#endif
+
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // EASTDC_VSNPRINTF8_ENABLED
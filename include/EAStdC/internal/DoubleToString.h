@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Internal shortest round-trip double to string conversion, shared by the
+// FtoaShortest functions in EAString and the %r format of Sprintf.
+//
+// The conversion to decimal is the Ryu algorithm (Ulf Adams, "Ryu: Fast
+// Float-to-String Conversion", PLDI 2018), which finds the shortest decimal
+// that lies within the rounding interval of the double with a few 64 x 128 bit
+// multiplications by tabled powers of five, instead of the arbitrary precision
+// arithmetic or digit by digit trial printing that the other approaches need.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTDC_INTERNAL_DOUBLETOSTRING_H
+#define EASTDC_INTERNAL_DOUBLETOSTRING_H
+
+
+#include <EABase/eabase.h>
+#include <EAStdC/internal/Config.h>
+#include <EAStdC/internal/IntToString.h>
+
+#if defined(_MSC_VER) && defined(EA_PROCESSOR_X86_64)
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <intrin.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+namespace EA
+{
+	namespace StdC
+	{
+		namespace Internal
+		{
+			// The longest string WriteShortestDouble writes, which is for a negative
+			// value in the form "-0.00000" followed by 17 significant digits.
+			const int kShortestDoubleLengthMax = 25;
+
+
+			// Returns the high 64 bits of the 128 bit product of a and b, and sets nLow to the low 64 bits.
+			EA_FORCE_INLINE uint64_t Multiply64To128(uint64_t a, uint64_t b, uint64_t& nLow)
+			{
+				#if defined(__SIZEOF_INT128__)
+					const unsigned __int128 nProduct = (unsigned __int128)a * b;
+					nLow = (uint64_t)nProduct;
+					return (uint64_t)(nProduct >> 64);
+				#elif defined(_MSC_VER) && defined(EA_PROCESSOR_X86_64)
+					uint64_t nHigh;
+					nLow = _umul128(a, b, &nHigh);
+					return nHigh;
+				#else
+					const uint64_t aLow  = (uint32_t)a, aHigh = a >> 32;
+					const uint64_t bLow  = (uint32_t)b, bHigh = b >> 32;
+					const uint64_t nLL   = aLow  * bLow;
+					const uint64_t nLH   = aLow  * bHigh;
+					const uint64_t nHL   = aHigh * bLow;
+					const uint64_t nHH   = aHigh * bHigh;
+					const uint64_t nMid  = (nLL >> 32) + (uint32_t)nLH + (uint32_t)nHL;
+
+					nLow = (nMid << 32) | (uint32_t)nLL;
+					return nHH + (nLH >> 32) + (nHL >> 32) + (nMid >> 32);
+				#endif
+			}
+
+
+			// Converts dValue, which must be finite and positive, to the decimal nMantissa * 10^nExponent
+			// with the fewest significant digits that reads back as dValue. When there are several such
+			// decimals, the one closest to dValue is chosen. The returned mantissa has no trailing zeroes.
+			// Returns 0 (with nExponent 0) for a value of zero. Defined in EAString.cpp.
+			EASTDC_API uint64_t DoubleToShortestDecimal(double dValue, int& nExponent);
+
+
+			// Writes the digits of dValue, which must be finite, in the shortest form that reads back
+			// as dValue, and returns the position after the last char written. The sign isn't written.
+			// The notation is that of JavaScript's Number to string conversion: plain decimal notation
+			// for values in [1e-6, 1e21) and exponential notation (e.g. "1.5e-7" and "1e+21") otherwise.
+			// There must be room for kShortestDoubleLengthMax chars. Doesn't write a terminating 0.
+			template <typename CharT>
+			CharT* WriteShortestDouble(double dValue, CharT* pBuffer, CharT cDecimalPoint, CharT cExponent)
+			{
+				if(dValue < 0)
+					dValue = -dValue;
+
+				int            nExponent;
+				const uint64_t nMantissa    = DoubleToShortestDecimal(dValue, nExponent);
+				const int      nDigitCount  = (int)CountDecimalDigits(nMantissa);
+				const int      nPointPos    = nDigitCount + nExponent; // The value is 0.ddd * 10^nPointPos.
+
+				if((nPointPos > 0) && (nPointPos <= 21))
+				{
+					if(nDigitCount <= nPointPos) // If the value is an integer...
+					{
+						CharT* const pEnd = WriteDecimalBackward(nMantissa, pBuffer + nDigitCount) + nPointPos;
+
+						for(CharT* p = pBuffer + nDigitCount; p < pEnd; ++p)
+							*p = '0';
+						return pEnd;
+					}
+
+					// Write the digits one position to the right, then move the integral digits back left over the decimal point position.
+					WriteDecimalBackward(nMantissa, pBuffer + 1 + nDigitCount);
+					for(int i = 0; i < nPointPos; i++)
+						pBuffer[i] = pBuffer[i + 1];
+					pBuffer[nPointPos] = cDecimalPoint;
+					return pBuffer + 1 + nDigitCount;
+				}
+
+				if((nPointPos <= 0) && (nPointPos > -6))
+				{
+					*pBuffer++ = '0';
+					*pBuffer++ = cDecimalPoint;
+					for(int i = nPointPos; i < 0; i++)
+						*pBuffer++ = '0';
+					return WriteDecimalBackward(nMantissa, pBuffer + nDigitCount) + nDigitCount;
+				}
+
+				// Exponential notation: d[.ddd]e(+|-)x
+				WriteDecimalBackward(nMantissa, pBuffer + 1 + nDigitCount);
+				pBuffer[0] = pBuffer[1];
+
+				if(nDigitCount > 1)
+				{
+					pBuffer[1] = cDecimalPoint;
+					pBuffer += 1 + nDigitCount;
+				}
+				else
+					pBuffer += 1;
+
+				const int nDecimalExponent = nPointPos - 1;
+
+				*pBuffer++ = cExponent;
+				*pBuffer++ = (nDecimalExponent < 0) ? (CharT)'-' : (CharT)'+';
+
+				const uint32_t nExponentAbs = (uint32_t)((nDecimalExponent < 0) ? -nDecimalExponent : nDecimalExponent);
+				pBuffer += CountDecimalDigits(nExponentAbs);
+				WriteDecimalBackward(nExponentAbs, pBuffer);
+
+				return pBuffer;
+			}
+		}
+	}
+}
+
+
+#endif // Header include guard
@@ -59,7 +59,14 @@ namespace StdC
 
 	EASTDC_EAMEMORY_DECL uint8_t* Memset8_128(void* pDestination, uint8_t c, size_t uint8Count)
 	{
-		// To do: Make an optimized version of this.
+		// Blocks larger than the last-level cache are written with non-temporal stores, 
+		// as writing them through the cache would only evict more useful memory.
+		if(uint8Count >= EASTDC_MEMORY_STREAMING_THRESHOLD)
+		{
+			Internal::MemsetNonTemporal(pDestination, c, uint8Count);
+			return (uint8_t*)pDestination;
+		}
+
 		return (uint8_t*)memset(pDestination, c, uint8Count);
 	}
 
@@ -111,6 +118,13 @@ namespace StdC
 		EA_ASSERT((pSource      >= (const uint8_t*)pDestination + nByteCount) || // Verify the memory doesn't overlap.
 				  (pDestination >= (const uint8_t*)pSource      + nByteCount));
 
+		// Below this size the alignment fixup and the store fence cost more than the cache 
+		// pollution of a few lines, so we let memcpy handle it.
+		if(nByteCount >= 256)
+		{
+			Internal::MemcpyNonTemporal(pDestination, pSource, nByteCount);
+			return (char*)pDestination;
+		}
 
 		return (char*)memcpy(pDestination, pSource, nByteCount);
 	}
@@ -123,6 +137,14 @@ namespace StdC
 
 		// This is expected to work with both cacheable and uncacheable memory, 
 		// thus we can't use all alternative optimized functions that exist for memcpy.
+		// Non-temporal stores are fine for either, and we use them for blocks larger 
+		// than the last-level cache.
+		if(nByteCount >= EASTDC_MEMORY_STREAMING_THRESHOLD)
+		{
+			Internal::MemcpyNonTemporal(pDestination, pSource, nByteCount);
+			return (char*)pDestination;
+		}
+
 		return (char*)memcpy(pDestination, pSource, nByteCount);
 	}
 
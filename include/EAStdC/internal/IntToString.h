@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Internal integer to string conversion, shared by the I32toa family of
+// functions in EAString and the integer formatting of Sprintf.
+//
+// Decimal digits are written two at a time from a table of digit pairs,
+// with 64 bit values first being split into 32 bit pieces of eight digits,
+// so that most of the divisions are 32 bit divisions by a constant, which
+// compilers implement as multiplications. Hexadecimal and the other power
+// of two bases use shifts and masks instead of divisions.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTDC_INTERNAL_INTTOSTRING_H
+#define EASTDC_INTERNAL_INTTOSTRING_H
+
+
+#include <EABase/eabase.h>
+#include <EAStdC/internal/Config.h>
+#include <EAStdC/EABitTricks.h>
+
+
+namespace EA
+{
+	namespace StdC
+	{
+		namespace Internal
+		{
+			// "00010203...9899", defined in EAString.cpp.
+			extern const char gDigitPairs[201];
+
+
+			// Returns the number of decimal digits in nValue, which is 1 for 0.
+			inline uint32_t CountDecimalDigits(uint64_t nValue)
+			{
+				static const uint64_t kPowersOf10[20] =
+				{
+					UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000), UINT64_C(1000000),
+					UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+					UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000), UINT64_C(1000000000000000),
+					UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+				};
+
+				// 1233 / 4096 approximates log10(2), so t is either the number of digits or one less than it. 
+				// Setting the low bit of nValue makes 0 count as 1 and doesn't affect comparisons with kPowersOf10.
+				nValue |= 1;
+
+				const uint32_t t = ((uint32_t)(64 - CountLeading0Bits(nValue)) * 1233) >> 12;
+
+				return t + 1 - (uint32_t)(nValue < kPowersOf10[t]);
+			}
+
+
+			// Writes the two digits of nValue (which is < 100) to p.
+			template <typename CharT>
+			EA_FORCE_INLINE void WriteDigitPair(uint32_t nValue, CharT* p)
+			{
+				p[0] = (CharT)gDigitPairs[nValue * 2];
+				p[1] = (CharT)gDigitPairs[nValue * 2 + 1];
+			}
+
+
+			// Writes the decimal digits of nValue so that they end just before pEnd, and
+			// returns the position of the first digit. Doesn't write a terminating 0.
+			template <typename CharT>
+			inline CharT* WriteDecimalBackward(uint64_t nValue, CharT* pEnd)
+			{
+				while(nValue > UINT32_MAX) // Write 8 digit pieces until the rest fits in 32 bits.
+				{
+					uint32_t nLow = (uint32_t)(nValue % 100000000);
+					nValue /= 100000000;
+
+					for(int i = 0; i < 4; i++)
+					{
+						pEnd -= 2;
+						WriteDigitPair((nLow % 100), pEnd);
+						nLow /= 100;
+					}
+				}
+
+				uint32_t nValue32 = (uint32_t)nValue;
+
+				while(nValue32 >= 100)
+				{
+					pEnd -= 2;
+					WriteDigitPair((nValue32 % 100), pEnd);
+					nValue32 /= 100;
+				}
+
+				if(nValue32 < 10)
+					*--pEnd = (CharT)('0' + nValue32);
+				else
+				{
+					pEnd -= 2;
+					WriteDigitPair(nValue32, pEnd);
+				}
+
+				return pEnd;
+			}
+
+
+			// Writes the digits of nValue in base (1 << nShift) so that they end just before
+			// pEnd, and returns the position of the first digit. Digits above 9 are letters,
+			// which are upper case if bUpperCase. Doesn't write a terminating 0.
+			template <typename CharT>
+			inline CharT* WritePowerOf2Backward(uint64_t nValue, CharT* pEnd, unsigned nShift, bool bUpperCase)
+			{
+				const char* const pDigits = bUpperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+				const uint64_t    nMask   = ((uint64_t)1 << nShift) - 1;
+
+				do{
+					*--pEnd = (CharT)pDigits[nValue & nMask];
+					nValue >>= nShift;
+				} while(nValue);
+
+				return pEnd;
+			}
+
+
+			// Writes the digits of nValue in the given base (2 - 36) so that they end just before
+			// pEnd, and returns the position of the first digit. Digits above 9 are letters,
+			// which are upper case if bUpperCase. Doesn't write a terminating 0.
+			// There must be room for 64 digits before pEnd.
+			template <typename CharT>
+			inline CharT* WriteIntegerBackward(uint64_t nValue, CharT* pEnd, unsigned nBase, bool bUpperCase)
+			{
+				switch(nBase)
+				{
+					case 10: return WriteDecimalBackward(nValue, pEnd);
+					case 16: return WritePowerOf2Backward(nValue, pEnd, 4, bUpperCase);
+					case 8:  return WritePowerOf2Backward(nValue, pEnd, 3, bUpperCase);
+					case 2:  return WritePowerOf2Backward(nValue, pEnd, 1, bUpperCase);
+				}
+
+				const char cLetter = bUpperCase ? 'A' : 'a';
+
+				do{
+					const unsigned nDigit = (unsigned)(nValue % nBase);
+					nValue /= nBase;
+
+					*--pEnd = (CharT)((nDigit > 9) ? (nDigit - 10 + cLetter) : (nDigit + '0'));
+				} while(nValue);
+
+				return pEnd;
+			}
+
+
+			// Writes the digits of nValue in the given base (2 - 36) to pBuffer, followed by
+			// a terminating 0, and returns the position of the terminating 0. Digits above 9
+			// are lower case letters.
+			template <typename CharT>
+			inline CharT* WriteInteger(uint64_t nValue, CharT* pBuffer, unsigned nBase)
+			{
+				uint32_t nLength;
+
+				if(nBase == 10)
+					nLength = CountDecimalDigits(nValue);
+				else if(nBase == 16)
+					nLength = (uint32_t)(67 - CountLeading0Bits(nValue | 1)) / 4;
+				else
+				{
+					// Other bases are written to a temporary buffer and then copied.
+					CharT        buffer[64];
+					const CharT* pFirst = WriteIntegerBackward(nValue, buffer + 64, nBase, false);
+
+					while(pFirst < (buffer + 64))
+						*pBuffer++ = *pFirst++;
+
+					*pBuffer = 0;
+					return pBuffer;
+				}
+
+				WriteIntegerBackward(nValue, pBuffer + nLength, nBase, false);
+				pBuffer[nLength] = 0;
+
+				return pBuffer + nLength;
+			}
+		}
+	}
+}
+
+
+#endif // Header include guard
@@ -154,7 +154,7 @@ struct FormatData
 	int       mnWidth;              // Field width in characters.
 	int       mnPrecision;          // A value of kNoPrecision means that precision was not specified.
 	Modifier  mModifier;            // One of enum Modifier. Example is 'h' for 'short'.
-	int       mnType;               // 'c', 'C', 'b', 'd', 'i', 'u', 'e', 'E', 'f', 'g', 'G', 'o', 's', 'S', 'x', 'X', 'p', 'n', '%', or 0 (for error).
+	int       mnType;               // 'c', 'C', 'b', 'd', 'i', 'u', 'e', 'E', 'f', 'g', 'G', 'r', 'R', 'o', 's', 'S', 'x', 'X', 'p', 'n', '%', or 0 (for error).
 	int       mDecimalPoint;        // Typically equal to '.', but could be ',' for some locales.
 	bool      mbDisplayThousands;   // Non-standard extension, though found in a number of Unix compiler C library printf implementations.
 	int       mThousandsSeparator;  // Typically equal to ',' but could be '.' or ' ' for some locales.
@@ -0,0 +1,42 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Internal decimal to double conversion, shared by the StrtodEnglish functions
+// in EAString and the floating point formats of Scanf.
+//
+// The conversion is the Eisel-Lemire algorithm, which computes the correctly
+// rounded double from a 64 bit decimal mantissa with one or two 64 x 64 bit
+// multiplications by a tabled 128 bit power of five.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTDC_INTERNAL_STRINGTODOUBLE_H
+#define EASTDC_INTERNAL_STRINGTODOUBLE_H
+
+
+#include <EABase/eabase.h>
+#include <EAStdC/internal/Config.h>
+
+
+namespace EA
+{
+	namespace StdC
+	{
+		namespace Internal
+		{
+			// Sets dValue to the double nearest to nMantissa * 10^nExponent, with ties rounded to even, 
+			// and returns true. Values too large for a double result in infinity and values too small
+			// result in zero. 
+			// If bTruncated is true, nMantissa holds the leading digits of a longer decimal whose other
+			// digits aren't all zero. In that case the function returns false if the leading digits don't
+			// determine the result, and the caller needs to convert all of the digits by other means.
+			// Defined in EAString.cpp.
+			EASTDC_API bool DecimalToDouble(uint64_t nMantissa, int64_t nExponent, bool bTruncated, double& dValue);
+		}
+	}
+}
+
+
+#endif // Header include guard
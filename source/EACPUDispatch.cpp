@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <EAStdC/internal/Config.h>
+#include <EAStdC/EACPUDispatch.h>
+#include <EAStdC/internal/CPUDispatch.h>
+#include <EAStdC/EAProcess.h>
+#include <EAStdC/EAString.h>
+
+#if EASTDC_CPU_DISPATCH_ENABLED && !defined(_MSC_VER)
+	EA_DISABLE_ALL_VC_WARNINGS()
+	#include <cpuid.h>
+	EA_RESTORE_ALL_VC_WARNINGS()
+#endif
+
+
+namespace EA
+{
+namespace StdC
+{
+
+namespace Internal
+{
+	// Indexed by CPUFeatureLevel. Levels for which there are no dedicated kernels use
+	// those of the highest level below them.
+	static const CPUDispatchTable kCPUDispatchTables[] =
+	{
+		{
+			kCPUFeatureLevelScalar,
+			MemcmpFindDifferenceScalar, MemcheckScalar, MemchrScalar, MemmemFindCandidateScalar, MemfillPatternScalar,
+			Memchr16Scalar, Memchr32Scalar, MemrchrScalar, Memrchr16Scalar, Memrchr32Scalar, MemchrAnyScalar, MemFindEqualScalar,
+			TimingSafeMemEqualScalar, TimingSafeMemcmpScalar, TimingSafeMemIsClearScalar,
+			Strlen16Scalar, Strlen32Scalar,
+			NULL, NULL, NULL, NULL, // The general Strlcpy code is as fast as scalar transcoding kernels would be.
+			StrnicmpScalar, Strnicmp16Scalar, Strnicmp32Scalar,
+			StrstrFindCandidateScalar, StrstrFindCandidate16Scalar, StrstrFindCandidate32Scalar, StrrstrFindCandidateScalar, StrrstrFindCandidate16Scalar, StrrstrFindCandidate32Scalar,
+			CharSetFindScalar,
+			UTF8ValidateScalar, UTF8CountCharsScalar, UTF8IncrementScalar,
+			CRC32ReverseScalar
+		},
+
+		#if EASTDC_CPU_DISPATCH_ENABLED
+		{
+			kCPUFeatureLevelSSE2,
+			MemcmpFindDifferenceSSE2, MemcheckSSE2, MemchrSSE2, MemmemFindCandidateSSE2, MemfillPatternSSE2,
+			Memchr16SSE2, Memchr32SSE2, MemrchrSSE2, Memrchr16SSE2, Memrchr32SSE2, MemchrAnySSE2, MemFindEqualSSE2,
+			TimingSafeMemEqualSSE2, TimingSafeMemcmpSSE2, TimingSafeMemIsClearSSE2,
+			Strlen16SSE2, Strlen32SSE2,
+			UTF8ToUTF16SSE2, UTF8ToUTF32SSE2, UTF16ToUTF8SSE2, UTF32ToUTF8SSE2,
+			StrnicmpSSE2, Strnicmp16SSE2, Strnicmp32SSE2,
+			StrstrFindCandidateSSE2, StrstrFindCandidate16SSE2, StrstrFindCandidate32SSE2, StrrstrFindCandidateSSE2, StrrstrFindCandidate16SSE2, StrrstrFindCandidate32SSE2,
+			CharSetFindScalar,
+			UTF8ValidateSSE2, UTF8CountCharsSSE2, UTF8IncrementSSE2,
+			CRC32ReverseScalar
+		},
+		{
+			kCPUFeatureLevelSSE42,
+			MemcmpFindDifferenceSSE2, MemcheckSSE2, MemchrSSE2, MemmemFindCandidateSSE2, MemfillPatternSSE2,
+			Memchr16SSE2, Memchr32SSE2, MemrchrSSE2, Memrchr16SSE2, Memrchr32SSE2, MemchrAnySSE42, MemFindEqualSSE2,
+			TimingSafeMemEqualSSE2, TimingSafeMemcmpSSE2, TimingSafeMemIsClearSSE2,
+			Strlen16SSE2, Strlen32SSE2,
+			UTF8ToUTF16SSE2, UTF8ToUTF32SSE2, UTF16ToUTF8SSE2, UTF32ToUTF8SSE2,
+			StrnicmpSSE2, Strnicmp16SSE2, Strnicmp32SSE2,
+			StrstrFindCandidateSSE2, StrstrFindCandidate16SSE2, StrstrFindCandidate32SSE2, StrrstrFindCandidateSSE2, StrrstrFindCandidate16SSE2, StrrstrFindCandidate32SSE2,
+			CharSetFindSSE42,
+			UTF8ValidateSSE2, UTF8CountCharsSSE2, UTF8IncrementSSE2,
+			CRC32ReverseSSE42
+		},
+		{
+			kCPUFeatureLevelAVX2,
+			MemcmpFindDifferenceAVX2, MemcheckAVX2, MemchrAVX2, MemmemFindCandidateAVX2, MemfillPatternAVX2,
+			Memchr16AVX2, Memchr32AVX2, MemrchrAVX2, Memrchr16AVX2, Memrchr32AVX2, MemchrAnyAVX2, MemFindEqualAVX2,
+			TimingSafeMemEqualAVX2, TimingSafeMemcmpAVX2, TimingSafeMemIsClearAVX2,
+			Strlen16AVX2, Strlen32AVX2,
+			UTF8ToUTF16AVX2, UTF8ToUTF32AVX2, UTF16ToUTF8AVX2, UTF32ToUTF8AVX2,
+			StrnicmpAVX2, Strnicmp16AVX2, Strnicmp32AVX2,
+			StrstrFindCandidateAVX2, StrstrFindCandidate16AVX2, StrstrFindCandidate32AVX2, StrrstrFindCandidateAVX2, StrrstrFindCandidate16AVX2, StrrstrFindCandidate32AVX2,
+			CharSetFindAVX2,
+			UTF8ValidateAVX2, UTF8CountCharsAVX2, UTF8IncrementAVX2,
+			CRC32ReverseSSE42
+		},
+		{
+			// There are no AVX-512 kernels yet, so this level is an alias of the AVX2 level. It exists so that
+			// GetCPUFeatureLevelSupported reports the hardware accurately and AVX-512 kernels can be added slot by slot.
+			kCPUFeatureLevelAVX512,
+			MemcmpFindDifferenceAVX2, MemcheckAVX2, MemchrAVX2, MemmemFindCandidateAVX2, MemfillPatternAVX2,
+			Memchr16AVX2, Memchr32AVX2, MemrchrAVX2, Memrchr16AVX2, Memrchr32AVX2, MemchrAnyAVX2, MemFindEqualAVX2,
+			TimingSafeMemEqualAVX2, TimingSafeMemcmpAVX2, TimingSafeMemIsClearAVX2,
+			Strlen16AVX2, Strlen32AVX2,
+			UTF8ToUTF16AVX2, UTF8ToUTF32AVX2, UTF16ToUTF8AVX2, UTF32ToUTF8AVX2,
+			StrnicmpAVX2, Strnicmp16AVX2, Strnicmp32AVX2,
+			StrstrFindCandidateAVX2, StrstrFindCandidate16AVX2, StrstrFindCandidate32AVX2, StrrstrFindCandidateAVX2, StrrstrFindCandidate16AVX2, StrrstrFindCandidate32AVX2,
+			CharSetFindAVX2,
+			UTF8ValidateAVX2, UTF8CountCharsAVX2, UTF8IncrementAVX2,
+			CRC32ReverseSSE42
+		}
+		#endif
+	};
+
+	EASTDC_API const CPUDispatchTable* gpCPUDispatchTable = NULL;
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		static void GetCPUID(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+		{
+			#if defined(_MSC_VER)
+				int r[4];
+				__cpuidex(r, (int)leaf, (int)subleaf);
+				registers[0] = (uint32_t)r[0]; registers[1] = (uint32_t)r[1]; registers[2] = (uint32_t)r[2]; registers[3] = (uint32_t)r[3];
+			#else
+				registers[0] = registers[1] = registers[2] = registers[3] = 0;
+
+				if(leaf <= __get_cpuid_max(leaf & 0x80000000, NULL))
+					__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+			#endif
+		}
+
+
+		// Returns the XCR0 register, which indicates which register states the OS saves on a context switch.
+		static uint64_t GetXCR0()
+		{
+			#if defined(_MSC_VER)
+				return (uint64_t)_xgetbv(0);
+			#else
+				uint32_t eax, edx;
+				__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				return ((uint64_t)edx << 32) | eax;
+			#endif
+		}
+
+
+		static CPUFeatureLevel DetectCPUFeatureLevel()
+		{
+			uint32_t leaf0[4], leaf1[4], leaf7[4];
+
+			GetCPUID(0, 0, leaf0);
+			GetCPUID(1, 0, leaf1);
+
+			if(leaf0[0] >= 7)
+				GetCPUID(7, 0, leaf7);
+			else
+				leaf7[0] = leaf7[1] = leaf7[2] = leaf7[3] = 0;
+
+			const bool bSSE2    = (leaf1[3] & (1u << 26)) != 0;
+			const bool bPCLMUL  = (leaf1[2] & (1u <<  1)) != 0;
+			const bool bSSE41   = (leaf1[2] & (1u << 19)) != 0;
+			const bool bSSE42   = (leaf1[2] & (1u << 20)) != 0;
+			const bool bPOPCNT  = (leaf1[2] & (1u << 23)) != 0;
+			const bool bOSXSAVE = (leaf1[2] & (1u << 27)) != 0;
+			const bool bAVX     = (leaf1[2] & (1u << 28)) != 0;
+			const bool bBMI1    = (leaf7[1] & (1u <<  3)) != 0;
+			const bool bAVX2    = (leaf7[1] & (1u <<  5)) != 0;
+			const bool bBMI2    = (leaf7[1] & (1u <<  8)) != 0;
+			const bool bAVX512F = (leaf7[1] & (1u << 16)) != 0;
+			const bool bAVX512B = (leaf7[1] & (1u << 30)) != 0;
+			const bool bAVX512V = (leaf7[1] & (1u << 31)) != 0;
+
+			const uint64_t xcr0  = bOSXSAVE ? GetXCR0() : 0;
+			const bool     bYMM  = (xcr0 & 0x06) == 0x06; // XMM and YMM state.
+			const bool     bZMM  = (xcr0 & 0xe6) == 0xe6; // XMM, YMM, opmask and ZMM state.
+
+			if(!bSSE2)
+				return kCPUFeatureLevelScalar;
+			if(!bSSE41 || !bSSE42 || !bPOPCNT || !bPCLMUL)
+				return kCPUFeatureLevelSSE2;
+			if(!bAVX || !bAVX2 || !bBMI1 || !bBMI2 || !bYMM)
+				return kCPUFeatureLevelSSE42;
+			if(!bAVX512F || !bAVX512B || !bAVX512V || !bZMM)
+				return kCPUFeatureLevelAVX2;
+			return kCPUFeatureLevelAVX512;
+		}
+	#endif
+
+
+	// The table for the highest supported level, or NULL if it hasn't been detected yet.
+	static const CPUDispatchTable* gpCPUDispatchTableSupported = NULL;
+
+	static CPUFeatureLevel GetCPUFeatureLevelSupportedInternal()
+	{
+		const CPUDispatchTable* pTable = LoadCPUDispatchTable(&gpCPUDispatchTableSupported);
+
+		if(pTable == NULL)
+		{
+			// Concurrent first calls all detect the same level, so it doesn't matter which store wins.
+			#if EASTDC_CPU_DISPATCH_ENABLED
+				pTable = &kCPUDispatchTables[DetectCPUFeatureLevel()];
+			#else
+				pTable = &kCPUDispatchTables[kCPUFeatureLevelScalar];
+			#endif
+
+			StoreCPUDispatchTable(&gpCPUDispatchTableSupported, pTable);
+		}
+
+		return pTable->mLevel;
+	}
+
+
+	static const CPUDispatchTable* GetCPUDispatchTableForLevel(CPUFeatureLevel level)
+	{
+		const CPUFeatureLevel levelSupported = GetCPUFeatureLevelSupportedInternal();
+
+		if((level < kCPUFeatureLevelScalar) || (level > levelSupported))
+			level = levelSupported;
+
+		return &kCPUDispatchTables[level];
+	}
+
+
+	EASTDC_API const CPUDispatchTable* ResolveCPUDispatchTable()
+	{
+		CPUFeatureLevel level = kCPUFeatureLevelCount; // Default to the best supported level.
+		char            levelName[16];
+
+		if(GetEnvironmentVar("EASTDC_CPU_FEATURE_LEVEL", levelName, sizeof(levelName)) < sizeof(levelName))
+		{
+			for(int i = kCPUFeatureLevelScalar; i < kCPUFeatureLevelCount; i++)
+			{
+				if(StrnicmpScalar(levelName, GetCPUFeatureLevelName((CPUFeatureLevel)i), (size_t)-1) == 0)
+					level = (CPUFeatureLevel)i;
+			}
+		}
+
+		const CPUDispatchTable* pTable = GetCPUDispatchTableForLevel(level);
+		StoreCPUDispatchTable(&gpCPUDispatchTable, pTable);
+
+		return pTable;
+	}
+
+} // namespace Internal
+
+
+
+EASTDC_API CPUFeatureLevel GetCPUFeatureLevelSupported()
+{
+	return Internal::GetCPUFeatureLevelSupportedInternal();
+}
+
+
+EASTDC_API CPUFeatureLevel GetCPUFeatureLevel()
+{
+	return Internal::GetCPUDispatchTable().mLevel;
+}
+
+
+EASTDC_API CPUFeatureLevel SetCPUFeatureLevel(CPUFeatureLevel level)
+{
+	const Internal::CPUDispatchTable* pTable = Internal::GetCPUDispatchTableForLevel(level);
+	Internal::StoreCPUDispatchTable(&Internal::gpCPUDispatchTable, pTable);
+
+	return pTable->mLevel;
+}
+
+
+EASTDC_API const char* GetCPUFeatureLevelName(CPUFeatureLevel level)
+{
+	static const char* const kNames[kCPUFeatureLevelCount] = { "scalar", "sse2", "sse42", "avx2", "avx512" };
+
+	if((level >= kCPUFeatureLevelScalar) && (level < kCPUFeatureLevelCount))
+		return kNames[level];
+
+	return "";
+}
+
+
+} // namespace StdC
+} // namespace EA
@@ -4,6 +4,7 @@
 
 
 #include <EAStdC/EAHashCRC.h>
+#include <EAStdC/internal/CPUDispatch.h>
 
 
 namespace EA
@@ -231,25 +232,135 @@ EASTDC_API uint32_t crc32TableReverse[256] =
 };
 
 
-EASTDC_API uint32_t CRC32Reverse(const void* pData, size_t nLength, uint32_t nInitialValue, bool bFinalize)
+// CRC32Reverse kernels, called by CRC32Reverse via the CPU dispatch table.
+// They operate on the unfinalized CRC value.
+namespace Internal
 {
-	const uint8_t* pData8 = (const uint8_t*)pData;
-
-	while(nLength >= 8)
+	uint32_t CRC32ReverseScalar(const void* pData, size_t nLength, uint32_t nInitialValue)
 	{
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
-		nLength -= 8;
+		const uint8_t* pData8 = (const uint8_t*)pData;
+
+		while(nLength >= 8)
+		{
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+			nLength -= 8;
+		}
+
+		while(nLength--)
+			nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+
+		return nInitialValue;
 	}
 
-	while(nLength--)
-		nInitialValue = crc32TableReverse[(nInitialValue ^ *pData8++) & 0xff] ^ (nInitialValue >> 8);
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Folds 64 bytes at a time with carry-less multiplication and then Barrett-reduces 
+		// to 32 bits, per Gopal et al., "Fast CRC Computation for Generic Polynomials Using 
+		// PCLMULQDQ Instruction" (Intel, 2009). The constants are the bit-reflected folding 
+		// constants for the CRC32 polynomial (0x04c11db7 / 0xedb88320) given in that paper.
+		EASTDC_TARGET_SSE42 uint32_t CRC32ReverseSSE42(const void* pData, size_t nLength, uint32_t nInitialValue)
+		{
+			if(nLength < 64)
+				return CRC32ReverseScalar(pData, nLength, nInitialValue);
+
+			EA_PREFIX_ALIGN(16) static const uint64_t k1k2[2] EA_POSTFIX_ALIGN(16) = { UINT64_C(0x0154442bd4), UINT64_C(0x01c6e41596) };
+			EA_PREFIX_ALIGN(16) static const uint64_t k3k4[2] EA_POSTFIX_ALIGN(16) = { UINT64_C(0x01751997d0), UINT64_C(0x00ccaa009e) };
+			EA_PREFIX_ALIGN(16) static const uint64_t k5k0[2] EA_POSTFIX_ALIGN(16) = { UINT64_C(0x0163cd6124), UINT64_C(0x0000000000) };
+			EA_PREFIX_ALIGN(16) static const uint64_t poly[2] EA_POSTFIX_ALIGN(16) = { UINT64_C(0x01db710641), UINT64_C(0x01f7011641) };
+
+			const uint8_t* pData8    = (const uint8_t*)pData;
+			const size_t   tailSize  = nLength & 15;
+			size_t         foldSize  = nLength - tailSize;
+			__m128i        x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+			x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x00));
+			x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x10));
+			x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x20));
+			x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x30));
+			x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)nInitialValue));
+			x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+
+			pData8   += 64;
+			foldSize -= 64;
+
+			// Fold four 128 bit lanes in parallel, 64 bytes per iteration.
+			for(; foldSize >= 64; foldSize -= 64, pData8 += 64)
+			{
+				x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+				x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+				x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+				x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+				x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+				x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+				x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+				x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+				x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x00)));
+				x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x10)));
+				x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x20)));
+				x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8 + 0x30)));
+			}
+
+			// Fold the four lanes into one.
+			x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+			// Fold any remaining 16 byte blocks.
+			for(; foldSize >= 16; foldSize -= 16, pData8 += 16)
+			{
+				x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+				x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+				x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData8))), x5);
+			}
+
+			// Fold 128 bits to 64 bits.
+			x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+			x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+			x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+			x2 = _mm_srli_si128(x1, 4);
+			x1 = _mm_and_si128(x1, x3);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x1 = _mm_xor_si128(x1, x2);
+
+			// Barrett reduce to 32 bits.
+			x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+			x2 = _mm_and_si128(x1, x3);
+			x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+			x2 = _mm_and_si128(x2, x3);
+			x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+			x1 = _mm_xor_si128(x1, x2);
+
+			return CRC32ReverseScalar(pData8, tailSize, (uint32_t)_mm_extract_epi32(x1, 1));
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API uint32_t CRC32Reverse(const void* pData, size_t nLength, uint32_t nInitialValue, bool bFinalize)
+{
+	nInitialValue = Internal::GetCPUDispatchTable().mpCRC32Reverse(pData, nLength, nInitialValue);
 
 	if(bFinalize)
 		nInitialValue = ~nInitialValue;
@@ -5,8 +5,26 @@
 
 #include <EAStdC/internal/Config.h>
 #include <EAStdC/EAMemory.h>
+#include <EAStdC/EABitTricks.h>
+#include <EAStdC/internal/CPUDispatch.h>
 #include <EAAssert/eaassert.h>
 
+EA_DISABLE_ALL_VC_WARNINGS()
+#if EA_SSE >= 2
+	#include <emmintrin.h>
+#endif
+#if EASTDC_SYS_MMAN_H_AVAILABLE
+	#include <sys/mman.h>
+	#include <unistd.h>
+	#include <stdio.h>
+	#if defined(EA_PLATFORM_LINUX)
+		#include <sys/syscall.h>
+	#endif
+#elif defined(EA_PLATFORM_WINDOWS)
+	#include <Windows.h>
+#endif
+EA_RESTORE_ALL_VC_WARNINGS()
+
 
 
 // In optimized non-debug builds, we inline various functions.
@@ -226,331 +244,1516 @@ EASTDC_API void* MemsetN(void* pDestination, const void* pSource, size_t sourceB
 }
 
 
-EASTDC_API const void* Memcheck8(const void* p, uint8_t c, size_t byteCount)
+// Prefetches the cache line containing p for reading or writing. The locality is the 
+// __builtin_prefetch hint, from 0 (no temporal locality) to 3 (keep in all cache levels).
+template <int locality = 3>
+static inline void MemoryPrefetchRead(const void* p)
 {
-	for(const uint8_t* p8 = (const uint8_t*)p; byteCount > 0; ++p8, --byteCount)
-	{
-		if(*p8 != c)
-			return p8;
-	}
+	#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(p, 0, locality);
+	#elif EA_SSE
+		_mm_prefetch((const char*)p, (locality == 3) ? _MM_HINT_T0 : (locality == 2) ? _MM_HINT_T1 : (locality == 1) ? _MM_HINT_T2 : _MM_HINT_NTA);
+	#else
+		EA_UNUSED(p);
+	#endif
+}
 
-	return NULL;
+template <int locality = 3>
+static inline void MemoryPrefetchWrite(void* p)
+{
+	#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(p, 1, locality);
+	#elif EA_SSE
+		// There is no portable write prefetch intrinsic.
+		_mm_prefetch((const char*)p, (locality == 3) ? _MM_HINT_T0 : (locality == 2) ? _MM_HINT_T1 : (locality == 1) ? _MM_HINT_T2 : _MM_HINT_NTA);
+	#else
+		EA_UNUSED(p);
+	#endif
 }
 
 
-EASTDC_API const void* Memcheck16(const void* p, uint16_t c, size_t byteCount)
+// This is a local function called by MemcpyBatch.
+// Copies of up to 64 bytes are done with two possibly overlapping loads and stores of the 
+// largest fixed width that fits, all of which are done by the compiler as register moves. 
+// Both loads are done before either store, so the result doesn't depend on their order.
+static inline void MemcpySmall(uint8_t* EA_RESTRICT pDestination, const uint8_t* EA_RESTRICT pSource, size_t n)
 {
-	union U16 {
-		uint16_t c16;
-		uint8_t  c8[2];
-	};
-	const U16 u = { c };
-	size_t    i = (size_t)((uintptr_t)p % 2);
-
-	for(const uint8_t* p8 = (const uint8_t*)p, *p8End = (const uint8_t*)p + byteCount; p8 != p8End; ++p8, i ^= 1)
+	if(n <= 16)
 	{
-		if(*p8 != u.c8[i])
-			return p8;
+		if(n >= 8)
+		{
+			uint64_t a, b;
+			memcpy(&a, pSource, 8);
+			memcpy(&b, pSource + n - 8, 8);
+			memcpy(pDestination, &a, 8);
+			memcpy(pDestination + n - 8, &b, 8);
+		}
+		else if(n >= 4)
+		{
+			uint32_t a, b;
+			memcpy(&a, pSource, 4);
+			memcpy(&b, pSource + n - 4, 4);
+			memcpy(pDestination, &a, 4);
+			memcpy(pDestination + n - 4, &b, 4);
+		}
+		else if(n >= 2)
+		{
+			uint16_t a, b;
+			memcpy(&a, pSource, 2);
+			memcpy(&b, pSource + n - 2, 2);
+			memcpy(pDestination, &a, 2);
+			memcpy(pDestination + n - 2, &b, 2);
+		}
+		else if(n)
+			*pDestination = *pSource;
+	}
+	else if(n <= 32)
+	{
+		uint8_t a[16], b[16];
+		memcpy(a, pSource, 16);
+		memcpy(b, pSource + n - 16, 16);
+		memcpy(pDestination, a, 16);
+		memcpy(pDestination + n - 16, b, 16);
+	}
+	else
+	{
+		uint8_t a[32], b[32];
+		memcpy(a, pSource, 32);
+		memcpy(b, pSource + n - 32, 32);
+		memcpy(pDestination, a, 32);
+		memcpy(pDestination + n - 32, b, 32);
 	}
-
-	return NULL;
 }
 
 
-EASTDC_API const void* Memcheck32(const void* p, uint32_t c, size_t byteCount)
+EASTDC_API void MemcpyBatch(const MemcpyDesc* pDescArray, size_t descCount)
 {
-	union U32 {
-		uint32_t c32;
-		uint8_t  c8[4];
-	};
-	const U32 u = { c };
-	size_t    i = (size_t)((uintptr_t)p % 4);
+	const size_t kPrefetchDistance = 8; // In entries. Far enough ahead to cover most of a cache miss, near enough that the lines are still present when used.
 
-	// This code could be a little faster if it could work with an aligned 
-	// destination and do word compares. There are some pitfalls to be careful
-	// of which may make the effort not worth it in practice for typical uses 
-	// of this code. In particular we need to make sure that word compares are 
-	// done with word-aligned memory, and that may mean using a version of 
-	// the c argument which has bytes rotated from their current position.
-	for(const uint8_t* p8 = (const uint8_t*)p, *p8End = (const uint8_t*)p + byteCount; p8 != p8End; ++p8, i = (i + 1) % 4)
+	for(size_t i = 0; i < descCount; ++i)
 	{
-		if(*p8 != u.c8[i])
-			return p8;
-	}
+		if((i + kPrefetchDistance) < descCount)
+		{
+			const MemcpyDesc& descAhead = pDescArray[i + kPrefetchDistance];
 
-	return NULL;
-}
+			// Prefetch the first and last cache lines of each range. Small unaligned fields often
+			// straddle a cache line boundary, while the middle of large ranges is left to the hardware prefetcher.
+			if(descAhead.mnByteCount)
+			{
+				const uint8_t* const pSourceAhead = static_cast<const uint8_t*>(descAhead.mpSource);
+				uint8_t* const       pDestAhead   = static_cast<uint8_t*>(descAhead.mpDestination);
 
+				MemoryPrefetchRead(pSourceAhead);
+				MemoryPrefetchRead(pSourceAhead + descAhead.mnByteCount - 1);
+				MemoryPrefetchWrite(pDestAhead);
+				MemoryPrefetchWrite(pDestAhead + descAhead.mnByteCount - 1);
+			}
+		}
 
-EASTDC_API const void* Memcheck64(const void* p, uint64_t c, size_t byteCount)
-{
-	union U64 {
-		uint64_t c64;
-		uint8_t  c8[8];
-	};
-	const U64 u = { c };
-	size_t    i = (size_t)((uintptr_t)p % 8);
+		const MemcpyDesc& desc = pDescArray[i];
 
-	for(const uint8_t* p8 = (const uint8_t*)p, *p8End = (const uint8_t*)p + byteCount; p8 != p8End; ++p8, i = (i + 1) % 8)
-	{
-		if(*p8 != u.c8[i])
-			return p8;
+		if(desc.mnByteCount <= 64)
+			MemcpySmall(static_cast<uint8_t*>(desc.mpDestination), static_cast<const uint8_t*>(desc.mpSource), desc.mnByteCount);
+		else
+			memcpy(desc.mpDestination, desc.mpSource, desc.mnByteCount);
 	}
-
-	return NULL;
 }
 
 
-
-
-EASTDC_API const char* Memchr(const char* p, char c, size_t nCharCount)
+// Memcheck kernels, called by MemcheckValue via the CPU dispatch table.
+// Each returns the first address in [p8, p8End) whose byte differs from pPattern32[address % 32],
+// or NULL if there is no difference. Bytes up to the first vector boundary are checked individually.
+// After that, 64 bytes per iteration are compared against the pattern with aligned loads. When a 
+// block mismatches, the block loop is exited and the mismatch is located one vector at a time.
+namespace Internal
 {
-	for(const char* p8 = (const char*)p; nCharCount > 0; ++p8, --nCharCount)
+	const uint8_t* MemcheckScalar(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32)
 	{
-		if(*p8 == c)
-			return p8;
+		for(; p8 != p8End; ++p8)
+		{
+			if(*p8 != pPattern32[(uintptr_t)p8 & 31])
+				return p8;
+		}
+
+		return NULL;
 	}
 
-	return NULL;
-}
 
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 const uint8_t* MemcheckSSE2(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32)
+		{
+			if((size_t)(p8End - p8) >= 32)
+			{
+				for(; (uintptr_t)p8 & 15; ++p8)
+				{
+					if(*p8 != pPattern32[(uintptr_t)p8 & 31])
+						return p8;
+				}
+
+				// pPattern32 repeats every valueSize (<= 16) bytes, so its first half applies to any 16 byte aligned address.
+				const __m128i pattern16 = _mm_load_si128(reinterpret_cast<const __m128i*>(pPattern32));
 
-EASTDC_API const char16_t* Memchr16(const char16_t* pString, char16_t c, size_t nCharCount)
-{
-	for(; nCharCount > 0; ++pString, --nCharCount)
-	{
-		if(*pString == c)
-			return pString;
-	}
+				for(; (size_t)(p8End - p8) >= 64; p8 += 64)
+				{
+					const __m128i eqA = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8)),      pattern16);
+					const __m128i eqB = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8 + 16)), pattern16);
+					const __m128i eqC = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8 + 32)), pattern16);
+					const __m128i eqD = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8 + 48)), pattern16);
 
-	return NULL;
-}
+					if(EA_UNLIKELY(_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(eqA, eqB), _mm_and_si128(eqC, eqD))) != 0xffff))
+						break;
+				}
 
+				for(; (size_t)(p8End - p8) >= 16; p8 += 16)
+				{
+					const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8)), pattern16)) ^ 0xffff;
 
-EASTDC_API const char32_t* Memchr32(const char32_t* pString, char32_t c, size_t nCharCount)
-{
-	for(; nCharCount > 0; ++pString, --nCharCount)
-	{
-		if(*pString == c)
-			return pString;
-	}
+					if(mask)
+						return p8 + CountTrailing0Bits(mask);
+				}
+			}
 
-	return NULL;
-}
+			return MemcheckScalar(p8, p8End, pPattern32);
+		}
 
 
-#if EASTDC_MEMCHR16_ENABLED
-	EASTDC_API const char16_t* Memchr(const char16_t* pString, char16_t c, size_t nCharCount)
-	{
-		return Memchr16(pString, c, nCharCount);
-	}
-#endif
+		EASTDC_TARGET_AVX2 const uint8_t* MemcheckAVX2(const uint8_t* p8, const uint8_t* p8End, const uint8_t* pPattern32)
+		{
+			if((size_t)(p8End - p8) >= 64)
+			{
+				for(; (uintptr_t)p8 & 31; ++p8)
+				{
+					if(*p8 != pPattern32[(uintptr_t)p8 & 31])
+						return p8;
+				}
 
+				const __m256i pattern32 = _mm256_load_si256(reinterpret_cast<const __m256i*>(pPattern32));
 
-EASTDC_API int Memcmp(const void* pString1, const void* pString2, size_t nCharCount)
-{
-	const char* p1 = (const char*)pString1;
-	const char* p2 = (const char*)pString2;
+				for(; (size_t)(p8End - p8) >= 64; p8 += 64)
+				{
+					const __m256i eqA = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(p8)),      pattern32);
+					const __m256i eqB = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(p8 + 32)), pattern32);
 
-	for(; nCharCount > 0; ++p1, ++p2, --nCharCount)
-	{
-		if(*p1 != *p2)
-			return (*p1 < *p2) ? -1 : 1;
-	}
+					if(EA_UNLIKELY((uint32_t)_mm256_movemask_epi8(_mm256_and_si256(eqA, eqB)) != 0xffffffff))
+						break;
+				}
 
-	return 0;
-}
+				for(; (size_t)(p8End - p8) >= 32; p8 += 32)
+				{
+					const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(p8)), pattern32));
 
+					if(mask)
+						return p8 + CountTrailing0Bits(mask);
+				}
+			}
 
-#if EASTDC_MEMCPY16_ENABLED
-	EASTDC_API int Memcmp(const char16_t* pString1, const char16_t* pString2, size_t nCharCount)
-	{
-		for(; nCharCount > 0; ++pString1, ++pString2, --nCharCount)
-		{
-			if(*pString1 != *pString2)
-				return (*pString1 < *pString2) ? -1 : 1;
+			return MemcheckScalar(p8, p8End, pPattern32);
 		}
+	#endif
 
-		return 0;
-	}
-#endif
+} // namespace Internal
 
 
-// Search for pFind/findSize within pMemory/memorySize.
-EASTDC_API void* Memmem(const void* pMemory, size_t memorySize, const void* pFind, size_t findSize)
+// This is a local function called by the Memcheck functions.
+// Verifies that each byte in the given memory matches the value at pValue/valueSize, where the 
+// value is expected to be laid out at its natural alignment. Thus the byte at any address a is 
+// compared to pValue[a % valueSize]. valueSize must be a power of two and <= 16.
+static const void* MemcheckValue(const void* p, const void* pValue, size_t valueSize, size_t byteCount)
 {
-	EA_ASSERT((pMemory || !memorySize) && (pFind || !findSize)); // Verify that if pMemory or pFind is NULL, their respective size must be 0.
+	EA_ASSERT((valueSize <= 16) && ((valueSize & (valueSize - 1)) == 0));
 
-	const uint8_t* const pMemory8 = static_cast<const uint8_t*>(pMemory);
-	const uint8_t* const pFind8   = static_cast<const uint8_t*>(pFind);
-	const uint8_t* const pEnd8    = (pMemory8 + memorySize) - findSize;
+	const uint8_t* const p8      = static_cast<const uint8_t*>(p);
+	const uint8_t* const pValue8 = static_cast<const uint8_t*>(pValue);
 
-	if(memorySize && (findSize <= memorySize))
-	{
-		if(findSize) // An empty pFind results in success, return pMemory.
-		{
-			for(const uint8_t* pCurrent8 = pMemory8; pCurrent8 <= pEnd8; ++pCurrent8)       // This looping algorithm is not the fastest possible way to 
-			{                                                                               // implement this function. A faster, but much more complex, algorithm
-				if(EA_UNLIKELY(pCurrent8[0] == pFind8[0])) // Do a quick first char check.  // might involve a two-way memory search (http://www-igm.univ-mlv.fr/~lecroq/string/node26.html#SECTION00260).
-				{                                                                           // Another algorithm might be to start by searching for words instead of bytes, then use Memcmp.
-					if(Memcmp(pCurrent8 + 1, pFind8 + 1, findSize - 1) == 0)
-						return const_cast<uint8_t*>(pCurrent8);
-				}
-			}
-		}
-		else
-			return const_cast<void*>(pMemory);
-	}
+	EA_PREFIX_ALIGN(32) uint8_t pattern[32] EA_POSTFIX_ALIGN(32); // pattern[i] is the byte expected at addresses for which (a % 32) == i.
+	for(size_t i = 0; i < 32; i++)
+		pattern[i] = pValue8[i & (valueSize - 1)];
 
-	return NULL;
+	return Internal::GetCPUDispatchTable().mpMemcheck(p8, p8 + byteCount, pattern);
 }
 
 
-// This is a local function called by MemfillSpecific.
-static void Memfill24(void* pD, const void* pS, size_t byteCount)
+EASTDC_API const void* Memcheck8(const void* p, uint8_t c, size_t byteCount)
 {
-	unsigned char* pDestination = static_cast<unsigned char*>(pD);
-	const unsigned char* pSource = static_cast<const unsigned char*>(pS);
-	// Optimization wise, this function will assume that pDestination is already aligned 32-bit
-	// Construct the 3 32-bit values
-	unsigned int val8a = *(static_cast<const unsigned char*>(pSource));
-	unsigned int val8b = *(static_cast<const unsigned char*>(pSource+1));
-	unsigned int val8c = *(static_cast<const unsigned char*>(pSource+2));
-	unsigned int val32a,val32b,val32c;
+	return MemcheckValue(p, &c, sizeof(c), byteCount);
+}
 
-	#if defined(EA_SYSTEM_BIG_ENDIAN)
-		val32a=(val8a*256*256*256)+(val8b*256*256)+(val8c*256)+val8a;
-		val32b=(val8b*256*256*256)+(val8c*256*256)+(val8a*256)+val8b;
-		val32c=(val8c*256*256*256)+(val8a*256*256)+(val8b*256)+val8c;
-	#else
-		val32a=val8a+(val8b*256)+(val8c*256*256)+(val8a*256*256*256);
-		val32b=val8b+(val8c*256)+(val8a*256*256)+(val8b*256*256*256);
-		val32c=val8c+(val8a*256)+(val8b*256*256)+(val8c*256*256*256);
-	#endif
 
-	// time to copy
-	// we have to align the address to 32-bit, otherwise it's going to crash on the ps2!
-	while (((reinterpret_cast<uintptr_t>(pDestination) & 0x03)!=0) && (byteCount>0))
-	{
-		byteCount--;
-		// rotate the values over
-		#if defined(EA_SYSTEM_BIG_ENDIAN)
-			*(pDestination++)=static_cast<uint8_t>(val32a >> 24);
-			unsigned int tmp = val32a;
-			val32a=(val32a << 8) + (val32b >> 24);
-			val32b=(val32b << 8) + (val32c >> 24);
-			val32c=(val32c << 8) + (tmp >> 24);
-		#else
-			*(pDestination++)=static_cast<uint8_t>(val32a);
-			unsigned int tmp = val32a;
-			val32a=(val32a >> 8) + (val32b << 24);
-			val32b=(val32b >> 8) + (val32c << 24);
-			val32c=(val32c >> 8) + (tmp << 24);
-		#endif
-	}
+EASTDC_API const void* Memcheck16(const void* p, uint16_t c, size_t byteCount)
+{
+	return MemcheckValue(p, &c, sizeof(c), byteCount);
+}
 
-	while (byteCount >= 12)
-	{
-		*(reinterpret_cast<unsigned int*>(pDestination)) = val32a;
-		*(reinterpret_cast<unsigned int*>(pDestination+4)) = val32b;
-		*(reinterpret_cast<unsigned int*>(pDestination+8)) = val32c;
-		pDestination+=12;
-		byteCount-=12;
-	}
-	while (byteCount >= 4)
-	{
-		*(reinterpret_cast<unsigned int*>(pDestination)) = val32a;
-		pDestination+=4;
-		byteCount-=4;
-		val32a=val32b;
-		val32b=val32c;
-	}
-	while (byteCount >= 1)
-	{
-		#if defined(EA_SYSTEM_BIG_ENDIAN)
-			*pDestination = static_cast<uint8_t>(val32a >> 24);
-			val32a = val32a << 8;
-		#else
-			*pDestination = static_cast<uint8_t>(val32a);
-			val32a = val32a >> 8;
-		#endif
-		pDestination++;
-		byteCount--;
-	}
+
+EASTDC_API const void* Memcheck32(const void* p, uint32_t c, size_t byteCount)
+{
+	return MemcheckValue(p, &c, sizeof(c), byteCount);
 }
 
-// This is a local function called by MemfillSpecific.
-static void MemfillAny(void* pD, const void* pS, size_t destByteCount, size_t sourceByteCount)
+
+EASTDC_API const void* Memcheck64(const void* p, uint64_t c, size_t byteCount)
 {
-	union Memory // Use a union to avoid memory aliasing problems in the compiler.
-	{
-		void*     mpVoid;
-		uint8_t*  mp8;
-		uint32_t* mp32;
-		uint32_t  m32;
-	};
+	return MemcheckValue(p, &c, sizeof(c), byteCount);
+}
 
-	Memory d;
-	d.mpVoid = pD;
 
-	Memory s;
-	s.mpVoid = const_cast<void*>(pS);
 
-	if (((sourceByteCount & 0x03) == 0) && ((d.m32 & 0x03) == 0) && ((s.m32 & 0x03) == 0))
+
+// Memchr kernels, called by Memchr via the CPU dispatch table.
+// The SIMD pathways read the first vector unaligned and then continue with aligned 
+// loads from the next vector boundary, rereading a few bytes in the process. The 
+// last partial vector is handled by rereading the vector that ends at p + nCharCount.
+namespace Internal
+{
+	const char* MemchrScalar(const char* p, char c, size_t nCharCount)
 	{
-		// Routine for 32-bit aligned copy
-		size_t i = 0;
-		
-		while (destByteCount >= 4)
+		for(const char* p8 = (const char*)p; nCharCount > 0; ++p8, --nCharCount)
 		{
-			s.mpVoid = const_cast<void*>(pS);
-
-			for (i = 0; (i < sourceByteCount) && (destByteCount >= 4); i += 4, destByteCount -= 4)
-				*d.mp32++ = *s.mp32++;
+			if(*p8 == c)
+				return p8;
 		}
 
-		if (i == sourceByteCount)
-			i = 0;
+		return NULL;
+	}
 
-		s.mpVoid = const_cast<void*>(pS);
-		s.mp8   += i;
 
-		while (destByteCount >= 1)
-		{
-			*d.mp8++ = *s.mp8++;
-			destByteCount--;
-		}
-	}
-	else
-	{
-		// Routine for non 32-bit aligned copy
-		while (destByteCount)
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 const char* MemchrSSE2(const char* p, char c, size_t nCharCount)
 		{
-			s.mpVoid = const_cast<void*>(pS);
+			if(nCharCount < 16)
+				return MemchrScalar(p, c, nCharCount);
 
-			for (size_t i = 0; (i < sourceByteCount) && destByteCount; i++)
+			const __m128i  c16  = _mm_set1_epi8(c);
+			const char*    pEnd = p + nCharCount;
+			uint32_t       mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), c16));
+
+			if(mask)
+				return p + CountTrailing0Bits(mask);
+
+			const char* p8 = (const char*)(((uintptr_t)p + 16) & ~(uintptr_t)15);
+
+			for(; (size_t)(pEnd - p8) >= 64; p8 += 64)
 			{
-				*d.mp8++ = *s.mp8++;
-				destByteCount--;
+				const __m128i eqA = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8)),      c16);
+				const __m128i eqB = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8 + 16)), c16);
+				const __m128i eqC = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8 + 32)), c16);
+				const __m128i eqD = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8 + 48)), c16);
+
+				if(EA_UNLIKELY(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(eqA, eqB), _mm_or_si128(eqC, eqD)))))
+					break;
 			}
-		}
-	}
-}
 
+			for(; (size_t)(pEnd - p8) >= 16; p8 += 16)
+			{
+				mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(p8)), c16));
 
-// This is a local function called by MemfillSpecific.
-static void Memfill128(void* pD, const void* pS, size_t byteCount)
-{
-	unsigned char* pDestination = static_cast<unsigned char*>(pD);
-	const unsigned char* pSource = static_cast<const unsigned char*>(pS);
-	unsigned int v1;
-	unsigned int v2;
-	unsigned int v3;
-	unsigned int v4;
+				if(mask)
+					return p8 + CountTrailing0Bits(mask);
+			}
 
-	if ((reinterpret_cast<uintptr_t>(pSource) & 0x3) != 0)
-	{
-		// If the source is not aligned, we need to retrieve the values on a byte by byte basis
+			if(p8 != pEnd)
+			{
+				p8   = pEnd - 16;
+				mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p8)), c16));
+
+				if(mask)
+					return p8 + CountTrailing0Bits(mask);
+			}
+
+			return NULL;
+		}
+
+
+		EASTDC_TARGET_AVX2 const char* MemchrAVX2(const char* p, char c, size_t nCharCount)
+		{
+			if(nCharCount < 32)
+				return MemchrSSE2(p, c, nCharCount);
+
+			const __m256i  c32  = _mm256_set1_epi8(c);
+			const char*    pEnd = p + nCharCount;
+			uint32_t       mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), c32));
+
+			if(mask)
+				return p + CountTrailing0Bits(mask);
+
+			const char* p8 = (const char*)(((uintptr_t)p + 32) & ~(uintptr_t)31);
+
+			for(; (size_t)(pEnd - p8) >= 64; p8 += 64)
+			{
+				const __m256i eqA = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(p8)),      c32);
+				const __m256i eqB = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(p8 + 32)), c32);
+
+				if(EA_UNLIKELY(_mm256_movemask_epi8(_mm256_or_si256(eqA, eqB))))
+					break;
+			}
+
+			for(; (size_t)(pEnd - p8) >= 32; p8 += 32)
+			{
+				mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(p8)), c32));
+
+				if(mask)
+					return p8 + CountTrailing0Bits(mask);
+			}
+
+			if(p8 != pEnd)
+			{
+				p8   = pEnd - 32;
+				mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p8)), c32));
+
+				if(mask)
+					return p8 + CountTrailing0Bits(mask);
+			}
+
+			return NULL;
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API const char* Memchr(const char* p, char c, size_t nCharCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemchr(p, c, nCharCount);
+}
+
+
+// Memchr16, Memchr32, Memrchr and MemchrAny kernels, called via the CPU dispatch table.
+// The forward searches use unaligned loads, as char16_t and char32_t arrays aren't necessarily 
+// aligned to the vector size (or even to the element size). The last partial vector is handled 
+// by rereading the vector that ends at p + nCharCount. The reverse searches work the same way from 
+// the other end, with the first partial vector masked to the elements not yet examined. 
+// Comparisons of wider elements produce sizeof(T) mask bits per element, so a bit index is 
+// converted to an element index by dividing by sizeof(T).
+namespace Internal
+{
+	template <typename T>
+	static const T* MemchrScalarT(const T* p, T c, size_t nCharCount)
+	{
+		for(; nCharCount > 0; ++p, --nCharCount)
+		{
+			if(*p == c)
+				return p;
+		}
+
+		return NULL;
+	}
+
+	template <typename T>
+	static const T* MemrchrScalarT(const T* p, T c, size_t nCharCount)
+	{
+		for(const T* pCurrent = p + nCharCount; pCurrent != p; )
+		{
+			if(*--pCurrent == c)
+				return pCurrent;
+		}
+
+		return NULL;
+	}
+
+	const char16_t* Memchr16Scalar(const char16_t* p, char16_t c, size_t nCharCount) { return MemchrScalarT(p, c, nCharCount); }
+	const char32_t* Memchr32Scalar(const char32_t* p, char32_t c, size_t nCharCount) { return MemchrScalarT(p, c, nCharCount); }
+	const char*     MemrchrScalar (const char* p, char c, size_t nCharCount)         { return MemrchrScalarT(p, c, nCharCount); }
+	const char16_t* Memrchr16Scalar(const char16_t* p, char16_t c, size_t nCharCount){ return MemrchrScalarT(p, c, nCharCount); }
+	const char32_t* Memrchr32Scalar(const char32_t* p, char32_t c, size_t nCharCount){ return MemrchrScalarT(p, c, nCharCount); }
+
+	const char* MemchrAnyScalar(const char* p, size_t nCharCount, const char* pSet, size_t setCount)
+	{
+		uint32_t bitmap[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+		for(size_t i = 0; i < setCount; i++)
+			bitmap[(uint8_t)pSet[i] >> 5] |= (1u << ((uint8_t)pSet[i] & 31));
+
+		for(; nCharCount > 0; ++p, --nCharCount)
+		{
+			if(bitmap[(uint8_t)*p >> 5] & (1u << ((uint8_t)*p & 31)))
+				return p;
+		}
+
+		return NULL;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 static inline __m128i MemchrSplatSSE2(char c)     { return _mm_set1_epi8(c); }
+		EASTDC_TARGET_SSE2 static inline __m128i MemchrSplatSSE2(char16_t c) { return _mm_set1_epi16((short)c); }
+		EASTDC_TARGET_SSE2 static inline __m128i MemchrSplatSSE2(char32_t c) { return _mm_set1_epi32((int)c); }
+
+		EASTDC_TARGET_SSE2 static inline __m128i MemchrEqualSSE2(__m128i a, __m128i b, char)     { return _mm_cmpeq_epi8(a, b);  }
+		EASTDC_TARGET_SSE2 static inline __m128i MemchrEqualSSE2(__m128i a, __m128i b, char16_t) { return _mm_cmpeq_epi16(a, b); }
+		EASTDC_TARGET_SSE2 static inline __m128i MemchrEqualSSE2(__m128i a, __m128i b, char32_t) { return _mm_cmpeq_epi32(a, b); }
+
+		template <typename T>
+		EASTDC_TARGET_SSE2 static inline uint32_t MemchrMaskSSE2(const T* p, __m128i cv)
+		{
+			return (uint32_t)_mm_movemask_epi8(MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), cv, T()));
+		}
+
+		template <typename T>
+		EASTDC_TARGET_SSE2 static const T* MemchrSSE2T(const T* p, T c, size_t nCharCount)
+		{
+			const size_t kVectorCount = 16 / sizeof(T);
+
+			if(nCharCount < kVectorCount)
+				return MemchrScalarT(p, c, nCharCount);
+
+			const __m128i cv   = MemchrSplatSSE2(c);
+			const T*      pEnd = p + nCharCount;
+			uint32_t      mask;
+
+			for(; (size_t)(pEnd - p) >= (kVectorCount * 4); p += (kVectorCount * 4))
+			{
+				const __m128i eqA = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),                      cv, T());
+				const __m128i eqB = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + kVectorCount)),       cv, T());
+				const __m128i eqC = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + (kVectorCount * 2))), cv, T());
+				const __m128i eqD = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + (kVectorCount * 3))), cv, T());
+
+				if(EA_UNLIKELY(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(eqA, eqB), _mm_or_si128(eqC, eqD)))))
+					break;
+			}
+
+			for(; (size_t)(pEnd - p) >= kVectorCount; p += kVectorCount)
+			{
+				if((mask = MemchrMaskSSE2(p, cv)) != 0)
+					return p + (CountTrailing0Bits(mask) / sizeof(T));
+			}
+
+			if(p != pEnd)
+			{
+				p = pEnd - kVectorCount;
+
+				if((mask = MemchrMaskSSE2(p, cv)) != 0)
+					return p + (CountTrailing0Bits(mask) / sizeof(T));
+			}
+
+			return NULL;
+		}
+
+		template <typename T>
+		EASTDC_TARGET_SSE2 static const T* MemrchrSSE2T(const T* p, T c, size_t nCharCount)
+		{
+			const size_t kVectorCount = 16 / sizeof(T);
+
+			if(nCharCount < kVectorCount)
+				return MemrchrScalarT(p, c, nCharCount);
+
+			const __m128i cv   = MemchrSplatSSE2(c);
+			const T*      pEnd = p + nCharCount; // Everything at and after pEnd has been examined.
+			uint32_t      mask;
+
+			for(; (size_t)(pEnd - p) >= (kVectorCount * 4); pEnd -= (kVectorCount * 4))
+			{
+				const __m128i eqA = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pEnd - (kVectorCount * 4))), cv, T());
+				const __m128i eqB = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pEnd - (kVectorCount * 3))), cv, T());
+				const __m128i eqC = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pEnd - (kVectorCount * 2))), cv, T());
+				const __m128i eqD = MemchrEqualSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pEnd - kVectorCount)),       cv, T());
+
+				if(EA_UNLIKELY(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(eqA, eqB), _mm_or_si128(eqC, eqD)))))
+					break;
+			}
+
+			for(; (size_t)(pEnd - p) >= kVectorCount; pEnd -= kVectorCount)
+			{
+				if((mask = MemchrMaskSSE2(pEnd - kVectorCount, cv)) != 0)
+					return pEnd - kVectorCount + ((31 - CountLeading0Bits(mask)) / sizeof(T));
+			}
+
+			if(p != pEnd)
+			{
+				mask = MemchrMaskSSE2(p, cv) & ((1u << ((size_t)(pEnd - p) * sizeof(T))) - 1);
+
+				if(mask)
+					return p + ((31 - CountLeading0Bits(mask)) / sizeof(T));
+			}
+
+			return NULL;
+		}
+
+		EASTDC_TARGET_SSE2 const char16_t* Memchr16SSE2(const char16_t* p, char16_t c, size_t nCharCount) { return MemchrSSE2T(p, c, nCharCount); }
+		EASTDC_TARGET_SSE2 const char32_t* Memchr32SSE2(const char32_t* p, char32_t c, size_t nCharCount) { return MemchrSSE2T(p, c, nCharCount); }
+		EASTDC_TARGET_SSE2 const char*     MemrchrSSE2 (const char* p, char c, size_t nCharCount)         { return MemrchrSSE2T(p, c, nCharCount); }
+		EASTDC_TARGET_SSE2 const char16_t* Memrchr16SSE2(const char16_t* p, char16_t c, size_t nCharCount){ return MemrchrSSE2T(p, c, nCharCount); }
+		EASTDC_TARGET_SSE2 const char32_t* Memrchr32SSE2(const char32_t* p, char32_t c, size_t nCharCount){ return MemrchrSSE2T(p, c, nCharCount); }
+
+
+		EASTDC_TARGET_AVX2 static inline __m256i MemchrSplatAVX2(char c)     { return _mm256_set1_epi8(c); }
+		EASTDC_TARGET_AVX2 static inline __m256i MemchrSplatAVX2(char16_t c) { return _mm256_set1_epi16((short)c); }
+		EASTDC_TARGET_AVX2 static inline __m256i MemchrSplatAVX2(char32_t c) { return _mm256_set1_epi32((int)c); }
+
+		EASTDC_TARGET_AVX2 static inline __m256i MemchrEqualAVX2(__m256i a, __m256i b, char)     { return _mm256_cmpeq_epi8(a, b);  }
+		EASTDC_TARGET_AVX2 static inline __m256i MemchrEqualAVX2(__m256i a, __m256i b, char16_t) { return _mm256_cmpeq_epi16(a, b); }
+		EASTDC_TARGET_AVX2 static inline __m256i MemchrEqualAVX2(__m256i a, __m256i b, char32_t) { return _mm256_cmpeq_epi32(a, b); }
+
+		template <typename T>
+		EASTDC_TARGET_AVX2 static inline uint32_t MemchrMaskAVX2(const T* p, __m256i cv)
+		{
+			return (uint32_t)_mm256_movemask_epi8(MemchrEqualAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), cv, T()));
+		}
+
+		template <typename T>
+		EASTDC_TARGET_AVX2 static const T* MemchrAVX2T(const T* p, T c, size_t nCharCount)
+		{
+			const size_t kVectorCount = 32 / sizeof(T);
+
+			if(nCharCount < kVectorCount)
+				return MemchrSSE2T(p, c, nCharCount);
+
+			const __m256i cv   = MemchrSplatAVX2(c);
+			const T*      pEnd = p + nCharCount;
+			uint32_t      mask;
+
+			for(; (size_t)(pEnd - p) >= (kVectorCount * 2); p += (kVectorCount * 2))
+			{
+				const __m256i eqA = MemchrEqualAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),                cv, T());
+				const __m256i eqB = MemchrEqualAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + kVectorCount)), cv, T());
+
+				if(EA_UNLIKELY(_mm256_movemask_epi8(_mm256_or_si256(eqA, eqB))))
+					break;
+			}
+
+			for(; (size_t)(pEnd - p) >= kVectorCount; p += kVectorCount)
+			{
+				if((mask = MemchrMaskAVX2(p, cv)) != 0)
+					return p + (CountTrailing0Bits(mask) / sizeof(T));
+			}
+
+			if(p != pEnd)
+			{
+				p = pEnd - kVectorCount;
+
+				if((mask = MemchrMaskAVX2(p, cv)) != 0)
+					return p + (CountTrailing0Bits(mask) / sizeof(T));
+			}
+
+			return NULL;
+		}
+
+		template <typename T>
+		EASTDC_TARGET_AVX2 static const T* MemrchrAVX2T(const T* p, T c, size_t nCharCount)
+		{
+			const size_t kVectorCount = 32 / sizeof(T);
+
+			if(nCharCount < kVectorCount)
+				return MemrchrSSE2T(p, c, nCharCount);
+
+			const __m256i cv   = MemchrSplatAVX2(c);
+			const T*      pEnd = p + nCharCount; // Everything at and after pEnd has been examined.
+			uint32_t      mask;
+
+			for(; (size_t)(pEnd - p) >= (kVectorCount * 2); pEnd -= (kVectorCount * 2))
+			{
+				const __m256i eqA = MemchrEqualAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pEnd - (kVectorCount * 2))), cv, T());
+				const __m256i eqB = MemchrEqualAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pEnd - kVectorCount)),       cv, T());
+
+				if(EA_UNLIKELY(_mm256_movemask_epi8(_mm256_or_si256(eqA, eqB))))
+					break;
+			}
+
+			for(; (size_t)(pEnd - p) >= kVectorCount; pEnd -= kVectorCount)
+			{
+				if((mask = MemchrMaskAVX2(pEnd - kVectorCount, cv)) != 0)
+					return pEnd - kVectorCount + ((31 - CountLeading0Bits(mask)) / sizeof(T));
+			}
+
+			if(p != pEnd)
+			{
+				mask = MemchrMaskAVX2(p, cv) & ((1u << ((size_t)(pEnd - p) * sizeof(T))) - 1);
+
+				if(mask)
+					return p + ((31 - CountLeading0Bits(mask)) / sizeof(T));
+			}
+
+			return NULL;
+		}
+
+		EASTDC_TARGET_AVX2 const char16_t* Memchr16AVX2(const char16_t* p, char16_t c, size_t nCharCount) { return MemchrAVX2T(p, c, nCharCount); }
+		EASTDC_TARGET_AVX2 const char32_t* Memchr32AVX2(const char32_t* p, char32_t c, size_t nCharCount) { return MemchrAVX2T(p, c, nCharCount); }
+		EASTDC_TARGET_AVX2 const char*     MemrchrAVX2 (const char* p, char c, size_t nCharCount)         { return MemrchrAVX2T(p, c, nCharCount); }
+		EASTDC_TARGET_AVX2 const char16_t* Memrchr16AVX2(const char16_t* p, char16_t c, size_t nCharCount){ return MemrchrAVX2T(p, c, nCharCount); }
+		EASTDC_TARGET_AVX2 const char32_t* Memrchr32AVX2(const char32_t* p, char32_t c, size_t nCharCount){ return MemrchrAVX2T(p, c, nCharCount); }
+
+
+		// MemchrAny with SSE2 compares each vector against each member of the set, which is 
+		// worthwhile for small sets only. With SSSE3 and later, a byte b is looked up in two 16 byte 
+		// tables indexed by its low nibble, one for each value of its top bit. Bit (b >> 4) & 7 of the 
+		// entry is set if b is in the set. pshufb yields zero for index bytes with the top bit set, 
+		// which selects between the two tables. That handles sets of any size at a constant cost.
+		const size_t kMemchrAnySSE2SetMax = 8;
+
+		EASTDC_TARGET_SSE2 const char* MemchrAnySSE2(const char* p, size_t nCharCount, const char* pSet, size_t setCount)
+		{
+			if((nCharCount < 16) || (setCount > kMemchrAnySSE2SetMax) || (setCount == 0))
+				return MemchrAnyScalar(p, nCharCount, pSet, setCount);
+
+			__m128i     setVectors[kMemchrAnySSE2SetMax];
+			const char* pEnd = p + nCharCount;
+
+			for(size_t i = 0; i < setCount; i++)
+				setVectors[i] = _mm_set1_epi8(pSet[i]);
+
+			for(const char* pCurrent = p; ; pCurrent += 16)
+			{
+				if((size_t)(pEnd - pCurrent) < 16)
+				{
+					if(pCurrent == pEnd)
+						return NULL;
+					pCurrent = pEnd - 16;
+				}
+
+				const __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCurrent));
+				__m128i       eq = _mm_cmpeq_epi8(v, setVectors[0]);
+
+				for(size_t i = 1; i < setCount; i++)
+					eq = _mm_or_si128(eq, _mm_cmpeq_epi8(v, setVectors[i]));
+
+				const uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+
+				if(mask)
+					return pCurrent + CountTrailing0Bits(mask);
+			}
+		}
+
+
+		// Builds the two nibble tables described above.
+		static void MemchrAnyBuildTables(const char* pSet, size_t setCount, uint8_t* pTableLow, uint8_t* pTableHigh)
+		{
+			memset(pTableLow,  0, 16);
+			memset(pTableHigh, 0, 16);
+
+			for(size_t i = 0; i < setCount; i++)
+			{
+				const uint8_t b = (uint8_t)pSet[i];
+				((b & 0x80) ? pTableHigh : pTableLow)[b & 0x0f] |= (uint8_t)(1u << ((b >> 4) & 7));
+			}
+		}
+
+
+		EASTDC_TARGET_SSE42 static inline uint32_t MemchrAnyMaskSSE42(const char* p, __m128i tableLow, __m128i tableHigh)
+		{
+			const __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i bits = _mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x07)));
+			const __m128i t    = _mm_or_si128(_mm_shuffle_epi8(tableLow, v), _mm_shuffle_epi8(tableHigh, _mm_xor_si128(v, _mm_set1_epi8(-128))));
+
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(t, bits), bits));
+		}
+
+		EASTDC_TARGET_SSE42 const char* MemchrAnySSE42(const char* p, size_t nCharCount, const char* pSet, size_t setCount)
+		{
+			if(nCharCount < 16)
+				return MemchrAnyScalar(p, nCharCount, pSet, setCount);
+
+			EA_PREFIX_ALIGN(16) uint8_t tableLow[16]  EA_POSTFIX_ALIGN(16);
+			EA_PREFIX_ALIGN(16) uint8_t tableHigh[16] EA_POSTFIX_ALIGN(16);
+			MemchrAnyBuildTables(pSet, setCount, tableLow, tableHigh);
+
+			const __m128i tl   = _mm_load_si128(reinterpret_cast<const __m128i*>(tableLow));
+			const __m128i th   = _mm_load_si128(reinterpret_cast<const __m128i*>(tableHigh));
+			const char*   pEnd = p + nCharCount;
+
+			for(const char* pCurrent = p; ; pCurrent += 16)
+			{
+				if((size_t)(pEnd - pCurrent) < 16)
+				{
+					if(pCurrent == pEnd)
+						return NULL;
+					pCurrent = pEnd - 16;
+				}
+
+				const uint32_t mask = MemchrAnyMaskSSE42(pCurrent, tl, th);
+
+				if(mask)
+					return pCurrent + CountTrailing0Bits(mask);
+			}
+		}
+
+
+		EASTDC_TARGET_AVX2 static inline uint32_t MemchrAnyMaskAVX2(const char* p, __m256i tableLow, __m256i tableHigh)
+		{
+			const __m256i v    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			const __m256i bits = _mm256_shuffle_epi8(_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), 
+			                                         _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x07)));
+			const __m256i t    = _mm256_or_si256(_mm256_shuffle_epi8(tableLow, v), _mm256_shuffle_epi8(tableHigh, _mm256_xor_si256(v, _mm256_set1_epi8(-128))));
+
+			return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(t, bits), bits));
+		}
+
+		EASTDC_TARGET_AVX2 const char* MemchrAnyAVX2(const char* p, size_t nCharCount, const char* pSet, size_t setCount)
+		{
+			if(nCharCount < 32)
+				return MemchrAnySSE42(p, nCharCount, pSet, setCount);
+
+			EA_PREFIX_ALIGN(16) uint8_t tableLow[16]  EA_POSTFIX_ALIGN(16);
+			EA_PREFIX_ALIGN(16) uint8_t tableHigh[16] EA_POSTFIX_ALIGN(16);
+			MemchrAnyBuildTables(pSet, setCount, tableLow, tableHigh);
+
+			const __m256i tl   = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tableLow)));  // pshufb works within each 16 byte lane,
+			const __m256i th   = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tableHigh))); // so each lane needs a copy of the table.
+			const char*   pEnd = p + nCharCount;
+
+			for(const char* pCurrent = p; ; pCurrent += 32)
+			{
+				if((size_t)(pEnd - pCurrent) < 32)
+				{
+					if(pCurrent == pEnd)
+						return NULL;
+					pCurrent = pEnd - 32;
+				}
+
+				const uint32_t mask = MemchrAnyMaskAVX2(pCurrent, tl, th);
+
+				if(mask)
+					return pCurrent + CountTrailing0Bits(mask);
+			}
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API const char16_t* Memchr16(const char16_t* pString, char16_t c, size_t nCharCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemchr16(pString, c, nCharCount);
+}
+
+
+EASTDC_API const char32_t* Memchr32(const char32_t* pString, char32_t c, size_t nCharCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemchr32(pString, c, nCharCount);
+}
+
+
+#if EASTDC_MEMCHR16_ENABLED
+	EASTDC_API const char16_t* Memchr(const char16_t* pString, char16_t c, size_t nCharCount)
+	{
+		return Memchr16(pString, c, nCharCount);
+	}
+#endif
+
+
+EASTDC_API const char* MemchrAny(const char* p, size_t nCharCount, const char* pSet, size_t setCount)
+{
+	if(setCount == 1)
+		return Memchr(p, pSet[0], nCharCount);
+
+	return Internal::GetCPUDispatchTable().mpMemchrAny(p, nCharCount, pSet, setCount);
+}
+
+
+EASTDC_API const char* Memrchr(const char* p, char c, size_t nCharCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemrchr(p, c, nCharCount);
+}
+
+
+EASTDC_API const char16_t* Memrchr16(const char16_t* pString, char16_t c, size_t nCharCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemrchr16(pString, c, nCharCount);
+}
+
+
+EASTDC_API const char32_t* Memrchr32(const char32_t* pString, char32_t c, size_t nCharCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemrchr32(pString, c, nCharCount);
+}
+
+
+// MemcmpFindDifference kernels, called by Memcmp via the CPU dispatch table.
+// Return the offset of the first byte that differs between p1 and p2, or byteCount if 
+// there is no difference. The SIMD pathways compare a full vector at a time with unaligned 
+// loads and locate the first mismatching lane with movemask + ctz. If byteCount isn't a 
+// multiple of the vector size then the last vector is re-read so that it ends exactly at 
+// byteCount. That overlaps bytes already known to be equal and so can't change the result.
+namespace Internal
+{
+	size_t MemcmpFindDifferenceScalar(const void* p1, const void* p2, size_t byteCount)
+	{
+		const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+		const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+		size_t i = 0;
+
+		for(; i < byteCount; ++i)
+		{
+			if(p18[i] != p28[i])
+				break;
+		}
+
+		return i;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 size_t MemcmpFindDifferenceSSE2(const void* p1, const void* p2, size_t byteCount)
+		{
+			if(byteCount < 16)
+				return MemcmpFindDifferenceScalar(p1, p2, byteCount);
+
+			const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+			size_t i = 0;
+
+			for(; (i + 32) <= byteCount; i += 32)
+			{
+				const __m128i eqA = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i)),      _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i)));
+				const __m128i eqB = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i + 16)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i + 16)));
+
+				if(EA_UNLIKELY(_mm_movemask_epi8(_mm_and_si128(eqA, eqB)) != 0xffff))
+				{
+					const uint32_t maskA = (uint32_t)_mm_movemask_epi8(eqA) ^ 0xffff;
+					if(maskA)
+						return i + (size_t)CountTrailing0Bits(maskA);
+					return i + 16 + (size_t)CountTrailing0Bits((uint32_t)_mm_movemask_epi8(eqB) ^ 0xffff);
+				}
+			}
+
+			for(;;)
+			{
+				if((i + 16) > byteCount)
+				{
+					if(i == byteCount)
+						break;
+					i = byteCount - 16;
+				}
+
+				const __m128i  eq   = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i)));
+				const uint32_t mask = (uint32_t)_mm_movemask_epi8(eq) ^ 0xffff;
+
+				if(mask)
+					return i + (size_t)CountTrailing0Bits(mask);
+
+				i += 16;
+			}
+
+			return byteCount;
+		}
+
+
+		EASTDC_TARGET_AVX2 size_t MemcmpFindDifferenceAVX2(const void* p1, const void* p2, size_t byteCount)
+		{
+			if(byteCount < 32)
+				return MemcmpFindDifferenceSSE2(p1, p2, byteCount);
+
+			const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+			size_t i = 0;
+
+			for(; (i + 64) <= byteCount; i += 64)
+			{
+				const __m256i eqA = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i)),      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i)));
+				const __m256i eqB = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i + 32)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i + 32)));
+
+				if(EA_UNLIKELY((uint32_t)_mm256_movemask_epi8(_mm256_and_si256(eqA, eqB)) != 0xffffffff))
+				{
+					const uint32_t maskA = ~(uint32_t)_mm256_movemask_epi8(eqA);
+					if(maskA)
+						return i + (size_t)CountTrailing0Bits(maskA);
+					return i + 32 + (size_t)CountTrailing0Bits(~(uint32_t)_mm256_movemask_epi8(eqB));
+				}
+			}
+
+			for(;;)
+			{
+				if((i + 32) > byteCount)
+				{
+					if(i == byteCount)
+						break;
+					i = byteCount - 32;
+				}
+
+				const __m256i  eq   = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i)));
+				const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(eq);
+
+				if(mask)
+					return i + (size_t)CountTrailing0Bits(mask);
+
+				i += 32;
+			}
+
+			return byteCount;
+		}
+	#endif
+
+} // namespace Internal
+
+
+static inline size_t MemcmpFindDifference(const void* p1, const void* p2, size_t byteCount)
+{
+	return Internal::GetCPUDispatchTable().mpMemcmpFindDifference(p1, p2, byteCount);
+}
+
+
+EASTDC_API int Memcmp(const void* pString1, const void* pString2, size_t nCharCount)
+{
+	const uint8_t* p1 = static_cast<const uint8_t*>(pString1);
+	const uint8_t* p2 = static_cast<const uint8_t*>(pString2);
+	const size_t   i  = MemcmpFindDifference(p1, p2, nCharCount);
+
+	if(i == nCharCount)
+		return 0;
+
+	return (p1[i] < p2[i]) ? -1 : 1; // Bytes are compared as uint8_t, as with memcmp.
+}
+
+
+#if EASTDC_MEMCPY16_ENABLED
+	EASTDC_API int Memcmp(const char16_t* pString1, const char16_t* pString2, size_t nCharCount)
+	{
+		// A char16_t differs if and only if one of its bytes differs, so we can search bytewise
+		// and convert the first differing byte offset to a char16_t index.
+		const size_t i = MemcmpFindDifference(pString1, pString2, nCharCount * sizeof(char16_t)) / sizeof(char16_t);
+
+		if(i == nCharCount)
+			return 0;
+
+		return (pString1[i] < pString2[i]) ? -1 : 1;
+	}
+#endif
+
+
+// MemFindEqual kernels, called by MemDiffRanges via the CPU dispatch table.
+// Return the offset of the first byte that is equal in p1 and p2, or byteCount if there is none. 
+// These mirror the MemcmpFindDifference kernels above, with the sense of the comparison inverted.
+namespace Internal
+{
+	size_t MemFindEqualScalar(const void* p1, const void* p2, size_t byteCount)
+	{
+		const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+		const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+		size_t i = 0;
+
+		for(; i < byteCount; ++i)
+		{
+			if(p18[i] == p28[i])
+				break;
+		}
+
+		return i;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 size_t MemFindEqualSSE2(const void* p1, const void* p2, size_t byteCount)
+		{
+			if(byteCount < 16)
+				return MemFindEqualScalar(p1, p2, byteCount);
+
+			const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+			size_t i = 0;
+
+			for(;;)
+			{
+				if((i + 16) > byteCount)
+				{
+					if(i == byteCount)
+						break;
+					i = byteCount - 16;
+				}
+
+				const __m128i  eq   = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i)));
+				const uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+
+				if(mask)
+					return i + (size_t)CountTrailing0Bits(mask);
+
+				i += 16;
+			}
+
+			return byteCount;
+		}
+
+
+		EASTDC_TARGET_AVX2 size_t MemFindEqualAVX2(const void* p1, const void* p2, size_t byteCount)
+		{
+			if(byteCount < 32)
+				return MemFindEqualSSE2(p1, p2, byteCount);
+
+			const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+			size_t i = 0;
+
+			for(;;)
+			{
+				if((i + 32) > byteCount)
+				{
+					if(i == byteCount)
+						break;
+					i = byteCount - 32;
+				}
+
+				const __m256i  eq   = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i)));
+				const uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+
+				if(mask)
+					return i + (size_t)CountTrailing0Bits(mask);
+
+				i += 32;
+			}
+
+			return byteCount;
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API size_t MemFindDifference(const void* p1, const void* p2, size_t n)
+{
+	return MemcmpFindDifference(p1, p2, n);
+}
+
+
+EASTDC_API size_t MemDiffRanges(const void* p1, const void* p2, size_t n, MemDiffRange* pRangeArray, size_t rangeCapacity, size_t mergeGranularity)
+{
+	const Internal::CPUDispatchTable& table = Internal::GetCPUDispatchTable();
+	const uint8_t* const              p18   = static_cast<const uint8_t*>(p1);
+	const uint8_t* const              p28   = static_cast<const uint8_t*>(p2);
+	size_t                            rangeCount = 0;
+
+	// i is always the offset of a differing byte, or n.
+	for(size_t i = table.mpMemcmpFindDifference(p18, p28, n); i < n; )
+	{
+		const size_t begin = i;
+		size_t       end;
+
+		for(;;)
+		{
+			end = i + table.mpMemFindEqual(p18 + i, p28 + i, n - i);
+
+			if(end == n)
+			{
+				i = n;
+				break;
+			}
+
+			i = end + table.mpMemcmpFindDifference(p18 + end, p28 + end, n - end);
+
+			if((i == n) || ((i - end) >= mergeGranularity)) // If the run of equal bytes is long enough to end the range...
+				break;
+		}
+
+		if(rangeCount < rangeCapacity)
+		{
+			pRangeArray[rangeCount].mBegin = begin;
+			pRangeArray[rangeCount].mEnd   = end;
+		}
+
+		rangeCount++;
+	}
+
+	return rangeCount;
+}
+
+
+// Search for pFind/findSize within pMemory/memorySize.
+EASTDC_API void* Memmem(const void* pMemory, size_t memorySize, const void* pFind, size_t findSize)
+{
+	EA_ASSERT((pMemory || !memorySize) && (pFind || !findSize)); // Verify that if pMemory or pFind is NULL, their respective size must be 0.
+
+	if(memorySize && (findSize <= memorySize))
+	{
+		if(findSize) // An empty pFind results in success, return pMemory.
+			return MemmemSearcher(pFind, findSize).Search(pMemory, memorySize);
+		else
+			return const_cast<void*>(pMemory);
+	}
+
+	return NULL;
+}
+
+
+MemmemSearcher::MemmemSearcher()
+{
+	Init(NULL, 0);
+}
+
+
+MemmemSearcher::MemmemSearcher(const void* pFind, size_t findSize)
+{
+	Init(pFind, findSize);
+}
+
+
+// Computes the critical factorization of the pattern as per the two-way string matching 
+// algorithm (Crochemore and Perrin, "Two-way string-matching", Journal of the ACM 38(3), 1991).
+// The critical position is the larger of the two maximal suffix positions computed for 
+// each of the two orderings of the alphabet.
+void MemmemSearcher::Init(const void* pFind, size_t findSize)
+{
+	EA_ASSERT(pFind || !findSize);
+
+	mpFind       = static_cast<const uint8_t*>(pFind);
+	mFindSize    = findSize;
+	mCriticalPos = 0;
+	mPeriod      = 1;
+	mbPeriodic   = false;
+
+	if(findSize > 2) // The two-way search is only used for patterns of 3 or more bytes.
+	{
+		const uint8_t* const pFind8 = mpFind;
+		size_t maxSuffix, maxSuffixRev, j, k, p, period;
+
+		// Maximal suffix for the normal ordering. Note that maxSuffix starts at -1 and thus (maxSuffix + k) wraps around to k - 1.
+		maxSuffix = (size_t)-1; j = 0; k = p = 1;
+
+		while((j + k) < findSize)
+		{
+			const uint8_t a = pFind8[j + k];
+			const uint8_t b = pFind8[maxSuffix + k];
+
+			if(a < b)       { j += k; k = 1; p = j - maxSuffix; }
+			else if(a == b) { if(k != p) ++k; else { j += p; k = 1; } }
+			else            { maxSuffix = j++; k = p = 1; }
+		}
+		period = p;
+
+		// Maximal suffix for the reverse ordering.
+		maxSuffixRev = (size_t)-1; j = 0; k = p = 1;
+
+		while((j + k) < findSize)
+		{
+			const uint8_t a = pFind8[j + k];
+			const uint8_t b = pFind8[maxSuffixRev + k];
+
+			if(b < a)       { j += k; k = 1; p = j - maxSuffixRev; }
+			else if(a == b) { if(k != p) ++k; else { j += p; k = 1; } }
+			else            { maxSuffixRev = j++; k = p = 1; }
+		}
+
+		if((maxSuffixRev + 1) < (maxSuffix + 1))
+			mCriticalPos = maxSuffix + 1;
+		else
+		{
+			mCriticalPos = maxSuffixRev + 1;
+			period = p;
+		}
+
+		// If the left half of the pattern is a repetition of the period then we need to use 
+		// the variant of the algorithm which remembers how much of the right half matched.
+		if(((mCriticalPos + period) <= findSize) && (memcmp(pFind8, pFind8 + period, mCriticalPos) == 0))
+		{
+			mPeriod    = period;
+			mbPeriodic = true;
+		}
+		else
+			mPeriod = ((mCriticalPos > (findSize - mCriticalPos)) ? mCriticalPos : (findSize - mCriticalPos)) + 1;
+	}
+}
+
+
+// Searches from position onward with the two-way algorithm, which runs in linear 
+// time and constant space regardless of the contents of the pattern or the memory.
+const uint8_t* MemmemSearcher::SearchTwoWay(const uint8_t* pMemory, size_t memorySize, size_t position) const
+{
+	const uint8_t* const pFind8 = mpFind;
+	const size_t         findSize = mFindSize;
+	size_t               j = position;
+	size_t               i;
+
+	if(mbPeriodic)
+	{
+		size_t memory = 0; // How much of the right half is known to match due to the previous shift by the period.
+
+		while((j + findSize) <= memorySize)
+		{
+			// Scan the right half.
+			i = (mCriticalPos > memory) ? mCriticalPos : memory;
+			while((i < findSize) && (pFind8[i] == pMemory[i + j]))
+				++i;
+
+			if(i >= findSize)
+			{
+				// Scan the left half.
+				i = mCriticalPos - 1;
+				while((memory < (i + 1)) && (pFind8[i] == pMemory[i + j]))
+					--i;
+
+				if((i + 1) < (memory + 1))
+					return pMemory + j;
+
+				j     += mPeriod;
+				memory = findSize - mPeriod;
+			}
+			else
+			{
+				j     += (i - mCriticalPos + 1);
+				memory = 0;
+			}
+		}
+	}
+	else
+	{
+		while((j + findSize) <= memorySize)
+		{
+			// Scan the right half.
+			i = mCriticalPos;
+			while((i < findSize) && (pFind8[i] == pMemory[i + j]))
+				++i;
+
+			if(i >= findSize)
+			{
+				// Scan the left half.
+				i = mCriticalPos - 1;
+				while((i != (size_t)-1) && (pFind8[i] == pMemory[i + j]))
+					--i;
+
+				if(i == (size_t)-1)
+					return pMemory + j;
+
+				j += mPeriod;
+			}
+			else
+				j += (i - mCriticalPos + 1);
+		}
+	}
+
+	return NULL;
+}
+
+
+void* MemmemSearcher::Search(const void* pMemory, size_t memorySize) const
+{
+	EA_ASSERT(pMemory || !memorySize);
+
+	const uint8_t* const pMemory8 = static_cast<const uint8_t*>(pMemory);
+
+	if(!memorySize || (mFindSize > memorySize))
+		return NULL;
+
+	if(mFindSize == 0) // An empty pFind results in success, return pMemory.
+		return const_cast<void*>(pMemory);
+
+	if(mFindSize == 1)
+		return const_cast<char*>(Memchr(static_cast<const char*>(pMemory), (char)mpFind[0], memorySize));
+
+	// Candidate positions are those where both the first and the last byte of the pattern match.
+	// Each candidate is then verified with Memcmp. We count the bytes spent verifying, and if 
+	// that grows beyond a small multiple of the memory scanned (as happens with repetitive data
+	// such as long runs of the same byte) we continue with the two-way algorithm instead.
+	const Internal::CPUDispatchTable& table = Internal::GetCPUDispatchTable();
+	const uint8_t* const pFind8        = mpFind;
+	const size_t         lastPos       = mFindSize - 1;
+	const size_t         positionCount = memorySize - lastPos; // The number of positions at which the pattern can begin.
+	size_t               verifyCost    = 0;
+
+	for(size_t j = 0; (j = table.mpMemmemFindCandidate(pMemory8, j, positionCount, pFind8, lastPos)) < positionCount; ++j)
+	{
+		if(Memcmp(pMemory8 + j + 1, pFind8 + 1, mFindSize - 2) == 0)
+			return const_cast<uint8_t*>(pMemory8 + j);
+
+		verifyCost += mFindSize;
+
+		if(verifyCost > ((j * 4) + 4096))
+			return const_cast<uint8_t*>(SearchTwoWay(pMemory8, memorySize, j + 1));
+	}
+
+	return NULL;
+}
+
+
+// MemmemFindCandidate kernels, called by MemmemSearcher::Search via the CPU dispatch table.
+// Each returns the first position >= j and < positionCount at which both pFind8[0] and 
+// pFind8[lastPos] match, or positionCount if there is none. The SIMD pathways test a 
+// vector's worth of positions at a time by comparing two unaligned loads lastPos apart.
+namespace Internal
+{
+	size_t MemmemFindCandidateScalar(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos)
+	{
+		for(; j < positionCount; ++j)
+		{
+			if((pMemory8[j] == pFind8[0]) && (pMemory8[j + lastPos] == pFind8[lastPos]))
+				return j;
+		}
+
+		return positionCount;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 size_t MemmemFindCandidateSSE2(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos)
+		{
+			const __m128i first16 = _mm_set1_epi8((char)pFind8[0]);
+			const __m128i last16  = _mm_set1_epi8((char)pFind8[lastPos]);
+
+			for(; (j + 16) <= positionCount; j += 16)
+			{
+				const __m128i  eqFirst = _mm_cmpeq_epi8(first16, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pMemory8 + j)));
+				const __m128i  eqLast  = _mm_cmpeq_epi8(last16,  _mm_loadu_si128(reinterpret_cast<const __m128i*>(pMemory8 + j + lastPos)));
+				const uint32_t mask    = (uint32_t)_mm_movemask_epi8(_mm_and_si128(eqFirst, eqLast));
+
+				if(mask)
+					return j + (size_t)CountTrailing0Bits(mask);
+			}
+
+			return MemmemFindCandidateScalar(pMemory8, j, positionCount, pFind8, lastPos);
+		}
+
+
+		EASTDC_TARGET_AVX2 size_t MemmemFindCandidateAVX2(const uint8_t* pMemory8, size_t j, size_t positionCount, const uint8_t* pFind8, size_t lastPos)
+		{
+			const __m256i first32 = _mm256_set1_epi8((char)pFind8[0]);
+			const __m256i last32  = _mm256_set1_epi8((char)pFind8[lastPos]);
+
+			for(; (j + 32) <= positionCount; j += 32)
+			{
+				const __m256i  eqFirst = _mm256_cmpeq_epi8(first32, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pMemory8 + j)));
+				const __m256i  eqLast  = _mm256_cmpeq_epi8(last32,  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pMemory8 + j + lastPos)));
+				const uint32_t mask    = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(eqFirst, eqLast));
+
+				if(mask)
+					return j + (size_t)CountTrailing0Bits(mask);
+			}
+
+			return MemmemFindCandidateSSE2(pMemory8, j, positionCount, pFind8, lastPos);
+		}
+	#endif
+
+} // namespace Internal
+
+
+// This is a local function called by MemfillSpecific.
+static void Memfill24(void* pD, const void* pS, size_t byteCount)
+{
+	unsigned char* pDestination = static_cast<unsigned char*>(pD);
+	const unsigned char* pSource = static_cast<const unsigned char*>(pS);
+	// Optimization wise, this function will assume that pDestination is already aligned 32-bit
+	// Construct the 3 32-bit values
+	unsigned int val8a = *(static_cast<const unsigned char*>(pSource));
+	unsigned int val8b = *(static_cast<const unsigned char*>(pSource+1));
+	unsigned int val8c = *(static_cast<const unsigned char*>(pSource+2));
+	unsigned int val32a,val32b,val32c;
+
+	#if defined(EA_SYSTEM_BIG_ENDIAN)
+		val32a=(val8a*256*256*256)+(val8b*256*256)+(val8c*256)+val8a;
+		val32b=(val8b*256*256*256)+(val8c*256*256)+(val8a*256)+val8b;
+		val32c=(val8c*256*256*256)+(val8a*256*256)+(val8b*256)+val8c;
+	#else
+		val32a=val8a+(val8b*256)+(val8c*256*256)+(val8a*256*256*256);
+		val32b=val8b+(val8c*256)+(val8a*256*256)+(val8b*256*256*256);
+		val32c=val8c+(val8a*256)+(val8b*256*256)+(val8c*256*256*256);
+	#endif
+
+	// time to copy
+	// we have to align the address to 32-bit, otherwise it's going to crash on the ps2!
+	while (((reinterpret_cast<uintptr_t>(pDestination) & 0x03)!=0) && (byteCount>0))
+	{
+		byteCount--;
+		// rotate the values over
+		#if defined(EA_SYSTEM_BIG_ENDIAN)
+			*(pDestination++)=static_cast<uint8_t>(val32a >> 24);
+			unsigned int tmp = val32a;
+			val32a=(val32a << 8) + (val32b >> 24);
+			val32b=(val32b << 8) + (val32c >> 24);
+			val32c=(val32c << 8) + (tmp >> 24);
+		#else
+			*(pDestination++)=static_cast<uint8_t>(val32a);
+			unsigned int tmp = val32a;
+			val32a=(val32a >> 8) + (val32b << 24);
+			val32b=(val32b >> 8) + (val32c << 24);
+			val32c=(val32c >> 8) + (tmp << 24);
+		#endif
+	}
+
+	while (byteCount >= 12)
+	{
+		*(reinterpret_cast<unsigned int*>(pDestination)) = val32a;
+		*(reinterpret_cast<unsigned int*>(pDestination+4)) = val32b;
+		*(reinterpret_cast<unsigned int*>(pDestination+8)) = val32c;
+		pDestination+=12;
+		byteCount-=12;
+	}
+	while (byteCount >= 4)
+	{
+		*(reinterpret_cast<unsigned int*>(pDestination)) = val32a;
+		pDestination+=4;
+		byteCount-=4;
+		val32a=val32b;
+		val32b=val32c;
+	}
+	while (byteCount >= 1)
+	{
+		#if defined(EA_SYSTEM_BIG_ENDIAN)
+			*pDestination = static_cast<uint8_t>(val32a >> 24);
+			val32a = val32a << 8;
+		#else
+			*pDestination = static_cast<uint8_t>(val32a);
+			val32a = val32a >> 8;
+		#endif
+		pDestination++;
+		byteCount--;
+	}
+}
+
+// This is a local function called by MemfillSpecific.
+static void MemfillAny(void* pD, const void* pS, size_t destByteCount, size_t sourceByteCount)
+{
+	union Memory // Use a union to avoid memory aliasing problems in the compiler.
+	{
+		void*     mpVoid;
+		uint8_t*  mp8;
+		uint32_t* mp32;
+		uint32_t  m32;
+	};
+
+	Memory d;
+	d.mpVoid = pD;
+
+	Memory s;
+	s.mpVoid = const_cast<void*>(pS);
+
+	if (((sourceByteCount & 0x03) == 0) && ((d.m32 & 0x03) == 0) && ((s.m32 & 0x03) == 0))
+	{
+		// Routine for 32-bit aligned copy
+		size_t i = 0;
+		
+		while (destByteCount >= 4)
+		{
+			s.mpVoid = const_cast<void*>(pS);
+
+			for (i = 0; (i < sourceByteCount) && (destByteCount >= 4); i += 4, destByteCount -= 4)
+				*d.mp32++ = *s.mp32++;
+		}
+
+		if (i == sourceByteCount)
+			i = 0;
+
+		s.mpVoid = const_cast<void*>(pS);
+		s.mp8   += i;
+
+		while (destByteCount >= 1)
+		{
+			*d.mp8++ = *s.mp8++;
+			destByteCount--;
+		}
+	}
+	else
+	{
+		// Routine for non 32-bit aligned copy
+		while (destByteCount)
+		{
+			s.mpVoid = const_cast<void*>(pS);
+
+			for (size_t i = 0; (i < sourceByteCount) && destByteCount; i++)
+			{
+				*d.mp8++ = *s.mp8++;
+				destByteCount--;
+			}
+		}
+	}
+}
+
+
+// This is a local function called by MemfillSpecific.
+static void Memfill128(void* pD, const void* pS, size_t byteCount)
+{
+	unsigned char* pDestination = static_cast<unsigned char*>(pD);
+	const unsigned char* pSource = static_cast<const unsigned char*>(pS);
+	unsigned int v1;
+	unsigned int v2;
+	unsigned int v3;
+	unsigned int v4;
+
+	if ((reinterpret_cast<uintptr_t>(pSource) & 0x3) != 0)
+	{
+		// If the source is not aligned, we need to retrieve the values on a byte by byte basis
 		#if defined(EA_SYSTEM_BIG_ENDIAN)
 			v1 =(static_cast<uint32_t>(*(static_cast<const uint8_t*>(pSource)))*256*256*256) +
 				(static_cast<uint32_t>(*(static_cast<const uint8_t*>(pSource+1)))*256*256) +
@@ -587,412 +1790,1336 @@ static void Memfill128(void* pD, const void* pS, size_t byteCount)
 				(static_cast<uint32_t>(*(static_cast<const uint8_t*>(pSource+15)))*256*256*256);
 		#endif
 	}
-	else
+	else
+	{
+		v1 = *(reinterpret_cast<const uint32_t*>(pSource));
+		v2 = *(reinterpret_cast<const uint32_t*>(pSource+4));
+		v3 = *(reinterpret_cast<const uint32_t*>(pSource+8));
+		v4 = *(reinterpret_cast<const uint32_t*>(pSource+12));
+	}
+
+	// Alignment correction
+	if ((reinterpret_cast<uintptr_t>(pDestination) & 0xF) != 0)
+	{
+		// Perform 32-bit alignment (this is required for ps2, since it crashes when it writes a 32-bit
+		//   value to an unaligned 32-bit memory address)
+		while (((reinterpret_cast<uintptr_t>(pDestination) & 0x03) != 0) && (byteCount>0))
+		{
+			byteCount--;
+			// rotate the values over
+			#if defined(EA_SYSTEM_BIG_ENDIAN)
+				*(pDestination++)=static_cast<uint8_t>(v1 >> 24);
+				unsigned int tmp = v1;
+				v1=(v1 << 8) + (v2 >> 24);
+				v2=(v2 << 8) + (v3 >> 24);
+				v3=(v3 << 8) + (v4 >> 24);
+				v4=(v4 << 8) + (tmp >> 24);
+			#else
+				*(pDestination++)=static_cast<uint8_t>(v1);
+				unsigned int tmp = v1;
+				v1=(v1 >> 8) + (v2 << 24);
+				v2=(v2 >> 8) + (v3 << 24);
+				v3=(v3 >> 8) + (v4 << 24);
+				v4=(v4 >> 8) + (tmp << 24);
+			#endif
+		}
+
+		if (byteCount >=256)
+		{
+			// not really worth performing all these functions if byteCount isn't large
+			// Perform 128-bit alignment on 32-bit boundary
+			unsigned int tempval,tempval2;
+			switch (reinterpret_cast<uintptr_t>(pDestination)&0xC)
+			{
+			case 0xC:
+				*reinterpret_cast<uint32_t*>(pDestination) = v1;
+				pDestination+=4;
+				byteCount-=4;
+				tempval = v1;
+				v1 = v2;
+				v2 = v3;
+				v3 = v4;
+				v4 = tempval;
+				break;
+			case 0x8:
+				*reinterpret_cast<uint32_t*>(pDestination) = v1;
+				*reinterpret_cast<uint32_t*>(pDestination+4) = v2;
+				pDestination+=8;
+				byteCount-=8;
+				tempval = v1;
+				tempval2 = v3;
+				v1 = tempval2;
+				v3 = tempval;
+				tempval = v2;
+				tempval2 = v4;
+				v2 = tempval2;
+				v4 = tempval;
+				break;
+			case 0x4:
+				*reinterpret_cast<uint32_t*>(pDestination) = v1;
+				*reinterpret_cast<uint32_t*>(pDestination+4) = v2;
+				*reinterpret_cast<uint32_t*>(pDestination+8) = v3;
+				pDestination+=12;
+				byteCount-=12;
+				tempval = v4;
+				v4 = v3;
+				v3 = v2;
+				v2 = v1;
+				v1 = tempval;
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	// Start copying the stuff
+	while (byteCount >= 16)
+	{
+		*(reinterpret_cast<uint32_t*>(pDestination)) = v1;
+		*(reinterpret_cast<uint32_t*>(pDestination+4)) = v2;
+		*(reinterpret_cast<uint32_t*>(pDestination+8)) = v3;
+		*(reinterpret_cast<uint32_t*>(pDestination+12)) = v4;
+		byteCount-=16;
+		pDestination+=16;
+	}
+	if (byteCount > 0)
+	{
+		// end of destination not aligned to 128-bit
+		unsigned int i = 0;
+		while (byteCount >= 4)
+		{
+			*(reinterpret_cast<unsigned int*>(pDestination)) = v1;
+			pDestination+=4;
+			byteCount-=4;
+			v1=v2;
+			v2=v3;
+			v3=v4;
+		}
+		#if defined(EA_SYSTEM_BIG_ENDIAN)
+			for (i=0;(i<4) && (byteCount);i++)
+			{
+				*pDestination++ = static_cast<uint8_t>(v1 >> 24);
+				v1 = v1 << 8;
+				byteCount--;
+			}
+		#else
+			// write the remainder for low-endian as long as the byteCount value allows it
+			for (i=0;(i<4) && (byteCount!=0);i++)
+			{
+				*pDestination++ = static_cast<uint8_t>(v1);
+				v1 = v1 >> 8;
+				byteCount--;
+			}
+		#endif
+	}
+}
+
+// MemfillPattern kernels, called by MemfillSpecific, Memfill24 and Memfill64 via the CPU dispatch table.
+// Each fills destByteCount bytes at pDestination with the sourceByteCount byte pattern at pSource, 
+// starting with the first byte of the pattern.
+// The SIMD versions handle patterns of up to kMemfillPatternMax bytes. They first expand the pattern 
+// into a small buffer which holds pattern[i % sourceByteCount] for each i, so that the vector to be 
+// stored at any pattern offset is a single unaligned load from that buffer. After an unaligned head 
+// store, aligned vectors are stored while the pattern offset advances by (vector size % pattern size).
+// When the pattern repeats after few enough vectors, those vectors are instead kept in registers and 
+// stored in rotation, as in the three register scheme that Memfill24 uses.
+namespace Internal
+{
+	const size_t kMemfillPatternMax = 64;
+
+	void MemfillPatternScalar(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount)
+	{
+		if(sourceByteCount == 3)
+			Memfill24(pDestination, pSource, destByteCount);
+		else if(sourceByteCount == 16)
+			Memfill128(pDestination, pSource, destByteCount);
+		else
+			MemfillAny(pDestination, pSource, destByteCount, sourceByteCount);
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Writes pattern[i % patternSize] to pExpanded[i] for i in [0, expandedSize).
+		static void MemfillPatternExpand(uint8_t* pExpanded, const void* pPattern, size_t patternSize, size_t expandedSize)
+		{
+			memcpy(pExpanded, pPattern, patternSize);
+
+			for(size_t i = patternSize, copySize; i < expandedSize; i += copySize)
+			{
+				copySize = ((expandedSize - i) < i) ? (expandedSize - i) : i;
+				memcpy(pExpanded + i, pExpanded, copySize);
+			}
+		}
+
+
+		EASTDC_TARGET_SSE2 void MemfillPatternSSE2(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount)
+		{
+			if((sourceByteCount == 0) || (sourceByteCount > kMemfillPatternMax) || (destByteCount < 64))
+			{
+				MemfillPatternScalar(pDestination, pSource, destByteCount, sourceByteCount);
+				return;
+			}
+
+			const size_t L = sourceByteCount;
+			uint8_t      expanded[kMemfillPatternMax + 64];
+			uint8_t*     p8 = static_cast<uint8_t*>(pDestination);
+			size_t       n  = destByteCount;
+
+			MemfillPatternExpand(expanded, pSource, L, L + 64);
+
+			// Store the first vector unaligned, then continue from the next 16 byte boundary.
+			const size_t headSize = 16 - ((uintptr_t)p8 & 15);
+			_mm_storeu_si128((__m128i*)p8, _mm_loadu_si128((const __m128i*)expanded));
+			p8 += headSize;
+			n  -= headSize;
+
+			size_t       o    = headSize % L; // Offset of the pattern byte that goes to p8.
+			const size_t step = 16 % L;
+
+			if((64 % L) == 0) // The pattern repeats every 64 bytes (L is 1, 2, 4, 8, 16, 32 or 64).
+			{
+				const __m128i v0 = _mm_loadu_si128((const __m128i*)(expanded + o));
+				const __m128i v1 = _mm_loadu_si128((const __m128i*)(expanded + ((o + 16) % L)));
+				const __m128i v2 = _mm_loadu_si128((const __m128i*)(expanded + ((o + 32) % L)));
+				const __m128i v3 = _mm_loadu_si128((const __m128i*)(expanded + ((o + 48) % L)));
+
+				for(; n >= 64; p8 += 64, n -= 64)
+				{
+					_mm_store_si128((__m128i*)(p8 +  0), v0);
+					_mm_store_si128((__m128i*)(p8 + 16), v1);
+					_mm_store_si128((__m128i*)(p8 + 32), v2);
+					_mm_store_si128((__m128i*)(p8 + 48), v3);
+				}
+			}
+			else if((48 % L) == 0) // The pattern repeats every 48 bytes (L is 3, 6, 12, 24 or 48).
+			{
+				const __m128i v0 = _mm_loadu_si128((const __m128i*)(expanded + o));
+				const __m128i v1 = _mm_loadu_si128((const __m128i*)(expanded + ((o + 16) % L)));
+				const __m128i v2 = _mm_loadu_si128((const __m128i*)(expanded + ((o + 32) % L)));
+
+				for(; n >= 48; p8 += 48, n -= 48)
+				{
+					_mm_store_si128((__m128i*)(p8 +  0), v0);
+					_mm_store_si128((__m128i*)(p8 + 16), v1);
+					_mm_store_si128((__m128i*)(p8 + 32), v2);
+				}
+			}
+
+			for(; n >= 16; p8 += 16, n -= 16)
+			{
+				_mm_store_si128((__m128i*)p8, _mm_loadu_si128((const __m128i*)(expanded + o)));
+
+				if((o += step) >= L)
+					o -= L;
+			}
+
+			memcpy(p8, expanded + o, n);
+		}
+
+
+		EASTDC_TARGET_AVX2 void MemfillPatternAVX2(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount)
+		{
+			if((sourceByteCount == 0) || (sourceByteCount > kMemfillPatternMax) || (destByteCount < 128))
+			{
+				MemfillPatternSSE2(pDestination, pSource, destByteCount, sourceByteCount);
+				return;
+			}
+
+			const size_t L = sourceByteCount;
+			uint8_t      expanded[kMemfillPatternMax + 64];
+			uint8_t*     p8 = static_cast<uint8_t*>(pDestination);
+			size_t       n  = destByteCount;
+
+			MemfillPatternExpand(expanded, pSource, L, L + 64);
+
+			// Store the first vector unaligned, then continue from the next 32 byte boundary.
+			const size_t headSize = 32 - ((uintptr_t)p8 & 31);
+			_mm256_storeu_si256((__m256i*)p8, _mm256_loadu_si256((const __m256i*)expanded));
+			p8 += headSize;
+			n  -= headSize;
+
+			size_t       o    = headSize % L; // Offset of the pattern byte that goes to p8.
+			const size_t step = 32 % L;
+
+			if((64 % L) == 0) // The pattern repeats every 64 bytes (L is 1, 2, 4, 8, 16, 32 or 64).
+			{
+				const __m256i v0 = _mm256_loadu_si256((const __m256i*)(expanded + o));
+				const __m256i v1 = _mm256_loadu_si256((const __m256i*)(expanded + ((o + 32) % L)));
+
+				for(; n >= 128; p8 += 128, n -= 128)
+				{
+					_mm256_store_si256((__m256i*)(p8 +  0), v0);
+					_mm256_store_si256((__m256i*)(p8 + 32), v1);
+					_mm256_store_si256((__m256i*)(p8 + 64), v0);
+					_mm256_store_si256((__m256i*)(p8 + 96), v1);
+				}
+			}
+			else if((96 % L) == 0) // The pattern repeats every 96 bytes (L is 3, 6, 12, 24 or 48).
+			{
+				const __m256i v0 = _mm256_loadu_si256((const __m256i*)(expanded + o));
+				const __m256i v1 = _mm256_loadu_si256((const __m256i*)(expanded + ((o + 32) % L)));
+				const __m256i v2 = _mm256_loadu_si256((const __m256i*)(expanded + ((o + 64) % L)));
+
+				for(; n >= 96; p8 += 96, n -= 96)
+				{
+					_mm256_store_si256((__m256i*)(p8 +  0), v0);
+					_mm256_store_si256((__m256i*)(p8 + 32), v1);
+					_mm256_store_si256((__m256i*)(p8 + 64), v2);
+				}
+			}
+
+			for(; n >= 32; p8 += 32, n -= 32)
+			{
+				_mm256_store_si256((__m256i*)p8, _mm256_loadu_si256((const __m256i*)(expanded + o)));
+
+				if((o += step) >= L)
+					o -= L;
+			}
+
+			memcpy(p8, expanded + o, n);
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API void Memfill16(void* pDestination, uint16_t c, size_t byteCount)
+{
+	Memfill32(pDestination, (uint32_t)((c << 16) + c), byteCount);
+}
+
+
+EASTDC_API void Memfill24(void* pDestination, uint32_t c, size_t byteCount)
+{
+	const uint8_t c24[3] = { (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c };
+	Internal::GetCPUDispatchTable().mpMemfillPattern(pDestination, c24, byteCount, sizeof(c24));
+}
+
+
+#if defined(EA_PROCESSOR_X86) &&  defined(_MSC_VER)
+
+	EASTDC_API __declspec(naked) void Memfill32(void* /*pDestination*/, uint32_t /*c*/, size_t /*byteCount*/)
+	{
+		__asm
+		{
+			mov     eax,dword ptr [esp+4]   ; pDestination
+			mov     edx,dword ptr [esp+8]   ; c
+			mov     ecx,dword ptr [esp+12]  ; byteCount
+
+			sub     ecx,32
+			jns     b32a
+			jmp     b32b
+
+			align   16
+
+		; 32 byte filler
+		b32a:
+			sub     ecx,32
+			mov     [eax],edx
+			mov     [eax+4],edx
+			mov     [eax+8],edx
+			mov     [eax+12],edx
+			mov     [eax+16],edx
+			mov     [eax+20],edx
+			mov     [eax+24],edx
+			mov     [eax+28],edx
+			lea     eax,[eax+32]
+			jns     b32a
+
+		b32b:
+			add     ecx,32-8
+			js      b8b
+
+		; 8 byte filler
+		b8a:
+			mov     [eax],edx
+			mov     [eax+4],edx
+			add     eax,8
+			sub     ecx,8
+			jns     b8a
+
+		b8b:
+			add     ecx,8
+			jne     bend
+			ret
+
+		; tail cleanup 4,2,1
+		bend:
+			cmp     ecx,4
+			jb      be4
+			mov     [eax],edx
+			add     eax,4
+			sub     ecx,4
+		be4:
+			cmp     ecx,2
+			jb      be2
+			mov     [eax],dx
+			ror     edx,16
+			add     eax,2
+			sub     ecx,2
+		be2:
+			cmp     ecx,1
+			jb      be1
+			mov     [eax],dl
+			inc     eax
+			dec     ecx
+		be1:
+			ret
+		}
+	}
+
+#else
+
+	EASTDC_API void Memfill32(void* pDestination, uint32_t c, size_t byteCount)
+	{
+		while (((reinterpret_cast<intptr_t>(pDestination) & 3) != 0) && (byteCount > 0))
+		{
+			#if defined(EA_SYSTEM_BIG_ENDIAN)
+				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t>(c >> 24);
+				pDestination = static_cast<void*>(static_cast<char *>(pDestination) + 1);
+				c = (c << 8) + (c >> 24);        // rotate the value
+			#else
+				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t>(c);
+				pDestination = static_cast<void*>(static_cast<char *>(pDestination) + 1);
+				c = (c << 24) + (c >> 8);        // rotate the value
+			#endif
+
+			--byteCount;
+		}
+
+		if ((byteCount >= 4) && ((reinterpret_cast<intptr_t>(pDestination) & 4) != 0))
+		{
+			*static_cast<uint32_t*>(pDestination) = static_cast<uint32_t>(c);
+			pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 4);
+			byteCount -= 4;
+		}
+
+		if (byteCount >= 64)
+		{
+			uint64_t c64 = (static_cast<uint64_t>(c) << static_cast<uint64_t>(32)) | static_cast<uint64_t>(c);
+
+			do
+			{
+				(static_cast<uint64_t*>(pDestination))[0] = c64;
+				(static_cast<uint64_t*>(pDestination))[1] = c64;
+				(static_cast<uint64_t*>(pDestination))[2] = c64;
+				(static_cast<uint64_t*>(pDestination))[3] = c64;
+				(static_cast<uint64_t*>(pDestination))[4] = c64;
+				(static_cast<uint64_t*>(pDestination))[5] = c64;
+				(static_cast<uint64_t*>(pDestination))[6] = c64;
+				(static_cast<uint64_t*>(pDestination))[7] = c64;
+
+				pDestination = static_cast<void*> (static_cast<char*>(pDestination) + 64);
+				byteCount -= 64;
+			}
+			while (byteCount >= 64);
+		}
+
+		if (byteCount >= 16)
+		{
+			do
+			{
+				(reinterpret_cast<uint32_t*>(pDestination))[0] = c;
+				(reinterpret_cast<uint32_t*>(pDestination))[1] = c;
+				(reinterpret_cast<uint32_t*>(pDestination))[2] = c;
+				(reinterpret_cast<uint32_t*>(pDestination))[3] = c;
+
+				pDestination = static_cast<void*> (static_cast<char*>(pDestination) + 16);
+				byteCount -= 16;
+			}
+			while (byteCount >= 16);
+		}
+
+		if (byteCount >= 4)
+		{
+			do
+			{
+				*static_cast<uint32_t*>(pDestination) = static_cast<uint32_t> (c);
+				pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 4);
+				byteCount -= 4;
+			}
+			while (byteCount >= 4);
+		}
+
+		while (byteCount >= 1)
+		{
+			#if defined(EA_SYSTEM_BIG_ENDIAN)
+				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t> (c >> 24);
+				pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 1);
+				c = c << 8;
+			#else
+				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t> (c);
+				pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 1);
+				c = c >> 8;
+			#endif
+
+			--byteCount;
+		}
+	}
+
+#endif
+
+
+
+EASTDC_API void Memfill64(void* pDestination, uint64_t c, size_t byteCount)
+{
+	Internal::GetCPUDispatchTable().mpMemfillPattern(pDestination, &c, byteCount, sizeof(c));
+}
+
+EASTDC_API void Memfill8(void* pDestination, uint8_t c, size_t byteCount)
+{
+	Memset8(pDestination, c, byteCount);
+}
+
+
+EASTDC_API void MemfillSpecific(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount)
+{
+	switch (sourceByteCount)
+	{
+		case 1:
+		{
+			const uint8_t c = *static_cast<const uint8_t*>(pSource);
+			Memset8(pDestination, c, destByteCount);
+			break;
+		}
+
+		case 2:
+		{
+			const uint16_t c = *static_cast<const uint16_t*>(pSource);
+			Memfill16(pDestination, c, destByteCount);
+			break;
+		}
+
+
+		case 4:
+		{
+			uint32_t c = *static_cast<const uint32_t*>(pSource);
+			Memfill32(pDestination, c, destByteCount);
+			break;
+		}
+
+		default:
+			Internal::GetCPUDispatchTable().mpMemfillPattern(pDestination, pSource, destByteCount, sourceByteCount);
+			break;
+	}
+}
+
+
+// TimingSafe kernels, called by TimingSafeMemEqual, TimingSafeMemcmp and TimingSafeMemIsClear
+// via the CPU dispatch table. They execute the same instructions for every input of a given 
+// byteCount: there are no early exits and no branches or memory addresses which depend on the 
+// memory contents. The only branches are on byteCount. Differences are accumulated with logical 
+// operations, which CPUs execute in a data-independent time. The SIMD versions accumulate a full 
+// vector at a time and re-read the last vector so that it ends exactly at byteCount, which is 
+// harmless because OR-ing in (or comparing) the same bytes twice can't change the result.
+//
+// Concern: If the compiler sees the contents of the memory then it may optimize away the code 
+// below. In practice the compiler won't be able to see that in the use cases that matter to users.
+namespace Internal
+{
+	static inline uint64_t TimingSafeLoad64(const uint8_t* p)
+	{
+		uint64_t u64;
+		memcpy(&u64, p, sizeof(u64));
+		return u64;
+	}
+
+
+	bool TimingSafeMemEqualScalar(const void* p1, const void* p2, size_t byteCount)
+	{
+		const uint8_t* p18  = static_cast<const uint8_t*>(p1);
+		const uint8_t* p28  = static_cast<const uint8_t*>(p2);
+		uint64_t       mask = 0;
+		size_t         i    = 0;
+
+		for(; (i + 8) <= byteCount; i += 8)
+			mask |= (TimingSafeLoad64(p18 + i) ^ TimingSafeLoad64(p28 + i)); // Accumulate any differences between the memory.
+
+		for(; i < byteCount; i++)
+			mask |= (uint64_t)(p18[i] ^ p28[i]);
+
+		return (mask == 0);
+	}
+
+
+	int TimingSafeMemcmpScalar(const void* p1, const void* p2, size_t byteCount)
 	{
-		v1 = *(reinterpret_cast<const uint32_t*>(pSource));
-		v2 = *(reinterpret_cast<const uint32_t*>(pSource+4));
-		v3 = *(reinterpret_cast<const uint32_t*>(pSource+8));
-		v4 = *(reinterpret_cast<const uint32_t*>(pSource+12));
+		const uint8_t* p18    = static_cast<const uint8_t*>(p1);
+		const uint8_t* p28    = static_cast<const uint8_t*>(p2);
+		int            result = 0;
+
+		while(byteCount--) // Walk through the bytes from back to front and recalculate the difference if one is encountered.
+		{
+			const int c1   = p18[byteCount];
+			const int c2   = p28[byteCount];
+			const int mask = (((c1 ^ c2) - 1) >> 8); // The result of the following is that mask is -1 (*p1 == *p2) or 0 (*p1 != *p2).
+			result &= mask;                          // If (*p1 == *p2) then mask is 0xffffffff and result is unchanged. Else result will is reset to 0 (to be updated on the next line).
+			result += (c1 - c2);                     // If (*p1 == *p2) then this adds 0 and result is unchanged. Else result will be (*p1 - *p2).
+		}                                            // result is now the difference of the first unequal bytes.
+
+		return (result > 0) - (result < 0);
 	}
 
-	// Alignment correction
-	if ((reinterpret_cast<uintptr_t>(pDestination) & 0xF) != 0)
+
+	bool TimingSafeMemIsClearScalar(const void* p, size_t byteCount)
 	{
-		// Perform 32-bit alignment (this is required for ps2, since it crashes when it writes a 32-bit
-		//   value to an unaligned 32-bit memory address)
-		while (((reinterpret_cast<uintptr_t>(pDestination) & 0x03) != 0) && (byteCount>0))
+		const uint8_t* p8   = static_cast<const uint8_t*>(p);
+		uint64_t       mask = 0;
+		size_t         i    = 0;
+
+		for(; (i + 8) <= byteCount; i += 8)
+			mask |= TimingSafeLoad64(p8 + i);
+
+		for(; i < byteCount; i++)
+			mask |= p8[i];
+
+		return (mask == 0);
+	}
+
+
+	// Converts the result of comparing one vector of bytes into the -1, 0 or 1 that Memcmp would 
+	// return for it, without branching. diffMask has a bit set for each byte which differs and 
+	// greaterMask a bit set for each byte of p1 which is greater than that of p2. We isolate the 
+	// lowest set bit of diffMask, which is the first differing byte.
+	static inline int TimingSafeMemcmpSign(uint32_t diffMask, uint32_t greaterMask)
+	{
+		const uint32_t firstMask = diffMask & (0u - diffMask);
+
+		return (int)((firstMask & greaterMask) != 0) - (int)((firstMask & ~greaterMask) != 0);
+	}
+
+
+	// Accumulates the sign of a vector into result, unless a previous vector already differed.
+	// found is 0 until the first vector with a difference and -1 thereafter.
+	static inline void TimingSafeMemcmpAccumulate(int& result, int& found, uint32_t diffMask, uint32_t greaterMask)
+	{
+		result |= (TimingSafeMemcmpSign(diffMask, greaterMask) & ~found);
+		found  |= -(int)(diffMask != 0);
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		EASTDC_TARGET_SSE2 bool TimingSafeMemEqualSSE2(const void* p1, const void* p2, size_t byteCount)
 		{
-			byteCount--;
-			// rotate the values over
-			#if defined(EA_SYSTEM_BIG_ENDIAN)
-				*(pDestination++)=static_cast<uint8_t>(v1 >> 24);
-				unsigned int tmp = v1;
-				v1=(v1 << 8) + (v2 >> 24);
-				v2=(v2 << 8) + (v3 >> 24);
-				v3=(v3 << 8) + (v4 >> 24);
-				v4=(v4 << 8) + (tmp >> 24);
-			#else
-				*(pDestination++)=static_cast<uint8_t>(v1);
-				unsigned int tmp = v1;
-				v1=(v1 >> 8) + (v2 << 24);
-				v2=(v2 >> 8) + (v3 << 24);
-				v3=(v3 >> 8) + (v4 << 24);
-				v4=(v4 >> 8) + (tmp << 24);
-			#endif
+			if(byteCount < 16)
+				return TimingSafeMemEqualScalar(p1, p2, byteCount);
+
+			const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+			__m128i        a0  = _mm_setzero_si128();
+			__m128i        a1  = _mm_setzero_si128();
+			size_t         i   = 0;
+
+			for(; (i + 32) <= byteCount; i += 32) // Two accumulators, so that successive loads aren't serialized on a single OR.
+			{
+				a0 = _mm_or_si128(a0, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i)),      _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i))));
+				a1 = _mm_or_si128(a1, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i + 16)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i + 16))));
+			}
+
+			if((i + 16) <= byteCount)
+			{
+				a0 = _mm_or_si128(a0, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i))));
+				i += 16;
+			}
+
+			if(i < byteCount)
+			{
+				i = byteCount - 16;
+				a1 = _mm_or_si128(a1, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i))));
+			}
+
+			a0 = _mm_or_si128(a0, a1);
+
+			return (_mm_movemask_epi8(_mm_cmpeq_epi8(a0, _mm_setzero_si128())) == 0xffff);
 		}
 
-		if (byteCount >=256)
+
+		EASTDC_TARGET_SSE2 int TimingSafeMemcmpSSE2(const void* p1, const void* p2, size_t byteCount)
 		{
-			// not really worth performing all these functions if byteCount isn't large
-			// Perform 128-bit alignment on 32-bit boundary
-			unsigned int tempval,tempval2;
-			switch (reinterpret_cast<uintptr_t>(pDestination)&0xC)
+			if(byteCount < 16)
+				return TimingSafeMemcmpScalar(p1, p2, byteCount);
+
+			const uint8_t* p18    = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28    = static_cast<const uint8_t*>(p2);
+			int            result = 0;
+			int            found  = 0;
+
+			for(size_t i = 0; ; i += 16)
 			{
-			case 0xC:
-				*reinterpret_cast<uint32_t*>(pDestination) = v1;
-				pDestination+=4;
-				byteCount-=4;
-				tempval = v1;
-				v1 = v2;
-				v2 = v3;
-				v3 = v4;
-				v4 = tempval;
-				break;
-			case 0x8:
-				*reinterpret_cast<uint32_t*>(pDestination) = v1;
-				*reinterpret_cast<uint32_t*>(pDestination+4) = v2;
-				pDestination+=8;
-				byteCount-=8;
-				tempval = v1;
-				tempval2 = v3;
-				v1 = tempval2;
-				v3 = tempval;
-				tempval = v2;
-				tempval2 = v4;
-				v2 = tempval2;
-				v4 = tempval;
-				break;
-			case 0x4:
-				*reinterpret_cast<uint32_t*>(pDestination) = v1;
-				*reinterpret_cast<uint32_t*>(pDestination+4) = v2;
-				*reinterpret_cast<uint32_t*>(pDestination+8) = v3;
-				pDestination+=12;
-				byteCount-=12;
-				tempval = v4;
-				v4 = v3;
-				v3 = v2;
-				v2 = v1;
-				v1 = tempval;
-				break;
-			default:
-				break;
+				if((i + 16) > byteCount)
+				{
+					if(i == byteCount)
+						break;
+					i = byteCount - 16; // Bytes re-read here were equal if found is still 0, and are ignored otherwise.
+				}
+
+				const __m128i  a           = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p18 + i));
+				const __m128i  b           = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p28 + i));
+				const uint32_t diffMask    = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) ^ 0xffff;
+				const uint32_t greaterMask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(a, b), a)) & diffMask; // a >= b, unsigned.
+
+				TimingSafeMemcmpAccumulate(result, found, diffMask, greaterMask);
 			}
+
+			return result;
 		}
-	}
 
-	// Start copying the stuff
-	while (byteCount >= 16)
-	{
-		*(reinterpret_cast<uint32_t*>(pDestination)) = v1;
-		*(reinterpret_cast<uint32_t*>(pDestination+4)) = v2;
-		*(reinterpret_cast<uint32_t*>(pDestination+8)) = v3;
-		*(reinterpret_cast<uint32_t*>(pDestination+12)) = v4;
-		byteCount-=16;
-		pDestination+=16;
-	}
-	if (byteCount > 0)
-	{
-		// end of destination not aligned to 128-bit
-		unsigned int i = 0;
-		while (byteCount >= 4)
+
+		EASTDC_TARGET_SSE2 bool TimingSafeMemIsClearSSE2(const void* p, size_t byteCount)
 		{
-			*(reinterpret_cast<unsigned int*>(pDestination)) = v1;
-			pDestination+=4;
-			byteCount-=4;
-			v1=v2;
-			v2=v3;
-			v3=v4;
+			if(byteCount < 16)
+				return TimingSafeMemIsClearScalar(p, byteCount);
+
+			const uint8_t* p8 = static_cast<const uint8_t*>(p);
+			__m128i        a0 = _mm_setzero_si128();
+			__m128i        a1 = _mm_setzero_si128();
+			size_t         i  = 0;
+
+			for(; (i + 32) <= byteCount; i += 32)
+			{
+				a0 = _mm_or_si128(a0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p8 + i)));
+				a1 = _mm_or_si128(a1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p8 + i + 16)));
+			}
+
+			if((i + 16) <= byteCount)
+			{
+				a0 = _mm_or_si128(a0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p8 + i)));
+				i += 16;
+			}
+
+			if(i < byteCount)
+				a1 = _mm_or_si128(a1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p8 + byteCount - 16)));
+
+			a0 = _mm_or_si128(a0, a1);
+
+			return (_mm_movemask_epi8(_mm_cmpeq_epi8(a0, _mm_setzero_si128())) == 0xffff);
 		}
-		#if defined(EA_SYSTEM_BIG_ENDIAN)
-			for (i=0;(i<4) && (byteCount);i++)
+
+
+		EASTDC_TARGET_AVX2 bool TimingSafeMemEqualAVX2(const void* p1, const void* p2, size_t byteCount)
+		{
+			if(byteCount < 32)
+				return TimingSafeMemEqualSSE2(p1, p2, byteCount);
+
+			const uint8_t* p18 = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28 = static_cast<const uint8_t*>(p2);
+			__m256i        a0  = _mm256_setzero_si256();
+			__m256i        a1  = _mm256_setzero_si256();
+			size_t         i   = 0;
+
+			for(; (i + 64) <= byteCount; i += 64)
 			{
-				*pDestination++ = static_cast<uint8_t>(v1 >> 24);
-				v1 = v1 << 8;
-				byteCount--;
+				a0 = _mm256_or_si256(a0, _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i)),      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i))));
+				a1 = _mm256_or_si256(a1, _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i + 32)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i + 32))));
 			}
-		#else
-			// write the remainder for low-endian as long as the byteCount value allows it
-			for (i=0;(i<4) && (byteCount!=0);i++)
+
+			if((i + 32) <= byteCount)
 			{
-				*pDestination++ = static_cast<uint8_t>(v1);
-				v1 = v1 >> 8;
-				byteCount--;
+				a0 = _mm256_or_si256(a0, _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i))));
+				i += 32;
 			}
-		#endif
+
+			if(i < byteCount)
+			{
+				i = byteCount - 32;
+				a1 = _mm256_or_si256(a1, _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i))));
+			}
+
+			a0 = _mm256_or_si256(a0, a1);
+
+			return (_mm256_testz_si256(a0, a0) != 0);
+		}
+
+
+		EASTDC_TARGET_AVX2 int TimingSafeMemcmpAVX2(const void* p1, const void* p2, size_t byteCount)
+		{
+			if(byteCount < 32)
+				return TimingSafeMemcmpSSE2(p1, p2, byteCount);
+
+			const uint8_t* p18    = static_cast<const uint8_t*>(p1);
+			const uint8_t* p28    = static_cast<const uint8_t*>(p2);
+			int            result = 0;
+			int            found  = 0;
+
+			for(size_t i = 0; ; i += 32)
+			{
+				if((i + 32) > byteCount)
+				{
+					if(i == byteCount)
+						break;
+					i = byteCount - 32;
+				}
+
+				const __m256i  a           = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p18 + i));
+				const __m256i  b           = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p28 + i));
+				const uint32_t diffMask    = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+				const uint32_t greaterMask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(a, b), a)) & diffMask;
+
+				TimingSafeMemcmpAccumulate(result, found, diffMask, greaterMask);
+			}
+
+			return result;
+		}
+
+
+		EASTDC_TARGET_AVX2 bool TimingSafeMemIsClearAVX2(const void* p, size_t byteCount)
+		{
+			if(byteCount < 32)
+				return TimingSafeMemIsClearSSE2(p, byteCount);
+
+			const uint8_t* p8 = static_cast<const uint8_t*>(p);
+			__m256i        a0 = _mm256_setzero_si256();
+			__m256i        a1 = _mm256_setzero_si256();
+			size_t         i  = 0;
+
+			for(; (i + 64) <= byteCount; i += 64)
+			{
+				a0 = _mm256_or_si256(a0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p8 + i)));
+				a1 = _mm256_or_si256(a1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p8 + i + 32)));
+			}
+
+			if((i + 32) <= byteCount)
+			{
+				a0 = _mm256_or_si256(a0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p8 + i)));
+				i += 32;
+			}
+
+			if(i < byteCount)
+				a1 = _mm256_or_si256(a1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p8 + byteCount - 32)));
+
+			a0 = _mm256_or_si256(a0, a1);
+
+			return (_mm256_testz_si256(a0, a0) != 0);
+		}
+	#endif
+
+} // namespace Internal
+
+
+// Has similar behavior to the Unix bcmp function but executes the same instructions every 
+// time and thus executes in the same amount of time for a given byteCount.
+EASTDC_API bool TimingSafeMemEqual(const void* pMem1, const void* pMem2, size_t byteCount)
+{
+	return Internal::GetCPUDispatchTable().mpTimingSafeMemEqual(pMem1, pMem2, byteCount);
+}
+
+
+// Has the same behavior as Memcmp, but executes the same instructions every time and
+// thus executes in the same amount of time for a given byteCount.
+EASTDC_API int TimingSafeMemcmp(const void* pMem1, const void* pMem2, size_t byteCount)
+{
+	return Internal::GetCPUDispatchTable().mpTimingSafeMemcmp(pMem1, pMem2, byteCount);
+}
+
+
+EASTDC_API bool TimingSafeMemIsClear(const void* pMem, size_t byteCount)
+{
+	return Internal::GetCPUDispatchTable().mpTimingSafeMemIsClear(pMem, byteCount);
+}
+
+
+
+namespace Internal
+{
+	// Returns the size of the pages which the OS maps memory with by default.
+	static size_t GetMemoryPageSize()
+	{
+		static size_t sPageSize = 0; // Concurrent initialization is benign, as every thread computes the same value.
+
+		if(sPageSize == 0)
+		{
+			#if EASTDC_SYS_MMAN_H_AVAILABLE
+				const long pageSize = sysconf(_SC_PAGESIZE);
+				sPageSize = (pageSize > 0) ? (size_t)pageSize : 4096;
+			#elif defined(EA_PLATFORM_WINDOWS)
+				SYSTEM_INFO systemInfo;
+				GetSystemInfo(&systemInfo);
+				sPageSize = (size_t)systemInfo.dwPageSize;
+			#else
+				sPageSize = 4096;
+			#endif
+		}
+
+		return sPageSize;
 	}
+
+
+	template <int rw, int locality>
+	static void PrefetchLines(const char* pLine, const char* pEnd)
+	{
+		for(; pLine < pEnd; pLine += kCacheLineSize)
+		{
+			if(rw)
+				MemoryPrefetchWrite<locality>(const_cast<char*>(pLine));
+			else
+				MemoryPrefetchRead<locality>(pLine);
+		}
+	}
+
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+		// Applies madvise to the pages which contain any of the n bytes at p.
+		static bool MemAdvise(const void* p, size_t n, int advice)
+		{
+			if(n == 0)
+				return true;
+
+			const uintptr_t pageMask = (uintptr_t)(GetMemoryPageSize() - 1);
+			const uintptr_t pBegin   = (uintptr_t)p & ~pageMask;
+			const uintptr_t pEnd     = ((uintptr_t)p + n + pageMask) & ~pageMask;
+
+			return (madvise(reinterpret_cast<void*>(pBegin), (size_t)(pEnd - pBegin), advice) == 0);
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API void PrefetchRange(const void* p, size_t n, bool bForWrite, int locality)
+{
+	if(n == 0)
+		return;
+
+	// The prefetch instructions take the hints as immediate values, so we need a separate loop for each combination.
+	const char* const pLine = reinterpret_cast<const char*>((uintptr_t)p & ~(uintptr_t)kCacheLineSizeMask);
+	const char* const pEnd  = static_cast<const char*>(p) + n;
+
+	if(bForWrite)
+	{
+		switch(locality)
+		{
+			case 0:  Internal::PrefetchLines<1, 0>(pLine, pEnd); break;
+			case 1:  Internal::PrefetchLines<1, 1>(pLine, pEnd); break;
+			case 2:  Internal::PrefetchLines<1, 2>(pLine, pEnd); break;
+			default: Internal::PrefetchLines<1, 3>(pLine, pEnd); break;
+		}
+	}
+	else
+	{
+		switch(locality)
+		{
+			case 0:  Internal::PrefetchLines<0, 0>(pLine, pEnd); break;
+			case 1:  Internal::PrefetchLines<0, 1>(pLine, pEnd); break;
+			case 2:  Internal::PrefetchLines<0, 2>(pLine, pEnd); break;
+			default: Internal::PrefetchLines<0, 3>(pLine, pEnd); break;
+		}
+	}
+}
+
+
+EASTDC_API void MemTouch(void* p, size_t n)
+{
+	if(n == 0)
+		return;
+
+	const uintptr_t pageSize = (uintptr_t)Internal::GetMemoryPageSize();
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE && defined(MADV_POPULATE_WRITE)
+		// Linux 5.14+ can fault in the pages writable without our touching them, which 
+		// is a single system call rather than one fault per page. Older kernels fail with EINVAL.
+		if(Internal::MemAdvise(p, n, MADV_POPULATE_WRITE))
+			return;
+	#endif
+
+	// We touch p itself and then the first byte of each page after it. A read followed by a 
+	// write of the same value leaves the memory as it was. The volatile prevents the compiler 
+	// from removing the access.
+	volatile uint8_t* const p8    = static_cast<volatile uint8_t*>(p);
+	const uintptr_t         pBase = (uintptr_t)p;
+
+	for(uintptr_t i = 0; i < n; i = ((pBase + i + pageSize) & ~(pageSize - 1)) - pBase)
+		p8[i] = p8[i];
 }
 
 
-EASTDC_API void Memfill16(void* pDestination, uint16_t c, size_t byteCount)
+EASTDC_API bool MemAdviseSequential(const void* p, size_t n)
 {
-	Memfill32(pDestination, (uint32_t)((c << 16) + c), byteCount);
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+		return Internal::MemAdvise(p, n, MADV_SEQUENTIAL);
+	#else
+		EA_UNUSED(p); EA_UNUSED(n);
+		return false;
+	#endif
 }
 
 
-EASTDC_API void Memfill24(void* pDestination, uint32_t c, size_t byteCount)
+EASTDC_API bool MemAdviseWillNeed(const void* p, size_t n)
 {
-	const uint8_t c24[3] = { (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c };
-	Memfill24(pDestination, c24, byteCount);
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+		return Internal::MemAdvise(p, n, MADV_WILLNEED);
+	#else
+		EA_UNUSED(p); EA_UNUSED(n);
+		return false;
+	#endif
 }
 
 
-#if defined(EA_PROCESSOR_X86) &&  defined(_MSC_VER)
-
-	EASTDC_API __declspec(naked) void Memfill32(void* /*pDestination*/, uint32_t /*c*/, size_t /*byteCount*/)
+namespace Internal
+{
+	// Returns the default huge page size, or the regular page size if huge pages aren't supported.
+	// AllocLargeBuffer rounds all mapping sizes up to this, so that FreeLargeBuffer can reconstruct 
+	// the mapping size from just the user size.
+	static size_t GetLargeBufferPageSize()
 	{
-		__asm
-		{
-			mov     eax,dword ptr [esp+4]   ; pDestination
-			mov     edx,dword ptr [esp+8]   ; c
-			mov     ecx,dword ptr [esp+12]  ; byteCount
-
-			sub     ecx,32
-			jns     b32a
-			jmp     b32b
-
-			align   16
-
-		; 32 byte filler
-		b32a:
-			sub     ecx,32
-			mov     [eax],edx
-			mov     [eax+4],edx
-			mov     [eax+8],edx
-			mov     [eax+12],edx
-			mov     [eax+16],edx
-			mov     [eax+20],edx
-			mov     [eax+24],edx
-			mov     [eax+28],edx
-			lea     eax,[eax+32]
-			jns     b32a
+		static size_t sHugePageSize = 0;
 
-		b32b:
-			add     ecx,32-8
-			js      b8b
+		if(sHugePageSize == 0)
+		{
+			size_t hugePageSize = 0;
+
+			#if EASTDC_SYS_MMAN_H_AVAILABLE && defined(EA_PLATFORM_LINUX) && EASTDC_FILE_AVAILABLE
+				FILE* pFile = fopen("/proc/meminfo", "r");
+
+				if(pFile)
+				{
+					char          line[128];
+					unsigned long kb;
+
+					while(fgets(line, sizeof(line), pFile))
+					{
+						if(sscanf(line, "Hugepagesize: %lu kB", &kb) == 1)
+						{
+							hugePageSize = (size_t)kb * 1024;
+							break;
+						}
+					}
+
+					fclose(pFile);
+				}
 
-		; 8 byte filler
-		b8a:
-			mov     [eax],edx
-			mov     [eax+4],edx
-			add     eax,8
-			sub     ecx,8
-			jns     b8a
+				if((hugePageSize == 0) || ((hugePageSize & (hugePageSize - 1)) != 0)) // If not reported (e.g. no kernel support)...
+					hugePageSize = 2 * 1024 * 1024; // Use the x86-64 and ARM64 default, which is harmless as a rounding granularity.
+			#elif defined(EA_PLATFORM_WINDOWS)
+				hugePageSize = (size_t)GetLargePageMinimum(); // Returns 0 if large pages aren't supported.
+			#endif
 
-		b8b:
-			add     ecx,8
-			jne     bend
-			ret
+			if(hugePageSize < GetMemoryPageSize())
+				hugePageSize = GetMemoryPageSize();
 
-		; tail cleanup 4,2,1
-		bend:
-			cmp     ecx,4
-			jb      be4
-			mov     [eax],edx
-			add     eax,4
-			sub     ecx,4
-		be4:
-			cmp     ecx,2
-			jb      be2
-			mov     [eax],dx
-			ror     edx,16
-			add     eax,2
-			sub     ecx,2
-		be2:
-			cmp     ecx,1
-			jb      be1
-			mov     [eax],dl
-			inc     eax
-			dec     ecx
-		be1:
-			ret
+			sHugePageSize = hugePageSize;
 		}
+
+		return sHugePageSize;
 	}
 
-#else
 
-	EASTDC_API void Memfill32(void* pDestination, uint32_t c, size_t byteCount)
-	{
-		while (((reinterpret_cast<intptr_t>(pDestination) & 3) != 0) && (byteCount > 0))
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+		// Maps mappedSize bytes at an address aligned to alignment. If alignment is greater than 
+		// the natural alignment of the mapping (pageSize) then we map extra and unmap the excess.
+		static void* LargeBufferMapAligned(size_t mappedSize, size_t alignment, size_t pageSize, int extraFlags)
 		{
-			#if defined(EA_SYSTEM_BIG_ENDIAN)
-				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t>(c >> 24);
-				pDestination = static_cast<void*>(static_cast<char *>(pDestination) + 1);
-				c = (c << 8) + (c >> 24);        // rotate the value
+			#if defined(MAP_ANONYMOUS)
+				const int flags = MAP_PRIVATE | MAP_ANONYMOUS | extraFlags;
 			#else
-				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t>(c);
-				pDestination = static_cast<void*>(static_cast<char *>(pDestination) + 1);
-				c = (c << 24) + (c >> 8);        // rotate the value
+				const int flags = MAP_PRIVATE | MAP_ANON | extraFlags;
 			#endif
 
-			--byteCount;
+			if(alignment <= pageSize)
+			{
+				void* const p = mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+				return (p == MAP_FAILED) ? NULL : p;
+			}
+
+			const size_t reservedSize = mappedSize + alignment - pageSize;
+
+			if(reservedSize < mappedSize) // If overflowed...
+				return NULL;
+
+			void* const p = mmap(NULL, reservedSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+			if(p == MAP_FAILED)
+				return NULL;
+
+			const uintptr_t pBegin   = (uintptr_t)p;
+			const uintptr_t pAligned = (pBegin + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+			const uintptr_t pEnd     = pBegin + reservedSize;
+
+			if(pAligned > pBegin)
+				munmap(p, (size_t)(pAligned - pBegin));
+			if((pAligned + mappedSize) < pEnd)
+				munmap(reinterpret_cast<void*>(pAligned + mappedSize), (size_t)(pEnd - (pAligned + mappedSize)));
+
+			return reinterpret_cast<void*>(pAligned);
 		}
 
-		if ((byteCount >= 4) && ((reinterpret_cast<intptr_t>(pDestination) & 4) != 0))
+
+		// Sets the memory policy of the range to prefer the NUMA node of the calling thread.
+		// We use the system calls directly in order to avoid a dependency on libnuma.
+		static bool LargeBufferBindNUMALocal(void* p, size_t mappedSize)
 		{
-			*static_cast<uint32_t*>(pDestination) = static_cast<uint32_t>(c);
-			pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 4);
-			byteCount -= 4;
+			#if defined(EA_PLATFORM_LINUX) && defined(SYS_mbind) && defined(SYS_getcpu)
+				const int     kMPolPreferred = 1; // MPOL_PREFERRED, from <linux/mempolicy.h>.
+				unsigned      cpu  = 0;
+				unsigned      node = 0;
+				unsigned long nodeMask[16];       // Enough for 1024 nodes.
+				const size_t  kNodeMaskBitCount = sizeof(nodeMask) * 8;
+
+				if(syscall(SYS_getcpu, &cpu, &node, NULL) != 0)
+					return false;
+
+				if(node >= kNodeMaskBitCount)
+					return false;
+
+				memset(nodeMask, 0, sizeof(nodeMask));
+				nodeMask[node / (sizeof(unsigned long) * 8)] = 1ul << (node % (sizeof(unsigned long) * 8));
+
+				return (syscall(SYS_mbind, p, mappedSize, kMPolPreferred, nodeMask, (unsigned long)(kNodeMaskBitCount + 1), 0u) == 0);
+			#else
+				EA_UNUSED(p); EA_UNUSED(mappedSize);
+				return false;
+			#endif
 		}
 
-		if (byteCount >= 64)
+	#elif defined(EA_PLATFORM_WINDOWS)
+		// VirtualAlloc addresses are aligned to the allocation granularity (usually 64 KB). For greater
+		// alignments we reserve a larger region to find a suitable address, release it, and then 
+		// allocate at that address. Another thread could take the address in between, so we retry.
+		static void* LargeBufferVirtualAllocAligned(size_t mappedSize, size_t alignment, DWORD allocationType)
 		{
-			uint64_t c64 = (static_cast<uint64_t>(c) << static_cast<uint64_t>(32)) | static_cast<uint64_t>(c);
+			SYSTEM_INFO systemInfo;
+			GetSystemInfo(&systemInfo);
 
-			do
+			if(alignment <= (size_t)systemInfo.dwAllocationGranularity)
+				return VirtualAlloc(NULL, mappedSize, allocationType, PAGE_READWRITE);
+
+			for(int i = 0; i < 8; i++)
 			{
-				(static_cast<uint64_t*>(pDestination))[0] = c64;
-				(static_cast<uint64_t*>(pDestination))[1] = c64;
-				(static_cast<uint64_t*>(pDestination))[2] = c64;
-				(static_cast<uint64_t*>(pDestination))[3] = c64;
-				(static_cast<uint64_t*>(pDestination))[4] = c64;
-				(static_cast<uint64_t*>(pDestination))[5] = c64;
-				(static_cast<uint64_t*>(pDestination))[6] = c64;
-				(static_cast<uint64_t*>(pDestination))[7] = c64;
+				void* const p = VirtualAlloc(NULL, mappedSize + alignment, MEM_RESERVE, PAGE_NOACCESS);
 
-				pDestination = static_cast<void*> (static_cast<char*>(pDestination) + 64);
-				byteCount -= 64;
+				if(!p)
+					return NULL;
+
+				VirtualFree(p, 0, MEM_RELEASE);
+
+				void* const pAligned = reinterpret_cast<void*>(((uintptr_t)p + (alignment - 1)) & ~(uintptr_t)(alignment - 1));
+				void* const pResult  = VirtualAlloc(pAligned, mappedSize, allocationType, PAGE_READWRITE);
+
+				if(pResult)
+					return pResult;
 			}
-			while (byteCount >= 64);
+
+			return NULL;
 		}
+	#endif
 
-		if (byteCount >= 16)
-		{
-			do
+} // namespace Internal
+
+
+EASTDC_API void* AllocLargeBuffer(size_t nSize, size_t alignment, int flags, LargeBufferInfo* pInfo)
+{
+	EA_ASSERT((alignment & (alignment - 1)) == 0);
+
+	const size_t    pageSize     = Internal::GetMemoryPageSize();
+	const size_t    hugePageSize = Internal::GetLargeBufferPageSize();
+	const size_t    mappedSize   = (nSize + (hugePageSize - 1)) & ~(hugePageSize - 1);
+	void*           p            = NULL;
+	LargeBufferInfo info         = { pageSize, false, false };
+
+	if(alignment < pageSize)
+		alignment = pageSize;
+
+	if((nSize == 0) || (mappedSize < nSize)) // If nothing to do or overflowed...
+		return NULL;
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+		#if defined(MAP_HUGETLB)
+			if((flags & kLargeBufferHugePages) && (hugePageSize > pageSize))
 			{
-				(reinterpret_cast<uint32_t*>(pDestination))[0] = c;
-				(reinterpret_cast<uint32_t*>(pDestination))[1] = c;
-				(reinterpret_cast<uint32_t*>(pDestination))[2] = c;
-				(reinterpret_cast<uint32_t*>(pDestination))[3] = c;
+				p = Internal::LargeBufferMapAligned(mappedSize, (alignment > hugePageSize) ? alignment : hugePageSize, hugePageSize, MAP_HUGETLB);
 
-				pDestination = static_cast<void*> (static_cast<char*>(pDestination) + 16);
-				byteCount -= 16;
+				if(p)
+					info.mPageSize = hugePageSize;
 			}
-			while (byteCount >= 16);
-		}
+		#endif
 
-		if (byteCount >= 4)
+		if(!p)
 		{
-			do
-			{
-				*static_cast<uint32_t*>(pDestination) = static_cast<uint32_t> (c);
-				pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 4);
-				byteCount -= 4;
-			}
-			while (byteCount >= 4);
+			// Transparent huge pages can only back huge page aligned regions, so we align to the huge page size when requesting them.
+			const size_t mapAlignment = ((flags & kLargeBufferTransparentHugePages) && (alignment < hugePageSize)) ? hugePageSize : alignment;
+
+			p = Internal::LargeBufferMapAligned(mappedSize, mapAlignment, pageSize, 0);
+
+			#if defined(MADV_HUGEPAGE)
+				if(p && (flags & kLargeBufferTransparentHugePages))
+					info.mbTransparentHugePages = (madvise(p, mappedSize, MADV_HUGEPAGE) == 0);
+			#endif
 		}
 
-		while (byteCount >= 1)
+		if(p && (flags & kLargeBufferNUMALocal))
+			info.mbNUMALocal = Internal::LargeBufferBindNUMALocal(p, mappedSize); // Must be done before the memory is touched.
+
+	#elif defined(EA_PLATFORM_WINDOWS)
+		// MEM_LARGE_PAGES fails unless the user has the SeLockMemoryPrivilege. Large pages are 
+		// always committed immediately, and there is no transparent huge page equivalent.
+		if((flags & kLargeBufferHugePages) && (hugePageSize > pageSize))
 		{
-			#if defined(EA_SYSTEM_BIG_ENDIAN)
-				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t> (c >> 24);
-				pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 1);
-				c = c << 8;
-			#else
-				*static_cast<uint8_t*>(pDestination) = static_cast<uint8_t> (c);
-				pDestination = static_cast<void*>(static_cast<char*>(pDestination) + 1);
-				c = c >> 8;
-			#endif
+			p = Internal::LargeBufferVirtualAllocAligned(mappedSize, alignment, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES);
 
-			--byteCount;
+			if(p)
+				info.mPageSize = hugePageSize;
 		}
-	}
 
-#endif
+		if(!p)
+			p = Internal::LargeBufferVirtualAllocAligned(mappedSize, alignment, MEM_RESERVE | MEM_COMMIT);
 
+	#else
+		// There is no OS page mapping support, so we use the heap. We store the address returned by 
+		// malloc just before the aligned buffer, which is why FreeLargeBuffer doesn't need the alignment.
+		void* const pMalloc = malloc(mappedSize + alignment + sizeof(void*));
 
+		if(pMalloc)
+		{
+			p = reinterpret_cast<void*>(((uintptr_t)pMalloc + sizeof(void*) + (alignment - 1)) & ~(uintptr_t)(alignment - 1));
+			static_cast<void**>(p)[-1] = pMalloc;
+			memset(p, 0, nSize);
+		}
+	#endif
 
-EASTDC_API void Memfill64(void* pDestination, uint64_t c, size_t byteCount)
-{
-	MemfillAny(pDestination, &c, byteCount, sizeof(c));
+	if(p && (flags & kLargeBufferPopulate))
+		MemTouch(p, nSize);
+
+	if(pInfo)
+		*pInfo = info;
+
+	return p;
 }
 
-EASTDC_API void Memfill8(void* pDestination, uint8_t c, size_t byteCount)
+
+EASTDC_API void FreeLargeBuffer(void* p, size_t nSize)
 {
-	Memset8(pDestination, c, byteCount);
+	if(p)
+	{
+		#if EASTDC_SYS_MMAN_H_AVAILABLE
+			const size_t hugePageSize = Internal::GetLargeBufferPageSize();
+			munmap(p, (nSize + (hugePageSize - 1)) & ~(hugePageSize - 1));
+		#elif defined(EA_PLATFORM_WINDOWS)
+			EA_UNUSED(nSize);
+			VirtualFree(p, 0, MEM_RELEASE);
+		#else
+			EA_UNUSED(nSize);
+			free(static_cast<void**>(p)[-1]);
+		#endif
+	}
 }
 
 
-EASTDC_API void MemfillSpecific(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount)
+
+namespace Internal
 {
-	switch (sourceByteCount)
+	// How far ahead of the current position we prefetch the source during non-temporal copies.
+	// The prefetch uses the NTA hint so that the source also avoids polluting the outer cache levels.
+	const size_t kNonTemporalPrefetchDistance = 512;
+
+
+	EASTDC_API void MemcpyNonTemporal(void* EA_RESTRICT pDestination, const void* EA_RESTRICT pSource, size_t nByteCount)
 	{
-		case 1:
-		{
-			const uint8_t c = *static_cast<const uint8_t*>(pSource);
-			Memset8(pDestination, c, destByteCount);
-			break;
-		}
+		#if EA_SSE >= 2
+			uint8_t*       pDest8   = static_cast<uint8_t*>(pDestination);
+			const uint8_t* pSource8 = static_cast<const uint8_t*>(pSource);
 
-		case 2:
-		{
-			const uint16_t c = *static_cast<const uint16_t*>(pSource);
-			Memfill16(pDestination, c, destByteCount);
-			break;
-		}
+			// Copy the head with regular stores until the destination is 16 byte aligned.
+			const size_t headSize = (size_t)((0 - (uintptr_t)pDest8) & 15);
 
-		case 3:
-			Memfill24(pDestination, pSource, destByteCount);
-			break;
+			if(headSize >= nByteCount)
+			{
+				memcpy(pDest8, pSource8, nByteCount);
+				return;
+			}
 
-		case 4:
-		{
-			uint32_t c = *static_cast<const uint32_t*>(pSource);
-			Memfill32(pDestination, c, destByteCount);
-			break;
-		}
+			memcpy(pDest8, pSource8, headSize);
+			pDest8     += headSize;
+			pSource8   += headSize;
+			nByteCount -= headSize;
 
-		case 8:
-		default:
-			MemfillAny(pDestination, pSource, destByteCount, sourceByteCount);
-			break;
+			if(((uintptr_t)pSource8 & 15) == 0)
+			{
+				for(; nByteCount >= 64; nByteCount -= 64, pDest8 += 64, pSource8 += 64)
+				{
+					_mm_prefetch(reinterpret_cast<const char*>(pSource8 + kNonTemporalPrefetchDistance), _MM_HINT_NTA);
+
+					const __m128i v0 = _mm_load_si128(reinterpret_cast<const __m128i*>(pSource8) + 0);
+					const __m128i v1 = _mm_load_si128(reinterpret_cast<const __m128i*>(pSource8) + 1);
+					const __m128i v2 = _mm_load_si128(reinterpret_cast<const __m128i*>(pSource8) + 2);
+					const __m128i v3 = _mm_load_si128(reinterpret_cast<const __m128i*>(pSource8) + 3);
+
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 0, v0);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 1, v1);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 2, v2);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 3, v3);
+				}
+			}
+			else
+			{
+				for(; nByteCount >= 64; nByteCount -= 64, pDest8 += 64, pSource8 += 64)
+				{
+					_mm_prefetch(reinterpret_cast<const char*>(pSource8 + kNonTemporalPrefetchDistance), _MM_HINT_NTA);
+
+					const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource8) + 0);
+					const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource8) + 1);
+					const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource8) + 2);
+					const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource8) + 3);
+
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 0, v0);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 1, v1);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 2, v2);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 3, v3);
+				}
+			}
 
-		case 16:
-			Memfill128(pDestination, pSource, destByteCount);
-			break;
-	}
-}
+			for(; nByteCount >= 16; nByteCount -= 16, pDest8 += 16, pSource8 += 16)
+				_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource8)));
 
+			// Non-temporal stores are weakly ordered, so we need to fence them before anything
+			// else (e.g. another thread which sees a flag we write next) can rely on the result.
+			_mm_sfence();
 
-// Has similar behavior to the Unix bcmp function but executes the same instructions every 
-// time and thus executes in the same amount of time for a given byteCount. Assumes that the 
-// CPU executes the instructions below equivalently for all input byte combinations,
-// as is usually the case for logical integer operations.
-EASTDC_API bool TimingSafeMemEqual(const void* pMem1, const void* pMem2, size_t byteCount)
-{
-	const char* p1 = (const char*)pMem1;
-	const char* p2 = (const char*)pMem2;
-	char mask = 0;
+			memcpy(pDest8, pSource8, nByteCount);
+		#else
+			memcpy(pDestination, pSource, nByteCount);
+		#endif
+	}
 
-	for(; byteCount > 0; ++p1, ++p2, --byteCount)
-		mask |= (*p1 ^ *p2);    // Accumulate any differences between the memory.
 
-	return (mask == 0);  // Concern: If the compiler sees the contents of pMem1 and pMem2 then it may optimize away the code above. In practice the compiler won't be able to see that in the use cases that matter to users.
-}
+	EASTDC_API void MemsetNonTemporal(void* pDestination, uint8_t c, size_t uint8Count)
+	{
+		#if EA_SSE >= 2
+			uint8_t* pDest8 = static_cast<uint8_t*>(pDestination);
 
+			const size_t headSize = (size_t)((0 - (uintptr_t)pDest8) & 15);
 
-// Has the same behavior as memcmp, but executes the same instructions every time and
-// thus executes in the same amount of time for a given byteCount. Assumes that the 
-// CPU executes the instructions below equivalently for all input byte combinations,
-// as is usually the case for logical integer operations.
-EASTDC_API int TimingSafeMemcmp(const void* pMem1, const void* pMem2, size_t byteCount)
-{
-	const uint8_t* p1 = static_cast<const uint8_t*>(pMem1);
-	const uint8_t* p2 = static_cast<const uint8_t*>(pMem2);
-	int result = 0;
+			if(headSize >= uint8Count)
+			{
+				memset(pDest8, c, uint8Count);
+				return;
+			}
 
-	while(byteCount--) // Walk through the bytes from back to front and recalculate the difference if one is encountered.
-	{
-		const int c1   = p1[byteCount];
-		const int c2   = p2[byteCount];
-		const int mask = (((c1 ^ c2) - 1) >> 8); // The result of the following is that mask is -1 (*p1 == *p2) or 0 (*p1 != *p2).
-		result &= mask;                          // If (*p1 == *p2) then mask is 0xffffffff and result is unchanged. Else result will is reset to 0 (to be updated on the next line).
-		result += (c1 - c2);                     // If (*p1 == *p2) then this adds 0 and result is unchanged. Else result will be (*p1 - *p2).
-	}                                            // The return value will be equal to the difference of the first unequal bytes.
+			memset(pDest8, c, headSize);
+			pDest8     += headSize;
+			uint8Count -= headSize;
 
-	return result;
-}
+			const __m128i v = _mm_set1_epi8((char)c);
+
+			for(; uint8Count >= 64; uint8Count -= 64, pDest8 += 64)
+			{
+				_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 0, v);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 1, v);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 2, v);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8) + 3, v);
+			}
 
+			for(; uint8Count >= 16; uint8Count -= 16, pDest8 += 16)
+				_mm_stream_si128(reinterpret_cast<__m128i*>(pDest8), v);
 
-EASTDC_API bool TimingSafeMemIsClear(const void* pMem, size_t byteCount)
-{
-	uint32_t mask = 0;
-	const uint8_t* p = static_cast<const uint8_t*>(pMem);
+			_mm_sfence();
 
-	while(byteCount--)
-		mask |= *p++;
+			memset(pDest8, c, uint8Count);
+		#else
+			memset(pDestination, c, uint8Count);
+		#endif
+	}
 
-	return (mask == 0);   // Concern: If the compiler sees the contents of pMem then it may optimize away the code above. In practice the compiler won't be able to see that in the use cases that matter to users.
-}
+} // namespace Internal
 
 
 
@@ -0,0 +1,381 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) Electronic Arts Inc. All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Implements MemcpyParallel, MemsetParallel and MemTouchParallel.
+//
+// A block is divided into chunks whose boundaries are page-aligned in the
+// destination. The chunks are jobs which are run by a ParallelJobRunner,
+// which is either user-supplied (e.g. an adapter for a game's job system) or
+// the internal MemoryParallelPool. There are a few more chunks than threads,
+// so that a thread which is delayed (e.g. descheduled) doesn't hold up the
+// others for long.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <EAStdC/internal/Config.h>
+#include <EAStdC/EAMemory.h>
+#include <string.h>
+#if EASTDC_THREADING_SUPPORTED
+	#include <eathread/eathread.h>
+	#include <eathread/eathread_atomic.h>
+	#include <eathread/eathread_semaphore.h>
+	#include <eathread/eathread_thread.h>
+#endif
+
+
+namespace EA
+{
+namespace StdC
+{
+
+namespace Internal
+{
+	const size_t kMemoryParallelPageSize     = 4096;
+	const size_t kMemoryParallelChunkMin     = 1048576; // Chunks smaller than this aren't worth a separate job.
+	const size_t kMemoryParallelChunksPerJob = 4;       // Chunks per thread.
+
+
+	enum MemoryParallelOperation
+	{
+		kMemoryParallelCopy,
+		kMemoryParallelSet,
+		kMemoryParallelTouch
+	};
+
+
+	// Describes a MemcpyParallel, MemsetParallel or MemTouchParallel operation.
+	// Chunk i covers [GetChunkBegin(i), GetChunkBegin(i + 1)). All but the first chunk begin
+	// at a page-aligned destination address, as mChunkSize is a multiple of the page size.
+	struct MemoryParallelJob
+	{
+		MemoryParallelOperation mOperation;
+		uint8_t*                mpDestination;
+		const uint8_t*          mpSource;       // Used by kMemoryParallelCopy.
+		uint8_t                 mValue;         // Used by kMemoryParallelSet.
+		size_t                  mByteCount;
+		size_t                  mChunkSize;
+		size_t                  mChunkCount;
+
+		size_t GetChunkBegin(size_t i) const
+		{
+			if(i == 0)
+				return 0;
+
+			const size_t pageOffset = (size_t)((uintptr_t)mpDestination & (kMemoryParallelPageSize - 1));
+			const size_t chunkBegin = (i * mChunkSize) - pageOffset;
+
+			return (chunkBegin < mByteCount) ? chunkBegin : mByteCount;
+		}
+	};
+
+
+	static void MemoryParallelJobFunction(void* pJobContext, size_t jobIndex)
+	{
+		const MemoryParallelJob* const pJob   = static_cast<const MemoryParallelJob*>(pJobContext);
+		const size_t                   nBegin = pJob->GetChunkBegin(jobIndex);
+		const size_t                   nCount = pJob->GetChunkBegin(jobIndex + 1) - nBegin;
+
+		// The block as a whole is much larger than the cache, so there's no point
+		// in writing it through the cache unless the configuration says otherwise.
+		switch(pJob->mOperation)
+		{
+			case kMemoryParallelCopy:
+				if(pJob->mByteCount >= EASTDC_MEMORY_STREAMING_THRESHOLD)
+					MemcpyNonTemporal(pJob->mpDestination + nBegin, pJob->mpSource + nBegin, nCount);
+				else
+					memcpy(pJob->mpDestination + nBegin, pJob->mpSource + nBegin, nCount);
+				break;
+
+			case kMemoryParallelSet:
+				if(pJob->mByteCount >= EASTDC_MEMORY_STREAMING_THRESHOLD)
+					MemsetNonTemporal(pJob->mpDestination + nBegin, pJob->mValue, nCount);
+				else
+					memset(pJob->mpDestination + nBegin, pJob->mValue, nCount);
+				break;
+
+			case kMemoryParallelTouch:
+				MemTouch(pJob->mpDestination + nBegin, nCount);
+				break;
+		}
+	}
+
+
+	#if EASTDC_THREADING_SUPPORTED
+		// A fixed set of worker threads which run the jobs of one ParallelJobRunner call at a time,
+		// together with the thread that called Run. Each call posts the start semaphore once per worker
+		// and then waits until every worker has reported back via the done semaphore. That way no
+		// worker can still be looking at the state of a previous call when the next call begins.
+		class MemoryParallelPool
+		{
+		public:
+			MemoryParallelPool(int threadCount);
+		   ~MemoryParallelPool();
+
+			int  GetThreadCount() const { return mThreadCount; }
+			void Run(ParallelJobFunction pJobFunction, void* pJobContext, size_t jobCount);
+
+		protected:
+			static intptr_t ThreadFunction(void* pContext);
+			void RunJobs();
+
+			int                     mThreadCount;       // The requested thread count, including the thread that calls Run.
+			int                     mWorkerCount;       // The number of threads actually started.
+			EA::Thread::Thread      mThreads[EASTDC_MEMORY_PARALLEL_THREAD_MAX];
+			EA::Thread::Semaphore   mStartSemaphore;
+			EA::Thread::Semaphore   mDoneSemaphore;
+			EA::Thread::AtomicInt32 mNextJob;           // The index of the next job to be claimed.
+			EA::Thread::AtomicInt32 mWorkersPending;    // The number of workers which haven't yet finished with the current call.
+			ParallelJobFunction     mpJobFunction;
+			void*                   mpJobContext;
+			size_t                  mJobCount;
+			bool                    mbShutdown;
+		};
+
+
+		MemoryParallelPool::MemoryParallelPool(int threadCount)
+		  : mThreadCount(threadCount),
+			mWorkerCount(0),
+			mStartSemaphore(0),
+			mDoneSemaphore(0),
+			mNextJob(0),
+			mWorkersPending(0),
+			mpJobFunction(NULL),
+			mpJobContext(NULL),
+			mJobCount(0),
+			mbShutdown(false)
+		{
+			EA::Thread::ThreadParameters threadParameters;
+			threadParameters.mpName = "EAStdCMemory"; // Some platforms have an extremely limited thread name buffer.
+
+			for(int i = 0; (i < (threadCount - 1)) && (i < EASTDC_MEMORY_PARALLEL_THREAD_MAX); i++)
+			{
+				if(mThreads[i].Begin(ThreadFunction, this, &threadParameters) == EA::Thread::kThreadIdInvalid)
+					break;
+				mWorkerCount++;
+			}
+		}
+
+
+		MemoryParallelPool::~MemoryParallelPool()
+		{
+			mbShutdown = true;
+
+			if(mWorkerCount)
+				mStartSemaphore.Post(mWorkerCount);
+
+			for(int i = 0; i < mWorkerCount; i++)
+				mThreads[i].WaitForEnd();
+		}
+
+
+		void MemoryParallelPool::Run(ParallelJobFunction pJobFunction, void* pJobContext, size_t jobCount)
+		{
+			mpJobFunction = pJobFunction;
+			mpJobContext  = pJobContext;
+			mJobCount     = jobCount;
+			mWorkersPending.SetValue(mWorkerCount);
+			mNextJob.SetValue(0);
+
+			if(mWorkerCount)
+				mStartSemaphore.Post(mWorkerCount);
+
+			RunJobs();
+
+			if(mWorkerCount)
+				mDoneSemaphore.Wait();
+		}
+
+
+		void MemoryParallelPool::RunJobs()
+		{
+			for(size_t i; (i = (size_t)(mNextJob.Increment() - 1)) < mJobCount; )
+				mpJobFunction(mpJobContext, i);
+		}
+
+
+		intptr_t MemoryParallelPool::ThreadFunction(void* pContext)
+		{
+			MemoryParallelPool* const pPool = static_cast<MemoryParallelPool*>(pContext);
+
+			for(;;)
+			{
+				pPool->mStartSemaphore.Wait();
+
+				if(pPool->mbShutdown)
+					break;
+
+				pPool->RunJobs();
+
+				if(pPool->mWorkersPending.Decrement() == 0)
+					pPool->mDoneSemaphore.Post();
+			}
+
+			return 0;
+		}
+
+
+		static MemoryParallelPool*     gpMemoryParallelPool = NULL;
+		static EA::Thread::AtomicInt32 gMemoryParallelPoolBusy(0); // Non-zero while a thread is using (or creating) gpMemoryParallelPool.
+	#endif
+
+
+	static ParallelJobRunner gpParallelJobRunner        = NULL;
+	static void*             gpParallelJobRunnerContext = NULL;
+	static size_t            gParallelConcurrency       = 0;
+
+
+	static size_t GetMemoryParallelConcurrency()
+	{
+		if(gParallelConcurrency)
+			return gParallelConcurrency;
+
+		#if EASTDC_THREADING_SUPPORTED
+			const int processorCount = EA::Thread::GetProcessorCount();
+
+			if(processorCount > 1)
+				return (processorCount < EASTDC_MEMORY_PARALLEL_THREAD_MAX) ? (size_t)processorCount : (size_t)EASTDC_MEMORY_PARALLEL_THREAD_MAX;
+		#endif
+
+		return 1;
+	}
+
+
+	static void MemoryParallelRun(MemoryParallelJob& job)
+	{
+		if(gpParallelJobRunner)
+		{
+			gpParallelJobRunner(MemoryParallelJobFunction, &job, job.mChunkCount, gpParallelJobRunnerContext);
+			return;
+		}
+
+		#if EASTDC_THREADING_SUPPORTED
+			if(gMemoryParallelPoolBusy.SetValueConditional(1, 0))
+			{
+				const int threadCount = (int)GetMemoryParallelConcurrency();
+
+				if(gpMemoryParallelPool && (gpMemoryParallelPool->GetThreadCount() != threadCount))
+				{
+					EASTDC_DELETE gpMemoryParallelPool;
+					gpMemoryParallelPool = NULL;
+				}
+
+				if(!gpMemoryParallelPool)
+					gpMemoryParallelPool = EASTDC_NEW(EASTDC_ALLOC_PREFIX "MemoryParallelPool") MemoryParallelPool(threadCount);
+
+				gpMemoryParallelPool->Run(MemoryParallelJobFunction, &job, job.mChunkCount);
+				gMemoryParallelPoolBusy.SetValue(0);
+				return;
+			}
+		#endif
+
+		for(size_t i = 0; i < job.mChunkCount; i++)
+			MemoryParallelJobFunction(&job, i);
+	}
+
+
+	// Returns false if the operation isn't worth doing in parallel.
+	static bool MemoryParallelSetup(MemoryParallelJob& job, void* pDestination, size_t nByteCount)
+	{
+		if(nByteCount < EASTDC_MEMORY_PARALLEL_THRESHOLD)
+			return false;
+
+		const size_t concurrency = GetMemoryParallelConcurrency();
+
+		if(concurrency < 2)
+			return false;
+
+		size_t chunkSize = nByteCount / (concurrency * kMemoryParallelChunksPerJob);
+		if(chunkSize < kMemoryParallelChunkMin)
+			chunkSize = kMemoryParallelChunkMin;
+		chunkSize = (chunkSize + (kMemoryParallelPageSize - 1)) & ~(kMemoryParallelPageSize - 1);
+
+		const size_t pageOffset = (size_t)((uintptr_t)pDestination & (kMemoryParallelPageSize - 1));
+
+		job.mpDestination = static_cast<uint8_t*>(pDestination);
+		job.mByteCount    = nByteCount;
+		job.mChunkSize    = chunkSize;
+		job.mChunkCount   = (nByteCount + pageOffset + (chunkSize - 1)) / chunkSize;
+
+		return true;
+	}
+
+
+	EASTDC_API void MemoryParallelShutdown()
+	{
+		#if EASTDC_THREADING_SUPPORTED
+			// Wait for any MemcpyParallel call that is using the pool to finish, and hold the 
+			// busy flag so that no new call can start using the pool while it's being destroyed.
+			while(!gMemoryParallelPoolBusy.SetValueConditional(1, 0))
+				EA::Thread::ThreadSleep(EA::Thread::kTimeoutYield);
+
+			EASTDC_DELETE gpMemoryParallelPool;
+			gpMemoryParallelPool = NULL;
+			gMemoryParallelPoolBusy.SetValue(0);
+		#endif
+	}
+
+} // namespace Internal
+
+
+
+EASTDC_API char* MemcpyParallel(void* pDestination, const void* pSource, size_t nByteCount)
+{
+	Internal::MemoryParallelJob job;
+
+	if(!Internal::MemoryParallelSetup(job, pDestination, nByteCount))
+		return Memcpy(pDestination, pSource, nByteCount);
+
+	job.mOperation = Internal::kMemoryParallelCopy;
+	job.mpSource   = static_cast<const uint8_t*>(pSource);
+	job.mValue     = 0;
+	Internal::MemoryParallelRun(job);
+
+	return static_cast<char*>(pDestination);
+}
+
+
+EASTDC_API uint8_t* MemsetParallel(void* pDestination, uint8_t c, size_t uint8Count)
+{
+	Internal::MemoryParallelJob job;
+
+	if(!Internal::MemoryParallelSetup(job, pDestination, uint8Count))
+		return Memset8(pDestination, c, uint8Count);
+
+	job.mOperation = Internal::kMemoryParallelSet;
+	job.mpSource   = NULL;
+	job.mValue     = c;
+	Internal::MemoryParallelRun(job);
+
+	return static_cast<uint8_t*>(pDestination);
+}
+
+
+EASTDC_API void MemTouchParallel(void* p, size_t n)
+{
+	Internal::MemoryParallelJob job;
+
+	if(!Internal::MemoryParallelSetup(job, p, n))
+	{
+		MemTouch(p, n);
+		return;
+	}
+
+	job.mOperation = Internal::kMemoryParallelTouch;
+	job.mpSource   = NULL;
+	job.mValue     = 0;
+	Internal::MemoryParallelRun(job);
+}
+
+
+EASTDC_API void SetParallelJobRunner(ParallelJobRunner pRunner, void* pRunnerContext, size_t concurrency)
+{
+	Internal::gpParallelJobRunner        = pRunner;
+	Internal::gpParallelJobRunnerContext = pRunnerContext;
+	Internal::gParallelConcurrency       = concurrency;
+}
+
+
+} // namespace StdC
+} // namespace EA
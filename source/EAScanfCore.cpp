@@ -6,6 +6,7 @@
 #include <EAStdC/internal/Config.h>
 #include <EAStdC/EAScanf.h>
 #include <EAStdC/internal/ScanfCore.h>
+#include <EAStdC/internal/StringToDouble.h>
 #include <EAStdC/EAString.h>
 #include <EAStdC/EACType.h>
 #include <EAStdC/EAMathHelp.h>
@@ -258,39 +259,29 @@ int StringReader32(ReadAction readAction, int /*value*/, void* pContext)
 //    How to Read Floating Point Numbers Accurately
 //    Correctly Rounded Binary-Decimal and Decimal-Binary Conversions
 //
-const double powerTable[18] = { 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11 };
-
+// We use the same Eisel-Lemire conversion as StrtodEnglish, which is exact 
+// for up to 19 significant digits. Beyond that it is exact unless the 
+// leading 19 digits don't determine the result, in which case we fall 
+// back to the system provided strtod.
+//
 double DoubleValue::ToDouble() const
 {
-	if(mExponent >= -6 && mExponent <= 11) // If we can handle the result quickly and accurately with a simple implementation...
-	{
-		// We could handle exponents bigger than this if we used a bigger table or (better) if we 
-		// wrote code that allowed us to apply a multiplier to the existing table. On the other hand,
-		// for our purposes it is uncommon to work with such huge numbers.
-		double result = 0.0;
+	const int kMantissaDigitCountMax = 19; // The most decimal digits that always fit in 64 bits.
+	const int nMantissaDigitCount    = (mSigLen < kMantissaDigitCountMax) ? mSigLen : kMantissaDigitCountMax;
+	uint64_t  nMantissa              = 0;
+	bool      bTruncated             = false;
+	double    result;
 
-		for(int i = 0; i < mSigLen; ++i)
-			result = (result * 10.0) + (float)(mSigStr[i] - '0');
+	for(int i = 0; i < nMantissaDigitCount; ++i)
+		nMantissa = (nMantissa * 10) + (uint64_t)(mSigStr[i] - '0');
 
-		result *= powerTable[mExponent + 6];  // +6 because our smallest exponent above is 1e-6
+	for(int i = nMantissaDigitCount; i < mSigLen; ++i)
+		bTruncated |= (mSigStr[i] != '0');
 
+	if(Internal::DecimalToDouble(nMantissa, (int64_t)mExponent + (mSigLen - nMantissaDigitCount), bTruncated, result))
 		return result;
-	}
 	else
 	{
-		// Negative exponents mean the number has a fractional component. 
-		// However, floating point hardware can't perfectly represent decimal
-		// fractions. A result of this, as noted in the above papers, is that
-		// a simple loop which multiplies by 10 won't yield an ideal floating 
-		// point representation for all decimal values. In the absence of 
-		// FPU hardware support for decimal to binary conversions, the only 
-		// way to achieve the ideal solution is to use an iterative approximating
-		// algorithm.
-		//
-		// Until we implement that algorithm we do a fallback to the system
-		// provided strtod function, which in many cases will implement such 
-		// an algorithm itself internally.
-
 		char buffer[kMaxSignificandDigits + 12];
 		int     i;
 
@@ -327,7 +318,7 @@ double DoubleValue::ToDouble() const
 
 		buffer[i] = 0;
 
-		return strtod(buffer, NULL);  // This is not a fast function. That's why we want to replace it.
+		return strtod(buffer, NULL); // The buffer has no decimal point, so this doesn't depend on the locale.
 	}
 }
 
@@ -1587,10 +1578,8 @@ private:
 				{
 					if(Isdigit((CharT)c))
 					{
-						nExponent = (nExponent * 10) + (c - '0');
-
-						if(nExponent > kMaxDoubleExponent)
-							bOverflow = 1;
+						if(nExponent < 100000) // Beyond this the result is zero or infinity regardless, so we stop accumulating before nExponent itself overflows.
+							nExponent = (nExponent * 10) + (c - '0');
 
 						c = pReadFunction(kReadActionRead, 0, pContext);
 						nFieldCount++;
@@ -1731,16 +1720,19 @@ private:
 			// doubleValue.mSigStr[0] = '0';  // Leave nExponent as it is, which is probably zero.
 		}
 
-		doubleValue.mExponent = (int16_t)(nExponent + nExponentAdd);
+		// The value is 0.ddd * 10^nPointPosition. Outside of the range below it is certain to round to 
+		// zero or to overflow. Inside it ToDouble does the exact conversion, including for denormalized 
+		// values, which the DBL_MIN_10_EXP and DBL_MAX_10_EXP based check we used to do here rejected.
+		const int nPointPosition = nExponent + nExponentAdd + doubleValue.mSigLen;
 
-		if((doubleValue.mExponent < kMinDoubleExponent) || (doubleValue.mExponent > kMaxDoubleExponent))
+		if((nPointPosition < (kMinDoubleExponent - 16)) || (nPointPosition > (kMaxDoubleExponent + 1)))
 			bOverflow = 1;
 		// Note that it's still possible to have overflow if the exponent is present and less than max.
 
 		if(bOverflow)
 		{
-			if(bExponentNegative)       // If the value is very small, return zero.
-				return 0.0;
+			if(nPointPosition < 0)      // If the value is very small, return zero.
+				return bNegative ? -0.0 : 0.0;
 			else
 			{
 				// We don't set errno here; instead we set it in the caller.
@@ -1753,6 +1745,8 @@ private:
 			}
 		}
 
+		doubleValue.mExponent = (int16_t)(nExponent + nExponentAdd);
+
 		dValue = doubleValue.ToDouble();
 
 		if(dValue > DBL_MAX)   // If the value is denormalized too big...
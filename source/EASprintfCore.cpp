@@ -5,6 +5,8 @@
 
 #include <EAStdC/internal/Config.h>
 #include <EAStdC/internal/SprintfCore.h>
+#include <EAStdC/internal/IntToString.h>
+#include <EAStdC/internal/DoubleToString.h>
 #include <EAStdC/EAMathHelp.h>
 #include <EAStdC/EAString.h>
 #include <EAAssert/eaassert.h>
@@ -309,8 +311,7 @@ static int WriteLeftPadding(int(*pWriteFunction)(const CharT* EA_RESTRICT pData,
 		{    // Skip zero fill for leading sign character.
 			if(pWriteFunction(pBufferData, 1, pWriteFunctionContext, kWFSIntermediate) == -1)
 				return -1; // This is an error; not the same as running out of space.
-			--nWriteCount;
-			++pBufferData;
+			++pBufferData; // nWriteCount still includes the sign, as the sign counts towards the width.
 		}
 	}
 	else
@@ -843,6 +844,11 @@ const CharT* ReadFormat(const CharT* EA_RESTRICT pFormat, SprintfLocal::FormatDa
 			   fd.mnPrecision = 6;    // The C99 standard explicitly states that this defaults to 6.
 			break;
 
+		case 'r': // Shortest round-trip double. This is a convenient extension that we add.
+		case 'R':
+			fd.mnPrecision = 0;       // The precision is ignored, as the value determines the number of digits.
+			break;
+
 		case 'p':
 			if(sizeof(void*) == 2)
 				fd.mModifier = kModifierInt16;
@@ -939,8 +945,6 @@ CharT* WriteLongHelper(const SprintfLocal::FormatData& fd, ValueT lValue, CharT*
 
 	UValueT       ulValue = (UValueT)lValue;
 	unsigned int  nBase;
-	unsigned int  nShift = 0;
-	unsigned int  nAnd = 0;
 	Sign          sign = kSignNone;
 	CharT*        pCurrent = pBufferEnd;
 	int           nDigitCount = 0;
@@ -949,21 +953,17 @@ CharT* WriteLongHelper(const SprintfLocal::FormatData& fd, ValueT lValue, CharT*
 
 	*--pCurrent = 0;
 
-	if((lValue > 0) || (fd.mnPrecision > 0) || fd.mbAlternativeForm)
+	if((ulValue != 0) || (fd.mnPrecision > 0) || fd.mbAlternativeForm) // Test ulValue rather than lValue, as unsigned values with the high bit set are passed as negative lValues.
 	{
 		// Do initial setup. 
 		switch(fd.mnType)
 		{
 			case 'b': // Binary (this is non-standard, though many would like it to be so)
-				nBase  = 2;
-				nShift = 0x01;
-				nAnd   = 0x01;
+				nBase = 2;
 				break;
 
 			case 'o': // Octal
-				nBase  = 8;
-				nShift = 0x03;
-				nAnd   = 0x07;
+				nBase = 8;
 				break;
 
 			case 'd': // Decimal (signed)
@@ -984,52 +984,33 @@ CharT* WriteLongHelper(const SprintfLocal::FormatData& fd, ValueT lValue, CharT*
 
 			case 'x': // Hexidecimal
 			case 'X':
-				nBase  = 16;
-				nShift = 0x04;
-				nAnd   = 0x0f;
+				nBase = 16;
 				break;
 		}
 
 		// Write the individual digits.
-		// To do: Use the optimization in EAString.cpp's X64toaCommon10 function 
-		// to significantly improve writing base 10 strings. 
-		// Optimization: Replace the % and / below with >> and & for cases where
-		// we can do this (i.e. nBase = even power of two).
-		do
+		if((nBase == 10) && fd.mbDisplayThousands)
 		{
-			int nDigit;
-
-			if(nBase == 10)
+			do
 			{
-				nDigit = (int)(ulValue % nBase);
-				ulValue /= nBase;
-			}
-			else // Else take faster pathway.
-			{
-				nDigit = (int)(ulValue & nAnd);
-				ulValue >>= nShift;
-			}
+				*--pCurrent = (CharT)('0' + (int)(ulValue % 10));
+				ulValue /= 10;
+				++nDigitCount;
 
-			if(nDigit < 10)
-				nDigit = '0' + nDigit;
-			else
-			{
-				nDigit -= 10;
-				if(fd.mnType == 'x')
-					nDigit = 'a' + nDigit;
-				else
-					nDigit = 'A' + nDigit;
-			}
-
-			*--pCurrent = (CharT)nDigit;
-			++nDigitCount;
+				if((ulValue > 0) && (((nDigitCount + 1) % 4) == 0))
+				{
+					*--pCurrent = (CharT)fd.mThousandsSeparator;
+					++nDigitCount; // Even though the thousands separator isn't strictly a digit, it counts towards the space used by the number, which is what matters here.
+				}
+			} while(ulValue > 0);
+		}
+		else
+		{
+			CharT* const pDigitsEnd = pCurrent;
 
-			if((nBase == 10) && (fd.mbDisplayThousands) && (ulValue > 0) && (((nDigitCount + 1) % 4) == 0))
-			{
-				*--pCurrent = (CharT)fd.mThousandsSeparator;
-				++nDigitCount; // Even though the thousands separator isn't strictly a digit, it counts towards the space used by the number, which is what matters here.
-			}
-		} while(ulValue > 0);
+			pCurrent    = Internal::WriteIntegerBackward((uint64_t)ulValue, pCurrent, nBase, (fd.mnType == 'X'));
+			nDigitCount = (int)(pDigitsEnd - pCurrent);
+		}
 
 		// For octal mode, the standard specifies that when 'alternative form' is enabled, 
 		// the number is prefixed with a zero. This is like how the C language interprets 
@@ -1181,6 +1162,20 @@ CharT* WriteDouble(const SprintfLocal::FormatData& fd, double dValue, CharT* EA_
 
 		switch(nType)
 		{
+			case 'r':
+			case 'R':
+			{
+				// Write the fewest digits that read back as dValue, in the notation of FtoaShortest.
+				CharT        pBufferShortest[Internal::kShortestDoubleLengthMax];
+				const CharT* pShortestEnd = Internal::WriteShortestDouble(dValue, pBufferShortest, (CharT)fd.mDecimalPoint, (CharT)((nType == 'r') ? 'e' : 'E'));
+
+				while(pShortestEnd > pBufferShortest)
+					*--pCurrent = *--pShortestEnd;
+
+				nSign = IsNeg(dValue) ? 1 : 0;
+				break;
+			} // case r:
+
 			default :
 			case 'g':
 			case 'G':
@@ -1668,6 +1663,8 @@ int VprintfCoreInternal(int(*pWriteFunction)(const CharT* EA_RESTRICT pData, siz
 				case 'F':
 				case 'g':
 				case 'G':
+				case 'r':
+				case 'R':
 				case 'a': // See the C99 standard, section 7.19.6.1.8, for details on 'a' formatting.
 				case 'A':
 				{
@@ -196,7 +196,7 @@ namespace Internal
 				{
 					case 'b': case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': // If this character is the last posible character of a format specifier...
 					case 'g': case 'G': case 'e': case 'E': case 'f': case 'F': case 'a': 
-					case 'A': case 'p': case 'c': case 'C': case 's': case 'S': case 'n':
+					case 'A': case 'r': case 'R': case 'p': case 'c': case 'C': case 's': case 'S': case 'n':
 					{
 						// Finalize the current span.
 						spans[spanIndex].mpEnd = p + 1;
@@ -261,6 +261,7 @@ namespace Internal
 
 					case 'g': case 'G': case 'e': case 'E':
 					case 'f': case 'F': case 'a': case 'A':
+					case 'r': case 'R':
 						formatData.mModifier = kModifierDouble;
 						break;
 
@@ -4,6 +4,7 @@
 
 
 #include <EAStdC/EAStdC.h>
+#include <EAStdC/EAMemory.h>
 #include <EAStdC/internal/SprintfCore.h>
 
 
@@ -19,6 +20,7 @@ namespace EA
 		EASTDC_API void Shutdown()
 		{
 			SprintfLocal::EASprintfShutdown();
+			Internal::MemoryParallelShutdown();
 		}
 
 
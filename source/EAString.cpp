@@ -11,6 +11,10 @@
 #include <EAStdC/EAMemory.h>
 #include <EAStdC/EAAlignment.h>
 #include <EAStdC/EABitTricks.h>
+#include <EAStdC/internal/CPUDispatch.h>
+#include <EAStdC/internal/IntToString.h>
+#include <EAStdC/internal/DoubleToString.h>
+#include <EAStdC/internal/StringToDouble.h>
 #include <EAAssert/eaassert.h>
 EA_DISABLE_ALL_VC_WARNINGS()
 #include <string.h>
@@ -56,6 +60,42 @@ namespace StdC
 #endif
 
 
+// Vector helpers shared by the SIMD kernels of the string functions below.
+namespace Internal
+{
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Returns whether a read of nByteCount bytes at p stays within the page p is in.
+		static EA_FORCE_INLINE bool StringReadIsInPage(const void* p, size_t nByteCount)
+		{
+			return ((uintptr_t)p & 4095) <= (4096 - nByteCount);
+		}
+
+		// Returns the vector with 0x20 added to its ASCII upper case letters. The comparisons are signed, 
+		// but chars with the high bit set are negative and so aren't in the range either way.
+		EASTDC_TARGET_SSE2 inline __m128i FoldCharsSSE2(__m128i v, char)     { return _mm_or_si128(v, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8 (v, _mm_set1_epi8 ('A' - 1)), _mm_cmplt_epi8 (v, _mm_set1_epi8 ('Z' + 1))), _mm_set1_epi8 (0x20))); }
+		EASTDC_TARGET_SSE2 inline __m128i FoldCharsSSE2(__m128i v, char16_t) { return _mm_or_si128(v, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16('A' - 1)), _mm_cmplt_epi16(v, _mm_set1_epi16('Z' + 1))), _mm_set1_epi16(0x20))); }
+		EASTDC_TARGET_SSE2 inline __m128i FoldCharsSSE2(__m128i v, char32_t) { return _mm_or_si128(v, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32('A' - 1)), _mm_cmplt_epi32(v, _mm_set1_epi32('Z' + 1))), _mm_set1_epi32(0x20))); }
+		EASTDC_TARGET_SSE2 inline __m128i CharsEqualSSE2(__m128i a, __m128i b, char)     { return _mm_cmpeq_epi8 (a, b); }
+		EASTDC_TARGET_SSE2 inline __m128i CharsEqualSSE2(__m128i a, __m128i b, char16_t) { return _mm_cmpeq_epi16(a, b); }
+		EASTDC_TARGET_SSE2 inline __m128i CharsEqualSSE2(__m128i a, __m128i b, char32_t) { return _mm_cmpeq_epi32(a, b); }
+
+		EASTDC_TARGET_AVX2 inline __m256i FoldCharsAVX2(__m256i v, char)     { return _mm256_or_si256(v, _mm256_and_si256(_mm256_andnot_si256(_mm256_cmpgt_epi8 (v, _mm256_set1_epi8 ('Z')), _mm256_cmpgt_epi8 (v, _mm256_set1_epi8 ('A' - 1))), _mm256_set1_epi8 (0x20))); }
+		EASTDC_TARGET_AVX2 inline __m256i FoldCharsAVX2(__m256i v, char16_t) { return _mm256_or_si256(v, _mm256_and_si256(_mm256_andnot_si256(_mm256_cmpgt_epi16(v, _mm256_set1_epi16('Z')), _mm256_cmpgt_epi16(v, _mm256_set1_epi16('A' - 1))), _mm256_set1_epi16(0x20))); }
+		EASTDC_TARGET_AVX2 inline __m256i FoldCharsAVX2(__m256i v, char32_t) { return _mm256_or_si256(v, _mm256_and_si256(_mm256_andnot_si256(_mm256_cmpgt_epi32(v, _mm256_set1_epi32('Z')), _mm256_cmpgt_epi32(v, _mm256_set1_epi32('A' - 1))), _mm256_set1_epi32(0x20))); }
+		EASTDC_TARGET_AVX2 inline __m256i CharsEqualAVX2(__m256i a, __m256i b, char)     { return _mm256_cmpeq_epi8 (a, b); }
+		EASTDC_TARGET_AVX2 inline __m256i CharsEqualAVX2(__m256i a, __m256i b, char16_t) { return _mm256_cmpeq_epi16(a, b); }
+		EASTDC_TARGET_AVX2 inline __m256i CharsEqualAVX2(__m256i a, __m256i b, char32_t) { return _mm256_cmpeq_epi32(a, b); }
+
+		EASTDC_TARGET_SSE2 inline __m128i SetCharsSSE2(char c)     { return _mm_set1_epi8((char)c); }
+		EASTDC_TARGET_SSE2 inline __m128i SetCharsSSE2(char16_t c) { return _mm_set1_epi16((short)c); }
+		EASTDC_TARGET_SSE2 inline __m128i SetCharsSSE2(char32_t c) { return _mm_set1_epi32((int)c); }
+		EASTDC_TARGET_AVX2 inline __m256i SetCharsAVX2(char c)     { return _mm256_set1_epi8((char)c); }
+		EASTDC_TARGET_AVX2 inline __m256i SetCharsAVX2(char16_t c) { return _mm256_set1_epi16((short)c); }
+		EASTDC_TARGET_AVX2 inline __m256i SetCharsAVX2(char32_t c) { return _mm256_set1_epi32((int)c); }
+	#endif
+}
+
+
 EASTDC_API char* Strcpy(char* pDestination, const char* pSource)
 {
 	const char* s = pSource;
@@ -588,228 +628,976 @@ EA_FORCE_INLINE bool EncodeCodePoint(uint32_t c, char32_t*& pDestStart, char32_t
 	return true;
 }
 
-template <typename InCharT, typename OutCharT>
-bool StrlcpyInternal(OutCharT* pDest, const InCharT* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	EA_ASSERT(pDest != nullptr && pSource != nullptr);
+// UTF8ToUTF16 / UTF8ToUTF32 / UTF16ToUTF8 / UTF32ToUTF8 kernels, called by the transcoding 
+// Strlcpy functions via the CPU dispatch table. Each converts as long a run at the beginning 
+// of the source as it can handle quickly and returns the number of source chars it converted, 
+// leaving everything else (including 0 chars, invalid encodings and running out of destination
+// capacity) to the general code point by code point loops below. Thus it's always correct for 
+// a kernel to convert less, and the results are identical to those of the general code alone.
+// pDest may be NULL, in which case the output is only counted. Otherwise at most nDestCapacity 
+// chars are written and no terminating 0 is written. All nSourceLength chars must be readable.
+//
+// There are only SIMD versions, as the general code is as fast as a scalar kernel would be, 
+// and the scalar table entries are NULL. The kernels handle ASCII and 2 and 3 byte UTF-8 
+// sequences, which covers all of the BMP and thus practically all localized text. Their 
+// UTF-8 decoder checks a block of 16 bytes at a time for being a valid sequence of whole 
+// characters, in the same way as the general code does, and converts it with vector 
+// arithmetic. 4 byte sequences are left to the general code.
+namespace Internal
+{
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Writes the 16 ASCII chars in v to p.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE void UTF8WidenASCIISSE2(char16_t* p, __m128i v)
+		{
+			const __m128i zero = _mm_setzero_si128();
 
-	// If we have no capacity, then just return nothing
-	if(nDestCapacity == 0)
-	{
-		nDestUsed = 0;
-		nSourceUsed = 0;
-		return true;
-	}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p),     _mm_unpacklo_epi8(v, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + 8), _mm_unpackhi_epi8(v, zero));
+		}
 
-	const InCharT* pSourceStart = pSource;
-	const InCharT* pSourceEnd = pSource + nSourceLength;
-	if (pSourceEnd < pSourceStart)
-		pSourceEnd = (const InCharT*)(uintptr_t)-1;
-	OutCharT* pDestStart = pDest;
-	OutCharT* pDestEnd = pDest + nDestCapacity - 1;
-	bool bGood = true;
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE void UTF8WidenASCIISSE2(char32_t* p, __m128i v)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i lo   = _mm_unpacklo_epi8(v, zero);
+			const __m128i hi   = _mm_unpackhi_epi8(v, zero);
 
-	while(bGood && (pSource < pSourceEnd) && (pDest < pDestEnd))
-	{
-		uint32_t c = DecodeCodePoint(pSource, pSourceEnd);
-		if (c == 0)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p),      _mm_unpacklo_epi16(lo, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + 4),  _mm_unpackhi_epi16(lo, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + 8),  _mm_unpacklo_epi16(hi, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + 12), _mm_unpackhi_epi16(hi, zero));
+		}
+
+
+		// Decodes the 8 UTF-8 sequences which may begin at the bytes b0, with b1 and b2 being the bytes 
+		// which follow them, and returns the code points as 16 bit values. Only the results for 
+		// bytes which begin valid 1 to 3 byte sequences are meaningful.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE __m128i UTF8DecodeSSE2(__m128i b0, __m128i b1, __m128i b2)
 		{
-			pSource = pSourceEnd;
-			break;
+			const __m128i k3F    = _mm_set1_epi16(0x3f);
+			const __m128i t1     = _mm_and_si128(b1, k3F);
+			const __m128i t2     = _mm_and_si128(b2, k3F);
+			const __m128i value2 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1f)), 6), t1);
+			const __m128i value3 = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(t1, 6)), t2); // The shift by 12 discards the 0xe0 control bits.
+			const __m128i is2    = _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xbf));
+			const __m128i is3    = _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xdf));
+			const __m128i result = _mm_or_si128(_mm_andnot_si128(is2, b0), _mm_and_si128(is2, value2));
+
+			return _mm_or_si128(_mm_andnot_si128(is3, result), _mm_and_si128(is3, value3));
 		}
-		bGood = (c != kUnicodeInvalidDecode) && EncodeCodePoint(c, pDest, pDestEnd);
-	}
 
-	*pDest = 0;
 
-	nDestUsed = pDest - pDestStart;
-	nSourceUsed = pSource - pSourceStart;
-	return bGood;
-}
+		// Converts as much of the 16 bytes at p as consists of whole 1 to 3 byte UTF-8 sequences 
+		// which aren't 0 chars. Returns the number of bytes converted and sets nDestUsed. 
+		// Returns 0 if the block begins with something that's left to the general code or 
+		// the output doesn't fit in nDestCapacity.
+		template <typename OutCharT>
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE size_t UTF8DecodeBlockSSE2(OutCharT* pDest, size_t nDestCapacity, const char* p, size_t& nDestUsed)
+		{
+			const __m128i  v        = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const uint32_t nonASCII = (uint32_t)_mm_movemask_epi8(v);
+			const uint32_t zero     = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
 
-bool Strlcpy(char* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
-}
+			if((nonASCII | zero) == 0)
+			{
+				if(pDest)
+				{
+					if(nDestCapacity < 16)
+						return 0;
+					UTF8WidenASCIISSE2(pDest, v);
+				}
 
-bool Strlcpy(char* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
-}
+				nDestUsed = 16;
+				return 16;
+			}
 
-bool Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
-}
+			// Classify the bytes with signed compares, under which 0x80-0xff are negative.
+			// 2 byte sequences begin with 0xc2-0xdf and 3 byte sequences begin with 0xe0-0xef. 
+			// 0xc0, 0xc1 and 0xf5-0xff are always invalid and 0xf0-0xf4 begin 4 byte sequences. 
+			const uint32_t ascii     = ~(nonASCII | zero) & 0xffff;
+			const uint32_t following = (uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8((char)0xc0)));
+			const uint32_t lead2     = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)0xc1)), _mm_cmplt_epi8(v, _mm_set1_epi8((char)0xe0))));
+			const uint32_t lead3     = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)0xdf)), _mm_cmplt_epi8(v, _mm_set1_epi8((char)0xf0))));
+
+			// We stop at the first byte which isn't part of a 1 to 3 byte sequence, or which begins a sequence that 
+			// extends past the block. Within that, the following bytes must be exactly those which the lead bytes call for.
+			const uint32_t stop      = (~(ascii | following | lead2 | lead3) & 0xffff) | (lead2 & 0x8000) | (lead3 & 0xc000);
+			const uint32_t nCount    = stop ? (uint32_t)CountTrailing0Bits(stop) : 16;
+			const uint32_t window    = (1u << nCount) - 1;
+			const uint32_t expected  = (((lead2 | lead3) & window) << 1) | ((lead3 & window) << 2);
+
+			if(expected != (following & window))
+				return 0;
 
-bool Strlcpy(char16_t* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
-}
+			// 3 byte sequences which begin with 0xe0 must have a second byte of at least 0xa0, else they are overlong.
+			const uint32_t leadE0 = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xe0))) & window;
 
-bool Strlcpy(char32_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
-}
+			if(leadE0 && ((leadE0 << 1) & (uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8((char)0xa0)))))
+				return 0;
 
-bool Strlcpy(char32_t* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
-{
-	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
-}
+			const uint32_t lead = (ascii | lead2 | lead3) & window;
 
-EASTDC_API int Strlcpy(char* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength)
-{
-	size_t destCount = 0;
+			if(lead == 0)
+				return 0;
 
-	while(nSourceLength-- > 0)
-	{
-		uint32_t c = (uint16_t)*pSource++;   // Deal with surrogate characters
+			const size_t nDestCount = (size_t)CountBits(lead);
 
-		// Encode as UTF-8
-		if (c < 0x00000080u)
-		{
-			if(c == 0) // Break on NULL char, even if explicit length was set
-				break;
+			if(pDest)
+			{
+				if(nDestCapacity < nDestCount)
+					return 0;
 
-			if(pDest && ((destCount + 1) < nDestCapacity))
-				*pDest++ = static_cast<char>(c);
+				const __m128i zeroV = _mm_setzero_si128();
+				const __m128i v1    = _mm_srli_si128(v, 1);
+				const __m128i v2    = _mm_srli_si128(v, 2);
+				EA_ALIGN(16) uint16_t values[16];
 
-			destCount += 1;
+				_mm_store_si128(reinterpret_cast<__m128i*>(values),     UTF8DecodeSSE2(_mm_unpacklo_epi8(v, zeroV), _mm_unpacklo_epi8(v1, zeroV), _mm_unpacklo_epi8(v2, zeroV)));
+				_mm_store_si128(reinterpret_cast<__m128i*>(values + 8), UTF8DecodeSSE2(_mm_unpackhi_epi8(v, zeroV), _mm_unpackhi_epi8(v1, zeroV), _mm_unpackhi_epi8(v2, zeroV)));
+
+				for(uint32_t m = lead; m; m &= (m - 1))
+					*pDest++ = (OutCharT)values[CountTrailing0Bits(m)];
+			}
+
+			nDestUsed = nDestCount;
+			return nCount;
 		}
-		else if(c < 0x00000800u)
+
+
+		template <typename OutCharT>
+		EASTDC_TARGET_SSE2 size_t UTF8ToUTFSSE2(OutCharT* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed)
 		{
-			if(pDest && ((destCount + 2) < nDestCapacity))
+			size_t i = 0, d = 0, nBlockDestUsed = 0, n;
+
+			while(((nSourceLength - i) >= 16) && ((n = UTF8DecodeBlockSSE2(pDest ? pDest + d : NULL, nDestCapacity - d, pSource + i, nBlockDestUsed)) != 0))
 			{
-				*pDest++ = static_cast<char>((c >> 6) | 0xc0);
-				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+				i += n;
+				d += nBlockDestUsed;
 			}
 
-			destCount += 2;
+			nDestUsed = d;
+			return i;
 		}
-		else if(c < 0x00010000u)
+
+
+		template <typename OutCharT>
+		EASTDC_TARGET_AVX2 size_t UTF8ToUTFAVX2(OutCharT* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed)
 		{
-			if(pDest && ((destCount + 3) < nDestCapacity))
+			size_t i = 0, d = 0, nBlockDestUsed = 0, n;
+			bool   bASCII = true;
+
+			while((nSourceLength - i) >= 16)
 			{
-				*pDest++ = static_cast<char>((c >> 12) | 0xe0);
-				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+				// ASCII runs are converted 32 bytes at a time, and anything else 16 bytes at a time. 
+				// We try the former only while the blocks are ASCII.
+				if(bASCII && ((nSourceLength - i) >= 32) && (!pDest || ((nDestCapacity - d) >= 32)))
+				{
+					const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSource + i));
+
+					if((_mm256_movemask_epi8(v) | _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_setzero_si256()))) == 0)
+					{
+						if(pDest)
+						{
+							UTF8WidenASCIISSE2(pDest + d,      _mm256_castsi256_si128(v));
+							UTF8WidenASCIISSE2(pDest + d + 16, _mm256_extracti128_si256(v, 1));
+						}
+
+						i += 32;
+						d += 32;
+						continue;
+					}
+				}
+
+				if((n = UTF8DecodeBlockSSE2(pDest ? pDest + d : NULL, nDestCapacity - d, pSource + i, nBlockDestUsed)) == 0)
+					break;
+
+				i += n;
+				d += nBlockDestUsed;
+				bASCII = (nBlockDestUsed == n);
 			}
 
-			destCount += 3;
+			nDestUsed = d;
+			return i;
 		}
-		else if(c < 0x00200000u)
+
+
+		// Loads 8 chars as 16 bit values. Returns a mask with 2 bits (those of _mm_movemask_epi8) 
+		// for each char which is 0 or is outside the BMP and thus can't be converted.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE uint32_t UTF8EncodeLoadSSE2(const char16_t* p, __m128i& v)
 		{
-			if(pDest && ((destCount + 4) < nDestCapacity))
-			{
-				*pDest++ = static_cast<char>((c >> 18) | 0xf0);
-				*pDest++ = static_cast<char>(((c >> 12) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
-			}
+			v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
 
-			destCount += 4;
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_setzero_si128()));
 		}
-		else
+
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE uint32_t UTF8EncodeLoadSSE2(const char32_t* p, __m128i& v)
 		{
-			const uint32_t kIllegalUnicodeChar = 0x0000fffd;
+			const __m128i c0    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i c1    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4));
+			const __m128i zero  = _mm_setzero_si128();
+			const __m128i kHigh = _mm_set1_epi32((int)0xffff0000);
+			const __m128i k8000 = _mm_set1_epi32(0x8000);
+			const __m128i stop0 = _mm_or_si128(_mm_cmpeq_epi32(c0, zero), _mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(c0, kHigh), zero), _mm_set1_epi32(-1)));
+			const __m128i stop1 = _mm_or_si128(_mm_cmpeq_epi32(c1, zero), _mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(c1, kHigh), zero), _mm_set1_epi32(-1)));
 
-			if(pDest && ((destCount + 3) < nDestCapacity))
-			{
-				*pDest++ = static_cast<char>( (kIllegalUnicodeChar >> 12) | 0xe0);
-				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  6) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  0) | 0x80) & 0xbf);
-			}
+			// There is no unsigned saturating 32 to 16 bit pack in SSE2, so we bias the values into the signed range. 
+			// Values outside the BMP are garbage, but they are past the stop.
+			v = _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(c0, k8000), _mm_sub_epi32(c1, k8000)), _mm_set1_epi16((short)0x8000));
 
-			destCount += 3;
+			return (uint32_t)_mm_movemask_epi8(_mm_packs_epi32(stop0, stop1));
 		}
-	}
 
-	if(pDest && nDestCapacity != 0)
-		*pDest = 0;
 
-	return (int)(unsigned)destCount;
-}
+		// Encodes the 4 BMP chars in c, which are 32 bit values, as UTF-8, with the bytes of each in the 
+		// low bytes of its lane.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE __m128i UTF8EncodeSSE2(__m128i c)
+		{
+			const __m128i k3F   = _mm_set1_epi32(0x3f);
+			const __m128i k80   = _mm_set1_epi32(0x80);
+			const __m128i last  = _mm_or_si128(_mm_and_si128(c, k3F), k80);
+			const __m128i value2 = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(c, 6), _mm_set1_epi32(0xc0)), _mm_slli_epi32(last, 8));
+			const __m128i value3 = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(c, 12), _mm_set1_epi32(0xe0)), 
+			                                    _mm_or_si128(_mm_slli_epi32(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 6), k3F), k80), 8), _mm_slli_epi32(last, 16)));
+			const __m128i is2   = _mm_cmpgt_epi32(c, _mm_set1_epi32(0x7f));
+			const __m128i is3   = _mm_cmpgt_epi32(c, _mm_set1_epi32(0x7ff));
+			const __m128i result = _mm_or_si128(_mm_andnot_si128(is2, c), _mm_and_si128(is2, value2));
 
-EASTDC_API int Strlcpy(char* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength)
-{
-	size_t destCount = 0;
+			return _mm_or_si128(_mm_andnot_si128(is3, result), _mm_and_si128(is3, value3));
+		}
 
-	while(nSourceLength-- > 0)
-	{
-		uint32_t c = (uint32_t)*pSource++;   // Deal with surrogate characters
 
-		// Encode as UTF-8
-		if (c < 0x00000080u)
+		// Encodes the 8 chars in v, which all need 1 or 2 bytes, as UTF-8. Returns the bytes of each pair 
+		// of chars in the low bytes of a 32 bit lane.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE __m128i UTF8Encode2SSE2(__m128i v)
 		{
-			if(c == 0) // Break on NULL char, even if explicit length was set
-				break;
+			const __m128i is1   = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xff80)), _mm_setzero_si128());
+			const __m128i value2 = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(v, 6), _mm_set1_epi16(0xc0)), 
+			                                    _mm_slli_epi16(_mm_or_si128(_mm_and_si128(v, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80)), 8));
+			const __m128i pair  = _mm_or_si128(_mm_and_si128(is1, v), _mm_andnot_si128(is1, value2));
 
-			if(pDest && ((destCount + 1) < nDestCapacity))
-				*pDest++ = static_cast<char>(c);
+			// If the first char of a pair needs 1 byte, the second one's bytes move down by 1 byte.
+			const __m128i first1 = _mm_srai_epi32(_mm_slli_epi32(is1, 16), 16);
+			const __m128i joined = _mm_or_si128(_mm_and_si128(pair, _mm_set1_epi32(0xff)), _mm_and_si128(_mm_srli_epi32(pair, 8), _mm_set1_epi32((int)0xffffff00)));
 
-			destCount += 1;
+			return _mm_or_si128(_mm_and_si128(first1, joined), _mm_andnot_si128(first1, pair));
 		}
-		else if(c < 0x00000800u)
+
+
+		// Writes the 8 chars in v, which all need 3 bytes, as 24 bytes of UTF-8. Writes 2 bytes past them.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE void UTF8Encode3SSE2(char* pDest, __m128i v)
 		{
-			if(pDest && ((destCount + 2) < nDestCapacity))
+			const __m128i k3F   = _mm_set1_epi16(0x3f);
+			const __m128i k80   = _mm_set1_epi16(0x80);
+			const __m128i b0    = _mm_or_si128(_mm_srli_epi16(v, 12), _mm_set1_epi16(0xe0));
+			const __m128i b1    = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 6), k3F), k80);
+			const __m128i b2    = _mm_or_si128(_mm_and_si128(v, k3F), k80);
+			const __m128i b01   = _mm_or_si128(b0, _mm_slli_epi16(b1, 8));
+			const __m128i kLow  = _mm_set_epi32(0, -1, 0, -1);
+
+			// Each 32 bit lane gets the 3 bytes of a char, and then each 64 bit lane the 6 bytes of two.
+			const __m128i lo    = _mm_unpacklo_epi16(b01, b2);
+			const __m128i hi    = _mm_unpackhi_epi16(b01, b2);
+			const __m128i lo6   = _mm_or_si128(_mm_and_si128(lo, kLow), _mm_srli_epi64(_mm_andnot_si128(kLow, lo), 8));
+			const __m128i hi6   = _mm_or_si128(_mm_and_si128(hi, kLow), _mm_srli_epi64(_mm_andnot_si128(kLow, hi), 8));
+
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pDest),      lo6);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pDest + 6),  _mm_unpackhi_epi64(lo6, lo6));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pDest + 12), hi6);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pDest + 18), _mm_unpackhi_epi64(hi6, hi6));
+		}
+
+
+		// Converts as many of the 8 chars at p as are non-0 BMP chars. Returns the number of 
+		// chars converted and sets nDestUsed. Returns 0 if the block begins with something 
+		// that's left to the general code or the output doesn't fit in nDestCapacity.
+		template <typename InCharT>
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE size_t UTF8EncodeBlockSSE2(char* pDest, size_t nDestCapacity, const InCharT* p, size_t& nDestUsed)
+		{
+			__m128i v;
+
+			// The masks have 2 bits per char.
+			const uint32_t stop   = UTF8EncodeLoadSSE2(p, v);
+			const uint32_t nCount = stop ? ((uint32_t)CountTrailing0Bits(stop) / 2) : 8;
+
+			if(nCount == 0)
+				return 0;
+
+			const __m128i  zero     = _mm_setzero_si128();
+			const uint32_t window   = (1u << (nCount * 2)) - 1;
+			const uint32_t nonASCII = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xff80)), zero)) & window;
+			const uint32_t need3    = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xf800)), zero)) & window;
+			const uint32_t extra    = (nonASCII & 0x5555) + (need3 & 0x5555); // The number of bytes past the first which each char needs, in 2 bits.
+			const size_t   nDestCount = nCount + (size_t)CountBits((nonASCII & 0x5555) | (need3 & 0xaaaa));
+
+			if(pDest)
 			{
-				*pDest++ = static_cast<char>((c >> 6) | 0xc0);
-				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+				if(nDestCapacity < nDestCount)
+					return 0;
+
+				if(nonASCII == 0)
+				{
+					const __m128i bytes = _mm_packus_epi16(v, zero);
+
+					if(nCount == 8)
+						_mm_storel_epi64(reinterpret_cast<__m128i*>(pDest), bytes);
+					else
+					{
+						EA_ALIGN(16) char buffer[16];
+						_mm_store_si128(reinterpret_cast<__m128i*>(buffer), bytes);
+						memcpy(pDest, buffer, nCount);
+					}
+				}
+				else if(nDestCapacity >= (nDestCount + 8))
+				{
+					// We write more than the output and then undo what we wrote past the end.
+					char* const pDestEnd = pDest + nDestCount;
+					char        saved[8];
+
+					memcpy(saved, pDestEnd, 8);
+
+					if(need3 == 0xffff)
+						UTF8Encode3SSE2(pDest, v);
+					else if((need3 == 0) && (nCount == 8))
+					{
+						// We write the bytes of each pair of chars, which are at most 4, and advance by their length.
+						EA_ALIGN(16) uint32_t values[4];
+						_mm_store_si128(reinterpret_cast<__m128i*>(values), UTF8Encode2SSE2(v));
+
+						for(uint32_t i = 0; i < 4; i++)
+						{
+							memcpy(pDest, values + i, 4);
+							pDest += 2 + ((extra >> (i * 4)) & 1) + ((extra >> (i * 4 + 2)) & 1);
+						}
+					}
+					else
+					{
+						// We write all 4 bytes of each char's lane and advance by its length.
+						EA_ALIGN(16) uint32_t values[8];
+
+						_mm_store_si128(reinterpret_cast<__m128i*>(values),     UTF8EncodeSSE2(_mm_unpacklo_epi16(v, zero)));
+						_mm_store_si128(reinterpret_cast<__m128i*>(values + 4), UTF8EncodeSSE2(_mm_unpackhi_epi16(v, zero)));
+
+						for(uint32_t i = 0; i < nCount; i++)
+						{
+							memcpy(pDest, values + i, 4);
+							pDest += 1 + ((extra >> (i * 2)) & 3);
+						}
+					}
+
+					memcpy(pDestEnd, saved, 8);
+				}
+				else
+				{
+					EA_ALIGN(16) uint32_t values[8];
+
+					_mm_store_si128(reinterpret_cast<__m128i*>(values),     UTF8EncodeSSE2(_mm_unpacklo_epi16(v, zero)));
+					_mm_store_si128(reinterpret_cast<__m128i*>(values + 4), UTF8EncodeSSE2(_mm_unpackhi_epi16(v, zero)));
+
+					for(uint32_t i = 0; i < nCount; i++)
+					{
+						const uint32_t value  = values[i];
+						const uint32_t nExtra = (extra >> (i * 2)) & 3;
+
+						*pDest++ = (char)value;
+						if(nExtra >= 1)
+							*pDest++ = (char)(value >> 8);
+						if(nExtra >= 2)
+							*pDest++ = (char)(value >> 16);
+					}
+				}
 			}
 
-			destCount += 2;
+			nDestUsed = nDestCount;
+			return nCount;
 		}
-		else if(c < 0x00010000u)
+
+
+		// Returns the 16 chars at p narrowed to bytes if they are all ASCII and not 0, else returns false.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE bool UTF8NarrowASCIISSE2(const char16_t* p, __m128i& bytes)
 		{
-			if(pDest && ((destCount + 3) < nDestCapacity))
-			{
-				*pDest++ = static_cast<char>((c >> 12) | 0xe0);
-				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
-			}
+			const __m128i v0    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i v1    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+			const __m128i zero  = _mm_setzero_si128();
+			const __m128i isZero = _mm_or_si128(_mm_cmpeq_epi16(v0, zero), _mm_cmpeq_epi16(v1, zero));
+			const __m128i isLow = _mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(v0, v1), _mm_set1_epi16((short)0xff80)), zero);
 
-			destCount += 3;
+			if((_mm_movemask_epi8(isZero) != 0) || (_mm_movemask_epi8(isLow) != 0xffff))
+				return false;
+
+			bytes = _mm_packus_epi16(v0, v1);
+			return true;
 		}
-		else if(c < 0x00200000u)
-		{
-			if(pDest && ((destCount + 4) < nDestCapacity))
-			{
-				*pDest++ = static_cast<char>((c >> 18) | 0xf0);
-				*pDest++ = static_cast<char>(((c >> 12) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
-			}
 
-			destCount += 4;
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE bool UTF8NarrowASCIISSE2(const char32_t* p, __m128i& bytes)
+		{
+			const __m128i v0    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i v1    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4));
+			const __m128i v2    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+			const __m128i v3    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12));
+			const __m128i zero  = _mm_setzero_si128();
+			const __m128i isZero = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(v0, zero), _mm_cmpeq_epi32(v1, zero)), 
+			                                    _mm_or_si128(_mm_cmpeq_epi32(v2, zero), _mm_cmpeq_epi32(v3, zero)));
+			const __m128i isLow = _mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3)), _mm_set1_epi32((int)0xffffff80)), zero);
+
+			if((_mm_movemask_epi8(isZero) != 0) || (_mm_movemask_epi8(isLow) != 0xffff))
+				return false;
+
+			bytes = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+			return true;
 		}
-		else
+
+
+		template <typename InCharT>
+		EASTDC_TARGET_SSE2 size_t UTFToUTF8SSE2(char* pDest, size_t nDestCapacity, const InCharT* pSource, size_t nSourceLength, size_t& nDestUsed)
 		{
-			// We don't currently support Unicode beyond "Plane 0", as game software has never needed it.
-			// If you have a need for this support, feel free to submit a patch or make a specific request.
-			const uint32_t kIllegalUnicodeChar = 0x0000fffd;
+			size_t  i = 0, d = 0, nBlockDestUsed = 0, n;
+			bool    bASCII = true;
+			__m128i bytes;
 
-			if(pDest && ((destCount + 3) < nDestCapacity))
+			while((nSourceLength - i) >= 8)
 			{
-				*pDest++ = static_cast<char>( (kIllegalUnicodeChar >> 12) | 0xe0);
-				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  6) | 0x80) & 0xbf);
-				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  0) | 0x80) & 0xbf);
+				// ASCII runs are converted 16 chars at a time, and anything else 8 chars at a time. 
+				// We try the former only while the blocks are ASCII.
+				if(bASCII && ((nSourceLength - i) >= 16) && (!pDest || ((nDestCapacity - d) >= 16)) && UTF8NarrowASCIISSE2(pSource + i, bytes))
+				{
+					if(pDest)
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + d), bytes);
+
+					i += 16;
+					d += 16;
+					continue;
+				}
+
+				if((n = UTF8EncodeBlockSSE2(pDest ? pDest + d : NULL, nDestCapacity - d, pSource + i, nBlockDestUsed)) == 0)
+					break;
+
+				i += n;
+				d += nBlockDestUsed;
+				bASCII = (nBlockDestUsed == n);
 			}
 
-			destCount += 3;
+			nDestUsed = d;
+			return i;
 		}
-	}
 
-	if(pDest && nDestCapacity != 0)
-		*pDest = 0;
 
-	return (int)(unsigned)destCount;
-}
+		// Returns the 16 chars at p narrowed to bytes if they are all ASCII and not 0, else returns false.
+		EASTDC_TARGET_AVX2 EA_FORCE_INLINE bool UTF8NarrowASCIIAVX2(const char16_t* p, __m128i& bytes)
+		{
+			const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			const __m256i bad = _mm256_or_si256(_mm256_cmpeq_epi16(v, _mm256_setzero_si256()), _mm256_and_si256(v, _mm256_set1_epi16((short)0xff80)));
 
+			if(!_mm256_testz_si256(bad, bad))
+				return false;
 
+			bytes = _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+			return true;
+		}
 
-EASTDC_API int Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength)
-{
-	size_t destCount = 0;
+		EASTDC_TARGET_AVX2 EA_FORCE_INLINE bool UTF8NarrowASCIIAVX2(const char32_t* p, __m128i& bytes)
+		{
+			const __m256i v0   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			const __m256i v1   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 8));
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i kHigh = _mm256_set1_epi32((int)0xffffff80);
+			const __m256i bad  = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(v0, zero), _mm256_and_si256(v0, kHigh)), 
+			                                     _mm256_or_si256(_mm256_cmpeq_epi32(v1, zero), _mm256_and_si256(v1, kHigh)));
+
+			if(!_mm256_testz_si256(bad, bad))
+				return false;
+
+			bytes = _mm_packus_epi16(_mm_packs_epi32(_mm256_castsi256_si128(v0), _mm256_extracti128_si256(v0, 1)), 
+			                         _mm_packs_epi32(_mm256_castsi256_si128(v1), _mm256_extracti128_si256(v1, 1)));
+			return true;
+		}
+
+
+		template <typename InCharT>
+		EASTDC_TARGET_AVX2 size_t UTFToUTF8AVX2(char* pDest, size_t nDestCapacity, const InCharT* pSource, size_t nSourceLength, size_t& nDestUsed)
+		{
+			size_t  i = 0, d = 0, nBlockDestUsed = 0, n;
+			bool    bASCII = true;
+			__m128i bytes;
+
+			while((nSourceLength - i) >= 8)
+			{
+				// ASCII runs are converted 16 chars at a time, and anything else 8 chars at a time. 
+				// We try the former only while the blocks are ASCII.
+				if(bASCII && ((nSourceLength - i) >= 16) && (!pDest || ((nDestCapacity - d) >= 16)) && UTF8NarrowASCIIAVX2(pSource + i, bytes))
+				{
+					if(pDest)
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + d), bytes);
+
+					i += 16;
+					d += 16;
+					continue;
+				}
+
+				if((n = UTF8EncodeBlockSSE2(pDest ? pDest + d : NULL, nDestCapacity - d, pSource + i, nBlockDestUsed)) == 0)
+					break;
+
+				i += n;
+				d += nBlockDestUsed;
+				bASCII = (nBlockDestUsed == n);
+			}
+
+			nDestUsed = d;
+			return i;
+		}
+
+
+		EASTDC_TARGET_SSE2 size_t UTF8ToUTF16SSE2(char16_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTF8ToUTFSSE2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_SSE2 size_t UTF8ToUTF32SSE2(char32_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTF8ToUTFSSE2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_SSE2 size_t UTF16ToUTF8SSE2(char* pDest, size_t nDestCapacity, const char16_t* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTFToUTF8SSE2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_SSE2 size_t UTF32ToUTF8SSE2(char* pDest, size_t nDestCapacity, const char32_t* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTFToUTF8SSE2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_AVX2 size_t UTF8ToUTF16AVX2(char16_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTF8ToUTFAVX2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_AVX2 size_t UTF8ToUTF32AVX2(char32_t* pDest, size_t nDestCapacity, const char* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTF8ToUTFAVX2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_AVX2 size_t UTF16ToUTF8AVX2(char* pDest, size_t nDestCapacity, const char16_t* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTFToUTF8AVX2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+
+		EASTDC_TARGET_AVX2 size_t UTF32ToUTF8AVX2(char* pDest, size_t nDestCapacity, const char32_t* pSource, size_t nSourceLength, size_t& nDestUsed)
+			{ return UTFToUTF8AVX2(pDest, nDestCapacity, pSource, nSourceLength, nDestUsed); }
+	#endif
+
+} // namespace Internal
+
+
+// StrlcpyFastForward
+// Converts what it can at the beginning of the source with the dispatched kernel for the given 
+// conversion, if there is one. Returns the number of source chars converted and sets nDestUsed 
+// to the number of chars written, like the kernels. pDest is NULL if the output is only being 
+// counted. pSourceReadableEnd is how far the kernel may read the source. It starts as NULL if 
+// the source is 0-terminated, and is then extended as needed, up to the 0 char.
+//
+// It isn't inlined, and the Strlcpy loops don't pass their variables to it by reference, so that 
+// the code for the occasional call doesn't slow down their handling of each char.
+template <typename InCharT, typename OutCharT>
+EA_FORCE_INLINE size_t StrlcpyFastForward(OutCharT*, size_t, const InCharT*, const InCharT*, const InCharT*&, size_t& nDestUsed)
+{
+	nDestUsed = 0;
+	return 0;
+}
+
+#if EASTDC_STATIC_ANALYSIS_ENABLED
+	#define EASTDC_ENABLE_OPTIMIZED_STRLCPY 0 // Disabled for unterminated reads, for the same reason as EASTDC_ENABLE_OPTIMIZED_STRLEN.
+#else
+	#define EASTDC_ENABLE_OPTIMIZED_STRLCPY 1
+#endif
+
+inline const char*     StrlcpyFindZero(const char* p, size_t n)     { return Memchr(p, 0, n); }
+inline const char16_t* StrlcpyFindZero(const char16_t* p, size_t n) { return Memchr16(p, 0, n); }
+inline const char32_t* StrlcpyFindZero(const char32_t* p, size_t n) { return Memchr32(p, 0, n); }
+
+// Returns the first 0 char in [p, pLimit), or pLimit. The string may end before pLimit and 
+// the memory after it may not be readable, so we search no further than the end of the page 
+// at a time. A page is readable as a whole, and we only go on to the next one if the string does.
+template <typename InCharT>
+const InCharT* StrlcpyFindEnd(const InCharT* p, const InCharT* pLimit)
+{
+	#if EASTDC_ENABLE_OPTIMIZED_STRLCPY
+		while(p < pLimit)
+		{
+			size_t n = (4096 - ((uintptr_t)p & 4095)) / sizeof(InCharT);
+
+			if(n == 0) // If the char straddles the page boundary.
+				n = 1;
+			if(n > (size_t)(pLimit - p))
+				n = (size_t)(pLimit - p);
+
+			const InCharT* const pZero = StrlcpyFindZero(p, n);
+
+			if(pZero)
+				return pZero;
+			p += n;
+		}
+	#else
+		while((p < pLimit) && *p)
+			++p;
+	#endif
+
+	return p;
+}
+
+template <typename InCharT, typename OutCharT, typename Kernel>
+EA_NO_INLINE size_t StrlcpyFastForwardKernel(Kernel pKernel, OutCharT* pDest, size_t nDestCapacity, const InCharT* pSource, const InCharT* pSourceEnd, const InCharT*& pSourceReadableEnd, size_t& nDestUsed)
+{
+	nDestUsed = 0;
+
+	if(!pKernel) // If there is none for the current CPU feature level.
+		return 0;
+
+	if(pSourceReadableEnd != pSourceEnd)
+	{
+		// The source is 0-terminated. Unless its end was already found, we look for it only as far as the 
+		// kernel could convert with the capacity it has, so that copying the beginning of a long string 
+		// doesn't scan all of it. A char of the destination never takes more than 4 chars of the source. 
+		// When only counting, we have to get to the end anyway.
+		if((pSourceReadableEnd == NULL) || (pSourceReadableEnd < pSource))
+			pSourceReadableEnd = pSource;
+
+		if(*pSourceReadableEnd)
+		{
+			const InCharT* pLimit = pSourceEnd;
+
+			if(pDest && (nDestCapacity < ((size_t)(pSourceEnd - pSource) / 4)))
+				pLimit = pSource + (nDestCapacity * 4);
+
+			if(pSourceReadableEnd < pLimit)
+				pSourceReadableEnd = StrlcpyFindEnd(pSourceReadableEnd, pLimit);
+		}
+	}
+
+	const InCharT* pEnd = (pSourceEnd < pSourceReadableEnd) ? pSourceEnd : pSourceReadableEnd;
+
+	if(pSource < pEnd)
+		return pKernel(pDest, nDestCapacity, pSource, (size_t)(pEnd - pSource), nDestUsed);
+
+	return 0;
+}
+
+EA_FORCE_INLINE size_t StrlcpyFastForward(char16_t* pDest, size_t nDestCapacity, const char* pSource, const char* pSourceEnd, const char*& pSourceReadableEnd, size_t& nDestUsed)
+	{ return StrlcpyFastForwardKernel(Internal::GetCPUDispatchTable().mpUTF8ToUTF16, pDest, nDestCapacity, pSource, pSourceEnd, pSourceReadableEnd, nDestUsed); }
+
+EA_FORCE_INLINE size_t StrlcpyFastForward(char32_t* pDest, size_t nDestCapacity, const char* pSource, const char* pSourceEnd, const char*& pSourceReadableEnd, size_t& nDestUsed)
+	{ return StrlcpyFastForwardKernel(Internal::GetCPUDispatchTable().mpUTF8ToUTF32, pDest, nDestCapacity, pSource, pSourceEnd, pSourceReadableEnd, nDestUsed); }
+
+EA_FORCE_INLINE size_t StrlcpyFastForward(char* pDest, size_t nDestCapacity, const char16_t* pSource, const char16_t* pSourceEnd, const char16_t*& pSourceReadableEnd, size_t& nDestUsed)
+	{ return StrlcpyFastForwardKernel(Internal::GetCPUDispatchTable().mpUTF16ToUTF8, pDest, nDestCapacity, pSource, pSourceEnd, pSourceReadableEnd, nDestUsed); }
+
+EA_FORCE_INLINE size_t StrlcpyFastForward(char* pDest, size_t nDestCapacity, const char32_t* pSource, const char32_t* pSourceEnd, const char32_t*& pSourceReadableEnd, size_t& nDestUsed)
+	{ return StrlcpyFastForwardKernel(Internal::GetCPUDispatchTable().mpUTF32ToUTF8, pDest, nDestCapacity, pSource, pSourceEnd, pSourceReadableEnd, nDestUsed); }
+
+
+// StrlcpyFastForwardCounted
+// Calls StrlcpyFastForward for the int returning Strlcpy functions, which count the chars 
+// of the whole source but write them only while there is room for them and the terminating 0.
+template <typename InCharT, typename OutCharT>
+EA_FORCE_INLINE void StrlcpyFastForwardCounted(OutCharT*& pDest, size_t nDestCapacity, size_t& destCount, const InCharT*& pSource, size_t& nSourceLength, const InCharT* pSourceEnd, const InCharT*& pSourceReadableEnd)
+{
+	const bool   bWrite      = pDest && ((destCount + 1) < nDestCapacity);
+	size_t       nDestUsed   = 0;
+	const size_t nSourceUsed = StrlcpyFastForward(bWrite ? pDest : NULL, bWrite ? (nDestCapacity - 1 - destCount) : 0, pSource, pSourceEnd, pSourceReadableEnd, nDestUsed);
+
+	pSource       += nSourceUsed;
+	nSourceLength -= nSourceUsed;
+	destCount     += nDestUsed;
+
+	if(bWrite)
+		pDest += nDestUsed;
+}
+
+
+// StrlcpyFastForwardInternal
+// Calls StrlcpyFastForward for StrlcpyInternal, which writes only up to pDestEnd, where the 
+// terminating 0 goes.
+template <typename InCharT, typename OutCharT>
+EA_FORCE_INLINE void StrlcpyFastForwardInternal(OutCharT*& pDest, OutCharT* pDestEnd, const InCharT*& pSource, const InCharT* pSourceEnd, const InCharT*& pSourceReadableEnd)
+{
+	size_t nDestUsed = 0;
+
+	pSource += StrlcpyFastForward(pDest, (size_t)(pDestEnd - pDest), pSource, pSourceEnd, pSourceReadableEnd, nDestUsed);
+	pDest   += nDestUsed;
+}
+
+
+// StrlcpyHasKernel
+// Returns whether StrlcpyFastForward has a kernel for the conversion at the current CPU feature level.
+//
+// The Strlcpy loops call StrlcpyFastForward before the first char, and then only after the general 
+// code has converted a char which isn't ASCII. The kernels convert ASCII, so they stop at a char 
+// which isn't ASCII or stop for good, near the end of the source or because the destination is 
+// full. Thus there is one call per run the kernel converts, and the general code's handling of 
+// ASCII is the same as it was without the kernels.
+template <typename InCharT, typename OutCharT>
+EA_FORCE_INLINE bool StrlcpyHasKernel(const OutCharT*, const InCharT*)
+{
+	return false;
+}
+
+// Without CPU dispatch there are only the scalar table entries, which are NULL, and the generic 
+// version lets the compiler remove the calls.
+#if EASTDC_CPU_DISPATCH_ENABLED
+	EA_FORCE_INLINE bool StrlcpyHasKernel(const char16_t*, const char*)     { return Internal::GetCPUDispatchTable().mpUTF8ToUTF16 != NULL; }
+	EA_FORCE_INLINE bool StrlcpyHasKernel(const char32_t*, const char*)     { return Internal::GetCPUDispatchTable().mpUTF8ToUTF32 != NULL; }
+	EA_FORCE_INLINE bool StrlcpyHasKernel(const char*,     const char16_t*) { return Internal::GetCPUDispatchTable().mpUTF16ToUTF8 != NULL; }
+	EA_FORCE_INLINE bool StrlcpyHasKernel(const char*,     const char32_t*) { return Internal::GetCPUDispatchTable().mpUTF32ToUTF8 != NULL; }
+#endif
+
+
+template <typename InCharT, typename OutCharT>
+bool StrlcpyInternal(OutCharT* pDest, const InCharT* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	EA_ASSERT(pDest != nullptr && pSource != nullptr);
+
+	// If we have no capacity, then just return nothing
+	if(nDestCapacity == 0)
+	{
+		nDestUsed = 0;
+		nSourceUsed = 0;
+		return true;
+	}
+
+	const InCharT* pSourceStart = pSource;
+	const InCharT* pSourceEnd = pSource + nSourceLength;
+	if (pSourceEnd < pSourceStart)
+		pSourceEnd = (const InCharT*)(uintptr_t)-1;
+	const InCharT* pSourceReadableEnd = (nSourceLength == kSizeTypeUnset) ? NULL : pSourceEnd;
+	OutCharT* pDestStart = pDest;
+	OutCharT* pDestEnd = pDest + nDestCapacity - 1;
+	bool bGood = true;
+	const bool bKernel = StrlcpyHasKernel(pDest, pSource);
+
+	if(bKernel)
+		StrlcpyFastForwardInternal(pDest, pDestEnd, pSource, pSourceEnd, pSourceReadableEnd);
+
+	while(bGood && (pSource < pSourceEnd) && (pDest < pDestEnd))
+	{
+		uint32_t c = DecodeCodePoint(pSource, pSourceEnd);
+		if (c == 0)
+		{
+			pSource = pSourceEnd;
+			break;
+		}
+		bGood = (c != kUnicodeInvalidDecode) && EncodeCodePoint(c, pDest, pDestEnd);
+
+		if(bGood && (c >= 0x80) && bKernel)
+			StrlcpyFastForwardInternal(pDest, pDestEnd, pSource, pSourceEnd, pSourceReadableEnd);
+	}
+
+	*pDest = 0;
+
+	nDestUsed = pDest - pDestStart;
+	nSourceUsed = pSource - pSourceStart;
+	return bGood;
+}
+
+bool Strlcpy(char* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
+}
+
+bool Strlcpy(char* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
+}
+
+bool Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
+}
+
+bool Strlcpy(char16_t* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
+}
+
+bool Strlcpy(char32_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
+}
+
+bool Strlcpy(char32_t* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed)
+{
+	return StrlcpyInternal(pDest, pSource, nDestCapacity, nSourceLength, nDestUsed, nSourceUsed);
+}
+
+EASTDC_API int Strlcpy(char* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength)
+{
+	size_t destCount = 0;
+	const char16_t* pSourceEnd = pSource + nSourceLength;
+	if(pSourceEnd < pSource)
+		pSourceEnd = (const char16_t*)(uintptr_t)-1;
+	const char16_t* pSourceReadableEnd = (nSourceLength == kSizeTypeUnset) ? NULL : pSourceEnd;
+
+	const bool bKernel = StrlcpyHasKernel(pDest, pSource);
+
+	if(bKernel)
+		StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
+
+	while(nSourceLength-- > 0)
+	{
+		uint32_t c = (uint16_t)*pSource++;   // Deal with surrogate characters
+
+		// Encode as UTF-8
+		if (c < 0x00000080u)
+		{
+			if(c == 0) // Break on NULL char, even if explicit length was set
+				break;
+
+			if(pDest && ((destCount + 1) < nDestCapacity))
+				*pDest++ = static_cast<char>(c);
+
+			destCount += 1;
+		}
+		else if(c < 0x00000800u)
+		{
+			if(pDest && ((destCount + 2) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 6) | 0xc0);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+
+			destCount += 2;
+		}
+		else if(c < 0x00010000u)
+		{
+			if(pDest && ((destCount + 3) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 12) | 0xe0);
+				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+
+			destCount += 3;
+		}
+		else if(c < 0x00200000u)
+		{
+			if(pDest && ((destCount + 4) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 18) | 0xf0);
+				*pDest++ = static_cast<char>(((c >> 12) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+
+			destCount += 4;
+		}
+		else
+		{
+			const uint32_t kIllegalUnicodeChar = 0x0000fffd;
+
+			if(pDest && ((destCount + 3) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>( (kIllegalUnicodeChar >> 12) | 0xe0);
+				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  0) | 0x80) & 0xbf);
+			}
+
+			destCount += 3;
+		}
+
+		if((c >= 0x80) && bKernel)
+			StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
+	}
+
+	if(pDest && nDestCapacity != 0)
+		*pDest = 0;
+
+	return (int)(unsigned)destCount;
+}
+
+EASTDC_API int Strlcpy(char* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength)
+{
+	size_t destCount = 0;
+	const char32_t* pSourceEnd = pSource + nSourceLength;
+	if(pSourceEnd < pSource)
+		pSourceEnd = (const char32_t*)(uintptr_t)-1;
+	const char32_t* pSourceReadableEnd = (nSourceLength == kSizeTypeUnset) ? NULL : pSourceEnd;
+
+	const bool bKernel = StrlcpyHasKernel(pDest, pSource);
+
+	if(bKernel)
+		StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
+
+	while(nSourceLength-- > 0)
+	{
+		uint32_t c = (uint32_t)*pSource++;   // Deal with surrogate characters
+
+		// Encode as UTF-8
+		if (c < 0x00000080u)
+		{
+			if(c == 0) // Break on NULL char, even if explicit length was set
+				break;
+
+			if(pDest && ((destCount + 1) < nDestCapacity))
+				*pDest++ = static_cast<char>(c);
+
+			destCount += 1;
+		}
+		else if(c < 0x00000800u)
+		{
+			if(pDest && ((destCount + 2) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 6) | 0xc0);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+
+			destCount += 2;
+		}
+		else if(c < 0x00010000u)
+		{
+			if(pDest && ((destCount + 3) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 12) | 0xe0);
+				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+
+			destCount += 3;
+		}
+		else if(c < 0x00200000u)
+		{
+			if(pDest && ((destCount + 4) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 18) | 0xf0);
+				*pDest++ = static_cast<char>(((c >> 12) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+
+			destCount += 4;
+		}
+		else
+		{
+			// We don't currently support Unicode beyond "Plane 0", as game software has never needed it.
+			// If you have a need for this support, feel free to submit a patch or make a specific request.
+			const uint32_t kIllegalUnicodeChar = 0x0000fffd;
+
+			if(pDest && ((destCount + 3) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>( (kIllegalUnicodeChar >> 12) | 0xe0);
+				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>(((kIllegalUnicodeChar >>  0) | 0x80) & 0xbf);
+			}
+
+			destCount += 3;
+		}
+
+		if((c >= 0x80) && bKernel)
+			StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
+	}
+
+	if(pDest && nDestCapacity != 0)
+		*pDest = 0;
+
+	return (int)(unsigned)destCount;
+}
+
+
+
+EASTDC_API int Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength)
+{
+	size_t destCount = 0;
+	const char* pSourceEnd = pSource + nSourceLength;
+	if(pSourceEnd < pSource)
+		pSourceEnd = (const char*)(uintptr_t)-1;
+	const char* pSourceReadableEnd = (nSourceLength == kSizeTypeUnset) ? NULL : pSourceEnd;
+
+	const bool bKernel = StrlcpyHasKernel(pDest, pSource);
+
+	if(bKernel)
+		StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
 
 	while(nSourceLength-- > 0)
 	{
@@ -870,6 +1658,9 @@ EASTDC_API int Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacit
 			else
 				break;
 		}
+
+		if((c >= 0x80) && bKernel)
+			StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
 	}
 
 	if(pDest && (nDestCapacity != 0))
@@ -881,6 +1672,15 @@ EASTDC_API int Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacit
 EASTDC_API int Strlcpy(char32_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength)
 {
 	size_t destCount = 0;
+	const char* pSourceEnd = pSource + nSourceLength;
+	if(pSourceEnd < pSource)
+		pSourceEnd = (const char*)(uintptr_t)-1;
+	const char* pSourceReadableEnd = (nSourceLength == kSizeTypeUnset) ? NULL : pSourceEnd;
+
+	const bool bKernel = StrlcpyHasKernel(pDest, pSource);
+
+	if(bKernel)
+		StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
 
 	while(nSourceLength-- > 0)
 	{
@@ -941,6 +1741,9 @@ EASTDC_API int Strlcpy(char32_t* pDest, const char* pSource, size_t nDestCapacit
 			else
 				break;
 		}
+
+		if((c >= 0x80) && bKernel)
+			StrlcpyFastForwardCounted(pDest, nDestCapacity, destCount, pSource, nSourceLength, pSourceEnd, pSourceReadableEnd);
 	}
 
 	if(pDest && (nDestCapacity != 0))
@@ -1317,9 +2120,6 @@ EASTDC_API size_t Strlcat(char32_t* pDestination, const char16_t* pSource, size_
 // implementation by 2x-6x on lengths ranging from 128 bytes to 4096 bytes.
 // At lengths under 10 bytes this strlen performs similarly to strlen.
 // These observations apply to x86, x64 and PowerPC32 platforms.
-//
-// There could be faster strlen implementations with some additional
-// tricks, asm, SSE, etc. But this version works well while being simple.
 
 #if EASTDC_STATIC_ANALYSIS_ENABLED
 	#define EASTDC_ENABLE_OPTIMIZED_STRLEN 0 // Disabled because the optimized strlen reads words and the string may have some uninitialized chars at the end past the trailing 0 char. Valgrind reports this as an error, but it's not actually an error in practice.
@@ -1327,26 +2127,84 @@ EASTDC_API size_t Strlcat(char32_t* pDestination, const char16_t* pSource, size_
 	#define EASTDC_ENABLE_OPTIMIZED_STRLEN 1
 #endif
 
-#if EASTDC_ENABLE_OPTIMIZED_STRLEN
+EASTDC_API size_t Strlen(const char* pString)
+{
+	#if EASTDC_ENABLE_OPTIMIZED_STRLEN && EA_COMPILER_HAS_BUILTIN(__builtin_strlen)
+		// Compilers that have this builtin use a CRT strlen that does its own runtime dispatch.
+		return __builtin_strlen(pString);
+	#elif EASTDC_ENABLE_OPTIMIZED_STRLEN
+		// Instead of casting between types, we just create a union.
+		union PointerUnion
+		{
+			const char*   mp8;
+			const word_type* mpW;
+			uintptr_t        mU;
+		} pu;
+
+		// Leading unaligned bytes
+		for(pu.mp8 = pString; pu.mU & (sizeof(word_type) - 1); pu.mp8++)
+		{
+			if(*pu.mp8 == 0)
+				return (size_t)(pu.mp8 - pString);
+		}
+
+		for(; ; pu.mpW++)
+		{
+			#if defined(__GNUC__) && (__GNUC__ >= 3) && !defined(__EDG_VERSION__)
+				__builtin_prefetch(pu.mpW + 64, 0, 0);
+			#endif
+
+			// Quit if there are any zero chars.
+			const word_type kOneBytes  = ((word_type)-1 / 0xff); // 0x01010101
+			const word_type kHighBytes = (kOneBytes * 0x80);     // 0x80808080
+
+			const word_type u = *pu.mpW;
+
+			if((u - kOneBytes) & ~u & kHighBytes)
+				break;
+		}
+
+		// Trailing unaligned bytes
+		while(*pu.mp8)
+			++pu.mp8;
+
+		return (size_t)(pu.mp8 - pString);
+	#else
+		ssize_t nLength = (size_t)-1; // EABase 1.0.14 and later recognize ssize_t for all platforms.
+
+		do
+		{
+			++nLength;
+		} while (*pString++);
+
+		return (size_t)nLength;
+	#endif
+}
+
 
-	EASTDC_API size_t Strlen(const char* pString)
+// Strlen16 / Strlen32 kernels, called by Strlen via the CPU dispatch table.
+// The SIMD pathways use only aligned vector reads, which can't cross a page boundary 
+// and so can't fault even though they read bytes before the string and after its end. Each 
+// vector holds a whole number of characters only if the string is aligned to its character
+// size, which is practically always the case. Otherwise we use the scalar version.
+namespace Internal
+{
+	size_t Strlen16Scalar(const char16_t* pString)
 	{
-		#if EA_COMPILER_HAS_BUILTIN(__builtin_strlen)
-			return __builtin_strlen(pString);
-		#else
+		#if EASTDC_ENABLE_OPTIMIZED_STRLEN
 			// Instead of casting between types, we just create a union.
 			union PointerUnion
 			{
-				const char*   mp8;
+				const char16_t*  mp16;
 				const word_type* mpW;
 				uintptr_t        mU;
 			} pu;
 
 			// Leading unaligned bytes
-			for(pu.mp8 = pString; pu.mU & (sizeof(word_type) - 1); pu.mp8++)
+			for(pu.mp16 = pString; pu.mU & (sizeof(word_type) - 1); pu.mp16++)
 			{
-				if(*pu.mp8 == 0)
-					return (size_t)(pu.mp8 - pString);
+				if(*pu.mp16 == 0)
+					return (size_t)(pu.mp16 - pString);
 			}
 
 			for(; ; pu.mpW++)
@@ -1355,9 +2213,9 @@ EASTDC_API size_t Strlcat(char32_t* pDestination, const char16_t* pSource, size_
 					__builtin_prefetch(pu.mpW + 64, 0, 0);
 				#endif
 
-				// Quit if there are any zero chars.
-				const word_type kOneBytes  = ((word_type)-1 / 0xff); // 0x01010101
-				const word_type kHighBytes = (kOneBytes * 0x80);     // 0x80808080
+				// Quit if there are any zero char16_ts.
+				const word_type kOneBytes  = ((word_type)-1 / 0xffff); // 0x00010001
+				const word_type kHighBytes = (kOneBytes * 0x8000);     // 0x80008000
 
 				const word_type u = *pu.mpW;
 
@@ -1366,98 +2224,138 @@ EASTDC_API size_t Strlcat(char32_t* pDestination, const char16_t* pSource, size_
 			}
 
 			// Trailing unaligned bytes
-			while(*pu.mp8)
-				++pu.mp8;
+			while(*pu.mp16)
+				++pu.mp16;
+
+			return (size_t)(pu.mp16 - pString);
+		#else
+			size_t nLength = (size_t)-1;
+
+			do
+			{
+				++nLength;
+			} while (*pString++);
 
-			return (size_t)(pu.mp8 - pString);
+			return nLength;
 		#endif
 	}
 
-#else
 
-	EASTDC_API size_t Strlen(const char* pString)
+	// To consider: This might benefit from an optimized implementation on machines withi 64 bit registers.
+	size_t Strlen32Scalar(const char32_t* pString)
 	{
-		ssize_t nLength = (size_t)-1; // EABase 1.0.14 and later recognize ssize_t for all platforms.
-
-		do
-		{
+		size_t nLength = (size_t)-1;
+		
+		do{
 			++nLength;
-		} while (*pString++);
-
-		return (size_t)nLength;
+		}while(*pString++);
+		
+		return nLength;
 	}
 
-#endif
 
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Returns a mask with one bit per byte, set for the bytes of the zero characters in the vector.
+		EASTDC_TARGET_SSE2 inline uint32_t StrlenZeroMaskSSE2(const char16_t* p) { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128())); }
+		EASTDC_TARGET_SSE2 inline uint32_t StrlenZeroMaskSSE2(const char32_t* p) { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128())); }
+		EASTDC_TARGET_AVX2 inline uint32_t StrlenZeroMaskAVX2(const char16_t* p) { return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_load_si256(reinterpret_cast<const __m256i*>(p)), _mm256_setzero_si256())); }
+		EASTDC_TARGET_AVX2 inline uint32_t StrlenZeroMaskAVX2(const char32_t* p) { return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(p)), _mm256_setzero_si256())); }
 
-#if EASTDC_ENABLE_OPTIMIZED_STRLEN
 
-	EASTDC_API size_t Strlen(const char16_t* pString)
-	{
-		// Instead of casting between types, we just create a union.
-		union PointerUnion
+		template <typename T>
+		EASTDC_TARGET_SSE2 size_t StrlenSSE2T(const T* pString)
 		{
-			const char16_t*  mp16;
-			const word_type* mpW;
-			uintptr_t        mU;
-		} pu;
+			// The first aligned vector may begin before pString, so we shift out the mask bits for 
+			// the bytes before it. Byte offsets are a multiple of sizeof(T), so this shifts by whole characters.
+			const T* p    = (const T*)((uintptr_t)pString & ~(uintptr_t)15);
+			uint32_t mask = StrlenZeroMaskSSE2(p) >> ((uintptr_t)pString & 15);
 
-		// Leading unaligned bytes
-		for(pu.mp16 = pString; pu.mU & (sizeof(word_type) - 1); pu.mp16++)
-		{
-			if(*pu.mp16 == 0)
-				return (size_t)(pu.mp16 - pString);
+			if(mask)
+				return (size_t)CountTrailing0Bits(mask) / sizeof(T);
+
+			for(;;)
+			{
+				p += (16 / sizeof(T));
+				mask = StrlenZeroMaskSSE2(p);
+
+				if(mask)
+					return (size_t)(p - pString) + ((size_t)CountTrailing0Bits(mask) / sizeof(T));
+			}
 		}
 
-		for(; ; pu.mpW++)
+
+		template <typename T>
+		EASTDC_TARGET_AVX2 size_t StrlenAVX2T(const T* pString)
 		{
-			#if defined(__GNUC__) && (__GNUC__ >= 3) && !defined(__EDG_VERSION__)
-				__builtin_prefetch(pu.mpW + 64, 0, 0);
-			#endif
+			const T* p    = (const T*)((uintptr_t)pString & ~(uintptr_t)31);
+			uint32_t mask = StrlenZeroMaskAVX2(p) >> ((uintptr_t)pString & 31);
 
-			// Quit if there are any zero char16_ts.
-			const word_type kOneBytes  = ((word_type)-1 / 0xffff); // 0x00010001
-			const word_type kHighBytes = (kOneBytes * 0x8000);     // 0x80008000
+			if(mask)
+				return (size_t)CountTrailing0Bits(mask) / sizeof(T);
 
-			const word_type u = *pu.mpW;
+			for(;;)
+			{
+				p += (32 / sizeof(T));
+				mask = StrlenZeroMaskAVX2(p);
 
-			if((u - kOneBytes) & ~u & kHighBytes)
-				break;
+				if(mask)
+					return (size_t)(p - pString) + ((size_t)CountTrailing0Bits(mask) / sizeof(T));
+			}
 		}
 
-		// Trailing unaligned bytes
-		while(*pu.mp16)
-			++pu.mp16;
 
-		return (size_t)(pu.mp16 - pString);
-	}
+		EASTDC_TARGET_SSE2 size_t Strlen16SSE2(const char16_t* pString)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRLEN
+				if(((uintptr_t)pString & 1) == 0)
+					return StrlenSSE2T(pString);
+			#endif
+			return Strlen16Scalar(pString);
+		}
 
-#else
 
-	EASTDC_API size_t Strlen(const char16_t* pString)
-	{
-		size_t nLength = (size_t)-1;
+		EASTDC_TARGET_SSE2 size_t Strlen32SSE2(const char32_t* pString)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRLEN
+				if(((uintptr_t)pString & 3) == 0)
+					return StrlenSSE2T(pString);
+			#endif
+			return Strlen32Scalar(pString);
+		}
 
-		do
+
+		EASTDC_TARGET_AVX2 size_t Strlen16AVX2(const char16_t* pString)
 		{
-			++nLength;
-		} while (*pString++);
+			#if EASTDC_ENABLE_OPTIMIZED_STRLEN
+				if(((uintptr_t)pString & 1) == 0)
+					return StrlenAVX2T(pString);
+			#endif
+			return Strlen16Scalar(pString);
+		}
 
-		return nLength;
-	}
 
-#endif
+		EASTDC_TARGET_AVX2 size_t Strlen32AVX2(const char32_t* pString)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRLEN
+				if(((uintptr_t)pString & 3) == 0)
+					return StrlenAVX2T(pString);
+			#endif
+			return Strlen32Scalar(pString);
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API size_t Strlen(const char16_t* pString)
+{
+	return Internal::GetCPUDispatchTable().mpStrlen16(pString);
+}
+
 
-// To consider: This might benefit from an optimized implementation on machines withi 64 bit registers.
 EASTDC_API size_t Strlen(const char32_t* pString)
 {
-	size_t nLength = (size_t)-1;
-	
-	do{
-		++nLength;
-	}while(*pString++);
-	
-	return nLength;
+	return Internal::GetCPUDispatchTable().mpStrlen32(pString);
 }
 
 
@@ -1468,16 +2366,7 @@ EASTDC_API size_t Strlen(const char32_t* pString)
 // Return value will be <= Strlen(pString).
 EASTDC_API size_t StrlenUTF8Decoded(const char* pString)
 {
-	size_t nLength = 0;
-
-	while(*pString)
-	{
-		if((*pString & 0xc0) != 0x80)
-			++nLength;
-		++pString;
-	}
-
-	return nLength;
+	return Internal::GetCPUDispatchTable().mpUTF8CountChars(pString, Strlen(pString));
 }
 
 
@@ -1537,26 +2426,17 @@ EASTDC_API size_t StrlenUTF8Encoded(const char32_t* pString)
 
 EASTDC_API char* Strend(const char* pString)
 {
-	while (*pString)
-		++pString;
-
-	return (char*)pString;
+	return (char*)pString + Strlen(pString);
 }
 
 EASTDC_API char16_t* Strend(const char16_t* pString)
 {
-	while (*pString)
-		++pString;
-
-	return (char16_t*)pString;
+	return (char16_t*)pString + Strlen(pString);
 }
 
 EASTDC_API char32_t* Strend(const char32_t* pString)
 {
-	while(*pString)
-		++pString;
-
-	return (char32_t*)pString;
+	return (char32_t*)pString + Strlen(pString);
 }
 
 
@@ -1971,131 +2851,346 @@ EASTDC_API char32_t* Strnchr(const char32_t* pString, char32_t c, size_t n)
 
 
 
-EASTDC_API size_t Strcspn(const char* pString1, const char* pString2)
+// CharSet
+//
+// The chars below 256 are in a bitmap laid out as the two nibble tables of MemchrAny, so that 
+// the SSE4.2 and AVX2 kernels can look up a vector of chars with two byte shuffles. The other 
+// chars are filtered by a 32 bit hash and then binary searched for in a small sorted array, 
+// as delimiter sets seldom have many such chars. The char16_t and char32_t functions test a char 
+// at a time, with the set lookup in place of the loop over the set string that they had before.
+// The string versions of the functions use a StringCharSet, which also looks in the string for 
+// any chars which didn't fit in the set.
+// The char kernels stop at the terminating 0 and read ahead within the page, as Strlen does.
+
+#if EASTDC_STATIC_ANALYSIS_ENABLED
+	#define EASTDC_ENABLE_OPTIMIZED_STRSPN 0 // Disabled for unterminated reads, for the same reason as EASTDC_ENABLE_OPTIMIZED_STRLEN.
+#else
+	#define EASTDC_ENABLE_OPTIMIZED_STRSPN 1
+#endif
+
+namespace Internal
 {
-	const char* pStringCurrent = pString1;
+	// Returns whether c is in the set whose bitmap is pByteTable, as with CharSet::Contains.
+	static EA_FORCE_INLINE bool CharSetByteTableContains(const uint8_t* pByteTable, uint8_t c)
+	{
+		return ((pByteTable[((c >> 7) * 16) + (c & 15)] >> ((c >> 4) & 7)) & 1) != 0;
+	}
 
-	// This implementation does a double loop. As such, it can get slow for
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2.
-	while(*pStringCurrent)
+
+	const char* CharSetFindScalar(const char* p, const uint8_t* pByteTable, bool bInSet)
 	{
-		for(const char* pCharSet = pString2; *pCharSet; ++pCharSet)
+		while(*p && (CharSetByteTableContains(pByteTable, (uint8_t)*p) != bInSet))
+			++p;
+
+		return p;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Returns a mask with one bit per byte, set for the chars of v which are in the set. See MemchrAnyMaskSSE42.
+		EASTDC_TARGET_SSE42 inline uint32_t CharSetMaskSSE42(__m128i v, __m128i tableLow, __m128i tableHigh)
 		{
-			if(*pCharSet == *pStringCurrent)
-				return (size_t)(pStringCurrent - pString1);
+			const __m128i bits = _mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x07)));
+			const __m128i t    = _mm_or_si128(_mm_shuffle_epi8(tableLow, v), _mm_shuffle_epi8(tableHigh, _mm_xor_si128(v, _mm_set1_epi8(-128))));
+
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(t, bits), bits));
 		}
 
-		++pStringCurrent;
-	}
+		EASTDC_TARGET_AVX2 inline uint32_t CharSetMaskAVX2(__m256i v, __m256i tableLow, __m256i tableHigh)
+		{
+			const __m256i bits = _mm256_shuffle_epi8(_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), 
+			                                         _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x07)));
+			const __m256i t    = _mm256_or_si256(_mm256_shuffle_epi8(tableLow, v), _mm256_shuffle_epi8(tableHigh, _mm256_xor_si256(v, _mm256_set1_epi8(-128))));
 
-	return (size_t)(pStringCurrent - pString1);
-}
+			return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(t, bits), bits));
+		}
 
-EASTDC_API size_t Strcspn(const char16_t* pString1, const char16_t* pString2)
-{
-	const char16_t* pStringCurrent = pString1;
 
-	// This implementation does a double loop. As such, it can get slow for
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. But char16_t
-	// means that the map would have to be 65536 bits (8192 bytes) in size.
-	while(*pStringCurrent)
-	{
-		for(const char16_t* pCharSet = pString2; *pCharSet; ++pCharSet)
+		// A 0 char is never in the set, so when bInSet is false the inverted mask has it already.
+		EASTDC_TARGET_SSE42 const char* CharSetFindSSE42(const char* p, const uint8_t* pByteTable, bool bInSet)
 		{
-			if(*pCharSet == *pStringCurrent)
-				return (size_t)(pStringCurrent - pString1);
+			#if EASTDC_ENABLE_OPTIMIZED_STRSPN
+				const __m128i  tl      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pByteTable));
+				const __m128i  th      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pByteTable + 16));
+				const uint32_t nInvert = bInSet ? 0 : 0xffff;
+
+				for(;; p += 16)
+				{
+					if(StringReadIsInPage(p, 16))
+					{
+						const __m128i  v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+						const uint32_t mask = (CharSetMaskSSE42(v, tl, th) ^ nInvert) | (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+
+						if(mask)
+							return p + CountTrailing0Bits(mask);
+					}
+					else
+					{
+						for(int i = 0; i < 16; i++)
+						{
+							if(!p[i] || (CharSetByteTableContains(pByteTable, (uint8_t)p[i]) == bInSet))
+								return p + i;
+						}
+					}
+				}
+			#else
+				return CharSetFindScalar(p, pByteTable, bInSet);
+			#endif
 		}
 
-		++pStringCurrent;
-	}
+		EASTDC_TARGET_AVX2 const char* CharSetFindAVX2(const char* p, const uint8_t* pByteTable, bool bInSet)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRSPN
+				const __m256i  tl      = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pByteTable)));  // pshufb works within each 16 byte lane,
+				const __m256i  th      = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pByteTable + 16))); // so each lane needs a copy of the table.
+				const uint32_t nInvert = bInSet ? 0 : 0xffffffff;
 
-	return (size_t)(pStringCurrent - pString1);
-}
+				for(;; p += 32)
+				{
+					if(StringReadIsInPage(p, 32))
+					{
+						const __m256i  v    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+						const uint32_t mask = (CharSetMaskAVX2(v, tl, th) ^ nInvert) | (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
 
-EASTDC_API size_t Strcspn(const char32_t* pString1, const char32_t* pString2)
+						if(mask)
+							return p + CountTrailing0Bits(mask);
+					}
+					else
+					{
+						for(int i = 0; i < 32; i++)
+						{
+							if(!p[i] || (CharSetByteTableContains(pByteTable, (uint8_t)p[i]) == bInSet))
+								return p + i;
+						}
+					}
+				}
+			#else
+				return CharSetFindScalar(p, pByteTable, bInSet);
+			#endif
+		}
+	#endif
+
+} // namespace Internal
+
+
+// Returns the position in the n sorted chars at pChars of the first char which isn't less than c.
+static EA_FORCE_INLINE uint32_t CharSetLowerBound(const uint32_t* pChars, uint32_t n, uint32_t c)
 {
-	const char32_t* pStringCurrent = pString1;
+	uint32_t i = 0;
 
-	// This implementation does a double loop. As such, it can get slow for
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. But char32_t
-	// means that the map would have to be huge in size.
-	while(*pStringCurrent)
+	while(n)
 	{
-		for(const char32_t* pCharSet = pString2; *pCharSet; ++pCharSet)
+		const uint32_t nHalf = n / 2;
+
+		if(pChars[i + nHalf] < c)
 		{
-			if(*pCharSet == *pStringCurrent)
-				return (size_t)(pStringCurrent - pString1);
+			i += nHalf + 1;
+			n -= nHalf + 1;
 		}
-
-		++pStringCurrent;
+		else
+			n = nHalf;
 	}
 
-	return (size_t)(pStringCurrent - pString1);
+	return i;
+}
+
+
+CharSet::CharSet()
+{
+	Init("");
+}
+
+CharSet::CharSet(const char* pChars)
+{
+	Init(pChars);
+}
+
+CharSet::CharSet(const char16_t* pChars)
+{
+	Init(pChars);
+}
+
+CharSet::CharSet(const char32_t* pChars)
+{
+	Init(pChars);
 }
 
 
+void CharSet::Init(const char* pChars)
+{
+	memset(mByteTable, 0, sizeof(mByteTable));
+	mWideHash      = 0;
+	mWideCharCount = 0;
+	mbWideOverflow = false;
 
+	for(; *pChars; ++pChars)
+		Add((uint8_t)*pChars);
+}
 
-EASTDC_API char* Strpbrk(const char* pString1, const char* pString2)
+void CharSet::Init(const char16_t* pChars)
+{
+	Init("");
+
+	for(; *pChars; ++pChars)
+		Add(*pChars);
+}
+
+void CharSet::Init(const char32_t* pChars)
+{
+	Init("");
+
+	for(; *pChars; ++pChars)
+		Add((uint32_t)*pChars);
+}
+
+
+void CharSet::Add(uint32_t c)
 {
-	// This implementation does a double loop. As such, it can get slow for
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2.
-	while(*pString1)
+	if(c < 256)
+		mByteTable[c >> 7][c & 15] |= (uint8_t)(1u << ((c >> 4) & 7));
+	else
 	{
-		for(const char* pCharSet = pString2; *pCharSet; ++pCharSet)
+		const uint32_t i = CharSetLowerBound(mWideChars, mWideCharCount, c);
+
+		if((i == mWideCharCount) || (mWideChars[i] != c))
 		{
-			if(*pCharSet == *pString1)
-				return (char*)pString1;
+			if(mWideCharCount < kWideCharCapacity)
+			{
+				memmove(mWideChars + i + 1, mWideChars + i, (mWideCharCount - i) * sizeof(uint32_t));
+				mWideChars[i] = c;
+				mWideCharCount++;
+				mWideHash |= (1u << (c & 31));
+			}
+			else
+				mbWideOverflow = true;
 		}
-
-		++pString1;
 	}
+}
 
-	return NULL;
+
+bool CharSet::ContainsWide(uint32_t c) const
+{
+	const uint32_t i = CharSetLowerBound(mWideChars, mWideCharCount, c);
+
+	return (i < mWideCharCount) && (mWideChars[i] == c);
 }
 
-EASTDC_API char16_t* Strpbrk(const char16_t* pString1, const char16_t* pString2)
+
+// The set of chars of a string passed to the string versions of Strcspn, Strpbrk, Strspn, Strtok 
+// and Strtok2. Wide chars which didn't fit in the CharSet are looked for in the string itself, 
+// which remains valid for the duration of the call.
+template <typename T>
+class StringCharSet
 {
-	// This implementation does a double loop. As such, it can get slow for
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. But char16_t
-	// means that the map would have to be 65536 bits (8192 bytes) in size.
-	while(*pString1)
+public:
+	explicit StringCharSet(const T* pChars) : mCharSet(pChars), mpChars(pChars) { }
+
+	bool Contains(T c) const
 	{
-		for(const char16_t* pCharSet = pString2; *pCharSet; ++pCharSet)
+		if(mCharSet.Contains(c))
+			return true;
+
+		if(!mCharSet.IsComplete())
 		{
-			if(*pCharSet == *pString1)
-				return (char16_t*)pString1;
+			for(const T* p = mpChars; *p; ++p)
+			{
+				if(*p == c)
+					return true;
+			}
 		}
 
-		++pString1;
+		return false;
 	}
 
-	return NULL;
+protected:
+	const CharSet  mCharSet;
+	const T* const mpChars;
+};
+
+
+// Returns the first char at p which is (if bInSet) or isn't in charSet, or the terminating 0.
+template <typename T, typename Set>
+static const T* CharSetFind(const T* p, const Set& charSet, bool bInSet)
+{
+	while(*p && (charSet.Contains(*p) != bInSet))
+		++p;
+
+	return p;
+}
+
+static const char* CharSetFind(const char* p, const CharSet& charSet, bool bInSet)
+{
+	return Internal::GetCPUDispatchTable().mpCharSetFind(p, charSet.GetByteTable(), bInSet);
+}
+
+
+
+EASTDC_API size_t Strcspn(const char* pString1, const char* pString2)
+{
+	return Strcspn(pString1, CharSet(pString2));
+}
+
+EASTDC_API size_t Strcspn(const char16_t* pString1, const char16_t* pString2)
+{
+	return (size_t)(CharSetFind(pString1, StringCharSet<char16_t>(pString2), true) - pString1);
+}
+
+EASTDC_API size_t Strcspn(const char32_t* pString1, const char32_t* pString2)
+{
+	return (size_t)(CharSetFind(pString1, StringCharSet<char32_t>(pString2), true) - pString1);
+}
+
+EASTDC_API size_t Strcspn(const char* pString, const CharSet& charSet)
+{
+	return (size_t)(CharSetFind(pString, charSet, true) - pString);
+}
+
+EASTDC_API size_t Strcspn(const char16_t* pString, const CharSet& charSet)
+{
+	return (size_t)(CharSetFind(pString, charSet, true) - pString);
+}
+
+EASTDC_API size_t Strcspn(const char32_t* pString, const CharSet& charSet)
+{
+	return (size_t)(CharSetFind(pString, charSet, true) - pString);
+}
+
+
+
+
+EASTDC_API char* Strpbrk(const char* pString1, const char* pString2)
+{
+	return Strpbrk(pString1, CharSet(pString2));
+}
+
+EASTDC_API char16_t* Strpbrk(const char16_t* pString1, const char16_t* pString2)
+{
+	const char16_t* const p = CharSetFind(pString1, StringCharSet<char16_t>(pString2), true);
+	return *p ? (char16_t*)p : NULL;
 }
 
 EASTDC_API char32_t* Strpbrk(const char32_t* pString1, const char32_t* pString2)
 {
-	// This implementation does a double loop. As such, it can get slow for
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. But char32_t
-	// means that the map would have to be huge in size.
-	while(*pString1)
-	{
-		for(const char32_t* pCharSet = pString2; *pCharSet; ++pCharSet)
-		{
-			if(*pCharSet == *pString1)
-				return (char32_t*)pString1;
-		}
+	const char32_t* const p = CharSetFind(pString1, StringCharSet<char32_t>(pString2), true);
+	return *p ? (char32_t*)p : NULL;
+}
 
-		++pString1;
-	}
+EASTDC_API char* Strpbrk(const char* pString, const CharSet& charSet)
+{
+	const char* const p = CharSetFind(pString, charSet, true);
+	return *p ? (char*)p : NULL;
+}
 
-	return NULL;
+EASTDC_API char16_t* Strpbrk(const char16_t* pString, const CharSet& charSet)
+{
+	const char16_t* const p = CharSetFind(pString, charSet, true);
+	return *p ? (char16_t*)p : NULL;
+}
+
+EASTDC_API char32_t* Strpbrk(const char32_t* pString, const CharSet& charSet)
+{
+	const char32_t* const p = CharSetFind(pString, charSet, true);
+	return *p ? (char32_t*)p : NULL;
 }
 
 
@@ -2153,365 +3248,420 @@ EASTDC_API char32_t* Strrchr(const char32_t* pString, char32_t c)
 
 EASTDC_API size_t Strspn(const char* pString, const char* pSubString)
 {
-	// This implementation does a double loop. As such, it can get slow for 
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. 
-	const char* pStringCurrent = pString;
-
-	while(*pStringCurrent)
-	{
-		for(const char* pSubStringCurrent = pSubString; *pSubStringCurrent != *pStringCurrent; ++pSubStringCurrent)
-		{
-			if(*pSubStringCurrent == 0)
-				return (size_t)(pStringCurrent - pString);
-		}
-
-		++pStringCurrent;
-	}
-
-	return (size_t)(pStringCurrent - pString);
+	return Strspn(pString, CharSet(pSubString));
 }
 
 EASTDC_API size_t Strspn(const char16_t* pString, const char16_t* pSubString)
 {
-	// This implementation does a double loop. As such, it can get slow for 
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. But char16_t 
-	// means that the map would have to be 65536 bits (8192 bytes) in size.
-	const char16_t* pStringCurrent = pString;
-
-	while(*pStringCurrent)
-	{
-		for(const char16_t* pSubStringCurrent = pSubString; *pSubStringCurrent != *pStringCurrent; ++pSubStringCurrent)
-		{
-			if(*pSubStringCurrent == 0)
-				return (size_t)(pStringCurrent - pString);
-		}
-
-		++pStringCurrent;
-	}
-
-	return (size_t)(pStringCurrent - pString);
+	return (size_t)(CharSetFind(pString, StringCharSet<char16_t>(pSubString), false) - pString);
 }
 
 EASTDC_API size_t Strspn(const char32_t* pString, const char32_t* pSubString)
 {
-	// This implementation does a double loop. As such, it can get slow for 
-	// very long strings. An alternative implementation is to use a hash
-	// table or to create a bytemap of the chars in pString2. But char32_t 
-	// means that the map would have to be huge in size.
-	const char32_t* pStringCurrent = pString;
+	return (size_t)(CharSetFind(pString, StringCharSet<char32_t>(pSubString), false) - pString);
+}
 
-	while(*pStringCurrent)
-	{
-		for(const char32_t* pSubStringCurrent = pSubString; *pSubStringCurrent != *pStringCurrent; ++pSubStringCurrent)
-		{
-			if(*pSubStringCurrent == 0)
-				return (size_t)(pStringCurrent - pString);
-		}
+EASTDC_API size_t Strspn(const char* pString, const CharSet& charSet)
+{
+	return (size_t)(CharSetFind(pString, charSet, false) - pString);
+}
 
-		++pStringCurrent;
-	}
+EASTDC_API size_t Strspn(const char16_t* pString, const CharSet& charSet)
+{
+	return (size_t)(CharSetFind(pString, charSet, false) - pString);
+}
 
-	return (size_t)(pStringCurrent - pString);
+EASTDC_API size_t Strspn(const char32_t* pString, const CharSet& charSet)
+{
+	return (size_t)(CharSetFind(pString, charSet, false) - pString);
 }
 
 
 
-EASTDC_API char* Strstr(const char* pString, const char* pSubString)
-{
-	char* s1 = (char*)pString - 1;
-	char* p1 = (char*)pSubString - 1;
-	char  c0, c1, c2;
+// Strstr / Stristr / Strrstr / Strirstr
+//
+// Candidate positions are those where both the first and the last char of pSubString match, 
+// as with Memmem, and each candidate is then verified with Memcmp or Strnicmp. Testing the last 
+// char as well as the first rejects most false starts without leaving the scan loop, and the 
+// SIMD kernels test a vector's worth of positions at a time with two unaligned loads lastPos apart.
+// Stristr and Strirstr compare the chars case-folded as with Tolower, which folds only the ASCII 
+// letters, so a vector of chars is folded at once as with Stricmp.
+//
+// The forward kernels don't know the length of the string. They are called with the invariant that 
+// the lastPos chars at p are not 0, and they detect the end of the string in the chars at p + lastPos,
+// which are the last chars of the candidates at p. As with Stricmp, the vector reads may go past 
+// the end of the string, but never into another page. The reverse kernels are given the string 
+// length, which Strrstr needed anyway, and so read only within the string.
 
-	if((c0 = *++p1) == 0)   // An empty pSubString results in success, return pString.
-		return (char*)pString;
+#if EASTDC_STATIC_ANALYSIS_ENABLED
+	#define EASTDC_ENABLE_OPTIMIZED_STRSTR 0 // Disabled for unterminated reads, for the same reason as EASTDC_ENABLE_OPTIMIZED_STRLEN.
+#else
+	#define EASTDC_ENABLE_OPTIMIZED_STRSTR 1
+#endif
 
-	while((c1 = *++s1) != 0)
+namespace Internal
+{
+	template <bool bFold, typename T>
+	static EA_FORCE_INLINE T StrstrFold(T c)
 	{
-		if(c1 == c0)
-		{
-			const char* s2 = (s1 - 1);
-			const char* p2 = (p1 - 1);
-			
-			while((c1 = *++s2) == (c2 = *++p2) && c1){} // Do nothing
-
-			if(!c2)
-				return (char*)s1;
-		}
+		return bFold ? Tolower(c) : c;
 	}
-	return NULL;
-}
 
-EASTDC_API char16_t* Strstr(const char16_t* pString, const char16_t* pSubString)
-{
-	char16_t* s1 = (char16_t*)pString - 1;
-	char16_t* p1 = (char16_t*)pSubString - 1;
-	char16_t  c0, c1, c2;
 
-	if((c0 = *++p1) == 0)   // An empty pSubString results in success, return pString.
-		return (char16_t*)pString;
-
-	while((c1 = *++s1) != 0)
+	// Returns the first candidate position at or after p, or NULL if the end of the string comes first.
+	// It scans for the first char alone, as the nested loop search did, and checks that the string 
+	// reaches p + lastPos only where that matches. The chars before pKnown are known not to be 0, 
+	// so that each char is checked for 0 at most once.
+	template <bool bFold, typename T>
+	static const T* StrstrFindCandidateScalarT(const T* p, const T* pSubString, size_t lastPos)
 	{
-		if(c1 == c0)
+		const T  cFirst = StrstrFold<bFold>(pSubString[0]);
+		const T  cLast  = StrstrFold<bFold>(pSubString[lastPos]);
+		const T* pKnown = p + lastPos;
+
+		for(; *p; ++p)
 		{
-			const char16_t* s2 = (s1 - 1);
-			const char16_t* p2 = (p1 - 1);
-			
-			while((c1 = *++s2) == (c2 = *++p2) && c1){} // Do nothing
+			if(StrstrFold<bFold>(*p) == cFirst)
+			{
+				for(size_t i = (pKnown > p) ? (size_t)(pKnown - p) : 0; i <= lastPos; i++)
+				{
+					if(p[i] == 0)
+						return NULL;
+				}
+
+				pKnown = p + lastPos + 1;
 
-			if(!c2)
-				return (char16_t*)s1;
+				if(StrstrFold<bFold>(p[lastPos]) == cLast)
+					return p;
+			}
 		}
-	}
-	return NULL;
-}
 
-EASTDC_API char32_t* Strstr(const char32_t* pString, const char32_t* pSubString)
-{
-	char32_t* s1 = (char32_t*)pString - 1;
-	char32_t* p1 = (char32_t*)pSubString - 1;
-	char32_t  c0, c1, c2;
+		return NULL;
+	}
 
-	if((c0 = *++p1) == 0)   // An empty pSubString results in success, return pString.
-		return (char32_t*)pString;
 
-	while((c1 = *++s1) != 0)
+	// Returns the last candidate position before j, or (size_t)-1 if there is none.
+	template <bool bFold, typename T>
+	static size_t StrrstrFindCandidateScalarT(const T* pString, size_t j, const T* pSubString, size_t lastPos)
 	{
-		if(c1 == c0)
-		{
-			const char32_t* s2 = (s1 - 1);
-			const char32_t* p2 = (p1 - 1);
-			
-			while((c1 = *++s2) == (c2 = *++p2) && c1){} // Do nothing
+		const T cFirst = StrstrFold<bFold>(pSubString[0]);
+		const T cLast  = StrstrFold<bFold>(pSubString[lastPos]);
 
-			if(!c2)
-				return (char32_t*)s1;
+		while(j--)
+		{
+			if((StrstrFold<bFold>(pString[j]) == cFirst) && (StrstrFold<bFold>(pString[j + lastPos]) == cLast))
+				return j;
 		}
+
+		return (size_t)-1;
 	}
-	return NULL;
-}
 
 
+	const char*     StrstrFindCandidateScalar  (const char*     p, const char*     pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateScalarT<true>(p, pSubString, lastPos) : StrstrFindCandidateScalarT<false>(p, pSubString, lastPos); }
+	const char16_t* StrstrFindCandidate16Scalar(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateScalarT<true>(p, pSubString, lastPos) : StrstrFindCandidateScalarT<false>(p, pSubString, lastPos); }
+	const char32_t* StrstrFindCandidate32Scalar(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateScalarT<true>(p, pSubString, lastPos) : StrstrFindCandidateScalarT<false>(p, pSubString, lastPos); }
 
-EASTDC_API char* Stristr(const char* s1, const char* s2)
-{
-	const char* cp = s1;
+	size_t StrrstrFindCandidateScalar  (const char*     pString, size_t j, const char*     pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateScalarT<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateScalarT<false>(pString, j, pSubString, lastPos); }
+	size_t StrrstrFindCandidate16Scalar(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateScalarT<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateScalarT<false>(pString, j, pSubString, lastPos); }
+	size_t StrrstrFindCandidate32Scalar(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateScalarT<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateScalarT<false>(pString, j, pSubString, lastPos); }
 
-	if(!*s2)
-		return (char*)s1;
 
-	while(*cp)
-	{
-		const char* s = cp;
-		const char* t = s2;
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Returns a mask with one bit per byte, set for the bytes of the positions in the vector at p 
+		// which are candidates, and sets nZero to the same kind of mask for the 0 chars at p + lastPos.
+		template <bool bFold, typename T>
+		EASTDC_TARGET_SSE2 inline uint32_t StrstrCandidateMaskSSE2(const T* p, size_t lastPos, __m128i first, __m128i last, uint32_t& nZero)
+		{
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + lastPos));
 
-		while(*s && *t && (Tolower(*s) == Tolower(*t)))
-			++s, ++t;
+			if(bFold)
+			{
+				a = FoldCharsSSE2(a, T());
+				b = FoldCharsSSE2(b, T());
+			}
 
-		if(*t == 0)
-			return (char*)cp;
-		++cp;
-	}
+			nZero = (uint32_t)_mm_movemask_epi8(CharsEqualSSE2(b, _mm_setzero_si128(), T()));
+			return (uint32_t)_mm_movemask_epi8(_mm_and_si128(CharsEqualSSE2(a, first, T()), CharsEqualSSE2(b, last, T())));
+		}
 
-	return 0;
-}
+		template <bool bFold, typename T>
+		EASTDC_TARGET_AVX2 inline uint32_t StrstrCandidateMaskAVX2(const T* p, size_t lastPos, __m256i first, __m256i last, uint32_t& nZero)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + lastPos));
 
-EASTDC_API char16_t* Stristr(const char16_t* s1, const char16_t* s2)
-{
-	const char16_t* cp = s1;
+			if(bFold)
+			{
+				a = FoldCharsAVX2(a, T());
+				b = FoldCharsAVX2(b, T());
+			}
 
-	if(!*s2)
-		return (char16_t*)s1;
+			nZero = (uint32_t)_mm256_movemask_epi8(CharsEqualAVX2(b, _mm256_setzero_si256(), T()));
+			return (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(CharsEqualAVX2(a, first, T()), CharsEqualAVX2(b, last, T())));
+		}
 
-	while(*cp)
-	{
-		const char16_t* s = cp;
-		const char16_t* t = s2;
 
-		while(*s && *t && (Tolower(*s) == Tolower(*t)))
-			++s, ++t;
+		template <bool bFold, typename T>
+		EASTDC_TARGET_SSE2 const T* StrstrFindCandidateSSE2T(const T* p, const T* pSubString, size_t lastPos)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRSTR
+				const size_t  kVectorCharCount = 16 / sizeof(T);
+				const T       cFirst = StrstrFold<bFold>(pSubString[0]);
+				const T       cLast  = StrstrFold<bFold>(pSubString[lastPos]);
+				const __m128i first  = SetCharsSSE2(cFirst);
+				const __m128i last   = SetCharsSSE2(cLast);
+
+				for(;; p += kVectorCharCount)
+				{
+					if(StringReadIsInPage(p, 16) && StringReadIsInPage(p + lastPos, 16))
+					{
+						uint32_t nZero;
+						uint32_t mask = StrstrCandidateMaskSSE2<bFold>(p, lastPos, first, last, nZero);
+
+						if(nZero)
+							mask &= (nZero & (0 - nZero)) - 1; // Only positions before the end of the string.
+						if(mask)
+							return p + ((size_t)CountTrailing0Bits(mask) / sizeof(T));
+						if(nZero)
+							return NULL;
+					}
+					else
+					{
+						for(size_t i = 0; i < kVectorCharCount; i++)
+						{
+							if(p[i + lastPos] == 0)
+								return NULL;
+							if((StrstrFold<bFold>(p[i]) == cFirst) && (StrstrFold<bFold>(p[i + lastPos]) == cLast))
+								return p + i;
+						}
+					}
+				}
+			#else
+				return StrstrFindCandidateScalarT<bFold>(p, pSubString, lastPos);
+			#endif
+		}
 
-		if(*t == 0)
-			return (char16_t*)cp;
-		++cp;
-	}
+		template <bool bFold, typename T>
+		EASTDC_TARGET_AVX2 const T* StrstrFindCandidateAVX2T(const T* p, const T* pSubString, size_t lastPos)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRSTR
+				const size_t  kVectorCharCount = 32 / sizeof(T);
+				const T       cFirst = StrstrFold<bFold>(pSubString[0]);
+				const T       cLast  = StrstrFold<bFold>(pSubString[lastPos]);
+				const __m256i first  = SetCharsAVX2(cFirst);
+				const __m256i last   = SetCharsAVX2(cLast);
+
+				for(;; p += kVectorCharCount)
+				{
+					if(StringReadIsInPage(p, 32) && StringReadIsInPage(p + lastPos, 32))
+					{
+						uint32_t nZero;
+						uint32_t mask = StrstrCandidateMaskAVX2<bFold>(p, lastPos, first, last, nZero);
+
+						if(nZero)
+							mask &= (nZero & (0 - nZero)) - 1; // Only positions before the end of the string.
+						if(mask)
+							return p + ((size_t)CountTrailing0Bits(mask) / sizeof(T));
+						if(nZero)
+							return NULL;
+					}
+					else
+					{
+						for(size_t i = 0; i < kVectorCharCount; i++)
+						{
+							if(p[i + lastPos] == 0)
+								return NULL;
+							if((StrstrFold<bFold>(p[i]) == cFirst) && (StrstrFold<bFold>(p[i + lastPos]) == cLast))
+								return p + i;
+						}
+					}
+				}
+			#else
+				return StrstrFindCandidateScalarT<bFold>(p, pSubString, lastPos);
+			#endif
+		}
 
-	return 0;
-}
 
-EASTDC_API char32_t* Stristr(const char32_t* s1, const char32_t* s2)
-{
-	const char32_t* cp = s1;
+		// The reverse kernels test the vector's worth of positions before j, and the loads are 
+		// within the string because the last position is (length - 1 - lastPos).
+		template <bool bFold, typename T>
+		EASTDC_TARGET_SSE2 size_t StrrstrFindCandidateSSE2T(const T* pString, size_t j, const T* pSubString, size_t lastPos)
+		{
+			const size_t  kVectorCharCount = 16 / sizeof(T);
+			const __m128i first = SetCharsSSE2(StrstrFold<bFold>(pSubString[0]));
+			const __m128i last  = SetCharsSSE2(StrstrFold<bFold>(pSubString[lastPos]));
 
-	if(!*s2)
-		return (char32_t*)s1;
+			for(; j >= kVectorCharCount; j -= kVectorCharCount)
+			{
+				uint32_t       nZero;
+				const uint32_t mask = StrstrCandidateMaskSSE2<bFold>(pString + j - kVectorCharCount, lastPos, first, last, nZero);
 
-	while(*cp)
-	{
-		const char32_t* s = cp;
-		const char32_t* t = s2;
+				if(mask)
+					return j - kVectorCharCount + ((size_t)(31 - CountLeading0Bits(mask)) / sizeof(T));
+			}
 
-		while(*s && *t && (Tolower(*s) == Tolower(*t)))
-			++s, ++t;
+			return StrrstrFindCandidateScalarT<bFold>(pString, j, pSubString, lastPos);
+		}
 
-		if(*t == 0)
-			return (char32_t*)cp;
-		++cp;
-	}
+		template <bool bFold, typename T>
+		EASTDC_TARGET_AVX2 size_t StrrstrFindCandidateAVX2T(const T* pString, size_t j, const T* pSubString, size_t lastPos)
+		{
+			const size_t  kVectorCharCount = 32 / sizeof(T);
+			const __m256i first = SetCharsAVX2(StrstrFold<bFold>(pSubString[0]));
+			const __m256i last  = SetCharsAVX2(StrstrFold<bFold>(pSubString[lastPos]));
 
-	return 0;
-}
+			for(; j >= kVectorCharCount; j -= kVectorCharCount)
+			{
+				uint32_t       nZero;
+				const uint32_t mask = StrstrCandidateMaskAVX2<bFold>(pString + j - kVectorCharCount, lastPos, first, last, nZero);
 
+				if(mask)
+					return j - kVectorCharCount + ((size_t)(31 - CountLeading0Bits(mask)) / sizeof(T));
+			}
 
+			return StrrstrFindCandidateSSE2T<bFold>(pString, j, pSubString, lastPos);
+		}
 
 
-EASTDC_API char* Strrstr(const char* s1, const char* s2) 
-{
-	if(!*s2)
-		return (char*)s1;
+		EASTDC_TARGET_SSE2 const char*     StrstrFindCandidateSSE2  (const char*     p, const char*     pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateSSE2T<true>(p, pSubString, lastPos) : StrstrFindCandidateSSE2T<false>(p, pSubString, lastPos); }
+		EASTDC_TARGET_SSE2 const char16_t* StrstrFindCandidate16SSE2(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateSSE2T<true>(p, pSubString, lastPos) : StrstrFindCandidateSSE2T<false>(p, pSubString, lastPos); }
+		EASTDC_TARGET_SSE2 const char32_t* StrstrFindCandidate32SSE2(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateSSE2T<true>(p, pSubString, lastPos) : StrstrFindCandidateSSE2T<false>(p, pSubString, lastPos); }
+		EASTDC_TARGET_AVX2 const char*     StrstrFindCandidateAVX2  (const char*     p, const char*     pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateAVX2T<true>(p, pSubString, lastPos) : StrstrFindCandidateAVX2T<false>(p, pSubString, lastPos); }
+		EASTDC_TARGET_AVX2 const char16_t* StrstrFindCandidate16AVX2(const char16_t* p, const char16_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateAVX2T<true>(p, pSubString, lastPos) : StrstrFindCandidateAVX2T<false>(p, pSubString, lastPos); }
+		EASTDC_TARGET_AVX2 const char32_t* StrstrFindCandidate32AVX2(const char32_t* p, const char32_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrstrFindCandidateAVX2T<true>(p, pSubString, lastPos) : StrstrFindCandidateAVX2T<false>(p, pSubString, lastPos); }
 
-	const char* ps1 = s1 + Strlen(s1);
+		EASTDC_TARGET_SSE2 size_t StrrstrFindCandidateSSE2  (const char*     pString, size_t j, const char*     pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateSSE2T<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateSSE2T<false>(pString, j, pSubString, lastPos); }
+		EASTDC_TARGET_SSE2 size_t StrrstrFindCandidate16SSE2(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateSSE2T<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateSSE2T<false>(pString, j, pSubString, lastPos); }
+		EASTDC_TARGET_SSE2 size_t StrrstrFindCandidate32SSE2(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateSSE2T<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateSSE2T<false>(pString, j, pSubString, lastPos); }
+		EASTDC_TARGET_AVX2 size_t StrrstrFindCandidateAVX2  (const char*     pString, size_t j, const char*     pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateAVX2T<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateAVX2T<false>(pString, j, pSubString, lastPos); }
+		EASTDC_TARGET_AVX2 size_t StrrstrFindCandidate16AVX2(const char16_t* pString, size_t j, const char16_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateAVX2T<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateAVX2T<false>(pString, j, pSubString, lastPos); }
+		EASTDC_TARGET_AVX2 size_t StrrstrFindCandidate32AVX2(const char32_t* pString, size_t j, const char32_t* pSubString, size_t lastPos, bool bFold) { return bFold ? StrrstrFindCandidateAVX2T<true>(pString, j, pSubString, lastPos) : StrrstrFindCandidateAVX2T<false>(pString, j, pSubString, lastPos); }
+	#endif
 
-	while(ps1 != s1) 
-	{
-		const char* psc1 = --ps1;
-		const char* sc2  = s2;
+} // namespace Internal
 
-		for(;;)
-		{
-			if(*psc1++ != *sc2++)
-				break;
-			else if(!*sc2)
-				return (char*)ps1;
-		}
-	}
 
-	return 0;
+// Returns whether the count chars at p1 and p2, which aren't 0, are equal, case-folded if bFold.
+template <typename T>
+static EA_FORCE_INLINE bool StrstrVerify(const T* p1, const T* p2, size_t count, bool bFold)
+{
+	return bFold ? (Strnicmp(p1, p2, count) == 0) : (Memcmp(p1, p2, count * sizeof(T)) == 0);
 }
 
-EASTDC_API char16_t* Strrstr(const char16_t* s1, const char16_t* s2) 
+
+template <typename T>
+static T* StrstrCommon(const T* pString, const T* pSubString, bool bFold, const T* (*pFindCandidate)(const T*, const T*, size_t, bool))
 {
-	if(!*s2)
-		return (char16_t*)s1;
+	if(*pSubString == 0) // An empty pSubString results in success, return pString.
+		return (T*)pString;
 
-	const char16_t* ps1 = s1 + Strlen(s1);
+	const size_t lastPos = Strlen(pSubString) - 1;
 
-	while(ps1 != s1) 
+	for(size_t i = 0; i < lastPos; i++) // The kernels require the first lastPos chars of the string to not be 0.
 	{
-		const char16_t* psc1 = --ps1;
-		const char16_t* sc2  = s2;
+		if(pString[i] == 0)
+			return NULL;
+	}
 
-		for(;;)
-		{
-			if(*psc1++ != *sc2++)
-				break;
-			else if(!*sc2)
-				return (char16_t*)ps1;
-		}
+	for(const T* p = pString; (p = pFindCandidate(p, pSubString, lastPos, bFold)) != NULL; ++p)
+	{
+		if(StrstrVerify(p + 1, pSubString + 1, (lastPos ? (lastPos - 1) : 0), bFold))
+			return (T*)p;
 	}
 
-	return 0;
+	return NULL;
 }
 
-EASTDC_API char32_t* Strrstr(const char32_t* s1, const char32_t* s2) 
+
+template <typename T>
+static T* StrrstrCommon(const T* pString, const T* pSubString, bool bFold, size_t (*pFindCandidate)(const T*, size_t, const T*, size_t, bool))
 {
-	if(!*s2)
-		return (char32_t*)s1;
+	if(*pSubString == 0) // An empty pSubString results in success, return pString.
+		return (T*)pString;
 
-	const char32_t* ps1 = s1 + Strlen(s1);
+	const size_t length    = Strlen(pString);
+	const size_t subLength = Strlen(pSubString);
 
-	while(ps1 != s1) 
-	{
-		const char32_t* psc1 = --ps1;
-		const char32_t* sc2  = s2;
+	if(subLength > length)
+		return NULL;
 
-		for(;;)
-		{
-			if(*psc1++ != *sc2++)
-				break;
-			else if(!*sc2)
-				return (char32_t*)ps1;
-		}
+	const size_t lastPos = subLength - 1;
+
+	for(size_t j = length - lastPos; (j = pFindCandidate(pString, j, pSubString, lastPos, bFold)) != (size_t)-1; )
+	{
+		if(StrstrVerify(pString + j + 1, pSubString + 1, (lastPos ? (lastPos - 1) : 0), bFold))
+			return (T*)(pString + j);
 	}
 
-	return 0;
+	return NULL;
 }
 
 
+EASTDC_API char* Strstr(const char* pString, const char* pSubString)
+{
+	return StrstrCommon(pString, pSubString, false, Internal::GetCPUDispatchTable().mpStrstrFindCandidate);
+}
 
+EASTDC_API char16_t* Strstr(const char16_t* pString, const char16_t* pSubString)
+{
+	return StrstrCommon(pString, pSubString, false, Internal::GetCPUDispatchTable().mpStrstrFindCandidate16);
+}
 
-EASTDC_API char* Strirstr(const char* s1, const char* s2)
+EASTDC_API char32_t* Strstr(const char32_t* pString, const char32_t* pSubString)
 {
-	if(!*s2)
-		return (char*)s1;
+	return StrstrCommon(pString, pSubString, false, Internal::GetCPUDispatchTable().mpStrstrFindCandidate32);
+}
 
-	const char* ps1 = s1 + Strlen(s1);
 
-	while(ps1 != s1) 
-	{
-		const char* psc1 = --ps1;
-		const char* sc2  = s2;
 
-		for(;;)
-		{
-			if(Tolower(*psc1++) != Tolower(*sc2++))
-				break;
-			else if(!*sc2)
-				return (char*)ps1;
-		}
-	}
+EASTDC_API char* Stristr(const char* pString, const char* pSubString)
+{
+	return StrstrCommon(pString, pSubString, true, Internal::GetCPUDispatchTable().mpStrstrFindCandidate);
+}
 
-	return 0;
+EASTDC_API char16_t* Stristr(const char16_t* pString, const char16_t* pSubString)
+{
+	return StrstrCommon(pString, pSubString, true, Internal::GetCPUDispatchTable().mpStrstrFindCandidate16);
 }
 
-EASTDC_API char16_t* Strirstr(const char16_t* s1, const char16_t* s2)
+EASTDC_API char32_t* Stristr(const char32_t* pString, const char32_t* pSubString)
 {
-	if(!*s2)
-		return (char16_t*)s1;
+	return StrstrCommon(pString, pSubString, true, Internal::GetCPUDispatchTable().mpStrstrFindCandidate32);
+}
 
-	const char16_t* ps1 = s1 + Strlen(s1);
 
-	while(ps1 != s1) 
-	{
-		const char16_t* psc1 = --ps1;
-		const char16_t* sc2  = s2;
 
-		for(;;)
-		{
-			if(Tolower(*psc1++) != Tolower(*sc2++))
-				break;
-			else if(!*sc2)
-				return (char16_t*)ps1;
-		}
-	}
+EASTDC_API char* Strrstr(const char* pString, const char* pSubString)
+{
+	return StrrstrCommon(pString, pSubString, false, Internal::GetCPUDispatchTable().mpStrrstrFindCandidate);
+}
 
-	return 0;
+EASTDC_API char16_t* Strrstr(const char16_t* pString, const char16_t* pSubString)
+{
+	return StrrstrCommon(pString, pSubString, false, Internal::GetCPUDispatchTable().mpStrrstrFindCandidate16);
 }
 
-EASTDC_API char32_t* Strirstr(const char32_t* s1, const char32_t* s2)
+EASTDC_API char32_t* Strrstr(const char32_t* pString, const char32_t* pSubString)
 {
-	if(!*s2)
-		return (char32_t*)s1;
+	return StrrstrCommon(pString, pSubString, false, Internal::GetCPUDispatchTable().mpStrrstrFindCandidate32);
+}
 
-	const char32_t* ps1 = s1 + Strlen(s1);
 
-	while(ps1 != s1) 
-	{
-		const char32_t* psc1 = --ps1;
-		const char32_t* sc2  = s2;
 
-		for(;;)
-		{
-			if(Tolower(*psc1++) != Tolower(*sc2++))
-				break;
-			else if(!*sc2)
-				return (char32_t*)ps1;
-		}
-	}
+EASTDC_API char* Strirstr(const char* pString, const char* pSubString)
+{
+	return StrrstrCommon(pString, pSubString, true, Internal::GetCPUDispatchTable().mpStrrstrFindCandidate);
+}
 
-	return 0;
+EASTDC_API char16_t* Strirstr(const char16_t* pString, const char16_t* pSubString)
+{
+	return StrrstrCommon(pString, pSubString, true, Internal::GetCPUDispatchTable().mpStrrstrFindCandidate16);
+}
+
+EASTDC_API char32_t* Strirstr(const char32_t* pString, const char32_t* pSubString)
+{
+	return StrrstrCommon(pString, pSubString, true, Internal::GetCPUDispatchTable().mpStrrstrFindCandidate32);
 }
 
 
@@ -2656,208 +3806,36 @@ EASTDC_API bool Striend(const char16_t* pString, const char16_t* pSuffix, size_t
 	if(stringLength == kSizeTypeUnset)
 		stringLength = Strlen(pString);
 
-	if(suffixLength == kSizeTypeUnset)
-		suffixLength = Strlen(pSuffix);
-
-	if(stringLength >= suffixLength)
-		return Stricmp(pString + stringLength - suffixLength, pSuffix) == 0;
-
-	return false;
-}
-
-
-EASTDC_API bool Striend(const char32_t* pString, const char32_t* pSuffix, size_t stringLength, size_t suffixLength)
-{
-	if(stringLength == kSizeTypeUnset)
-		stringLength = Strlen(pString);
-
-	if(suffixLength == kSizeTypeUnset)
-		suffixLength = Strlen(pSuffix);
-
-	if(stringLength >= suffixLength)
-		return Stricmp(pString + stringLength - suffixLength, pSuffix) == 0;
-
-	return false;
-}
-
-
-///////////////////////////////////////////////////////////////////
-// This function was implemented by Avery Lee.
-//
-EASTDC_API char* Strtok(char* pString, const char* pDelimiters, char** pContext)
-{
-	// find point on string to resume
-	char* s = pString;
-
-	if(!s)
-	{
-		s = *pContext;
-		if(!s)
-			return NULL;
-	}
-
-	// Compute bit hash based on lower 5 bits of delimiter characters
-	const char* d = pDelimiters;
-	int32_t        hash = 0;
-	uint32_t       delimiterCount = 0;
-
-	while(const char c = *d++)
-	{
-		hash |= (int32_t)(0x80000000 >> (c & 31));
-		++delimiterCount;
-	}
-
-	// Skip delimiters
-	for(;;)
-	{
-		const char c = *s;
-
-		// If we hit the end of the string, it ends solely with delimiters
-		// and there are no more tokens to get.
-		if(!c)
-		{
-			*pContext = NULL;
-			return NULL;
-		}
-
-		// Fast rejection against hash set
-		if(int32_t(uint64_t(hash) << (c & 31)) >= 0)
-			break;
-
-		// brute-force search against delimiter list
-		for(uint32_t i=0; i<delimiterCount; ++i)
-		{
-			if (pDelimiters[i] == c)    // Is it a delimiter? ...
-				goto still_delimiters;  // yes, continue the loop
-		}
-
-		// Not a token, so exit
-		break;
-
-	still_delimiters:
-		++s;
-	}
-
-	// Mark beginning of token
-	char* const pToken = s;
-
-	// Search for end of token
-	while(const char c = *s)
-	{
-		// Fast rejection against hash set
-		if(int32_t(int64_t(hash) << (c & 31)) < 0)
-		{
-			// Brute-force search against delimiter list
-			for(uint32_t i=0; i<delimiterCount; ++i)
-			{
-				if(pDelimiters[i] == c)
-				{
-					// This token ends with a delimiter.
-					*s = 0;                 // null-term substring
-					*pContext = (s + 1);    // restart on next byte
-					return pToken;          // return found token
-				}
-			}
-		}
-
-		++s;
-	}
-
-	// We found a token but it was at the end of the string, 
-	// so we null out the context and return the last token.
-	*pContext = NULL;           // no more tokens
-	return pToken;              // return found token
-}
-
-EASTDC_API char16_t* Strtok(char16_t* pString, const char16_t* pDelimiters, char16_t** pContext)
-{
-	// Find point on string to resume
-	char16_t* s = pString;
-
-	if(!s)
-	{
-		s = *pContext;
-		if(!s)
-			return NULL;
-	}
-
-	// compute bit hash based on lower 5 bits of delimiter characters
-	const char16_t* d = pDelimiters;
-	int32_t         hash = 0;
-	uint32_t        delimiterCount = 0;
-
-	while(const char16_t c = *d++)
-	{
-		hash |= (int32_t)(0x80000000 >> (c & 31));
-		++delimiterCount;
-	}
-
-	// Skip delimiters
-	for(;;)
-	{
-		const char16_t c = *s;
-
-		// If we hit the end of the string, it ends solely with delimiters
-		// and there are no more tokens to get.
-		if(!c)
-		{
-			*pContext = NULL;
-			return NULL;
-		}
-
-		// Fast rejection against hash set
-		if(int32_t(int64_t(hash) << (c & 31)) >= 0)
-			break;
+	if(suffixLength == kSizeTypeUnset)
+		suffixLength = Strlen(pSuffix);
 
-		// Brute-force search against delimiter list
-		for(uint32_t i=0; i<delimiterCount; ++i)
-		{
-			if(pDelimiters[i] == (char16_t)c)    // Is it a delimiter? ...
-				goto still_delimiters;           // yes, continue the loop
-		}
+	if(stringLength >= suffixLength)
+		return Stricmp(pString + stringLength - suffixLength, pSuffix) == 0;
 
-		// Not a token, so exit
-		break;
+	return false;
+}
 
-	still_delimiters:
-		++s;
-	}
 
-	// Mark beginning of token
-	char16_t* const pToken = s;
+EASTDC_API bool Striend(const char32_t* pString, const char32_t* pSuffix, size_t stringLength, size_t suffixLength)
+{
+	if(stringLength == kSizeTypeUnset)
+		stringLength = Strlen(pString);
 
-	// Search for end of token
-	while(const char16_t c = *s)
-	{
-		// Fast rejection against hash set
-		if(int32_t(int64_t(hash) << (c & 31)) < 0)
-		{
-			// Brute-force search against delimiter list
-			for(uint32_t i=0; i<delimiterCount; ++i)
-			{
-				if(pDelimiters[i] == c)
-				{
-					// This token ends with a delimiter.
-					*s = 0;                 // null-term substring
-					*pContext = (s + 1);    // restart on next byte
-					return pToken;          // return found token
-				}
-			}
-		}
+	if(suffixLength == kSizeTypeUnset)
+		suffixLength = Strlen(pSuffix);
 
-		++s;
-	}
+	if(stringLength >= suffixLength)
+		return Stricmp(pString + stringLength - suffixLength, pSuffix) == 0;
 
-	// We found a token but it was at the end of the string, 
-	// so we null out the context and return the last token.
-	*pContext = NULL;           // no more tokens
-	return pToken;              // return found token
+	return false;
 }
 
-EASTDC_API char32_t* Strtok(char32_t* pString, const char32_t* pDelimiters, char32_t** pContext)
+
+template <typename T, typename Set>
+static T* StrtokCommon(T* pString, const Set& delimiters, T** pContext)
 {
 	// Find point on string to resume
-	char32_t* s = pString;
+	T* s = pString;
 
 	if(!s)
 	{
@@ -2866,100 +3844,79 @@ EASTDC_API char32_t* Strtok(char32_t* pString, const char32_t* pDelimiters, char
 			return NULL;
 	}
 
-	// compute bit hash based on lower 5 bits of delimiter characters
-	const char32_t* d = pDelimiters;
-	int32_t         hash = 0;
-	uint32_t        delimiterCount = 0;
+	// Skip delimiters. If we hit the end of the string, it ends solely 
+	// with delimiters and there are no more tokens to get.
+	s = (T*)CharSetFind(s, delimiters, false);
 
-	while(const uint32_t c = (uint32_t)*d++)
+	if(!*s)
 	{
-		hash |= (int32_t)(0x80000000 >> (c & 31));
-		++delimiterCount;
+		*pContext = NULL;
+		return NULL;
 	}
 
-	// Skip delimiters
-	for(;;)
-	{
-		const char32_t c = *s;
+	// Mark beginning of token and search for end of token.
+	T* const pToken = s;
+	s = (T*)CharSetFind(s, delimiters, true);
 
-		// If we hit the end of the string, it ends solely with delimiters
-		// and there are no more tokens to get.
-		if(!c)
-		{
-			*pContext = NULL;
-			return NULL;
-		}
+	if(*s)
+	{
+		// This token ends with a delimiter.
+		*s = 0;                 // null-term substring
+		*pContext = (s + 1);    // restart on next char
+	}
+	else
+		*pContext = NULL;       // The token is at the end of the string, so there are no more tokens.
 
-		// Fast rejection against hash set
-		if(int32_t(int64_t(hash) << (c & 31)) >= 0)
-			break;
+	return pToken;
+}
 
-		// Brute-force search against delimiter list
-		for(uint32_t i=0; i<delimiterCount; ++i)
-		{
-			if(pDelimiters[i] == c)    // Is it a delimiter? ...
-				goto still_delimiters;  // yes, continue the loop
-		}
 
-		// Not a token, so exit
-		break;
+EASTDC_API char* Strtok(char* pString, const char* pDelimiters, char** pContext)
+{
+	return StrtokCommon(pString, CharSet(pDelimiters), pContext);
+}
 
-	still_delimiters:
-		++s;
-	}
+EASTDC_API char16_t* Strtok(char16_t* pString, const char16_t* pDelimiters, char16_t** pContext)
+{
+	return StrtokCommon(pString, StringCharSet<char16_t>(pDelimiters), pContext);
+}
 
-	// Mark beginning of token
-	char32_t* const pToken = s;
+EASTDC_API char32_t* Strtok(char32_t* pString, const char32_t* pDelimiters, char32_t** pContext)
+{
+	return StrtokCommon(pString, StringCharSet<char32_t>(pDelimiters), pContext);
+}
 
-	// Search for end of token
-	while(const uint32_t c = (uint32_t)*s)
-	{
-		// Fast rejection against hash set
-		if(int32_t(int64_t(hash) << (c & 31)) < 0)
-		{
-			// Brute-force search against delimiter list
-			for(uint32_t i=0; i<delimiterCount; ++i)
-			{
-				if(pDelimiters[i] == (char32_t)c)
-				{
-					// This token ends with a delimiter.
-					*s = 0;                 // null-term substring
-					*pContext = (s + 1);    // restart on next byte
-					return pToken;          // return found token
-				}
-			}
-		}
+EASTDC_API char* Strtok(char* pString, const CharSet& delimiters, char** pContext)
+{
+	return StrtokCommon(pString, delimiters, pContext);
+}
 
-		++s;
-	}
+EASTDC_API char16_t* Strtok(char16_t* pString, const CharSet& delimiters, char16_t** pContext)
+{
+	return StrtokCommon(pString, delimiters, pContext);
+}
 
-	// We found a token but it was at the end of the string, 
-	// so we null out the context and return the last token.
-	*pContext = NULL;           // no more tokens
-	return pToken;              // return found token
+EASTDC_API char32_t* Strtok(char32_t* pString, const CharSet& delimiters, char32_t** pContext)
+{
+	return StrtokCommon(pString, delimiters, pContext);
 }
 
 
 
-EASTDC_API const char* Strtok2(const char* pString, const char* pDelimiters, 
-								  size_t* pResultLength, bool bFirst)
+template <typename T, typename Set>
+static const T* Strtok2Common(const T* pString, const Set& delimiters, size_t* pResultLength, bool bFirst)
 {
 	// Skip any non-delimiters
 	if(!bFirst)
-	{
-		while(*pString && !Strchr(pDelimiters, *pString))
-			++pString;
-	}
+		pString = CharSetFind(pString, delimiters, true);
 
 	// Skip any delimiters
-	while(*pString && Strchr(pDelimiters, *pString))
-		++pString;
+	pString = CharSetFind(pString, delimiters, false);
 
-	const char* const pBegin = pString;
+	const T* const pBegin = pString;
 
 	// Calculate the length of the string
-	while(*pString && !Strchr(pDelimiters, *pString))
-		++pString;
+	pString = CharSetFind(pString, delimiters, true);
 
 	if(pBegin != pString)
 	{
@@ -2971,62 +3928,36 @@ EASTDC_API const char* Strtok2(const char* pString, const char* pDelimiters,
 	return NULL;
 }
 
-EASTDC_API const char16_t* Strtok2(const char16_t* pString, const char16_t* pDelimiters, size_t* pResultLength, bool bFirst)
-{
-	// Skip any non-delimiters
-	if(!bFirst)
-	{
-		while(*pString && !Strchr(pDelimiters, *pString))
-			++pString;
-	}
-
-	// Skip any delimiters
-	while(*pString && Strchr(pDelimiters, *pString))
-		++pString;
-
-	const char16_t* const pBegin = pString;
 
-	// Calculate the length of the string
-	while(*pString && !Strchr(pDelimiters, *pString))
-		++pString;
-
-	if(pBegin != pString)
-	{
-		*pResultLength = static_cast<size_t>(pString - pBegin);
-		return pBegin;
-	}
+EASTDC_API const char* Strtok2(const char* pString, const char* pDelimiters, 
+								  size_t* pResultLength, bool bFirst)
+{
+	return Strtok2Common(pString, CharSet(pDelimiters), pResultLength, bFirst);
+}
 
-	*pResultLength = 0;
-	return NULL;
+EASTDC_API const char16_t* Strtok2(const char16_t* pString, const char16_t* pDelimiters, size_t* pResultLength, bool bFirst)
+{
+	return Strtok2Common(pString, StringCharSet<char16_t>(pDelimiters), pResultLength, bFirst);
 }
 
 EASTDC_API const char32_t* Strtok2(const char32_t* pString, const char32_t* pDelimiters, size_t* pResultLength, bool bFirst)
 {
-	// Skip any non-delimiters
-	if(!bFirst)
-	{
-		while(*pString && !Strchr(pDelimiters, *pString))
-			++pString;
-	}
-
-	// Skip any delimiters
-	while(*pString && Strchr(pDelimiters, *pString))
-		++pString;
-
-	const char32_t* const pBegin = pString;
+	return Strtok2Common(pString, StringCharSet<char32_t>(pDelimiters), pResultLength, bFirst);
+}
 
-	// Calculate the length of the string
-	while(*pString && !Strchr(pDelimiters, *pString))
-		++pString;
+EASTDC_API const char* Strtok2(const char* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst)
+{
+	return Strtok2Common(pString, delimiters, pResultLength, bFirst);
+}
 
-	if(pBegin != pString)
-	{
-		*pResultLength = static_cast<size_t>(pString - pBegin);
-		return pBegin;
-	}
+EASTDC_API const char16_t* Strtok2(const char16_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst)
+{
+	return Strtok2Common(pString, delimiters, pResultLength, bFirst);
+}
 
-	*pResultLength = 0;
-	return NULL;
+EASTDC_API const char32_t* Strtok2(const char32_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst)
+{
+	return Strtok2Common(pString, delimiters, pResultLength, bFirst);
 }
 
 
@@ -3406,116 +4337,240 @@ EASTDC_API int Strncmp(const char32_t* pString1, const char32_t* pString2, size_
 
 
 
-#if EASTDC_ENABLE_OPTIMIZED_STRCMP && (defined(EA_PLATFORM_LINUX) || defined(EA_PLATFORM_OSX))
-	// Some platforms have an optimized vector implementation of stricmp/strcasecmp which is fast and which provides
-	// identical return value behavior to our Stricmp (which is to return the byte difference and not just
-	// -1, 0, +1). And so until we have our own vectored version we use the built-in version.
-	EASTDC_API int Stricmp(const char* pString1, const char* pString2)
+// Stricmp / Strnicmp kernels, called via the CPU dispatch table. Stricmp uses them with an n of (size_t)-1.
+//
+// Tolower maps only the ASCII letters 'A'-'Z', so the SIMD pathways can fold case for a whole 
+// vector of chars at once by adding 0x20 to the chars in that range, and it doesn't matter whether 
+// the other chars are ASCII. They compare a vector of chars from each string and stop at the first 
+// vector with a difference or a 0 char in pString1, whose result is found from that char alone.
+// Much like the optimized Strlen, the vector reads may go past the end of the strings, but never 
+// into another page, which we assume to be at least 4096 bytes. Where a read would cross into 
+// the next page, we compare that vector's worth of chars one by one instead.
+
+#if EASTDC_STATIC_ANALYSIS_ENABLED
+	#define EASTDC_ENABLE_OPTIMIZED_STRICMP 0 // Disabled for unterminated reads, for the same reason as EASTDC_ENABLE_OPTIMIZED_STRLEN.
+#else
+	#define EASTDC_ENABLE_OPTIMIZED_STRICMP 1
+#endif
+
+namespace Internal
+{
+	// Returns the result of comparing the case-folded chars c1 and c2, as Strnicmp does.
+	static EA_FORCE_INLINE int StrnicmpDifference(char c1, char c2)
 	{
-		return strcasecmp(pString1, pString2);
+		return ((uint8_t)c1 - (uint8_t)c2);
+	}
+
+	static EA_FORCE_INLINE int StrnicmpDifference(char16_t c1, char16_t c2)
+	{
+		// Code below which uses (c1 - c2) assumes this.
+		EA_COMPILETIME_ASSERT(sizeof(int) > sizeof(uint16_t));
+		return ((uint16_t)c1 - (uint16_t)c2);
+	}
+
+	static EA_FORCE_INLINE int StrnicmpDifference(char32_t c1, char32_t c2)
+	{
+		// We can't just return c1 - c2, because the difference might be greater than INT_MAX.
+		return (c1 == c2) ? 0 : (((uint32_t)c1 > (uint32_t)c2) ? 1 : -1);
 	}
 
-	// To do: Implement a general portable version of a more optimized Stricmp.
 
-#else
-	EASTDC_API int Stricmp(const char* pString1, const char* pString2)
+	template <typename T>
+	static EA_FORCE_INLINE int StrnicmpScalarT(const T* pString1, const T* pString2, size_t n)
 	{
-		char c1, c2;
+		T c1, c2;
 
-		while((c1 = Tolower(*pString1++)) == (c2 = Tolower(*pString2++)))
+		++n;
+		while(--n)
 		{
-			if(c1 == 0)
-				return 0;
+			if((c1 = Tolower(*pString1++)) != (c2 = Tolower(*pString2++)))
+				return StrnicmpDifference(c1, c2);
+			else if(c1 == 0)
+				break;
 		}
-
-		return ((uint8_t)c1 - (uint8_t)c2);
+			
+		return 0;
 	}
-#endif
 
+	int StrnicmpScalar(const char* pString1, const char* pString2, size_t n)
+	{
+		return StrnicmpScalarT(pString1, pString2, n);
+	}
 
-EASTDC_API int Stricmp(const char16_t* pString1, const char16_t* pString2)
-{
-	char16_t c1, c2;
+	int Strnicmp16Scalar(const char16_t* pString1, const char16_t* pString2, size_t n)
+	{
+		return StrnicmpScalarT(pString1, pString2, n);
+	}
 
-	while((c1 = Tolower(*pString1++)) == (c2 = Tolower(*pString2++)))
+	int Strnicmp32Scalar(const char32_t* pString1, const char32_t* pString2, size_t n)
 	{
-		if(c1 == 0)
-			return 0;
+		return StrnicmpScalarT(pString1, pString2, n);
 	}
 
-	// Code below which uses (c1 - c2) assumes this.
-	EA_COMPILETIME_ASSERT(sizeof(int) > sizeof(uint16_t));
-	return ((uint16_t)c1 - (uint16_t)c2);
-}
 
-EASTDC_API int Stricmp(const char32_t* pString1, const char32_t* pString2)
-{
-	char32_t c1, c2;
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Compares nCount chars one by one. Returns true and sets nResult if the comparison ended 
+		// within them, with a difference or a 0 char.
+		template <typename T>
+		static EA_FORCE_INLINE bool StrnicmpChars(const T* pString1, const T* pString2, size_t nCount, int& nResult)
+		{
+			for(size_t i = 0; i < nCount; i++)
+			{
+				const T c1 = Tolower(pString1[i]);
+				const T c2 = Tolower(pString2[i]);
 
-	while((c1 = Tolower(*pString1++)) == (c2 = Tolower(*pString2++)))
-	{
-		if(c1 == 0)
-			return 0;
-	}
+				if((c1 != c2) || (c1 == 0))
+				{
+					nResult = StrnicmpDifference(c1, c2);
+					return true;
+				}
+			}
+
+			return false;
+		}
 
-	// We can't just return c1 - c2, because the difference might be greater than INT_MAX.
-	return ((uint32_t)c1 > (uint32_t)c2) ? 1 : -1;
-}
 
+		// Returns a mask with one bit per byte, set for the bytes of the chars which differ after case 
+		// folding or which are 0 in p1.
+		template <typename T>
+		EASTDC_TARGET_SSE2 inline uint32_t StrnicmpMaskSSE2(const T* p1, const T* p2)
+		{
+			const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p1));
+			const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p2));
 
+			const uint32_t nEqual = (uint32_t)_mm_movemask_epi8(CharsEqualSSE2(FoldCharsSSE2(a, T()), FoldCharsSSE2(b, T()), T()));
+			const uint32_t nZero  = (uint32_t)_mm_movemask_epi8(CharsEqualSSE2(a, _mm_setzero_si128(), T()));
 
-EASTDC_API int Strnicmp(const char* pString1, const char* pString2, size_t n)
-{
-	char c1, c2;
+			return (nEqual ^ 0xffff) | nZero;
+		}
 
-	++n;
-	while(--n)
+		template <typename T>
+		EASTDC_TARGET_AVX2 inline uint32_t StrnicmpMaskAVX2(const T* p1, const T* p2)
+		{
+			const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p1));
+			const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p2));
+
+			const uint32_t nEqual = (uint32_t)_mm256_movemask_epi8(CharsEqualAVX2(FoldCharsAVX2(a, T()), FoldCharsAVX2(b, T()), T()));
+			const uint32_t nZero  = (uint32_t)_mm256_movemask_epi8(CharsEqualAVX2(a, _mm256_setzero_si256(), T()));
+
+			return ~nEqual | nZero;
+		}
+
+
+		template <typename T>
+		EASTDC_TARGET_SSE2 int StrnicmpSSE2T(const T* pString1, const T* pString2, size_t n)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRICMP
+				const size_t kVectorCharCount = 16 / sizeof(T);
+
+				for(; n >= kVectorCharCount; pString1 += kVectorCharCount, pString2 += kVectorCharCount, n -= kVectorCharCount)
+				{
+					if(StringReadIsInPage(pString1, 16) && StringReadIsInPage(pString2, 16))
+					{
+						const uint32_t mask = StrnicmpMaskSSE2(pString1, pString2);
+
+						if(mask)
+						{
+							const size_t i = (size_t)CountTrailing0Bits(mask) / sizeof(T);
+							return StrnicmpDifference(Tolower(pString1[i]), Tolower(pString2[i]));
+						}
+					}
+					else
+					{
+						int nResult;
+
+						if(StrnicmpChars(pString1, pString2, kVectorCharCount, nResult))
+							return nResult;
+					}
+				}
+			#endif
+
+			return StrnicmpScalarT(pString1, pString2, n);
+		}
+
+		template <typename T>
+		EASTDC_TARGET_AVX2 int StrnicmpAVX2T(const T* pString1, const T* pString2, size_t n)
+		{
+			#if EASTDC_ENABLE_OPTIMIZED_STRICMP
+				const size_t kVectorCharCount = 32 / sizeof(T);
+
+				for(; n >= kVectorCharCount; pString1 += kVectorCharCount, pString2 += kVectorCharCount, n -= kVectorCharCount)
+				{
+					if(StringReadIsInPage(pString1, 32) && StringReadIsInPage(pString2, 32))
+					{
+						const uint32_t mask = StrnicmpMaskAVX2(pString1, pString2);
+
+						if(mask)
+						{
+							const size_t i = (size_t)CountTrailing0Bits(mask) / sizeof(T);
+							return StrnicmpDifference(Tolower(pString1[i]), Tolower(pString2[i]));
+						}
+					}
+					else
+					{
+						int nResult;
+
+						if(StrnicmpChars(pString1, pString2, kVectorCharCount, nResult))
+							return nResult;
+					}
+				}
+			#endif
+
+			return StrnicmpScalarT(pString1, pString2, n);
+		}
+
+
+		EASTDC_TARGET_SSE2 int StrnicmpSSE2  (const char*     pString1, const char*     pString2, size_t n) { return StrnicmpSSE2T(pString1, pString2, n); }
+		EASTDC_TARGET_SSE2 int Strnicmp16SSE2(const char16_t* pString1, const char16_t* pString2, size_t n) { return StrnicmpSSE2T(pString1, pString2, n); }
+		EASTDC_TARGET_SSE2 int Strnicmp32SSE2(const char32_t* pString1, const char32_t* pString2, size_t n) { return StrnicmpSSE2T(pString1, pString2, n); }
+		EASTDC_TARGET_AVX2 int StrnicmpAVX2  (const char*     pString1, const char*     pString2, size_t n) { return StrnicmpAVX2T(pString1, pString2, n); }
+		EASTDC_TARGET_AVX2 int Strnicmp16AVX2(const char16_t* pString1, const char16_t* pString2, size_t n) { return StrnicmpAVX2T(pString1, pString2, n); }
+		EASTDC_TARGET_AVX2 int Strnicmp32AVX2(const char32_t* pString1, const char32_t* pString2, size_t n) { return StrnicmpAVX2T(pString1, pString2, n); }
+	#endif
+
+} // namespace Internal
+
+
+#if EASTDC_ENABLE_OPTIMIZED_STRCMP && (defined(EA_PLATFORM_LINUX) || defined(EA_PLATFORM_OSX))
+	// Some platforms have an optimized vector implementation of stricmp/strcasecmp which is fast and which provides
+	// identical return value behavior to our Stricmp (which is to return the byte difference and not just
+	// -1, 0, +1). And so we use the built-in version.
+	EASTDC_API int Stricmp(const char* pString1, const char* pString2)
 	{
-		if((c1 = Tolower(*pString1++)) != (c2 = Tolower(*pString2++)))
-			return ((uint8_t)c1 - (uint8_t)c2);
-		else if(c1 == 0)
-			break;
+		return strcasecmp(pString1, pString2);
 	}
-		
-	return 0;
+#else
+	EASTDC_API int Stricmp(const char* pString1, const char* pString2)
+	{
+		return Internal::GetCPUDispatchTable().mpStrnicmp(pString1, pString2, (size_t)-1);
+	}
+#endif
+
+EASTDC_API int Stricmp(const char16_t* pString1, const char16_t* pString2)
+{
+	return Internal::GetCPUDispatchTable().mpStrnicmp16(pString1, pString2, (size_t)-1);
 }
 
-EASTDC_API int Strnicmp(const char16_t* pString1, const char16_t* pString2, size_t n)
+EASTDC_API int Stricmp(const char32_t* pString1, const char32_t* pString2)
 {
-	char16_t c1, c2;
+	return Internal::GetCPUDispatchTable().mpStrnicmp32(pString1, pString2, (size_t)-1);
+}
 
-	// Code below which uses (c1 - c2) assumes this.
-	EA_COMPILETIME_ASSERT(sizeof(int) > sizeof(uint16_t));
 
-	++n;
-	while(--n)
-	{
-		if((c1 = Tolower(*pString1++)) != (c2 = Tolower(*pString2++)))
-			return ((uint16_t)c1 - (uint16_t)c2);
-		else if(c1 == 0)
-			break;
-	}
-		
-	return 0;
+
+EASTDC_API int Strnicmp(const char* pString1, const char* pString2, size_t n)
+{
+	return Internal::GetCPUDispatchTable().mpStrnicmp(pString1, pString2, n);
+}
+
+EASTDC_API int Strnicmp(const char16_t* pString1, const char16_t* pString2, size_t n)
+{
+	return Internal::GetCPUDispatchTable().mpStrnicmp16(pString1, pString2, n);
 }
 
 EASTDC_API int Strnicmp(const char32_t* pString1, const char32_t* pString2, size_t n)
 {
-	char32_t c1, c2;
-
-	++n;
-	while(--n)
-	{
-		if((c1 = Tolower(*pString1++)) != (c2 = Tolower(*pString2++)))
-		{
-			// We can't just return c1 - c2, because the difference might be greater than INT_MAX.
-			return ((uint32_t)c1 > (uint32_t)c2) ? 1 : -1;
-		}
-		else if(c1 == 0)
-			break;
-	}
-		
-	return 0;
+	return Internal::GetCPUDispatchTable().mpStrnicmp32(pString1, pString2, n);
 }
 
 
@@ -4384,170 +5439,23 @@ EASTDC_API char32_t* FcvtBuf(double dValue, int nDigitCountAfterDecimal, int* de
 
 
 
-// Optimization technique:
-//     https://www.facebook.com/notes/facebook-engineering/three-optimization-tips-for-c/10151361643253920
-// This results in performance improvements of 2x to 5x depending on the input value. Our general test in 
-// TestString.cpp showed a 3.1x performance gain on VC++/x64.
-//
-static uint32_t digits10(uint64_t v)
-{
-	if(v < 10)
-		return 1;
-	if(v < 100)
-		return 2;
-	if(v < 1000)
-		return 3;
-	if(v < UINT64_C(1000000000000))
-	{
-		if(v < UINT64_C(100000000))
-		{
-			if(v < 1000000)
-			{
-				if (v < 10000)
-					return 4;
-				return (uint32_t)(5 + (v >= 100000));
-			}
-
-			return (uint32_t)(7 + (v >= 10000000));
-		}
-
-		if(v < UINT64_C(10000000000))
-			return (uint32_t)(9 + (v >= UINT64_C(1000000000)));
-
-		return (uint32_t)(11 + (v >= UINT64_C(100000000000)));
-	}
-
-	return 12 + digits10(v / UINT64_C(1000000000000));
-}
-
-char* X64toaCommon10(uint64_t nValue, char* pBuffer)
+namespace Internal
 {
-	static const char digits[201] =
+	const char gDigitPairs[201] =
 		"0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
 		"5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
-
-	uint32_t length = digits10(nValue);
-	uint32_t next   = length - 1;
-
-	pBuffer[length] = '\0';
-
-	while(nValue >= 100)
-	{
-		const uint64_t i = (nValue % 100) * 2;
-		nValue /= 100;
-		pBuffer[next] = digits[i + 1];
-		pBuffer[next - 1] = digits[i];
-		next -= 2;
-	}
-
-	if (nValue < 10)
-		pBuffer[next] = (char)('0' + (uint32_t)nValue);
-	else
-	{
-		const uint32_t i  = (uint32_t)nValue * 2;
-		pBuffer[next]     = digits[i + 1];
-		pBuffer[next - 1] = digits[i];
-	}
-
-	return pBuffer;
-}
-
-
-static char* X64toaCommon(uint64_t nValue, char* pBuffer, int nBase, bool bNegative)
-{
-	char* pCurrent = pBuffer;
-
-	if(bNegative)
-		*pCurrent++ = '-';
-
-	if(nBase == 10)
-		X64toaCommon10(nValue, pCurrent);
-	else
-	{
-		char* pFirstDigit = pCurrent;
-
-		do{
-			const unsigned nDigit = (unsigned)(nValue % nBase);
-			nValue /= nBase;
-
-			if(nDigit > 9)
-				*pCurrent++ = (char)(nDigit - 10 + 'a');
-			else
-				*pCurrent++ = (char)(nDigit + '0');
-		} while(nValue > 0);
-
-		// Need to reverse the string.
-		*pCurrent-- = 0;
-
-		do{
-			const char cTemp = *pCurrent;
-			*pCurrent--         = *pFirstDigit;
-			*pFirstDigit++      =  cTemp;
-		}while(pFirstDigit < pCurrent);
-	}
-
-	return pBuffer;
 }
 
 
-static char16_t* X64toaCommon(uint64_t nValue, char16_t* pBuffer, int nBase, bool bNegative)
-{
-	char16_t* pCurrent = pBuffer;
-
-	if(bNegative)
-		*pCurrent++ = '-';
-
-	char16_t* pFirstDigit = pCurrent;
-
-	do{
-		const unsigned nDigit = (unsigned)(nValue % nBase);
-		nValue /= nBase;
-
-		if(nDigit > 9)
-			*pCurrent++ = (char16_t)(nDigit - 10 + 'a');
-		else
-			*pCurrent++ = (char16_t)(nDigit + '0');
-	} while(nValue > 0);
-
-	// Need to reverse the string.
-	*pCurrent-- = 0;
-
-	do{
-		const char16_t cTemp = *pCurrent;
-		*pCurrent--          = *pFirstDigit;
-		*pFirstDigit++       =  cTemp;
-	}while(pFirstDigit < pCurrent);
-
-	return pBuffer;
-}
-
-static char32_t* X64toaCommon(uint64_t nValue, char32_t* pBuffer, int nBase, bool bNegative)
+template <typename CharT>
+static CharT* X64toaCommon(uint64_t nValue, CharT* pBuffer, int nBase, bool bNegative)
 {
-	char32_t* pCurrent = pBuffer;
+	CharT* pCurrent = pBuffer;
 
 	if(bNegative)
 		*pCurrent++ = '-';
 
-	char32_t* pFirstDigit = pCurrent;
-
-	do{
-		const unsigned nDigit = (unsigned)(nValue % nBase);
-		nValue /= nBase;
-
-		if(nDigit > 9)
-			*pCurrent++ = (char32_t)(nDigit - 10 + 'a');
-		else
-			*pCurrent++ = (char32_t)(nDigit + '0');
-	} while(nValue > 0);
-
-	// Need to reverse the string.
-	*pCurrent-- = 0;
-
-	do{
-		const char32_t cTemp = *pCurrent;
-		*pCurrent--          = *pFirstDigit;
-		*pFirstDigit++       =  cTemp;
-	}while(pFirstDigit < pCurrent);
+	Internal::WriteInteger(nValue, pCurrent, (unsigned)nBase);
 
 	return pBuffer;
 }
@@ -4671,338 +5579,989 @@ EASTDC_API char32_t* U64toa(uint64_t nValue, char32_t* pBuffer, int nBase)
 
 
 
-EASTDC_API double StrtodEnglish(const char* pValue, char** ppEnd)
+///////////////////////////////////////////////////////////////////////////////
+// StrtodEnglish
+//
+// DecimalToDouble is the Eisel-Lemire algorithm. See Daniel Lemire, "Number 
+// Parsing at a Gigabyte per Second", Software: Practice and Experience 51(8), 
+// 2021, and Noble Mushtak and Daniel Lemire, "Fast Number Parsing Without 
+// Fallback", Software: Practice and Experience 53(6), 2023, which proves that 
+// the truncated 128 bit product below always suffices for exact mantissas.
+//
+namespace Internal
+{
+	// 5^q normalized so that its high bit is the high bit of a 128 bit value, for q in [-342, 308].
+	// Stored as { high 64 bits, low 64 bits }, with negative powers rounded up and positive ones truncated.
+	static const uint64_t kPowersOf5For128[651][2] =
+	{
+		{ UINT64_C(0xeef453d6923bd65a), UINT64_C(0x113faa2906a13b3f) }, { UINT64_C(0x9558b4661b6565f8), UINT64_C(0x4ac7ca59a424c507) },
+		{ UINT64_C(0xbaaee17fa23ebf76), UINT64_C(0x5d79bcf00d2df649) }, { UINT64_C(0xe95a99df8ace6f53), UINT64_C(0xf4d82c2c107973dc) },
+		{ UINT64_C(0x91d8a02bb6c10594), UINT64_C(0x79071b9b8a4be869) }, { UINT64_C(0xb64ec836a47146f9), UINT64_C(0x9748e2826cdee284) },
+		{ UINT64_C(0xe3e27a444d8d98b7), UINT64_C(0xfd1b1b2308169b25) }, { UINT64_C(0x8e6d8c6ab0787f72), UINT64_C(0xfe30f0f5e50e20f7) },
+		{ UINT64_C(0xb208ef855c969f4f), UINT64_C(0xbdbd2d335e51a935) }, { UINT64_C(0xde8b2b66b3bc4723), UINT64_C(0xad2c788035e61382) },
+		{ UINT64_C(0x8b16fb203055ac76), UINT64_C(0x4c3bcb5021afcc31) }, { UINT64_C(0xaddcb9e83c6b1793), UINT64_C(0xdf4abe242a1bbf3d) },
+		{ UINT64_C(0xd953e8624b85dd78), UINT64_C(0xd71d6dad34a2af0d) }, { UINT64_C(0x87d4713d6f33aa6b), UINT64_C(0x8672648c40e5ad68) },
+		{ UINT64_C(0xa9c98d8ccb009506), UINT64_C(0x680efdaf511f18c2) }, { UINT64_C(0xd43bf0effdc0ba48), UINT64_C(0x0212bd1b2566def2) },
+		{ UINT64_C(0x84a57695fe98746d), UINT64_C(0x014bb630f7604b57) }, { UINT64_C(0xa5ced43b7e3e9188), UINT64_C(0x419ea3bd35385e2d) },
+		{ UINT64_C(0xcf42894a5dce35ea), UINT64_C(0x52064cac828675b9) }, { UINT64_C(0x818995ce7aa0e1b2), UINT64_C(0x7343efebd1940993) },
+		{ UINT64_C(0xa1ebfb4219491a1f), UINT64_C(0x1014ebe6c5f90bf8) }, { UINT64_C(0xca66fa129f9b60a6), UINT64_C(0xd41a26e077774ef6) },
+		{ UINT64_C(0xfd00b897478238d0), UINT64_C(0x8920b098955522b4) }, { UINT64_C(0x9e20735e8cb16382), UINT64_C(0x55b46e5f5d5535b0) },
+		{ UINT64_C(0xc5a890362fddbc62), UINT64_C(0xeb2189f734aa831d) }, { UINT64_C(0xf712b443bbd52b7b), UINT64_C(0xa5e9ec7501d523e4) },
+		{ UINT64_C(0x9a6bb0aa55653b2d), UINT64_C(0x47b233c92125366e) }, { UINT64_C(0xc1069cd4eabe89f8), UINT64_C(0x999ec0bb696e840a) },
+		{ UINT64_C(0xf148440a256e2c76), UINT64_C(0xc00670ea43ca250d) }, { UINT64_C(0x96cd2a865764dbca), UINT64_C(0x380406926a5e5728) },
+		{ UINT64_C(0xbc807527ed3e12bc), UINT64_C(0xc605083704f5ecf2) }, { UINT64_C(0xeba09271e88d976b), UINT64_C(0xf7864a44c633682e) },
+		{ UINT64_C(0x93445b8731587ea3), UINT64_C(0x7ab3ee6afbe0211d) }, { UINT64_C(0xb8157268fdae9e4c), UINT64_C(0x5960ea05bad82964) },
+		{ UINT64_C(0xe61acf033d1a45df), UINT64_C(0x6fb92487298e33bd) }, { UINT64_C(0x8fd0c16206306bab), UINT64_C(0xa5d3b6d479f8e056) },
+		{ UINT64_C(0xb3c4f1ba87bc8696), UINT64_C(0x8f48a4899877186c) }, { UINT64_C(0xe0b62e2929aba83c), UINT64_C(0x331acdabfe94de87) },
+		{ UINT64_C(0x8c71dcd9ba0b4925), UINT64_C(0x9ff0c08b7f1d0b14) }, { UINT64_C(0xaf8e5410288e1b6f), UINT64_C(0x07ecf0ae5ee44dd9) },
+		{ UINT64_C(0xdb71e91432b1a24a), UINT64_C(0xc9e82cd9f69d6150) }, { UINT64_C(0x892731ac9faf056e), UINT64_C(0xbe311c083a225cd2) },
+		{ UINT64_C(0xab70fe17c79ac6ca), UINT64_C(0x6dbd630a48aaf406) }, { UINT64_C(0xd64d3d9db981787d), UINT64_C(0x092cbbccdad5b108) },
+		{ UINT64_C(0x85f0468293f0eb4e), UINT64_C(0x25bbf56008c58ea5) }, { UINT64_C(0xa76c582338ed2621), UINT64_C(0xaf2af2b80af6f24e) },
+		{ UINT64_C(0xd1476e2c07286faa), UINT64_C(0x1af5af660db4aee1) }, { UINT64_C(0x82cca4db847945ca), UINT64_C(0x50d98d9fc890ed4d) },
+		{ UINT64_C(0xa37fce126597973c), UINT64_C(0xe50ff107bab528a0) }, { UINT64_C(0xcc5fc196fefd7d0c), UINT64_C(0x1e53ed49a96272c8) },
+		{ UINT64_C(0xff77b1fcbebcdc4f), UINT64_C(0x25e8e89c13bb0f7a) }, { UINT64_C(0x9faacf3df73609b1), UINT64_C(0x77b191618c54e9ac) },
+		{ UINT64_C(0xc795830d75038c1d), UINT64_C(0xd59df5b9ef6a2417) }, { UINT64_C(0xf97ae3d0d2446f25), UINT64_C(0x4b0573286b44ad1d) },
+		{ UINT64_C(0x9becce62836ac577), UINT64_C(0x4ee367f9430aec32) }, { UINT64_C(0xc2e801fb244576d5), UINT64_C(0x229c41f793cda73f) },
+		{ UINT64_C(0xf3a20279ed56d48a), UINT64_C(0x6b43527578c1110f) }, { UINT64_C(0x9845418c345644d6), UINT64_C(0x830a13896b78aaa9) },
+		{ UINT64_C(0xbe5691ef416bd60c), UINT64_C(0x23cc986bc656d553) }, { UINT64_C(0xedec366b11c6cb8f), UINT64_C(0x2cbfbe86b7ec8aa8) },
+		{ UINT64_C(0x94b3a202eb1c3f39), UINT64_C(0x7bf7d71432f3d6a9) }, { UINT64_C(0xb9e08a83a5e34f07), UINT64_C(0xdaf5ccd93fb0cc53) },
+		{ UINT64_C(0xe858ad248f5c22c9), UINT64_C(0xd1b3400f8f9cff68) }, { UINT64_C(0x91376c36d99995be), UINT64_C(0x23100809b9c21fa1) },
+		{ UINT64_C(0xb58547448ffffb2d), UINT64_C(0xabd40a0c2832a78a) }, { UINT64_C(0xe2e69915b3fff9f9), UINT64_C(0x16c90c8f323f516c) },
+		{ UINT64_C(0x8dd01fad907ffc3b), UINT64_C(0xae3da7d97f6792e3) }, { UINT64_C(0xb1442798f49ffb4a), UINT64_C(0x99cd11cfdf41779c) },
+		{ UINT64_C(0xdd95317f31c7fa1d), UINT64_C(0x40405643d711d583) }, { UINT64_C(0x8a7d3eef7f1cfc52), UINT64_C(0x482835ea666b2572) },
+		{ UINT64_C(0xad1c8eab5ee43b66), UINT64_C(0xda3243650005eecf) }, { UINT64_C(0xd863b256369d4a40), UINT64_C(0x90bed43e40076a82) },
+		{ UINT64_C(0x873e4f75e2224e68), UINT64_C(0x5a7744a6e804a291) }, { UINT64_C(0xa90de3535aaae202), UINT64_C(0x711515d0a205cb36) },
+		{ UINT64_C(0xd3515c2831559a83), UINT64_C(0x0d5a5b44ca873e03) }, { UINT64_C(0x8412d9991ed58091), UINT64_C(0xe858790afe9486c2) },
+		{ UINT64_C(0xa5178fff668ae0b6), UINT64_C(0x626e974dbe39a872) }, { UINT64_C(0xce5d73ff402d98e3), UINT64_C(0xfb0a3d212dc8128f) },
+		{ UINT64_C(0x80fa687f881c7f8e), UINT64_C(0x7ce66634bc9d0b99) }, { UINT64_C(0xa139029f6a239f72), UINT64_C(0x1c1fffc1ebc44e80) },
+		{ UINT64_C(0xc987434744ac874e), UINT64_C(0xa327ffb266b56220) }, { UINT64_C(0xfbe9141915d7a922), UINT64_C(0x4bf1ff9f0062baa8) },
+		{ UINT64_C(0x9d71ac8fada6c9b5), UINT64_C(0x6f773fc3603db4a9) }, { UINT64_C(0xc4ce17b399107c22), UINT64_C(0xcb550fb4384d21d3) },
+		{ UINT64_C(0xf6019da07f549b2b), UINT64_C(0x7e2a53a146606a48) }, { UINT64_C(0x99c102844f94e0fb), UINT64_C(0x2eda7444cbfc426d) },
+		{ UINT64_C(0xc0314325637a1939), UINT64_C(0xfa911155fefb5308) }, { UINT64_C(0xf03d93eebc589f88), UINT64_C(0x793555ab7eba27ca) },
+		{ UINT64_C(0x96267c7535b763b5), UINT64_C(0x4bc1558b2f3458de) }, { UINT64_C(0xbbb01b9283253ca2), UINT64_C(0x9eb1aaedfb016f16) },
+		{ UINT64_C(0xea9c227723ee8bcb), UINT64_C(0x465e15a979c1cadc) }, { UINT64_C(0x92a1958a7675175f), UINT64_C(0x0bfacd89ec191ec9) },
+		{ UINT64_C(0xb749faed14125d36), UINT64_C(0xcef980ec671f667b) }, { UINT64_C(0xe51c79a85916f484), UINT64_C(0x82b7e12780e7401a) },
+		{ UINT64_C(0x8f31cc0937ae58d2), UINT64_C(0xd1b2ecb8b0908810) }, { UINT64_C(0xb2fe3f0b8599ef07), UINT64_C(0x861fa7e6dcb4aa15) },
+		{ UINT64_C(0xdfbdcece67006ac9), UINT64_C(0x67a791e093e1d49a) }, { UINT64_C(0x8bd6a141006042bd), UINT64_C(0xe0c8bb2c5c6d24e0) },
+		{ UINT64_C(0xaecc49914078536d), UINT64_C(0x58fae9f773886e18) }, { UINT64_C(0xda7f5bf590966848), UINT64_C(0xaf39a475506a899e) },
+		{ UINT64_C(0x888f99797a5e012d), UINT64_C(0x6d8406c952429603) }, { UINT64_C(0xaab37fd7d8f58178), UINT64_C(0xc8e5087ba6d33b83) },
+		{ UINT64_C(0xd5605fcdcf32e1d6), UINT64_C(0xfb1e4a9a90880a64) }, { UINT64_C(0x855c3be0a17fcd26), UINT64_C(0x5cf2eea09a55067f) },
+		{ UINT64_C(0xa6b34ad8c9dfc06f), UINT64_C(0xf42faa48c0ea481e) }, { UINT64_C(0xd0601d8efc57b08b), UINT64_C(0xf13b94daf124da26) },
+		{ UINT64_C(0x823c12795db6ce57), UINT64_C(0x76c53d08d6b70858) }, { UINT64_C(0xa2cb1717b52481ed), UINT64_C(0x54768c4b0c64ca6e) },
+		{ UINT64_C(0xcb7ddcdda26da268), UINT64_C(0xa9942f5dcf7dfd09) }, { UINT64_C(0xfe5d54150b090b02), UINT64_C(0xd3f93b35435d7c4c) },
+		{ UINT64_C(0x9efa548d26e5a6e1), UINT64_C(0xc47bc5014a1a6daf) }, { UINT64_C(0xc6b8e9b0709f109a), UINT64_C(0x359ab6419ca1091b) },
+		{ UINT64_C(0xf867241c8cc6d4c0), UINT64_C(0xc30163d203c94b62) }, { UINT64_C(0x9b407691d7fc44f8), UINT64_C(0x79e0de63425dcf1d) },
+		{ UINT64_C(0xc21094364dfb5636), UINT64_C(0x985915fc12f542e4) }, { UINT64_C(0xf294b943e17a2bc4), UINT64_C(0x3e6f5b7b17b2939d) },
+		{ UINT64_C(0x979cf3ca6cec5b5a), UINT64_C(0xa705992ceecf9c42) }, { UINT64_C(0xbd8430bd08277231), UINT64_C(0x50c6ff782a838353) },
+		{ UINT64_C(0xece53cec4a314ebd), UINT64_C(0xa4f8bf5635246428) }, { UINT64_C(0x940f4613ae5ed136), UINT64_C(0x871b7795e136be99) },
+		{ UINT64_C(0xb913179899f68584), UINT64_C(0x28e2557b59846e3f) }, { UINT64_C(0xe757dd7ec07426e5), UINT64_C(0x331aeada2fe589cf) },
+		{ UINT64_C(0x9096ea6f3848984f), UINT64_C(0x3ff0d2c85def7621) }, { UINT64_C(0xb4bca50b065abe63), UINT64_C(0x0fed077a756b53a9) },
+		{ UINT64_C(0xe1ebce4dc7f16dfb), UINT64_C(0xd3e8495912c62894) }, { UINT64_C(0x8d3360f09cf6e4bd), UINT64_C(0x64712dd7abbbd95c) },
+		{ UINT64_C(0xb080392cc4349dec), UINT64_C(0xbd8d794d96aacfb3) }, { UINT64_C(0xdca04777f541c567), UINT64_C(0xecf0d7a0fc5583a0) },
+		{ UINT64_C(0x89e42caaf9491b60), UINT64_C(0xf41686c49db57244) }, { UINT64_C(0xac5d37d5b79b6239), UINT64_C(0x311c2875c522ced5) },
+		{ UINT64_C(0xd77485cb25823ac7), UINT64_C(0x7d633293366b828b) }, { UINT64_C(0x86a8d39ef77164bc), UINT64_C(0xae5dff9c02033197) },
+		{ UINT64_C(0xa8530886b54dbdeb), UINT64_C(0xd9f57f830283fdfc) }, { UINT64_C(0xd267caa862a12d66), UINT64_C(0xd072df63c324fd7b) },
+		{ UINT64_C(0x8380dea93da4bc60), UINT64_C(0x4247cb9e59f71e6d) }, { UINT64_C(0xa46116538d0deb78), UINT64_C(0x52d9be85f074e608) },
+		{ UINT64_C(0xcd795be870516656), UINT64_C(0x67902e276c921f8b) }, { UINT64_C(0x806bd9714632dff6), UINT64_C(0x00ba1cd8a3db53b6) },
+		{ UINT64_C(0xa086cfcd97bf97f3), UINT64_C(0x80e8a40eccd228a4) }, { UINT64_C(0xc8a883c0fdaf7df0), UINT64_C(0x6122cd128006b2cd) },
+		{ UINT64_C(0xfad2a4b13d1b5d6c), UINT64_C(0x796b805720085f81) }, { UINT64_C(0x9cc3a6eec6311a63), UINT64_C(0xcbe3303674053bb0) },
+		{ UINT64_C(0xc3f490aa77bd60fc), UINT64_C(0xbedbfc4411068a9c) }, { UINT64_C(0xf4f1b4d515acb93b), UINT64_C(0xee92fb5515482d44) },
+		{ UINT64_C(0x991711052d8bf3c5), UINT64_C(0x751bdd152d4d1c4a) }, { UINT64_C(0xbf5cd54678eef0b6), UINT64_C(0xd262d45a78a0635d) },
+		{ UINT64_C(0xef340a98172aace4), UINT64_C(0x86fb897116c87c34) }, { UINT64_C(0x9580869f0e7aac0e), UINT64_C(0xd45d35e6ae3d4da0) },
+		{ UINT64_C(0xbae0a846d2195712), UINT64_C(0x8974836059cca109) }, { UINT64_C(0xe998d258869facd7), UINT64_C(0x2bd1a438703fc94b) },
+		{ UINT64_C(0x91ff83775423cc06), UINT64_C(0x7b6306a34627ddcf) }, { UINT64_C(0xb67f6455292cbf08), UINT64_C(0x1a3bc84c17b1d542) },
+		{ UINT64_C(0xe41f3d6a7377eeca), UINT64_C(0x20caba5f1d9e4a93) }, { UINT64_C(0x8e938662882af53e), UINT64_C(0x547eb47b7282ee9c) },
+		{ UINT64_C(0xb23867fb2a35b28d), UINT64_C(0xe99e619a4f23aa43) }, { UINT64_C(0xdec681f9f4c31f31), UINT64_C(0x6405fa00e2ec94d4) },
+		{ UINT64_C(0x8b3c113c38f9f37e), UINT64_C(0xde83bc408dd3dd04) }, { UINT64_C(0xae0b158b4738705e), UINT64_C(0x9624ab50b148d445) },
+		{ UINT64_C(0xd98ddaee19068c76), UINT64_C(0x3badd624dd9b0957) }, { UINT64_C(0x87f8a8d4cfa417c9), UINT64_C(0xe54ca5d70a80e5d6) },
+		{ UINT64_C(0xa9f6d30a038d1dbc), UINT64_C(0x5e9fcf4ccd211f4c) }, { UINT64_C(0xd47487cc8470652b), UINT64_C(0x7647c3200069671f) },
+		{ UINT64_C(0x84c8d4dfd2c63f3b), UINT64_C(0x29ecd9f40041e073) }, { UINT64_C(0xa5fb0a17c777cf09), UINT64_C(0xf468107100525890) },
+		{ UINT64_C(0xcf79cc9db955c2cc), UINT64_C(0x7182148d4066eeb4) }, { UINT64_C(0x81ac1fe293d599bf), UINT64_C(0xc6f14cd848405530) },
+		{ UINT64_C(0xa21727db38cb002f), UINT64_C(0xb8ada00e5a506a7c) }, { UINT64_C(0xca9cf1d206fdc03b), UINT64_C(0xa6d90811f0e4851c) },
+		{ UINT64_C(0xfd442e4688bd304a), UINT64_C(0x908f4a166d1da663) }, { UINT64_C(0x9e4a9cec15763e2e), UINT64_C(0x9a598e4e043287fe) },
+		{ UINT64_C(0xc5dd44271ad3cdba), UINT64_C(0x40eff1e1853f29fd) }, { UINT64_C(0xf7549530e188c128), UINT64_C(0xd12bee59e68ef47c) },
+		{ UINT64_C(0x9a94dd3e8cf578b9), UINT64_C(0x82bb74f8301958ce) }, { UINT64_C(0xc13a148e3032d6e7), UINT64_C(0xe36a52363c1faf01) },
+		{ UINT64_C(0xf18899b1bc3f8ca1), UINT64_C(0xdc44e6c3cb279ac1) }, { UINT64_C(0x96f5600f15a7b7e5), UINT64_C(0x29ab103a5ef8c0b9) },
+		{ UINT64_C(0xbcb2b812db11a5de), UINT64_C(0x7415d448f6b6f0e7) }, { UINT64_C(0xebdf661791d60f56), UINT64_C(0x111b495b3464ad21) },
+		{ UINT64_C(0x936b9fcebb25c995), UINT64_C(0xcab10dd900beec34) }, { UINT64_C(0xb84687c269ef3bfb), UINT64_C(0x3d5d514f40eea742) },
+		{ UINT64_C(0xe65829b3046b0afa), UINT64_C(0x0cb4a5a3112a5112) }, { UINT64_C(0x8ff71a0fe2c2e6dc), UINT64_C(0x47f0e785eaba72ab) },
+		{ UINT64_C(0xb3f4e093db73a093), UINT64_C(0x59ed216765690f56) }, { UINT64_C(0xe0f218b8d25088b8), UINT64_C(0x306869c13ec3532c) },
+		{ UINT64_C(0x8c974f7383725573), UINT64_C(0x1e414218c73a13fb) }, { UINT64_C(0xafbd2350644eeacf), UINT64_C(0xe5d1929ef90898fa) },
+		{ UINT64_C(0xdbac6c247d62a583), UINT64_C(0xdf45f746b74abf39) }, { UINT64_C(0x894bc396ce5da772), UINT64_C(0x6b8bba8c328eb783) },
+		{ UINT64_C(0xab9eb47c81f5114f), UINT64_C(0x066ea92f3f326564) }, { UINT64_C(0xd686619ba27255a2), UINT64_C(0xc80a537b0efefebd) },
+		{ UINT64_C(0x8613fd0145877585), UINT64_C(0xbd06742ce95f5f36) }, { UINT64_C(0xa798fc4196e952e7), UINT64_C(0x2c48113823b73704) },
+		{ UINT64_C(0xd17f3b51fca3a7a0), UINT64_C(0xf75a15862ca504c5) }, { UINT64_C(0x82ef85133de648c4), UINT64_C(0x9a984d73dbe722fb) },
+		{ UINT64_C(0xa3ab66580d5fdaf5), UINT64_C(0xc13e60d0d2e0ebba) }, { UINT64_C(0xcc963fee10b7d1b3), UINT64_C(0x318df905079926a8) },
+		{ UINT64_C(0xffbbcfe994e5c61f), UINT64_C(0xfdf17746497f7052) }, { UINT64_C(0x9fd561f1fd0f9bd3), UINT64_C(0xfeb6ea8bedefa633) },
+		{ UINT64_C(0xc7caba6e7c5382c8), UINT64_C(0xfe64a52ee96b8fc0) }, { UINT64_C(0xf9bd690a1b68637b), UINT64_C(0x3dfdce7aa3c673b0) },
+		{ UINT64_C(0x9c1661a651213e2d), UINT64_C(0x06bea10ca65c084e) }, { UINT64_C(0xc31bfa0fe5698db8), UINT64_C(0x486e494fcff30a62) },
+		{ UINT64_C(0xf3e2f893dec3f126), UINT64_C(0x5a89dba3c3efccfa) }, { UINT64_C(0x986ddb5c6b3a76b7), UINT64_C(0xf89629465a75e01c) },
+		{ UINT64_C(0xbe89523386091465), UINT64_C(0xf6bbb397f1135823) }, { UINT64_C(0xee2ba6c0678b597f), UINT64_C(0x746aa07ded582e2c) },
+		{ UINT64_C(0x94db483840b717ef), UINT64_C(0xa8c2a44eb4571cdc) }, { UINT64_C(0xba121a4650e4ddeb), UINT64_C(0x92f34d62616ce413) },
+		{ UINT64_C(0xe896a0d7e51e1566), UINT64_C(0x77b020baf9c81d17) }, { UINT64_C(0x915e2486ef32cd60), UINT64_C(0x0ace1474dc1d122e) },
+		{ UINT64_C(0xb5b5ada8aaff80b8), UINT64_C(0x0d819992132456ba) }, { UINT64_C(0xe3231912d5bf60e6), UINT64_C(0x10e1fff697ed6c69) },
+		{ UINT64_C(0x8df5efabc5979c8f), UINT64_C(0xca8d3ffa1ef463c1) }, { UINT64_C(0xb1736b96b6fd83b3), UINT64_C(0xbd308ff8a6b17cb2) },
+		{ UINT64_C(0xddd0467c64bce4a0), UINT64_C(0xac7cb3f6d05ddbde) }, { UINT64_C(0x8aa22c0dbef60ee4), UINT64_C(0x6bcdf07a423aa96b) },
+		{ UINT64_C(0xad4ab7112eb3929d), UINT64_C(0x86c16c98d2c953c6) }, { UINT64_C(0xd89d64d57a607744), UINT64_C(0xe871c7bf077ba8b7) },
+		{ UINT64_C(0x87625f056c7c4a8b), UINT64_C(0x11471cd764ad4972) }, { UINT64_C(0xa93af6c6c79b5d2d), UINT64_C(0xd598e40d3dd89bcf) },
+		{ UINT64_C(0xd389b47879823479), UINT64_C(0x4aff1d108d4ec2c3) }, { UINT64_C(0x843610cb4bf160cb), UINT64_C(0xcedf722a585139ba) },
+		{ UINT64_C(0xa54394fe1eedb8fe), UINT64_C(0xc2974eb4ee658828) }, { UINT64_C(0xce947a3da6a9273e), UINT64_C(0x733d226229feea32) },
+		{ UINT64_C(0x811ccc668829b887), UINT64_C(0x0806357d5a3f525f) }, { UINT64_C(0xa163ff802a3426a8), UINT64_C(0xca07c2dcb0cf26f7) },
+		{ UINT64_C(0xc9bcff6034c13052), UINT64_C(0xfc89b393dd02f0b5) }, { UINT64_C(0xfc2c3f3841f17c67), UINT64_C(0xbbac2078d443ace2) },
+		{ UINT64_C(0x9d9ba7832936edc0), UINT64_C(0xd54b944b84aa4c0d) }, { UINT64_C(0xc5029163f384a931), UINT64_C(0x0a9e795e65d4df11) },
+		{ UINT64_C(0xf64335bcf065d37d), UINT64_C(0x4d4617b5ff4a16d5) }, { UINT64_C(0x99ea0196163fa42e), UINT64_C(0x504bced1bf8e4e45) },
+		{ UINT64_C(0xc06481fb9bcf8d39), UINT64_C(0xe45ec2862f71e1d6) }, { UINT64_C(0xf07da27a82c37088), UINT64_C(0x5d767327bb4e5a4c) },
+		{ UINT64_C(0x964e858c91ba2655), UINT64_C(0x3a6a07f8d510f86f) }, { UINT64_C(0xbbe226efb628afea), UINT64_C(0x890489f70a55368b) },
+		{ UINT64_C(0xeadab0aba3b2dbe5), UINT64_C(0x2b45ac74ccea842e) }, { UINT64_C(0x92c8ae6b464fc96f), UINT64_C(0x3b0b8bc90012929d) },
+		{ UINT64_C(0xb77ada0617e3bbcb), UINT64_C(0x09ce6ebb40173744) }, { UINT64_C(0xe55990879ddcaabd), UINT64_C(0xcc420a6a101d0515) },
+		{ UINT64_C(0x8f57fa54c2a9eab6), UINT64_C(0x9fa946824a12232d) }, { UINT64_C(0xb32df8e9f3546564), UINT64_C(0x47939822dc96abf9) },
+		{ UINT64_C(0xdff9772470297ebd), UINT64_C(0x59787e2b93bc56f7) }, { UINT64_C(0x8bfbea76c619ef36), UINT64_C(0x57eb4edb3c55b65a) },
+		{ UINT64_C(0xaefae51477a06b03), UINT64_C(0xede622920b6b23f1) }, { UINT64_C(0xdab99e59958885c4), UINT64_C(0xe95fab368e45eced) },
+		{ UINT64_C(0x88b402f7fd75539b), UINT64_C(0x11dbcb0218ebb414) }, { UINT64_C(0xaae103b5fcd2a881), UINT64_C(0xd652bdc29f26a119) },
+		{ UINT64_C(0xd59944a37c0752a2), UINT64_C(0x4be76d3346f0495f) }, { UINT64_C(0x857fcae62d8493a5), UINT64_C(0x6f70a4400c562ddb) },
+		{ UINT64_C(0xa6dfbd9fb8e5b88e), UINT64_C(0xcb4ccd500f6bb952) }, { UINT64_C(0xd097ad07a71f26b2), UINT64_C(0x7e2000a41346a7a7) },
+		{ UINT64_C(0x825ecc24c873782f), UINT64_C(0x8ed400668c0c28c8) }, { UINT64_C(0xa2f67f2dfa90563b), UINT64_C(0x728900802f0f32fa) },
+		{ UINT64_C(0xcbb41ef979346bca), UINT64_C(0x4f2b40a03ad2ffb9) }, { UINT64_C(0xfea126b7d78186bc), UINT64_C(0xe2f610c84987bfa8) },
+		{ UINT64_C(0x9f24b832e6b0f436), UINT64_C(0x0dd9ca7d2df4d7c9) }, { UINT64_C(0xc6ede63fa05d3143), UINT64_C(0x91503d1c79720dbb) },
+		{ UINT64_C(0xf8a95fcf88747d94), UINT64_C(0x75a44c6397ce912a) }, { UINT64_C(0x9b69dbe1b548ce7c), UINT64_C(0xc986afbe3ee11aba) },
+		{ UINT64_C(0xc24452da229b021b), UINT64_C(0xfbe85badce996168) }, { UINT64_C(0xf2d56790ab41c2a2), UINT64_C(0xfae27299423fb9c3) },
+		{ UINT64_C(0x97c560ba6b0919a5), UINT64_C(0xdccd879fc967d41a) }, { UINT64_C(0xbdb6b8e905cb600f), UINT64_C(0x5400e987bbc1c920) },
+		{ UINT64_C(0xed246723473e3813), UINT64_C(0x290123e9aab23b68) }, { UINT64_C(0x9436c0760c86e30b), UINT64_C(0xf9a0b6720aaf6521) },
+		{ UINT64_C(0xb94470938fa89bce), UINT64_C(0xf808e40e8d5b3e69) }, { UINT64_C(0xe7958cb87392c2c2), UINT64_C(0xb60b1d1230b20e04) },
+		{ UINT64_C(0x90bd77f3483bb9b9), UINT64_C(0xb1c6f22b5e6f48c2) }, { UINT64_C(0xb4ecd5f01a4aa828), UINT64_C(0x1e38aeb6360b1af3) },
+		{ UINT64_C(0xe2280b6c20dd5232), UINT64_C(0x25c6da63c38de1b0) }, { UINT64_C(0x8d590723948a535f), UINT64_C(0x579c487e5a38ad0e) },
+		{ UINT64_C(0xb0af48ec79ace837), UINT64_C(0x2d835a9df0c6d851) }, { UINT64_C(0xdcdb1b2798182244), UINT64_C(0xf8e431456cf88e65) },
+		{ UINT64_C(0x8a08f0f8bf0f156b), UINT64_C(0x1b8e9ecb641b58ff) }, { UINT64_C(0xac8b2d36eed2dac5), UINT64_C(0xe272467e3d222f3f) },
+		{ UINT64_C(0xd7adf884aa879177), UINT64_C(0x5b0ed81dcc6abb0f) }, { UINT64_C(0x86ccbb52ea94baea), UINT64_C(0x98e947129fc2b4e9) },
+		{ UINT64_C(0xa87fea27a539e9a5), UINT64_C(0x3f2398d747b36224) }, { UINT64_C(0xd29fe4b18e88640e), UINT64_C(0x8eec7f0d19a03aad) },
+		{ UINT64_C(0x83a3eeeef9153e89), UINT64_C(0x1953cf68300424ac) }, { UINT64_C(0xa48ceaaab75a8e2b), UINT64_C(0x5fa8c3423c052dd7) },
+		{ UINT64_C(0xcdb02555653131b6), UINT64_C(0x3792f412cb06794d) }, { UINT64_C(0x808e17555f3ebf11), UINT64_C(0xe2bbd88bbee40bd0) },
+		{ UINT64_C(0xa0b19d2ab70e6ed6), UINT64_C(0x5b6aceaeae9d0ec4) }, { UINT64_C(0xc8de047564d20a8b), UINT64_C(0xf245825a5a445275) },
+		{ UINT64_C(0xfb158592be068d2e), UINT64_C(0xeed6e2f0f0d56712) }, { UINT64_C(0x9ced737bb6c4183d), UINT64_C(0x55464dd69685606b) },
+		{ UINT64_C(0xc428d05aa4751e4c), UINT64_C(0xaa97e14c3c26b886) }, { UINT64_C(0xf53304714d9265df), UINT64_C(0xd53dd99f4b3066a8) },
+		{ UINT64_C(0x993fe2c6d07b7fab), UINT64_C(0xe546a8038efe4029) }, { UINT64_C(0xbf8fdb78849a5f96), UINT64_C(0xde98520472bdd033) },
+		{ UINT64_C(0xef73d256a5c0f77c), UINT64_C(0x963e66858f6d4440) }, { UINT64_C(0x95a8637627989aad), UINT64_C(0xdde7001379a44aa8) },
+		{ UINT64_C(0xbb127c53b17ec159), UINT64_C(0x5560c018580d5d52) }, { UINT64_C(0xe9d71b689dde71af), UINT64_C(0xaab8f01e6e10b4a6) },
+		{ UINT64_C(0x9226712162ab070d), UINT64_C(0xcab3961304ca70e8) }, { UINT64_C(0xb6b00d69bb55c8d1), UINT64_C(0x3d607b97c5fd0d22) },
+		{ UINT64_C(0xe45c10c42a2b3b05), UINT64_C(0x8cb89a7db77c506a) }, { UINT64_C(0x8eb98a7a9a5b04e3), UINT64_C(0x77f3608e92adb242) },
+		{ UINT64_C(0xb267ed1940f1c61c), UINT64_C(0x55f038b237591ed3) }, { UINT64_C(0xdf01e85f912e37a3), UINT64_C(0x6b6c46dec52f6688) },
+		{ UINT64_C(0x8b61313bbabce2c6), UINT64_C(0x2323ac4b3b3da015) }, { UINT64_C(0xae397d8aa96c1b77), UINT64_C(0xabec975e0a0d081a) },
+		{ UINT64_C(0xd9c7dced53c72255), UINT64_C(0x96e7bd358c904a21) }, { UINT64_C(0x881cea14545c7575), UINT64_C(0x7e50d64177da2e54) },
+		{ UINT64_C(0xaa242499697392d2), UINT64_C(0xdde50bd1d5d0b9e9) }, { UINT64_C(0xd4ad2dbfc3d07787), UINT64_C(0x955e4ec64b44e864) },
+		{ UINT64_C(0x84ec3c97da624ab4), UINT64_C(0xbd5af13bef0b113e) }, { UINT64_C(0xa6274bbdd0fadd61), UINT64_C(0xecb1ad8aeacdd58e) },
+		{ UINT64_C(0xcfb11ead453994ba), UINT64_C(0x67de18eda5814af2) }, { UINT64_C(0x81ceb32c4b43fcf4), UINT64_C(0x80eacf948770ced7) },
+		{ UINT64_C(0xa2425ff75e14fc31), UINT64_C(0xa1258379a94d028d) }, { UINT64_C(0xcad2f7f5359a3b3e), UINT64_C(0x096ee45813a04330) },
+		{ UINT64_C(0xfd87b5f28300ca0d), UINT64_C(0x8bca9d6e188853fc) }, { UINT64_C(0x9e74d1b791e07e48), UINT64_C(0x775ea264cf55347e) },
+		{ UINT64_C(0xc612062576589dda), UINT64_C(0x95364afe032a819e) }, { UINT64_C(0xf79687aed3eec551), UINT64_C(0x3a83ddbd83f52205) },
+		{ UINT64_C(0x9abe14cd44753b52), UINT64_C(0xc4926a9672793543) }, { UINT64_C(0xc16d9a0095928a27), UINT64_C(0x75b7053c0f178294) },
+		{ UINT64_C(0xf1c90080baf72cb1), UINT64_C(0x5324c68b12dd6339) }, { UINT64_C(0x971da05074da7bee), UINT64_C(0xd3f6fc16ebca5e04) },
+		{ UINT64_C(0xbce5086492111aea), UINT64_C(0x88f4bb1ca6bcf585) }, { UINT64_C(0xec1e4a7db69561a5), UINT64_C(0x2b31e9e3d06c32e6) },
+		{ UINT64_C(0x9392ee8e921d5d07), UINT64_C(0x3aff322e62439fd0) }, { UINT64_C(0xb877aa3236a4b449), UINT64_C(0x09befeb9fad487c3) },
+		{ UINT64_C(0xe69594bec44de15b), UINT64_C(0x4c2ebe687989a9b4) }, { UINT64_C(0x901d7cf73ab0acd9), UINT64_C(0x0f9d37014bf60a11) },
+		{ UINT64_C(0xb424dc35095cd80f), UINT64_C(0x538484c19ef38c95) }, { UINT64_C(0xe12e13424bb40e13), UINT64_C(0x2865a5f206b06fba) },
+		{ UINT64_C(0x8cbccc096f5088cb), UINT64_C(0xf93f87b7442e45d4) }, { UINT64_C(0xafebff0bcb24aafe), UINT64_C(0xf78f69a51539d749) },
+		{ UINT64_C(0xdbe6fecebdedd5be), UINT64_C(0xb573440e5a884d1c) }, { UINT64_C(0x89705f4136b4a597), UINT64_C(0x31680a88f8953031) },
+		{ UINT64_C(0xabcc77118461cefc), UINT64_C(0xfdc20d2b36ba7c3e) }, { UINT64_C(0xd6bf94d5e57a42bc), UINT64_C(0x3d32907604691b4d) },
+		{ UINT64_C(0x8637bd05af6c69b5), UINT64_C(0xa63f9a49c2c1b110) }, { UINT64_C(0xa7c5ac471b478423), UINT64_C(0x0fcf80dc33721d54) },
+		{ UINT64_C(0xd1b71758e219652b), UINT64_C(0xd3c36113404ea4a9) }, { UINT64_C(0x83126e978d4fdf3b), UINT64_C(0x645a1cac083126ea) },
+		{ UINT64_C(0xa3d70a3d70a3d70a), UINT64_C(0x3d70a3d70a3d70a4) }, { UINT64_C(0xcccccccccccccccc), UINT64_C(0xcccccccccccccccd) },
+		{ UINT64_C(0x8000000000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xa000000000000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xc800000000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xfa00000000000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0x9c40000000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xc350000000000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xf424000000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0x9896800000000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xbebc200000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xee6b280000000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0x9502f90000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xba43b74000000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xe8d4a51000000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0x9184e72a00000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xb5e620f480000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xe35fa931a0000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0x8e1bc9bf04000000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xb1a2bc2ec5000000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xde0b6b3a76400000), UINT64_C(0x0000000000000000) }, { UINT64_C(0x8ac7230489e80000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xad78ebc5ac620000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xd8d726b7177a8000), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0x878678326eac9000), UINT64_C(0x0000000000000000) }, { UINT64_C(0xa968163f0a57b400), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xd3c21bcecceda100), UINT64_C(0x0000000000000000) }, { UINT64_C(0x84595161401484a0), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0xa56fa5b99019a5c8), UINT64_C(0x0000000000000000) }, { UINT64_C(0xcecb8f27f4200f3a), UINT64_C(0x0000000000000000) },
+		{ UINT64_C(0x813f3978f8940984), UINT64_C(0x4000000000000000) }, { UINT64_C(0xa18f07d736b90be5), UINT64_C(0x5000000000000000) },
+		{ UINT64_C(0xc9f2c9cd04674ede), UINT64_C(0xa400000000000000) }, { UINT64_C(0xfc6f7c4045812296), UINT64_C(0x4d00000000000000) },
+		{ UINT64_C(0x9dc5ada82b70b59d), UINT64_C(0xf020000000000000) }, { UINT64_C(0xc5371912364ce305), UINT64_C(0x6c28000000000000) },
+		{ UINT64_C(0xf684df56c3e01bc6), UINT64_C(0xc732000000000000) }, { UINT64_C(0x9a130b963a6c115c), UINT64_C(0x3c7f400000000000) },
+		{ UINT64_C(0xc097ce7bc90715b3), UINT64_C(0x4b9f100000000000) }, { UINT64_C(0xf0bdc21abb48db20), UINT64_C(0x1e86d40000000000) },
+		{ UINT64_C(0x96769950b50d88f4), UINT64_C(0x1314448000000000) }, { UINT64_C(0xbc143fa4e250eb31), UINT64_C(0x17d955a000000000) },
+		{ UINT64_C(0xeb194f8e1ae525fd), UINT64_C(0x5dcfab0800000000) }, { UINT64_C(0x92efd1b8d0cf37be), UINT64_C(0x5aa1cae500000000) },
+		{ UINT64_C(0xb7abc627050305ad), UINT64_C(0xf14a3d9e40000000) }, { UINT64_C(0xe596b7b0c643c719), UINT64_C(0x6d9ccd05d0000000) },
+		{ UINT64_C(0x8f7e32ce7bea5c6f), UINT64_C(0xe4820023a2000000) }, { UINT64_C(0xb35dbf821ae4f38b), UINT64_C(0xdda2802c8a800000) },
+		{ UINT64_C(0xe0352f62a19e306e), UINT64_C(0xd50b2037ad200000) }, { UINT64_C(0x8c213d9da502de45), UINT64_C(0x4526f422cc340000) },
+		{ UINT64_C(0xaf298d050e4395d6), UINT64_C(0x9670b12b7f410000) }, { UINT64_C(0xdaf3f04651d47b4c), UINT64_C(0x3c0cdd765f114000) },
+		{ UINT64_C(0x88d8762bf324cd0f), UINT64_C(0xa5880a69fb6ac800) }, { UINT64_C(0xab0e93b6efee0053), UINT64_C(0x8eea0d047a457a00) },
+		{ UINT64_C(0xd5d238a4abe98068), UINT64_C(0x72a4904598d6d880) }, { UINT64_C(0x85a36366eb71f041), UINT64_C(0x47a6da2b7f864750) },
+		{ UINT64_C(0xa70c3c40a64e6c51), UINT64_C(0x999090b65f67d924) }, { UINT64_C(0xd0cf4b50cfe20765), UINT64_C(0xfff4b4e3f741cf6d) },
+		{ UINT64_C(0x82818f1281ed449f), UINT64_C(0xbff8f10e7a8921a4) }, { UINT64_C(0xa321f2d7226895c7), UINT64_C(0xaff72d52192b6a0d) },
+		{ UINT64_C(0xcbea6f8ceb02bb39), UINT64_C(0x9bf4f8a69f764490) }, { UINT64_C(0xfee50b7025c36a08), UINT64_C(0x02f236d04753d5b4) },
+		{ UINT64_C(0x9f4f2726179a2245), UINT64_C(0x01d762422c946590) }, { UINT64_C(0xc722f0ef9d80aad6), UINT64_C(0x424d3ad2b7b97ef5) },
+		{ UINT64_C(0xf8ebad2b84e0d58b), UINT64_C(0xd2e0898765a7deb2) }, { UINT64_C(0x9b934c3b330c8577), UINT64_C(0x63cc55f49f88eb2f) },
+		{ UINT64_C(0xc2781f49ffcfa6d5), UINT64_C(0x3cbf6b71c76b25fb) }, { UINT64_C(0xf316271c7fc3908a), UINT64_C(0x8bef464e3945ef7a) },
+		{ UINT64_C(0x97edd871cfda3a56), UINT64_C(0x97758bf0e3cbb5ac) }, { UINT64_C(0xbde94e8e43d0c8ec), UINT64_C(0x3d52eeed1cbea317) },
+		{ UINT64_C(0xed63a231d4c4fb27), UINT64_C(0x4ca7aaa863ee4bdd) }, { UINT64_C(0x945e455f24fb1cf8), UINT64_C(0x8fe8caa93e74ef6a) },
+		{ UINT64_C(0xb975d6b6ee39e436), UINT64_C(0xb3e2fd538e122b44) }, { UINT64_C(0xe7d34c64a9c85d44), UINT64_C(0x60dbbca87196b616) },
+		{ UINT64_C(0x90e40fbeea1d3a4a), UINT64_C(0xbc8955e946fe31cd) }, { UINT64_C(0xb51d13aea4a488dd), UINT64_C(0x6babab6398bdbe41) },
+		{ UINT64_C(0xe264589a4dcdab14), UINT64_C(0xc696963c7eed2dd1) }, { UINT64_C(0x8d7eb76070a08aec), UINT64_C(0xfc1e1de5cf543ca2) },
+		{ UINT64_C(0xb0de65388cc8ada8), UINT64_C(0x3b25a55f43294bcb) }, { UINT64_C(0xdd15fe86affad912), UINT64_C(0x49ef0eb713f39ebe) },
+		{ UINT64_C(0x8a2dbf142dfcc7ab), UINT64_C(0x6e3569326c784337) }, { UINT64_C(0xacb92ed9397bf996), UINT64_C(0x49c2c37f07965404) },
+		{ UINT64_C(0xd7e77a8f87daf7fb), UINT64_C(0xdc33745ec97be906) }, { UINT64_C(0x86f0ac99b4e8dafd), UINT64_C(0x69a028bb3ded71a3) },
+		{ UINT64_C(0xa8acd7c0222311bc), UINT64_C(0xc40832ea0d68ce0c) }, { UINT64_C(0xd2d80db02aabd62b), UINT64_C(0xf50a3fa490c30190) },
+		{ UINT64_C(0x83c7088e1aab65db), UINT64_C(0x792667c6da79e0fa) }, { UINT64_C(0xa4b8cab1a1563f52), UINT64_C(0x577001b891185938) },
+		{ UINT64_C(0xcde6fd5e09abcf26), UINT64_C(0xed4c0226b55e6f86) }, { UINT64_C(0x80b05e5ac60b6178), UINT64_C(0x544f8158315b05b4) },
+		{ UINT64_C(0xa0dc75f1778e39d6), UINT64_C(0x696361ae3db1c721) }, { UINT64_C(0xc913936dd571c84c), UINT64_C(0x03bc3a19cd1e38e9) },
+		{ UINT64_C(0xfb5878494ace3a5f), UINT64_C(0x04ab48a04065c723) }, { UINT64_C(0x9d174b2dcec0e47b), UINT64_C(0x62eb0d64283f9c76) },
+		{ UINT64_C(0xc45d1df942711d9a), UINT64_C(0x3ba5d0bd324f8394) }, { UINT64_C(0xf5746577930d6500), UINT64_C(0xca8f44ec7ee36479) },
+		{ UINT64_C(0x9968bf6abbe85f20), UINT64_C(0x7e998b13cf4e1ecb) }, { UINT64_C(0xbfc2ef456ae276e8), UINT64_C(0x9e3fedd8c321a67e) },
+		{ UINT64_C(0xefb3ab16c59b14a2), UINT64_C(0xc5cfe94ef3ea101e) }, { UINT64_C(0x95d04aee3b80ece5), UINT64_C(0xbba1f1d158724a12) },
+		{ UINT64_C(0xbb445da9ca61281f), UINT64_C(0x2a8a6e45ae8edc97) }, { UINT64_C(0xea1575143cf97226), UINT64_C(0xf52d09d71a3293bd) },
+		{ UINT64_C(0x924d692ca61be758), UINT64_C(0x593c2626705f9c56) }, { UINT64_C(0xb6e0c377cfa2e12e), UINT64_C(0x6f8b2fb00c77836c) },
+		{ UINT64_C(0xe498f455c38b997a), UINT64_C(0x0b6dfb9c0f956447) }, { UINT64_C(0x8edf98b59a373fec), UINT64_C(0x4724bd4189bd5eac) },
+		{ UINT64_C(0xb2977ee300c50fe7), UINT64_C(0x58edec91ec2cb657) }, { UINT64_C(0xdf3d5e9bc0f653e1), UINT64_C(0x2f2967b66737e3ed) },
+		{ UINT64_C(0x8b865b215899f46c), UINT64_C(0xbd79e0d20082ee74) }, { UINT64_C(0xae67f1e9aec07187), UINT64_C(0xecd8590680a3aa11) },
+		{ UINT64_C(0xda01ee641a708de9), UINT64_C(0xe80e6f4820cc9495) }, { UINT64_C(0x884134fe908658b2), UINT64_C(0x3109058d147fdcdd) },
+		{ UINT64_C(0xaa51823e34a7eede), UINT64_C(0xbd4b46f0599fd415) }, { UINT64_C(0xd4e5e2cdc1d1ea96), UINT64_C(0x6c9e18ac7007c91a) },
+		{ UINT64_C(0x850fadc09923329e), UINT64_C(0x03e2cf6bc604ddb0) }, { UINT64_C(0xa6539930bf6bff45), UINT64_C(0x84db8346b786151c) },
+		{ UINT64_C(0xcfe87f7cef46ff16), UINT64_C(0xe612641865679a63) }, { UINT64_C(0x81f14fae158c5f6e), UINT64_C(0x4fcb7e8f3f60c07e) },
+		{ UINT64_C(0xa26da3999aef7749), UINT64_C(0xe3be5e330f38f09d) }, { UINT64_C(0xcb090c8001ab551c), UINT64_C(0x5cadf5bfd3072cc5) },
+		{ UINT64_C(0xfdcb4fa002162a63), UINT64_C(0x73d9732fc7c8f7f6) }, { UINT64_C(0x9e9f11c4014dda7e), UINT64_C(0x2867e7fddcdd9afa) },
+		{ UINT64_C(0xc646d63501a1511d), UINT64_C(0xb281e1fd541501b8) }, { UINT64_C(0xf7d88bc24209a565), UINT64_C(0x1f225a7ca91a4226) },
+		{ UINT64_C(0x9ae757596946075f), UINT64_C(0x3375788de9b06958) }, { UINT64_C(0xc1a12d2fc3978937), UINT64_C(0x0052d6b1641c83ae) },
+		{ UINT64_C(0xf209787bb47d6b84), UINT64_C(0xc0678c5dbd23a49a) }, { UINT64_C(0x9745eb4d50ce6332), UINT64_C(0xf840b7ba963646e0) },
+		{ UINT64_C(0xbd176620a501fbff), UINT64_C(0xb650e5a93bc3d898) }, { UINT64_C(0xec5d3fa8ce427aff), UINT64_C(0xa3e51f138ab4cebe) },
+		{ UINT64_C(0x93ba47c980e98cdf), UINT64_C(0xc66f336c36b10137) }, { UINT64_C(0xb8a8d9bbe123f017), UINT64_C(0xb80b0047445d4184) },
+		{ UINT64_C(0xe6d3102ad96cec1d), UINT64_C(0xa60dc059157491e5) }, { UINT64_C(0x9043ea1ac7e41392), UINT64_C(0x87c89837ad68db2f) },
+		{ UINT64_C(0xb454e4a179dd1877), UINT64_C(0x29babe4598c311fb) }, { UINT64_C(0xe16a1dc9d8545e94), UINT64_C(0xf4296dd6fef3d67a) },
+		{ UINT64_C(0x8ce2529e2734bb1d), UINT64_C(0x1899e4a65f58660c) }, { UINT64_C(0xb01ae745b101e9e4), UINT64_C(0x5ec05dcff72e7f8f) },
+		{ UINT64_C(0xdc21a1171d42645d), UINT64_C(0x76707543f4fa1f73) }, { UINT64_C(0x899504ae72497eba), UINT64_C(0x6a06494a791c53a8) },
+		{ UINT64_C(0xabfa45da0edbde69), UINT64_C(0x0487db9d17636892) }, { UINT64_C(0xd6f8d7509292d603), UINT64_C(0x45a9d2845d3c42b6) },
+		{ UINT64_C(0x865b86925b9bc5c2), UINT64_C(0x0b8a2392ba45a9b2) }, { UINT64_C(0xa7f26836f282b732), UINT64_C(0x8e6cac7768d7141e) },
+		{ UINT64_C(0xd1ef0244af2364ff), UINT64_C(0x3207d795430cd926) }, { UINT64_C(0x8335616aed761f1f), UINT64_C(0x7f44e6bd49e807b8) },
+		{ UINT64_C(0xa402b9c5a8d3a6e7), UINT64_C(0x5f16206c9c6209a6) }, { UINT64_C(0xcd036837130890a1), UINT64_C(0x36dba887c37a8c0f) },
+		{ UINT64_C(0x802221226be55a64), UINT64_C(0xc2494954da2c9789) }, { UINT64_C(0xa02aa96b06deb0fd), UINT64_C(0xf2db9baa10b7bd6c) },
+		{ UINT64_C(0xc83553c5c8965d3d), UINT64_C(0x6f92829494e5acc7) }, { UINT64_C(0xfa42a8b73abbf48c), UINT64_C(0xcb772339ba1f17f9) },
+		{ UINT64_C(0x9c69a97284b578d7), UINT64_C(0xff2a760414536efb) }, { UINT64_C(0xc38413cf25e2d70d), UINT64_C(0xfef5138519684aba) },
+		{ UINT64_C(0xf46518c2ef5b8cd1), UINT64_C(0x7eb258665fc25d69) }, { UINT64_C(0x98bf2f79d5993802), UINT64_C(0xef2f773ffbd97a61) },
+		{ UINT64_C(0xbeeefb584aff8603), UINT64_C(0xaafb550ffacfd8fa) }, { UINT64_C(0xeeaaba2e5dbf6784), UINT64_C(0x95ba2a53f983cf38) },
+		{ UINT64_C(0x952ab45cfa97a0b2), UINT64_C(0xdd945a747bf26183) }, { UINT64_C(0xba756174393d88df), UINT64_C(0x94f971119aeef9e4) },
+		{ UINT64_C(0xe912b9d1478ceb17), UINT64_C(0x7a37cd5601aab85d) }, { UINT64_C(0x91abb422ccb812ee), UINT64_C(0xac62e055c10ab33a) },
+		{ UINT64_C(0xb616a12b7fe617aa), UINT64_C(0x577b986b314d6009) }, { UINT64_C(0xe39c49765fdf9d94), UINT64_C(0xed5a7e85fda0b80b) },
+		{ UINT64_C(0x8e41ade9fbebc27d), UINT64_C(0x14588f13be847307) }, { UINT64_C(0xb1d219647ae6b31c), UINT64_C(0x596eb2d8ae258fc8) },
+		{ UINT64_C(0xde469fbd99a05fe3), UINT64_C(0x6fca5f8ed9aef3bb) }, { UINT64_C(0x8aec23d680043bee), UINT64_C(0x25de7bb9480d5854) },
+		{ UINT64_C(0xada72ccc20054ae9), UINT64_C(0xaf561aa79a10ae6a) }, { UINT64_C(0xd910f7ff28069da4), UINT64_C(0x1b2ba1518094da04) },
+		{ UINT64_C(0x87aa9aff79042286), UINT64_C(0x90fb44d2f05d0842) }, { UINT64_C(0xa99541bf57452b28), UINT64_C(0x353a1607ac744a53) },
+		{ UINT64_C(0xd3fa922f2d1675f2), UINT64_C(0x42889b8997915ce8) }, { UINT64_C(0x847c9b5d7c2e09b7), UINT64_C(0x69956135febada11) },
+		{ UINT64_C(0xa59bc234db398c25), UINT64_C(0x43fab9837e699095) }, { UINT64_C(0xcf02b2c21207ef2e), UINT64_C(0x94f967e45e03f4bb) },
+		{ UINT64_C(0x8161afb94b44f57d), UINT64_C(0x1d1be0eebac278f5) }, { UINT64_C(0xa1ba1ba79e1632dc), UINT64_C(0x6462d92a69731732) },
+		{ UINT64_C(0xca28a291859bbf93), UINT64_C(0x7d7b8f7503cfdcfe) }, { UINT64_C(0xfcb2cb35e702af78), UINT64_C(0x5cda735244c3d43e) },
+		{ UINT64_C(0x9defbf01b061adab), UINT64_C(0x3a0888136afa64a7) }, { UINT64_C(0xc56baec21c7a1916), UINT64_C(0x088aaa1845b8fdd0) },
+		{ UINT64_C(0xf6c69a72a3989f5b), UINT64_C(0x8aad549e57273d45) }, { UINT64_C(0x9a3c2087a63f6399), UINT64_C(0x36ac54e2f678864b) },
+		{ UINT64_C(0xc0cb28a98fcf3c7f), UINT64_C(0x84576a1bb416a7dd) }, { UINT64_C(0xf0fdf2d3f3c30b9f), UINT64_C(0x656d44a2a11c51d5) },
+		{ UINT64_C(0x969eb7c47859e743), UINT64_C(0x9f644ae5a4b1b325) }, { UINT64_C(0xbc4665b596706114), UINT64_C(0x873d5d9f0dde1fee) },
+		{ UINT64_C(0xeb57ff22fc0c7959), UINT64_C(0xa90cb506d155a7ea) }, { UINT64_C(0x9316ff75dd87cbd8), UINT64_C(0x09a7f12442d588f2) },
+		{ UINT64_C(0xb7dcbf5354e9bece), UINT64_C(0x0c11ed6d538aeb2f) }, { UINT64_C(0xe5d3ef282a242e81), UINT64_C(0x8f1668c8a86da5fa) },
+		{ UINT64_C(0x8fa475791a569d10), UINT64_C(0xf96e017d694487bc) }, { UINT64_C(0xb38d92d760ec4455), UINT64_C(0x37c981dcc395a9ac) },
+		{ UINT64_C(0xe070f78d3927556a), UINT64_C(0x85bbe253f47b1417) }, { UINT64_C(0x8c469ab843b89562), UINT64_C(0x93956d7478ccec8e) },
+		{ UINT64_C(0xaf58416654a6babb), UINT64_C(0x387ac8d1970027b2) }, { UINT64_C(0xdb2e51bfe9d0696a), UINT64_C(0x06997b05fcc0319e) },
+		{ UINT64_C(0x88fcf317f22241e2), UINT64_C(0x441fece3bdf81f03) }, { UINT64_C(0xab3c2fddeeaad25a), UINT64_C(0xd527e81cad7626c3) },
+		{ UINT64_C(0xd60b3bd56a5586f1), UINT64_C(0x8a71e223d8d3b074) }, { UINT64_C(0x85c7056562757456), UINT64_C(0xf6872d5667844e49) },
+		{ UINT64_C(0xa738c6bebb12d16c), UINT64_C(0xb428f8ac016561db) }, { UINT64_C(0xd106f86e69d785c7), UINT64_C(0xe13336d701beba52) },
+		{ UINT64_C(0x82a45b450226b39c), UINT64_C(0xecc0024661173473) }, { UINT64_C(0xa34d721642b06084), UINT64_C(0x27f002d7f95d0190) },
+		{ UINT64_C(0xcc20ce9bd35c78a5), UINT64_C(0x31ec038df7b441f4) }, { UINT64_C(0xff290242c83396ce), UINT64_C(0x7e67047175a15271) },
+		{ UINT64_C(0x9f79a169bd203e41), UINT64_C(0x0f0062c6e984d386) }, { UINT64_C(0xc75809c42c684dd1), UINT64_C(0x52c07b78a3e60868) },
+		{ UINT64_C(0xf92e0c3537826145), UINT64_C(0xa7709a56ccdf8a82) }, { UINT64_C(0x9bbcc7a142b17ccb), UINT64_C(0x88a66076400bb691) },
+		{ UINT64_C(0xc2abf989935ddbfe), UINT64_C(0x6acff893d00ea435) }, { UINT64_C(0xf356f7ebf83552fe), UINT64_C(0x0583f6b8c4124d43) },
+		{ UINT64_C(0x98165af37b2153de), UINT64_C(0xc3727a337a8b704a) }, { UINT64_C(0xbe1bf1b059e9a8d6), UINT64_C(0x744f18c0592e4c5c) },
+		{ UINT64_C(0xeda2ee1c7064130c), UINT64_C(0x1162def06f79df73) }, { UINT64_C(0x9485d4d1c63e8be7), UINT64_C(0x8addcb5645ac2ba8) },
+		{ UINT64_C(0xb9a74a0637ce2ee1), UINT64_C(0x6d953e2bd7173692) }, { UINT64_C(0xe8111c87c5c1ba99), UINT64_C(0xc8fa8db6ccdd0437) },
+		{ UINT64_C(0x910ab1d4db9914a0), UINT64_C(0x1d9c9892400a22a2) }, { UINT64_C(0xb54d5e4a127f59c8), UINT64_C(0x2503beb6d00cab4b) },
+		{ UINT64_C(0xe2a0b5dc971f303a), UINT64_C(0x2e44ae64840fd61d) }, { UINT64_C(0x8da471a9de737e24), UINT64_C(0x5ceaecfed289e5d2) },
+		{ UINT64_C(0xb10d8e1456105dad), UINT64_C(0x7425a83e872c5f47) }, { UINT64_C(0xdd50f1996b947518), UINT64_C(0xd12f124e28f77719) },
+		{ UINT64_C(0x8a5296ffe33cc92f), UINT64_C(0x82bd6b70d99aaa6f) }, { UINT64_C(0xace73cbfdc0bfb7b), UINT64_C(0x636cc64d1001550b) },
+		{ UINT64_C(0xd8210befd30efa5a), UINT64_C(0x3c47f7e05401aa4e) }, { UINT64_C(0x8714a775e3e95c78), UINT64_C(0x65acfaec34810a71) },
+		{ UINT64_C(0xa8d9d1535ce3b396), UINT64_C(0x7f1839a741a14d0d) }, { UINT64_C(0xd31045a8341ca07c), UINT64_C(0x1ede48111209a050) },
+		{ UINT64_C(0x83ea2b892091e44d), UINT64_C(0x934aed0aab460432) }, { UINT64_C(0xa4e4b66b68b65d60), UINT64_C(0xf81da84d5617853f) },
+		{ UINT64_C(0xce1de40642e3f4b9), UINT64_C(0x36251260ab9d668e) }, { UINT64_C(0x80d2ae83e9ce78f3), UINT64_C(0xc1d72b7c6b426019) },
+		{ UINT64_C(0xa1075a24e4421730), UINT64_C(0xb24cf65b8612f81f) }, { UINT64_C(0xc94930ae1d529cfc), UINT64_C(0xdee033f26797b627) },
+		{ UINT64_C(0xfb9b7cd9a4a7443c), UINT64_C(0x169840ef017da3b1) }, { UINT64_C(0x9d412e0806e88aa5), UINT64_C(0x8e1f289560ee864e) },
+		{ UINT64_C(0xc491798a08a2ad4e), UINT64_C(0xf1a6f2bab92a27e2) }, { UINT64_C(0xf5b5d7ec8acb58a2), UINT64_C(0xae10af696774b1db) },
+		{ UINT64_C(0x9991a6f3d6bf1765), UINT64_C(0xacca6da1e0a8ef29) }, { UINT64_C(0xbff610b0cc6edd3f), UINT64_C(0x17fd090a58d32af3) },
+		{ UINT64_C(0xeff394dcff8a948e), UINT64_C(0xddfc4b4cef07f5b0) }, { UINT64_C(0x95f83d0a1fb69cd9), UINT64_C(0x4abdaf101564f98e) },
+		{ UINT64_C(0xbb764c4ca7a4440f), UINT64_C(0x9d6d1ad41abe37f1) }, { UINT64_C(0xea53df5fd18d5513), UINT64_C(0x84c86189216dc5ed) },
+		{ UINT64_C(0x92746b9be2f8552c), UINT64_C(0x32fd3cf5b4e49bb4) }, { UINT64_C(0xb7118682dbb66a77), UINT64_C(0x3fbc8c33221dc2a1) },
+		{ UINT64_C(0xe4d5e82392a40515), UINT64_C(0x0fabaf3feaa5334a) }, { UINT64_C(0x8f05b1163ba6832d), UINT64_C(0x29cb4d87f2a7400e) },
+		{ UINT64_C(0xb2c71d5bca9023f8), UINT64_C(0x743e20e9ef511012) }, { UINT64_C(0xdf78e4b2bd342cf6), UINT64_C(0x914da9246b255416) },
+		{ UINT64_C(0x8bab8eefb6409c1a), UINT64_C(0x1ad089b6c2f7548e) }, { UINT64_C(0xae9672aba3d0c320), UINT64_C(0xa184ac2473b529b1) },
+		{ UINT64_C(0xda3c0f568cc4f3e8), UINT64_C(0xc9e5d72d90a2741e) }, { UINT64_C(0x8865899617fb1871), UINT64_C(0x7e2fa67c7a658892) },
+		{ UINT64_C(0xaa7eebfb9df9de8d), UINT64_C(0xddbb901b98feeab7) }, { UINT64_C(0xd51ea6fa85785631), UINT64_C(0x552a74227f3ea565) },
+		{ UINT64_C(0x8533285c936b35de), UINT64_C(0xd53a88958f87275f) }, { UINT64_C(0xa67ff273b8460356), UINT64_C(0x8a892abaf368f137) },
+		{ UINT64_C(0xd01fef10a657842c), UINT64_C(0x2d2b7569b0432d85) }, { UINT64_C(0x8213f56a67f6b29b), UINT64_C(0x9c3b29620e29fc73) },
+		{ UINT64_C(0xa298f2c501f45f42), UINT64_C(0x8349f3ba91b47b8f) }, { UINT64_C(0xcb3f2f7642717713), UINT64_C(0x241c70a936219a73) },
+		{ UINT64_C(0xfe0efb53d30dd4d7), UINT64_C(0xed238cd383aa0110) }, { UINT64_C(0x9ec95d1463e8a506), UINT64_C(0xf4363804324a40aa) },
+		{ UINT64_C(0xc67bb4597ce2ce48), UINT64_C(0xb143c6053edcd0d5) }, { UINT64_C(0xf81aa16fdc1b81da), UINT64_C(0xdd94b7868e94050a) },
+		{ UINT64_C(0x9b10a4e5e9913128), UINT64_C(0xca7cf2b4191c8326) }, { UINT64_C(0xc1d4ce1f63f57d72), UINT64_C(0xfd1c2f611f63a3f0) },
+		{ UINT64_C(0xf24a01a73cf2dccf), UINT64_C(0xbc633b39673c8cec) }, { UINT64_C(0x976e41088617ca01), UINT64_C(0xd5be0503e085d813) },
+		{ UINT64_C(0xbd49d14aa79dbc82), UINT64_C(0x4b2d8644d8a74e18) }, { UINT64_C(0xec9c459d51852ba2), UINT64_C(0xddf8e7d60ed1219e) },
+		{ UINT64_C(0x93e1ab8252f33b45), UINT64_C(0xcabb90e5c942b503) }, { UINT64_C(0xb8da1662e7b00a17), UINT64_C(0x3d6a751f3b936243) },
+		{ UINT64_C(0xe7109bfba19c0c9d), UINT64_C(0x0cc512670a783ad4) }, { UINT64_C(0x906a617d450187e2), UINT64_C(0x27fb2b80668b24c5) },
+		{ UINT64_C(0xb484f9dc9641e9da), UINT64_C(0xb1f9f660802dedf6) }, { UINT64_C(0xe1a63853bbd26451), UINT64_C(0x5e7873f8a0396973) },
+		{ UINT64_C(0x8d07e33455637eb2), UINT64_C(0xdb0b487b6423e1e8) }, { UINT64_C(0xb049dc016abc5e5f), UINT64_C(0x91ce1a9a3d2cda62) },
+		{ UINT64_C(0xdc5c5301c56b75f7), UINT64_C(0x7641a140cc7810fb) }, { UINT64_C(0x89b9b3e11b6329ba), UINT64_C(0xa9e904c87fcb0a9d) },
+		{ UINT64_C(0xac2820d9623bf429), UINT64_C(0x546345fa9fbdcd44) }, { UINT64_C(0xd732290fbacaf133), UINT64_C(0xa97c177947ad4095) },
+		{ UINT64_C(0x867f59a9d4bed6c0), UINT64_C(0x49ed8eabcccc485d) }, { UINT64_C(0xa81f301449ee8c70), UINT64_C(0x5c68f256bfff5a74) },
+		{ UINT64_C(0xd226fc195c6a2f8c), UINT64_C(0x73832eec6fff3111) }, { UINT64_C(0x83585d8fd9c25db7), UINT64_C(0xc831fd53c5ff7eab) },
+		{ UINT64_C(0xa42e74f3d032f525), UINT64_C(0xba3e7ca8b77f5e55) }, { UINT64_C(0xcd3a1230c43fb26f), UINT64_C(0x28ce1bd2e55f35eb) },
+		{ UINT64_C(0x80444b5e7aa7cf85), UINT64_C(0x7980d163cf5b81b3) }, { UINT64_C(0xa0555e361951c366), UINT64_C(0xd7e105bcc332621f) },
+		{ UINT64_C(0xc86ab5c39fa63440), UINT64_C(0x8dd9472bf3fefaa7) }, { UINT64_C(0xfa856334878fc150), UINT64_C(0xb14f98f6f0feb951) },
+		{ UINT64_C(0x9c935e00d4b9d8d2), UINT64_C(0x6ed1bf9a569f33d3) }, { UINT64_C(0xc3b8358109e84f07), UINT64_C(0x0a862f80ec4700c8) },
+		{ UINT64_C(0xf4a642e14c6262c8), UINT64_C(0xcd27bb612758c0fa) }, { UINT64_C(0x98e7e9cccfbd7dbd), UINT64_C(0x8038d51cb897789c) },
+		{ UINT64_C(0xbf21e44003acdd2c), UINT64_C(0xe0470a63e6bd56c3) }, { UINT64_C(0xeeea5d5004981478), UINT64_C(0x1858ccfce06cac74) },
+		{ UINT64_C(0x95527a5202df0ccb), UINT64_C(0x0f37801e0c43ebc8) }, { UINT64_C(0xbaa718e68396cffd), UINT64_C(0xd30560258f54e6ba) },
+		{ UINT64_C(0xe950df20247c83fd), UINT64_C(0x47c6b82ef32a2069) }, { UINT64_C(0x91d28b7416cdd27e), UINT64_C(0x4cdc331d57fa5441) },
+		{ UINT64_C(0xb6472e511c81471d), UINT64_C(0xe0133fe4adf8e952) }, { UINT64_C(0xe3d8f9e563a198e5), UINT64_C(0x58180fddd97723a6) },
+		{ UINT64_C(0x8e679c2f5e44ff8f), UINT64_C(0x570f09eaa7ea7648) }
+	};
+
+	static const int kPowerOf5For128Min = -342;
+	static const int kPowerOf5For128Max =  308;
+
+
+	// Returns the IEEE bits (without the sign) of the double nearest to nMantissa * 10^nExponent, 
+	// for nMantissa != 0 and nExponent in [kPowerOf5For128Min, kPowerOf5For128Max].
+	static uint64_t EiselLemire(uint64_t nMantissa, int32_t nExponent)
+	{
+		const int            nLeadingZeroes = CountLeading0Bits(nMantissa);
+		const uint64_t       w              = nMantissa << nLeadingZeroes;
+		const uint64_t*const pPower         = kPowersOf5For128[nExponent - kPowerOf5For128Min];
+
+		// Multiply w by the 128 bit power of five. The low half of the power is needed 
+		// only if the bits below the 55 we keep (52 + implicit bit + round bit + one 
+		// for the possible leading zero) are all ones, as it can then carry into them.
+		uint64_t nLow;
+		uint64_t nHigh = Multiply64To128(w, pPower[0], nLow);
+
+		if((nHigh & 0x1ff) == 0x1ff)
+		{
+			uint64_t       nLowLow;
+			const uint64_t nLowHigh = Multiply64To128(w, pPower[1], nLowLow);
+
+			nLow += nLowHigh;
+			nHigh += (nLow < nLowHigh); // Add the carry.
+		}
+
+		const int nUpperBit = (int)(nHigh >> 63);
+		const int nShift    = nUpperBit + 64 - 52 - 3;
+		uint64_t  nResult   = nHigh >> nShift;
+		// The biased binary exponent. (217706 * e) >> 16 is floor(log2(10^e)) for the exponents here.
+		int32_t   nPower2   = (int32_t)((((217706 * nExponent) >> 16) + 63) + nUpperBit - nLeadingZeroes + 1023);
+
+		if(nPower2 <= 0) // If the result is denormalized...
+		{
+			if((-nPower2 + 1) >= 64) // If all bits are below the smallest denormal, the result is zero.
+				return 0;
+
+			nResult >>= (-nPower2 + 1);
+			nResult += (nResult & 1); // Round.
+			nResult >>= 1;
+
+			// Rounding up may have made the smallest normalized value, whose exponent field is 1, 
+			// which is what the implicit bit becomes here.
+			return nResult;
+		}
+
+		// Round half to even. An exact tie is possible only for small exponents, as 5^q needs to be
+		// exactly representable for the product to have a fractional part of exactly one half.
+		if((nLow <= 1) && (nExponent >= -4) && (nExponent <= 23) && ((nResult & 3) == 1))
+		{
+			if((nResult << nShift) == nHigh)
+				nResult &= ~(uint64_t)1; // Don't round up.
+		}
+
+		nResult += (nResult & 1); // Round.
+		nResult >>= 1;
+
+		if(nResult >= (UINT64_C(2) << 52)) // If rounding carried into a new bit...
+		{
+			nResult = (UINT64_C(1) << 52);
+			nPower2++;
+		}
+
+		nResult &= ~(UINT64_C(1) << 52);
+
+		if(nPower2 >= 0x7ff) // If the result overflows to infinity...
+			return UINT64_C(0x7ff) << 52;
+
+		return ((uint64_t)nPower2 << 52) | nResult;
+	}
+
+
+	EASTDC_API bool DecimalToDouble(uint64_t nMantissa, int64_t nExponent, bool bTruncated, double& dValue)
+	{
+		uint64_t nBits;
+
+		if((nMantissa == 0) || (nExponent < kPowerOf5For128Min))
+			nBits = 0;
+		else if(nExponent > kPowerOf5For128Max)
+			nBits = UINT64_C(0x7ff) << 52;
+		else
+		{
+			nBits = EiselLemire(nMantissa, (int32_t)nExponent);
+
+			// If digits were dropped, the exact value is in [nMantissa, nMantissa + 1) * 10^nExponent, 
+			// and the result is known only if both ends round to the same double.
+			if(bTruncated && (nBits != EiselLemire(nMantissa + 1, (int32_t)nExponent)))
+				return false;
+		}
+
+		memcpy(&dValue, &nBits, sizeof(dValue));
+		return true;
+	}
+
+} // namespace Internal
+
+
+// The char versions of StrtoU64Common and StrtodEnglish convert base 10 digits (and StrtoU64Common 
+// base 16 digits) eight at a time, with the eight chars loaded into a 64 bit word and their digit 
+// values computed with arithmetic on the word's bytes, instead of going through them one by one.
+//
+// LoadDigitWord loads the chars at p into the bytes of nWord, the first char being the 
+// low byte, and returns how many it loaded (1 to 8). The unloaded bytes are 0, which isn't
+// a digit. Without bBounded it may read chars past the terminating 0 char, but not past 
+// the page that p is in, so it can't fault, much like our Strlen. We assume pages are 
+// at least 4096 bytes.
+//
+#if EASTDC_STATIC_ANALYSIS_ENABLED
+	#define EASTDC_ENABLE_OPTIMIZED_STRTOI 0 // Disabled for unterminated reads, for the same reason as EASTDC_ENABLE_OPTIMIZED_STRLEN.
+#else
+	#define EASTDC_ENABLE_OPTIMIZED_STRTOI 1
+#endif
+
+template <bool bBounded>
+static EA_FORCE_INLINE int LoadDigitWord(const char* p, const char* pEnd, uint64_t& nWord)
+{
+	size_t nCount = 8;
+
+	if(bBounded)
+	{
+		if((size_t)(pEnd - p) < nCount)
+			nCount = (size_t)(pEnd - p);
+	}
+	else
+	{
+		#if EASTDC_ENABLE_OPTIMIZED_STRTOI
+			const size_t nPageRemaining = 4096 - ((uintptr_t)p & 4095);
+
+			if(nPageRemaining < nCount)
+				nCount = nPageRemaining;
+		#else
+			for(nCount = 0; (nCount < 8) && p[nCount]; ++nCount)
+				{ }
+
+			if(nCount == 0)
+				nCount = 1; // Load the 0 char, which ends the digits.
+		#endif
+	}
+
+	#if defined(EA_SYSTEM_BIG_ENDIAN)
+		nWord = 0;
+		for(size_t i = 0; i < nCount; ++i)
+			nWord |= (uint64_t)(uint8_t)p[i] << (i * 8);
+	#else
+		if(nCount == 8)
+			memcpy(&nWord, p, 8);
+		else
+		{
+			nWord = 0;
+			memcpy(&nWord, p, nCount);
+		}
+	#endif
+
+	return (int)nCount;
+}
+
+
+// Returns the number of leading bytes of nWord that are decimal digit chars, and sets nValue 
+// to the value of those digits. nValue is unchanged if there are none.
+static EA_FORCE_INLINE int ParseDecimalWord(uint64_t nWord, uint32_t& nValue)
+{
+	const uint64_t kZeroChars  = UINT64_C(0x3030303030303030);
+	const uint64_t kHighNibble = UINT64_C(0xf0f0f0f0f0f0f0f0);
+
+	// A byte is a digit if it's 0x30-0x3f and still is after adding 6. A carry out of a non-digit 
+	// byte may spoil the test of the bytes after it, but we are interested only in those before it.
+	const uint64_t nNonDigits  = ((nWord & kHighNibble) ^ kZeroChars) | (((nWord + UINT64_C(0x0606060606060606)) & kHighNibble) ^ kZeroChars);
+	const int      nCount      = nNonDigits ? (CountTrailing0Bits(nNonDigits) / 8) : 8;
+
+	if(nCount)
+	{
+		// Move the digits to the high bytes, so that the first digit is in the highest byte after 
+		// as many leading zeroes as needed to make eight digits, then combine the digits in pairs, 
+		// the pairs in pairs, and so on.
+		uint64_t v = (nWord - kZeroChars) << ((8 - nCount) * 8);
+
+		v = (v * 10) + (v >> 8);
+		v = (((v & UINT64_C(0x000000ff000000ff)) * UINT64_C(0x000f424000000064)) +          // 100 + (1000000 << 32)
+			 (((v >> 16) & UINT64_C(0x000000ff000000ff)) * UINT64_C(0x0000271000000001))) >> 32; // 1 + (10000 << 32)
+
+		nValue = (uint32_t)v;
+	}
+
+	return nCount;
+}
+
+
+static const uint32_t kPowersOf10U32[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+
+// Returns the number of leading bytes of nWord that are hexadecimal digit chars, and sets nValue 
+// to the value of those digits. nValue is unchanged if there are none.
+static EA_FORCE_INLINE int ParseHexWord(uint64_t nWord, uint32_t& nValue)
+{
+	const uint64_t kOnes = UINT64_C(0x0101010101010101);
+	const uint64_t kHigh = UINT64_C(0x8080808080808080);
+
+	// For a byte x < 0x80, ((x | 0x80) - lo) has its high bit set if x >= lo and ((hi | 0x80) - x) 
+	// has its high bit set if x <= hi, and neither subtraction borrows from the next byte.
+	const uint64_t x        = nWord & ~kHigh;
+	const uint64_t y        = (nWord | (kOnes * 0x20)) & ~kHigh; // Letters converted to lower case.
+	const uint64_t nDigits  = ((x | kHigh) - (kOnes * '0')) & (((kOnes * '9') | kHigh) - x);
+	const uint64_t nLetters = ((y | kHigh) - (kOnes * 'a')) & (((kOnes * 'f') | kHigh) - y) & kHigh;
+	const uint64_t nNonHex  = ~((nDigits | nLetters) & ~nWord) & kHigh;
+	const int      nCount   = nNonHex ? (CountTrailing0Bits(nNonHex) / 8) : 8;
+
+	if(nCount)
+	{
+		// Compute the digit values, move them to the high bytes as in ParseDecimalWord, and combine them in pairs.
+		uint64_t v = ((nWord & (kOnes * 0x0f)) + ((nLetters >> 7) * 9)) << ((8 - nCount) * 8);
+
+		v = ((v & UINT64_C(0x0f000f000f000f00)) >> 8)  | ((v & UINT64_C(0x000f000f000f000f)) << 4);
+		v = ((v & UINT64_C(0x00ff000000ff0000)) >> 16) | ((v & UINT64_C(0x000000ff000000ff)) << 8);
+		v = ((v & UINT64_C(0x0000ffff00000000)) >> 32) | ((v & UINT64_C(0x000000000000ffff)) << 16);
+
+		nValue = (uint32_t)v;
+	}
+
+	return nCount;
+}
+
+
+// Returns the value of c as a digit in bases up to 36, or 36 or more if c isn't a digit or an ASCII letter.
+template <typename CharT>
+static EA_FORCE_INLINE unsigned DigitValue(CharT c)
+{
+	if((unsigned)(c - '0') < 10)
+		return (unsigned)(c - '0');
+	if((unsigned)((c | 0x20) - 'a') < 26) // (c | 0x20) converts 'A'-'Z' to 'a'-'z'.
+		return (unsigned)((c | 0x20) - 'a' + 10);
+	return 36;
+}
+
+
+// Returns the char at p, or 0 if bBounded and p is at the end of the string.
+template <bool bBounded, typename CharT>
+static EA_FORCE_INLINE CharT PeekChar(const CharT* p, const CharT* pEnd)
 {
-	// This implementation is an exact copy of StrtodEnglish but 
-	// with char in place of char16_t. For the time being, if 
-	// you do maintenance on either of these functions, you need to 
-	// copy the result to the other version.
-	int            c;
-	double         dTotal(0.0);
-	char        chSign('+');
-	const char* pEnd = pValue;
+	return (!bBounded || (p < pEnd)) ? *p : (CharT)0;
+}
+
+
+// Converts the significand [pDigits, pDigitsEnd), which may contain a decimal point, times 10^nExponent 
+// with the C runtime library's strtod, which is slow but exact. This is used only for decimals with more 
+// than 19 significant digits whose first 19 digits don't determine the result.
+template <typename CharT>
+static double StrtodEnglishSlow(const CharT* pDigits, const CharT* pDigitsEnd, int64_t nExponent)
+{
+	// 768 digits are enough to decide the rounding of any double. Beyond them, a nonzero digit 
+	// is replaced by a single 1 digit, which rounds the same way.
+	const int kDigitCountMax = 768;
+	char      buffer[kDigitCountMax + 32];
+	int       nDigitCount = 0;
+	bool      bFraction = false;
+	bool      bNonZeroDropped = false;
+
+	for(; pDigits < pDigitsEnd; ++pDigits)
+	{
+		if(*pDigits == '.')
+			bFraction = true;
+		else if((nDigitCount == 0) && (*pDigits == '0')) // Skip leading zeroes.
+			nExponent -= bFraction;
+		else if(nDigitCount < kDigitCountMax)
+		{
+			buffer[nDigitCount++] = (char)*pDigits;
+			nExponent -= bFraction;
+		}
+		else
+		{
+			nExponent += !bFraction;
+			bNonZeroDropped |= (*pDigits != '0');
+		}
+	}
+
+	if(bNonZeroDropped)
+	{
+		buffer[nDigitCount++] = '1';
+		nExponent--;
+	}
+
+	buffer[nDigitCount++] = 'e';
+	I64toa(nExponent, buffer + nDigitCount, 10);
 
-	while(Isspace(*pValue))
-		++pValue;    //Remove leading spaces.
+	return strtod(buffer, NULL); // The buffer has no decimal point, so this doesn't depend on the locale.
+}
+
+
+// Accumulates the decimal digits at p into nMantissa eight at a time, while they are sure to fit 
+// in kMantissaDigitCountMax digits, and returns the position after them. The char by char loops 
+// of StrtodEnglishCore take over from there. Does nothing for char16_t and char32_t strings.
+template <bool bBounded, typename CharT>
+static EA_FORCE_INLINE const CharT* AccumulateDigitWords(const CharT* p, const CharT* pEnd, uint64_t& nMantissa, int& nDigitCount, int kMantissaDigitCountMax)
+{
+	if(sizeof(CharT) == 1)
+	{
+		while(nDigitCount <= (kMantissaDigitCountMax - 8))
+		{
+			uint64_t  nWord;
+			uint32_t  nWordValue;
+			const int nLoaded = LoadDigitWord<bBounded>((const char*)p, (const char*)pEnd, nWord);
+			const int nCount  = ParseDecimalWord(nWord, nWordValue);
+
+			if(nCount == 0)
+				break;
 
-	pEnd =  pValue;
-	c    = *pValue++;
-	if(c == '-' || c == '+'){
-		chSign = (char)c;
-		pEnd   = pValue;
-		c      = *pValue++;
+			nMantissa    = (nMantissa * kPowersOf10U32[nCount]) + nWordValue;
+			nDigitCount += nCount;
+			p           += nCount;
+
+			if(nCount < nLoaded) // If we found the end of the digits...
+				break;
+		}
 	}
 
-	while((c >= '0') && (c <= '9')){
-		dTotal = (10 * dTotal) + (c - '0');
-		pEnd = pValue;
-		c = *pValue++;
+	return p;
+}
+
+
+// Implements StrtodEnglish, except for setting errno. Instead, bRangeError is set to whether a nonzero 
+// value overflowed to HUGE_VAL or underflowed to zero. If bBounded then the string ends at pValueEnd, 
+// else it ends at its terminating 0 char.
+template <bool bBounded, typename CharT>
+static double StrtodEnglishCore(const CharT* pValue, const CharT* pValueEnd, CharT** ppEnd, bool& bRangeError)
+{
+	const int    kMantissaDigitCountMax = 19; // The most decimal digits that always fit in 64 bits.
+	const CharT* pCurrent = pValue;
+	bool         bNegative = false;
+
+	while(Isspace(PeekChar<bBounded>(pCurrent, pValueEnd)))
+		++pCurrent; // Remove leading spaces.
+
+	const CharT cSign = PeekChar<bBounded>(pCurrent, pValueEnd);
+
+	if((cSign == '-') || (cSign == '+'))
+	{
+		bNegative = (cSign == '-');
+		++pCurrent;
 	}
 
-	if(c == '.'){
-		double dMultiplier(1); //Possibly some BCD variable would be more accurate.
+	// Accumulate up to 19 significant digits in nMantissa, with nExponent being such that the value is nMantissa * 10^nExponent.
+	const CharT* const pDigits = pCurrent;
+	uint64_t           nMantissa = 0;
+	int                nDigitCount = 0;
+	int64_t            nExponent = 0;
+	bool               bTruncated = false;
+
+	while(PeekChar<bBounded>(pCurrent, pValueEnd) == '0')
+		++pCurrent;
 
-		pEnd = pValue;
-		c    = *pValue++;
-		while((c >= '0') && (c <= '9')){
-			dMultiplier *= 0.1;
-			dTotal += (c - '0') * dMultiplier;
-			pEnd = pValue;
-			c    = *pValue++;
+	pCurrent = AccumulateDigitWords<bBounded>(pCurrent, pValueEnd, nMantissa, nDigitCount, kMantissaDigitCountMax);
+
+	for(uint32_t d; (d = (uint32_t)(PeekChar<bBounded>(pCurrent, pValueEnd) - '0')) < 10; ++pCurrent)
+	{
+		if(nDigitCount < kMantissaDigitCountMax)
+		{
+			nMantissa = (nMantissa * 10) + d;
+			nDigitCount++;
+		}
+		else
+		{
+			nExponent++;
+			bTruncated |= (d != 0);
 		}
 	}
 
-	if(c == 'e' || c == 'E'){
-		int     nExponentValue(0);
-		double  dExponentTotal;
-		char chExponentSign('+');
+	bool bDigitsFound = (pCurrent != pDigits);
+
+	if(PeekChar<bBounded>(pCurrent, pValueEnd) == '.')
+	{
+		const CharT* const pFraction = ++pCurrent;
+
+		if(nDigitCount == 0)
+		{
+			while(PeekChar<bBounded>(pCurrent, pValueEnd) == '0')
+				++pCurrent;
+			nExponent -= (pCurrent - pFraction);
+		}
+
+		const int nIntegerDigitCount = nDigitCount;
 
-		pEnd = pValue;
-		c    = *pValue++; //Move past the exponent.
+		pCurrent   = AccumulateDigitWords<bBounded>(pCurrent, pValueEnd, nMantissa, nDigitCount, kMantissaDigitCountMax);
+		nExponent -= (nDigitCount - nIntegerDigitCount);
 
-		if(c == '-' || c == '+'){
-			chExponentSign = (char)c;
-			pEnd = pValue;
-			c    = *pValue++; //Move past the '+' or '-' sign.
+		for(uint32_t d; (d = (uint32_t)(PeekChar<bBounded>(pCurrent, pValueEnd) - '0')) < 10; ++pCurrent)
+		{
+			if(nDigitCount < kMantissaDigitCountMax)
+			{
+				nMantissa = (nMantissa * 10) + d;
+				nDigitCount++;
+				nExponent--;
+			}
+			else
+				bTruncated |= (d != 0);
 		}
 
-		while((c >= '0') && (c <= '9')){
-			nExponentValue = (10 * nExponentValue) + (c - '0');
-			pEnd = pValue;
-			c    = *pValue++;
+		bDigitsFound |= (pCurrent != pFraction);
+	}
+
+	bRangeError = false;
+
+	if(!bDigitsFound) // If there is no number, no conversion is done.
+	{
+		if(ppEnd)
+			*ppEnd = (CharT*)pValue;
+		return 0.0;
+	}
+
+	const CharT* const pDigitsEnd = pCurrent;
+	int64_t            nExplicitExponent = 0;
+
+	if((PeekChar<bBounded>(pCurrent, pValueEnd) | 0x20) == 'e') // (c | 0x20) converts 'E' to 'e'.
+	{
+		// The exponent is part of the number only if it has at least one digit.
+		const CharT* pExponent = pCurrent + 1;
+		const CharT  cExponentSign = PeekChar<bBounded>(pExponent, pValueEnd);
+		const bool   bExponentNegative = (cExponentSign == '-');
+
+		if((cExponentSign == '-') || (cExponentSign == '+'))
+			++pExponent;
+
+		if((uint32_t)(PeekChar<bBounded>(pExponent, pValueEnd) - '0') < 10)
+		{
+			for(uint32_t d; (d = (uint32_t)(PeekChar<bBounded>(pExponent, pValueEnd) - '0')) < 10; ++pExponent)
+			{
+				if(nExplicitExponent < 100000000) // Larger exponents overflow or underflow anyway.
+					nExplicitExponent = (nExplicitExponent * 10) + d;
+			}
+
+			if(bExponentNegative)
+				nExplicitExponent = -nExplicitExponent;
+			pCurrent = pExponent;
 		}
-
-		dExponentTotal = ::pow(10.0, (double)nExponentValue); // The CRT pow function is actually somewhat slow and weak.
-															  // It would be very nice to change this to at least implement
-		if(chExponentSign == '-')                             // the low exponents with a lookup table.
-			dExponentTotal = 1/dExponentTotal;
-		dTotal *= dExponentTotal;
 	}
 
 	if(ppEnd)
-		*ppEnd = (char*)pEnd;
-
-	if(chSign == '-')
-		return -dTotal;
-	return dTotal;
-}
-
-EASTDC_API double StrtodEnglish(const char16_t* pValue, char16_t** ppEnd)
-{
-	// This implementation is an exact copy of StrtodEnglish8 but 
-	// with char16_t in place of char. For the time being, if you
-	// do maintenance on either of these functions, you need to 
-	// copy the result to the other version.
-	char16_t        c;
-	double          dTotal(0.0);
-	char16_t        chSign('+');
-	const char16_t* pEnd = pValue;
-
-	while(Isspace(*pValue))
-		++pValue;    // Remove leading spaces.
+		*ppEnd = (CharT*)pCurrent;
 
-	pEnd =  pValue;
-	c    = *pValue++;
-	if(c == '-' || c == '+'){
-		chSign = (char16_t)c;
-		pEnd   = pValue;
-		c      = *pValue++;
-	}
+	double dValue;
 
-	while((c >= '0') && (c <= '9')){
-		dTotal = (10 * dTotal) + (c - '0');
-		pEnd = pValue;
-		c = *pValue++;
-	}
+	if(!Internal::DecimalToDouble(nMantissa, nExponent + nExplicitExponent, bTruncated, dValue))
+		dValue = StrtodEnglishSlow(pDigits, pDigitsEnd, nExplicitExponent);
 
-	if(c == '.'){
-		double dMultiplier(1); // Possibly some BCD variable would be more accurate.
+	bRangeError = (nMantissa != 0) && ((dValue == 0) || (dValue == HUGE_VAL));
 
-		pEnd = pValue;
-		c    = *pValue++;
-		while((c >= '0') && (c <= '9')){
-			dMultiplier *= 0.1;
-			dTotal += (c - '0') * dMultiplier;
-			pEnd = pValue;
-			c    = *pValue++;
-		}
-	}
+	return bNegative ? -dValue : dValue;
+}
 
-	if(c == 'e' || c == 'E'){
-		int      nExponentValue(0);
-		double   dExponentTotal;
-		char16_t chExponentSign('+');
 
-		pEnd = pValue;
-		c    = *pValue++; //Move past the exponent.
+template <typename CharT>
+static double StrtodEnglishCommon(const CharT* pValue, CharT** ppEnd)
+{
+	bool         bRangeError;
+	const double dValue = StrtodEnglishCore<false>(pValue, (const CharT*)NULL, ppEnd, bRangeError);
 
-		if(c == '-' || c == '+'){
-			chExponentSign = (char16_t)c;
-			pEnd = pValue;
-			c    = *pValue++; // Move past the '+' or '-' sign.
-		}
+	if(bRangeError)
+		errno = ERANGE;
 
-		while((c >= '0') && (c <= '9')){
-			nExponentValue = (int)((10 * nExponentValue) + (c - '0'));
-			pEnd = pValue;
-			c    = *pValue++;
-		}
+	return dValue;
+}
 
-		dExponentTotal = ::pow(10.0, (double)nExponentValue);  // The CRT pow function is actually somewhat slow and weak.
-															   // It would be very nice to change this to at least implement
-		if(chExponentSign == '-')                              // the low exponents with a lookup table.
-			dExponentTotal = 1/dExponentTotal;
-		dTotal *= dExponentTotal;
-	}
 
-	if(ppEnd)
-		*ppEnd = (char16_t*)pEnd;
+EASTDC_API double StrtodEnglish(const char* pValue, char** ppEnd)
+{
+	return StrtodEnglishCommon(pValue, ppEnd);
+}
 
-	if(chSign == '-')
-		return -dTotal;
-	return dTotal;
+EASTDC_API double StrtodEnglish(const char16_t* pValue, char16_t** ppEnd)
+{
+	return StrtodEnglishCommon(pValue, ppEnd);
 }
 
 EASTDC_API double StrtodEnglish(const char32_t* pValue, char32_t** ppEnd)
 {
-	// This implementation is an exact copy of StrtodEnglish8 but 
-	// with char32_t in place of char. For the time being, if you
-	// do maintenance on either of these functions, you need to 
-	// copy the result to the other version.
-	char32_t        c;
-	double          dTotal(0.0);
-	char32_t        chSign('+');
-	const char32_t* pEnd = pValue;
+	return StrtodEnglishCommon(pValue, ppEnd);
+}
 
-	while(Isspace(*pValue))
-		++pValue;    // Remove leading spaces.
 
-	pEnd =  pValue;
-	c    = *pValue++;
-	if(c == '-' || c == '+'){
-		chSign = (char32_t)c;
-		pEnd   = pValue;
-		c      = *pValue++;
-	}
 
-	while((c >= '0') && (c <= '9')){
-		dTotal = (10 * dTotal) + (c - '0');
-		pEnd = pValue;
-		c = *pValue++;
-	}
 
-	if(c == '.'){
-		double dMultiplier(1); // Possibly some BCD variable would be more accurate.
+// Converts the base 10 or base 16 digits at p eight at a time, as described above. Returns the 
+// position after the last digit. Sets bDigitWasRead if there were any digits and bOverflowOccurred 
+// if the value doesn't fit in 64 bits, in which case the digits are still consumed.
+template <bool bBounded>
+static const char* ParseDigitWords(const char* p, const char* pEnd, int nBase, uint64_t& nValue, bool& bDigitWasRead, bool& bOverflowOccurred)
+{
+	// UINT64_MAX / 10^n and UINT64_MAX % 10^n, for checking whether the next n digits would overflow.
+	static const uint64_t kDecimalMaxValue[9] = { UINT64_C(18446744073709551615), UINT64_C(1844674407370955161), UINT64_C(184467440737095516), 
+												  UINT64_C(18446744073709551), UINT64_C(1844674407370955), UINT64_C(184467440737095),
+												  UINT64_C(18446744073709), UINT64_C(1844674407370), UINT64_C(184467440737) };
+	static const uint32_t kDecimalModValue[9] = { 0, 5, 15, 615, 1615, 51615, 551615, 9551615, 9551615 };
 
-		pEnd = pValue;
-		c    = *pValue++;
-		while((c >= '0') && (c <= '9')){
-			dMultiplier *= 0.1;
-			dTotal += (c - '0') * dMultiplier;
-			pEnd = pValue;
-			c    = *pValue++;
-		}
-	}
+	for(;;)
+	{
+		uint64_t  nWord;
+		uint32_t  nWordValue = 0;
+		const int nLoaded = LoadDigitWord<bBounded>(p, pEnd, nWord);
+		const int nCount  = (nBase == 10) ? ParseDecimalWord(nWord, nWordValue) : ParseHexWord(nWord, nWordValue);
 
-	if(c == 'e' || c == 'E'){
-		int      nExponentValue(0);
-		double   dExponentTotal;
-		char32_t chExponentSign('+');
+		if(nCount == 0)
+			break;
 
-		pEnd = pValue;
-		c     = *pValue++; //Move past the exponent.
+		bDigitWasRead = true;
 
-		if(c == '-' || c == '+'){
-			chExponentSign = (char32_t)c;
-			pEnd = pValue;
-			c    = *pValue++; // Move past the '+' or '-' sign.
+		if(!bOverflowOccurred)
+		{
+			if(nBase == 10)
+			{
+				if((nValue < kDecimalMaxValue[nCount]) || ((nValue == kDecimalMaxValue[nCount]) && (nWordValue <= kDecimalModValue[nCount])))
+					nValue = (nValue * kPowersOf10U32[nCount]) + nWordValue;
+				else
+					bOverflowOccurred = true;
+			}
+			else
+			{
+				if((nValue >> (64 - (nCount * 4))) == 0)
+					nValue = (nValue << (nCount * 4)) | nWordValue;
+				else
+					bOverflowOccurred = true;
+			}
 		}
 
-		while((c >= '0') && (c <= '9')){
-			nExponentValue = (int)((10 * nExponentValue) + (c - '0'));
-			pEnd = pValue;
-			c    = *pValue++;
-		}
+		p += nCount;
 
-		dExponentTotal = ::pow(10.0, (double)nExponentValue);  // The CRT pow function is actually somewhat slow and weak.
-															   // It would be very nice to change this to at least implement
-		if(chExponentSign == '-')                              // the low exponents with a lookup table.
-			dExponentTotal = 1/dExponentTotal;
-		dTotal *= dExponentTotal;
+		if(nCount < nLoaded) // If we found the end of the digits...
+			break;
 	}
 
-	if(ppEnd)
-		*ppEnd = (char32_t*)pEnd;
-
-	if(chSign == '-')
-		return -dTotal;
-	return dTotal;
+	return p;
 }
 
 
-
-
-static uint64_t StrtoU64Common(const char* pValue, char** ppEnd, int nBase, bool bUnsigned)
+// Implements the StrtoI32, StrtoU32, StrtoI64 and StrtoU64 families of functions, except for setting
+// errno. Instead, bRangeError is set to whether the value was out of range and was clamped.
+// If bBounded then the string ends at pValueEnd, else it ends at its terminating 0 char.
+// A 0 char within a bounded string ends it as well.
+template <bool bBounded, typename CharT>
+static uint64_t StrtoU64Core(const CharT* pValue, const CharT* pValueEnd, CharT** ppEnd, int nBase, bool bUnsigned, bool& bRangeError)
 {
-	uint64_t       nValue(0);                 // Current value
-	const char* p = pValue;                // Current position
-	char        c;                         // Temp value
-	char        chSign('+');               // One of either '+' or '-'
-	bool           bDigitWasRead(false);      // True if any digits were read.
-	bool           bOverflowOccurred(false);  // True if integer overflow occurred.
+	uint64_t     nValue(0);                 // Current value
+	const CharT* p = pValue;                // Current position
+	CharT        c;                         // Temp value
+	CharT        chSign('+');               // One of either '+' or '-'
+	bool         bDigitWasRead(false);      // True if any digits were read.
+	bool         bOverflowOccurred(false);  // True if integer overflow occurred.
 
 	// Skip leading whitespace
-	c = *p++;
+	c = PeekChar<bBounded>(p, pValueEnd);
 	while(Isspace(c))
-		c = *p++;
+		c = PeekChar<bBounded>(++p, pValueEnd);
 
 	// Check for sign.
 	if((c == '-') || (c == '+')){
 		chSign = c;
-		c = *p++;
+		c = PeekChar<bBounded>(++p, pValueEnd);
 	}
 
+	bRangeError = false;
+
 	// Do checks on nBase.
 	if((nBase < 0) || (nBase == 1) || (nBase > 36)){
 		if(ppEnd)
-			*ppEnd = (char*)pValue;
+			*ppEnd = (CharT*)pValue;
 		return 0;
 	}
 	else if(nBase == 0){
 		// Auto detect one of base 8, 10, or 16. 
+		const CharT cNext = (c == '0') ? PeekChar<bBounded>(p + 1, pValueEnd) : (CharT)0;
+
 		if(c != '0')
 			nBase = 10;
-		else if(*p == 'x' || *p == 'X')
+		else if((cNext == 'x') || (cNext == 'X'))
 			nBase = 16;
 		else
 			nBase = 8;
 	}
 	if(nBase == 16){
 		// If there is a leading '0x', then skip past it.
-		if((c == '0') && ((*p == 'x') || (*p == 'X'))) {
-			++p;
-			c = *p++;
+		if(c == '0') {
+			const CharT cNext = PeekChar<bBounded>(p + 1, pValueEnd);
+
+			if((cNext == 'x') || (cNext == 'X'))
+				p += 2;
 		}
 	}
 
-	// If nValue exceeds this, an integer overflow is reported.
-	#if (EA_PLATFORM_WORD_SIZE >= 8)
-		const uint64_t nMaxValue(UINT64_MAX / nBase);
-		const uint64_t nModValue(UINT64_MAX % nBase);
-	#else
-		// 32 bit platforms are very slow at doing 64 bit div and mod operations.
-		uint64_t nMaxValue;
-		uint64_t nModValue;
-
-		switch(nBase)
-		{
-			case 2:
-				nMaxValue = UINT64_C(9223372036854775807);
-				nModValue = 1;
-				break;
-			case 8:
-				nMaxValue = UINT64_C(2305843009213693951);
-				nModValue = 7;
-				break;
-			case 10:
-				nMaxValue = UINT64_C(1844674407370955161);
-				nModValue = 5;
-				break;
-			case 16:
-				nMaxValue = UINT64_C(1152921504606846975);
-				nModValue = 15;
-				break;
-			default:
-				nMaxValue = (UINT64_MAX / nBase);
-				nModValue = (UINT64_MAX % nBase);
-				break;
-		}
-	#endif
+	if((sizeof(CharT) == 1) && ((nBase == 10) || (nBase == 16)))
+		p = (const CharT*)ParseDigitWords<bBounded>((const char*)p, (const char*)pValueEnd, nBase, nValue, bDigitWasRead, bOverflowOccurred);
+	else
+	{
+		// If nValue exceeds this, an integer overflow is reported.
+		#if (EA_PLATFORM_WORD_SIZE >= 8)
+			const uint64_t nMaxValue(UINT64_MAX / nBase);
+			const uint64_t nModValue(UINT64_MAX % nBase);
+		#else
+			// 32 bit platforms are very slow at doing 64 bit div and mod operations.
+			uint64_t nMaxValue;
+			uint64_t nModValue;
 
-	for(unsigned nCurrentDigit; ; ){
-		if(Isdigit(c))
-			nCurrentDigit = (unsigned)(c - '0');
-		else if(Isalpha(c))
-			nCurrentDigit = (unsigned)(Toupper(c) - 'A' + 10);
-		else
-			break; // The digit is invalid.
+			switch(nBase)
+			{
+				case 2:
+					nMaxValue = UINT64_C(9223372036854775807);
+					nModValue = 1;
+					break;
+				case 8:
+					nMaxValue = UINT64_C(2305843009213693951);
+					nModValue = 7;
+					break;
+				case 10:
+					nMaxValue = UINT64_C(1844674407370955161);
+					nModValue = 5;
+					break;
+				case 16:
+					nMaxValue = UINT64_C(1152921504606846975);
+					nModValue = 15;
+					break;
+				default:
+					nMaxValue = (UINT64_MAX / nBase);
+					nModValue = (UINT64_MAX % nBase);
+					break;
+			}
+		#endif
 
-		if(nCurrentDigit >= (unsigned)nBase)
-			break; // The digit is invalid.
+		for(unsigned nCurrentDigit; ; ++p){
+			nCurrentDigit = DigitValue(PeekChar<bBounded>(p, pValueEnd));
 
-		bDigitWasRead = true;
+			if(nCurrentDigit >= (unsigned)nBase)
+				break; // The digit is invalid.
 
-		// Check for overflow.
-		if((nValue < nMaxValue) || ((nValue == nMaxValue) && ((uint64_t)nCurrentDigit <= nModValue)))
-			nValue = (nValue * nBase) + nCurrentDigit;
-		else
-			bOverflowOccurred = true; // Set the flag, but continue processing.
+			bDigitWasRead = true;
 
-		c = *p++;
+			// Check for overflow.
+			if((nValue < nMaxValue) || ((nValue == nMaxValue) && ((uint64_t)nCurrentDigit <= nModValue)))
+				nValue = (nValue * nBase) + nCurrentDigit;
+			else
+				bOverflowOccurred = true; // Set the flag, but continue processing.
+		}
 	}
 
-	--p; // Go back to the last character
-
 	if(!bDigitWasRead){
 		if(ppEnd)
 			p = pValue; // We'll assign 'ppEnd' below.
@@ -5016,426 +6575,343 @@ static uint64_t StrtoU64Common(const char* pValue, char** ppEnd, int nBase, bool
 		else
 			nValue = INT64_MAX;
 
-		errno = ERANGE; // The standard specifies that we set this value.
+		bRangeError = true;
 	}
 
 	if(ppEnd)
-		*ppEnd = (char*)p;
+		*ppEnd = (CharT*)p;
 
-	if(chSign == '-')
+	if((chSign == '-') && !(bUnsigned && bOverflowOccurred)) // Unsigned overflow results in UINT64_MAX regardless of the sign, as with strtoull.
 		nValue = -nValue;
 
 	return nValue;
 }
 
-static uint64_t StrtoU64Common(const char16_t* pValue, char16_t** ppEnd, int nBase, bool bUnsigned)
+
+template <bool bBounded, typename CharT>
+static uint64_t StrtoU64Common(const CharT* pValue, const CharT* pValueEnd, CharT** ppEnd, int nBase, bool bUnsigned)
 {
-	uint64_t        nValue(0);                 // Current value
-	const char16_t* p = pValue;                // Current position
-	char16_t        c;                         // Temp value
-	char16_t        chSign('+');               // One of either '+' or '-'
-	bool            bDigitWasRead(false);      // True if any digits were read.
-	bool            bOverflowOccurred(false);  // True if integer overflow occurred.
+	bool           bRangeError;
+	const uint64_t nValue = StrtoU64Core<bBounded>(pValue, pValueEnd, ppEnd, nBase, bUnsigned, bRangeError);
 
-	// Skip leading whitespace
-	c = *p++;
-	while(Isspace(c))
-		c = *p++;
+	if(bRangeError)
+	{
+		errno = ERANGE; // The standard specifies that we set this value.
 
-	// Check for sign.
-	if((c == '-') || (c == '+')){
-		chSign = c;
-		c = *p++;
+		if((sizeof(CharT) > 1) && EA::StdC::GetAssertionsEnabled()) // Only the char16_t and char32_t versions have asserted on this.
+			{ EA_FAIL_MSG("StrtoU64Common: Range underflow or overflow.");}
 	}
 
-	// Do checks on nBase.
-	if((nBase < 0) || (nBase == 1) || (nBase > 36)){
-		if(ppEnd)
-			*ppEnd = (char16_t*)pValue;
-		return 0;
-	}
-	else if(nBase == 0){
-		// Auto detect one of base 8, 10, or 16. 
-		if(c != '0')
-			nBase = 10;
-		else if(*p == 'x' || *p == 'X')
-			nBase = 16;
-		else
-			nBase = 8;
-	}
-	if(nBase == 16){
-		// If there is a leading '0x', then skip past it.
-		if((c == '0') && ((*p == 'x') || (*p == 'X'))) {
-			++p;
-			c = *p++;
-		}
-	}
+	return nValue;
+}
 
-	// If nValue exceeds this, an integer overflow is reported.
-	#if (EA_PLATFORM_WORD_SIZE >= 8)
-		const uint64_t nMaxValue(UINT64_MAX / nBase);
-		const uint64_t nModValue(UINT64_MAX % nBase);
-	#else
-		// 32 bit platforms are very slow at doing 64 bit div and mod operations.
-		uint64_t nMaxValue;
-		uint64_t nModValue;
 
-		switch(nBase)
-		{
-			case 2:
-				nMaxValue = UINT64_C(9223372036854775807);
-				nModValue = 1;
-				break;
-			case 8:
-				nMaxValue = UINT64_C(2305843009213693951);
-				nModValue = 7;
-				break;
-			case 10:
-				nMaxValue = UINT64_C(1844674407370955161);
-				nModValue = 5;
-				break;
-			case 16:
-				nMaxValue = UINT64_C(1152921504606846975);
-				nModValue = 15;
-				break;
-			default:
-				nMaxValue = (UINT64_MAX / nBase);
-				nModValue = (UINT64_MAX % nBase);
-				break;
-		}
-	#endif
+template <bool bBounded, typename CharT>
+static int32_t StrtoI32Common(const CharT* pValue, const CharT* pValueEnd, CharT** ppEnd, int nBase)
+{
+	int64_t val = (int64_t) StrtoU64Common<bBounded>(pValue, pValueEnd, ppEnd, nBase, false);
 
-	for(unsigned nCurrentDigit; ;){
-		if(Isdigit(c))
-			nCurrentDigit = (unsigned)(c - '0');
-		else if(Isalpha(c))
-			nCurrentDigit = (unsigned)(Toupper(c) - 'A' + 10);
-		else
-			break; // The digit is invalid.
+	if(val < INT32_MIN)
+	{
+		if(EA::StdC::GetAssertionsEnabled())
+			{ EA_FAIL_MSG("StrtoI32: Range underflow. You may need to use StrtoI64 instead."); }
+		errno = ERANGE;
+		return (int32_t)INT32_MIN;
+	}
 
-		if(nCurrentDigit >= (unsigned)nBase)
-			break; // The digit is invalid.
+	if(val > INT32_MAX)
+	{
+		if(EA::StdC::GetAssertionsEnabled())
+			{ EA_FAIL_MSG("StrtoI32: Range overflow. You may need to use StrtoU32 or StrtoU64 instead."); }
+		errno = ERANGE;
+		return INT32_MAX;
+	}
+	
+	return (int32_t) val;
+}
 
-		bDigitWasRead = true;
 
-		// Check for overflow.
-		if((nValue < nMaxValue) || ((nValue == nMaxValue) && ((uint64_t)nCurrentDigit <= nModValue)))
-			nValue = (nValue * nBase) + nCurrentDigit;
-		else
-			bOverflowOccurred = true; // Set the flag, but continue processing.
+template <bool bBounded, typename CharT>
+static uint32_t StrtoU32Common(const CharT* pValue, const CharT* pValueEnd, CharT** ppEnd, int nBase)
+{
+	uint64_t val = StrtoU64Common<bBounded>(pValue, pValueEnd, ppEnd, nBase, true);
 
-		c = *p++;
+	if(val > UINT32_MAX)
+	{
+		if(EA::StdC::GetAssertionsEnabled())
+			{ EA_FAIL_MSG("StrtoU32: Range overflow. You may need to use StrtoU64 instead."); }
+		errno = ERANGE;
+		return UINT32_MAX;
 	}
 
-	--p; // Go back to the last character
+	return (uint32_t)val;
+}
 
-	if(!bDigitWasRead){
-		if(ppEnd)
-			p = pValue; // We'll assign 'ppEnd' below.
-	}                                                                                  // INT64_MAX + 1 is the same thing as -INT64_MIN with most compilers.
-	else if(bOverflowOccurred || (!bUnsigned && (((chSign == '-') && (nValue > ((uint64_t)INT64_MAX + 1))) || ((chSign == '+') && (nValue > (uint64_t)INT64_MAX))))){
-		// Integer overflow occurred.
-		if(bUnsigned)
-			nValue = UINT64_MAX;
-		else if(chSign == '-')
-			nValue = (uint64_t)INT64_MAX + 1; // INT64_MAX + 1 is the same thing as -INT64_MIN with most compilers.
-		else
-			nValue = INT64_MAX;
 
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoU64Common: Range underflow or overflow.");}
-		errno = ERANGE; // The standard specifies that we set this value.
-	}
 
-	if(ppEnd)
-		*ppEnd = (char16_t*)p;
+EASTDC_API int32_t StrtoI32(const char* pValue, char** ppEnd, int nBase)
+{
+	return StrtoI32Common<false>(pValue, (const char*)NULL, ppEnd, nBase);
+}
 
-	if(chSign == '-')
-		nValue = -nValue;
+EASTDC_API int32_t StrtoI32(const char16_t* pValue, char16_t** ppEnd, int nBase)
+{
+	return StrtoI32Common<false>(pValue, (const char16_t*)NULL, ppEnd, nBase);
+}
 
-	return nValue;
+EASTDC_API int32_t StrtoI32(const char32_t* pValue, char32_t** ppEnd, int nBase)
+{
+	return StrtoI32Common<false>(pValue, (const char32_t*)NULL, ppEnd, nBase);
 }
 
-static uint64_t StrtoU64Common(const char32_t* pValue, char32_t** ppEnd, int nBase, bool bUnsigned)
+EASTDC_API int32_t StrtoI32(const char* pValue, size_t nLength, char** ppEnd, int nBase)
 {
-	uint64_t        nValue(0);                 // Current value
-	const char32_t* p = pValue;                // Current position
-	char32_t        c;                         // Temp value
-	char32_t        chSign('+');               // One of either '+' or '-'
-	bool            bDigitWasRead(false);      // True if any digits were read.
-	bool            bOverflowOccurred(false);  // True if integer overflow occurred.
+	return StrtoI32Common<true>(pValue, pValue + nLength, ppEnd, nBase);
+}
 
-	// Skip leading whitespace
-	c = *p++;
-	while(Isspace(c))
-		c = *p++;
+EASTDC_API int32_t StrtoI32(const char16_t* pValue, size_t nLength, char16_t** ppEnd, int nBase)
+{
+	return StrtoI32Common<true>(pValue, pValue + nLength, ppEnd, nBase);
+}
 
-	// Check for sign.
-	if((c == '-') || (c == '+')){
-		chSign = c;
-		c = *p++;
-	}
+EASTDC_API int32_t StrtoI32(const char32_t* pValue, size_t nLength, char32_t** ppEnd, int nBase)
+{
+	return StrtoI32Common<true>(pValue, pValue + nLength, ppEnd, nBase);
+}
 
-	// Do checks on nBase.
-	if((nBase < 0) || (nBase == 1) || (nBase > 36)){
-		if(ppEnd)
-			*ppEnd = (char32_t*)pValue;
-		return 0;
-	}
-	else if(nBase == 0){
-		// Auto detect one of base 8, 10, or 32. 
-		if(c != '0')
-			nBase = 10;
-		else if(*p == 'x' || *p == 'X')
-			nBase = 32;
-		else
-			nBase = 8;
-	}
-	if(nBase == 16){
-		// If there is a leading '0x', then skip past it.
-		if((c == '0') && ((*p == 'x') || (*p == 'X'))) {
-			++p;
-			c = *p++;
-		}
-	}
 
-	// If nValue exceeds this, an integer overflow is reported.
-	#if (EA_PLATFORM_WORD_SIZE >= 8)
-		const uint64_t nMaxValue(UINT64_MAX / nBase);
-		const uint64_t nModValue(UINT64_MAX % nBase);
-	#else
-		// 32 bit platforms are very slow at doing 64 bit div and mod operations.
-		uint64_t nMaxValue;
-		uint64_t nModValue;
 
-		switch(nBase)
-		{
-			case 2:
-				nMaxValue = UINT64_C(9223372036854775807);
-				nModValue = 1;
-				break;
-			case 8:
-				nMaxValue = UINT64_C(2305843009213693951);
-				nModValue = 7;
-				break;
-			case 10:
-				nMaxValue = UINT64_C(1844674407370955161);
-				nModValue = 5;
-				break;
-			case 16:
-				nMaxValue = UINT64_C(1152921504606846975);
-				nModValue = 15;
-				break;
-			default:
-				nMaxValue = (UINT64_MAX / nBase);
-				nModValue = (UINT64_MAX % nBase);
-				break;
-		}
-	#endif
+EASTDC_API uint32_t StrtoU32(const char* pValue, char** ppEnd, int nBase)
+{
+	return StrtoU32Common<false>(pValue, (const char*)NULL, ppEnd, nBase);
+}
 
-	for(unsigned nCurrentDigit; ;){
-		if(Isdigit(c))
-			nCurrentDigit = (unsigned)(c - '0');
-		else if(Isalpha(c))
-			nCurrentDigit = (unsigned)(Toupper(c) - 'A' + 10);
-		else
-			break; // The digit is invalid.
+EASTDC_API uint32_t StrtoU32(const char16_t* pValue, char16_t** ppEnd, int nBase)
+{
+	return StrtoU32Common<false>(pValue, (const char16_t*)NULL, ppEnd, nBase);
+}
 
-		if(nCurrentDigit >= (unsigned)nBase)
-			break; // The digit is invalid.
+EASTDC_API uint32_t StrtoU32(const char32_t* pValue, char32_t** ppEnd, int nBase)
+{
+	return StrtoU32Common<false>(pValue, (const char32_t*)NULL, ppEnd, nBase);
+}
 
-		bDigitWasRead = true;
+EASTDC_API uint32_t StrtoU32(const char* pValue, size_t nLength, char** ppEnd, int nBase)
+{
+	return StrtoU32Common<true>(pValue, pValue + nLength, ppEnd, nBase);
+}
 
-		// Check for overflow.
-		if((nValue < nMaxValue) || ((nValue == nMaxValue) && ((uint64_t)nCurrentDigit <= nModValue)))
-			nValue = (nValue * nBase) + nCurrentDigit;
-		else
-			bOverflowOccurred = true; // Set the flag, but continue processing.
+EASTDC_API uint32_t StrtoU32(const char16_t* pValue, size_t nLength, char16_t** ppEnd, int nBase)
+{
+	return StrtoU32Common<true>(pValue, pValue + nLength, ppEnd, nBase);
+}
 
-		c = *p++;
-	}
+EASTDC_API uint32_t StrtoU32(const char32_t* pValue, size_t nLength, char32_t** ppEnd, int nBase)
+{
+	return StrtoU32Common<true>(pValue, pValue + nLength, ppEnd, nBase);
+}
 
-	--p; // Go back to the last character
 
-	if(!bDigitWasRead){
-		if(ppEnd)
-			p = pValue; // We'll assign 'ppEnd' below.
-	}                                                                                  // INT64_MAX + 1 is the same thing as -INT64_MIN with most compilers.
-	else if(bOverflowOccurred || (!bUnsigned && (((chSign == '-') && (nValue > ((uint64_t)INT64_MAX + 1))) || ((chSign == '+') && (nValue > (uint64_t)INT64_MAX))))){
-		// Integer overflow occurred.
-		if(bUnsigned)
-			nValue = UINT64_MAX;
-		else if(chSign == '-')
-			nValue = (uint64_t)INT64_MAX + 1; // INT64_MAX + 1 is the same thing as -INT64_MIN with most compilers.
-		else
-			nValue = INT64_MAX;
 
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoU64Common: Range underflow or overflow.");}
-		errno = ERANGE; // The standard specifies that we set this value.
-	}
+EASTDC_API int64_t StrtoI64(const char* pValue, char** ppEnd, int nBase)
+{
+	return (int64_t)StrtoU64Common<false>(pValue, (const char*)NULL, ppEnd, nBase, false);
+}
 
-	if(ppEnd)
-		*ppEnd = (char32_t*)p;
+EASTDC_API int64_t StrtoI64(const char16_t* pValue, char16_t** ppEnd, int nBase)
+{
+	return (int64_t)StrtoU64Common<false>(pValue, (const char16_t*)NULL, ppEnd, nBase, false);
+}
+
+EASTDC_API int64_t StrtoI64(const char32_t* pValue, char32_t** ppEnd, int nBase)
+{
+	return (int64_t)StrtoU64Common<false>(pValue, (const char32_t*)NULL, ppEnd, nBase, false);
+}
+
+EASTDC_API int64_t StrtoI64(const char* pValue, size_t nLength, char** ppEnd, int nBase)
+{
+	return (int64_t)StrtoU64Common<true>(pValue, pValue + nLength, ppEnd, nBase, false);
+}
 
-	if(chSign == '-')
-		nValue = -nValue;
+EASTDC_API int64_t StrtoI64(const char16_t* pValue, size_t nLength, char16_t** ppEnd, int nBase)
+{
+	return (int64_t)StrtoU64Common<true>(pValue, pValue + nLength, ppEnd, nBase, false);
+}
 
-	return nValue;
+EASTDC_API int64_t StrtoI64(const char32_t* pValue, size_t nLength, char32_t** ppEnd, int nBase)
+{
+	return (int64_t)StrtoU64Common<true>(pValue, pValue + nLength, ppEnd, nBase, false);
 }
 
 
 
-EASTDC_API int32_t StrtoI32(const char* pValue, char** ppEnd, int nBase)
+EASTDC_API uint64_t StrtoU64(const char* pValue, char** ppEnd, int nBase)
 {
-	int64_t val = (int64_t) StrtoU64Common(pValue, ppEnd, nBase, false);
-
-	if(val < INT32_MIN)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoI32: Range underflow. You may need to use StrtoI64 instead."); }
-		errno = ERANGE;
-		return (int32_t)INT32_MIN;
-	}
+	return StrtoU64Common<false>(pValue, (const char*)NULL, ppEnd, nBase, true);
+}
 
-	if(val > INT32_MAX)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoI32: Range overflow. You may need to use StrtoU32 or StrtoU64 instead."); }
-		errno = ERANGE;
-		return INT32_MAX;
-	}
-	
-	return (int32_t) val;
+EASTDC_API uint64_t StrtoU64(const char16_t* pValue, char16_t** ppEnd, int nBase)
+{
+	return StrtoU64Common<false>(pValue, (const char16_t*)NULL, ppEnd, nBase, true);
 }
 
-EASTDC_API int32_t StrtoI32(const char16_t* pValue, char16_t** ppEnd, int nBase)
+EASTDC_API uint64_t StrtoU64(const char32_t* pValue, char32_t** ppEnd, int nBase)
 {
-	int64_t val = (int64_t) StrtoU64Common(pValue, ppEnd, nBase, false);
+	return StrtoU64Common<false>(pValue, (const char32_t*)NULL, ppEnd, nBase, true);
+}
 
-	if(val < INT32_MIN)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoI32: Range underflow. You may need to use StrtoI64 instead."); }
-		errno = ERANGE;
-		return (int32_t)INT32_MIN;
-	}
+EASTDC_API uint64_t StrtoU64(const char* pValue, size_t nLength, char** ppEnd, int nBase)
+{
+	return StrtoU64Common<true>(pValue, pValue + nLength, ppEnd, nBase, true);
+}
 
-	if(val > INT32_MAX)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoI32: Range overflow. You may need to use StrtoU32 or StrtoU64 instead."); }
-		errno = ERANGE;
-		return INT32_MAX;
-	}
-	
-	return (int32_t) val;
+EASTDC_API uint64_t StrtoU64(const char16_t* pValue, size_t nLength, char16_t** ppEnd, int nBase)
+{
+	return StrtoU64Common<true>(pValue, pValue + nLength, ppEnd, nBase, true);
 }
 
-EASTDC_API int32_t StrtoI32(const char32_t* pValue, char32_t** ppEnd, int nBase)
+EASTDC_API uint64_t StrtoU64(const char32_t* pValue, size_t nLength, char32_t** ppEnd, int nBase)
 {
-	int64_t val = (int64_t) StrtoU64Common(pValue, ppEnd, nBase, false);
+	return StrtoU64Common<true>(pValue, pValue + nLength, ppEnd, nBase, true);
+}
 
-	if(val < INT32_MIN)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoI32: Range underflow. You may need to use StrtoI64 instead."); }
-		errno = ERANGE;
-		return (int32_t)INT32_MIN;
-	}
 
-	if(val > INT32_MAX)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoI32: Range overflow. You may need to use StrtoU32 or StrtoU64 instead."); }
-		errno = ERANGE;
-		return INT32_MAX;
-	}
-	
-	return (int32_t) val;
+
+///////////////////////////////////////////////////////////////////////////////
+// ParseInt32Array / ParseInt64Array / ParseFloatArray / ParseDoubleArray
+//
+// Each field is converted by the same code as StrtoI64 and StrtodEnglish, 
+// with the text bounded by its length instead of a terminating 0 char, and 
+// without setting errno. The number conversion itself finds the end of the 
+// field, so we don't scan ahead for the delimiter, and the char after the 
+// number is tested against the delimiter set with a single bitmap lookup.
+
+static EA_FORCE_INLINE bool IsArraySpace(char c)
+{
+	return (c == ' ') || ((unsigned)(c - '\t') <= (unsigned)('\r' - '\t')); // ' ', '\t', '\n', '\v', '\f', '\r'
 }
 
 
+static bool ParseArrayInt32(const char* p, const char* pEnd, const char*& pNumberEnd, int32_t& nValue)
+{
+	bool          bRangeError;
+	const int64_t nValue64 = (int64_t)StrtoU64Core<true>(p, pEnd, (char**)&pNumberEnd, 10, false, bRangeError);
+
+	nValue = (int32_t)nValue64;
+	return (pNumberEnd != p) && !bRangeError && (nValue64 >= INT32_MIN) && (nValue64 <= INT32_MAX);
+}
 
 
-EASTDC_API uint32_t StrtoU32(const char* pValue, char** ppEnd, int nBase)
+static bool ParseArrayInt64(const char* p, const char* pEnd, const char*& pNumberEnd, int64_t& nValue)
 {
-	uint64_t val = StrtoU64Common(pValue, ppEnd, nBase, true);
+	bool bRangeError;
 
-	if(val > UINT32_MAX)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoU32: Range overflow. You may need to use StrtoU64 instead."); }
-		errno = ERANGE;
-		return UINT32_MAX;
-	}
+	nValue = (int64_t)StrtoU64Core<true>(p, pEnd, (char**)&pNumberEnd, 10, false, bRangeError);
+	return (pNumberEnd != p) && !bRangeError;
+}
 
-	return (uint32_t)val;
+
+static bool ParseArrayDouble(const char* p, const char* pEnd, const char*& pNumberEnd, double& dValue)
+{
+	bool bRangeError;
+
+	dValue = StrtodEnglishCore<true>(p, pEnd, (char**)&pNumberEnd, bRangeError);
+	return (pNumberEnd != p) && !(bRangeError && ((dValue == HUGE_VAL) || (dValue == -HUGE_VAL))); // Underflow to zero isn't an error.
 }
 
-EASTDC_API uint32_t StrtoU32(const char16_t* pValue, char16_t** ppEnd, int nBase)
+
+static bool ParseArrayFloat(const char* p, const char* pEnd, const char*& pNumberEnd, float& fValue)
 {
-	uint64_t val = StrtoU64Common(pValue, ppEnd, nBase, true);
+	// Doubles below FLT_MAX + 2^103 (half a float ulp above FLT_MAX) round to FLT_MAX, and those at or above it round to infinity.
+	const double kFloatOverflowThreshold = 3.4028235677973366e+38;
+	double       dValue;
 
-	if(val > UINT32_MAX)
-	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoU32: Range overflow. You may need to use StrtoU64 instead."); }
-		errno = ERANGE;
-		return UINT32_MAX;
-	}
+	if(!ParseArrayDouble(p, pEnd, pNumberEnd, dValue) || (dValue >= kFloatOverflowThreshold) || (dValue <= -kFloatOverflowThreshold))
+		return false;
 
-	return (uint32_t)val;
+	fValue = (float)dValue;
+	return true;
 }
 
-EASTDC_API uint32_t StrtoU32(const char32_t* pValue, char32_t** ppEnd, int nBase)
+
+template <typename T, bool (*ParseValue)(const char*, const char*, const char*&, T&)>
+static size_t ParseNumberArray(const char* pText, size_t nTextLength, const char* pDelimiters, T* pValues, size_t nValueCapacity, size_t& nTextPosition)
 {
-	uint64_t val = StrtoU64Common(pValue, ppEnd, nBase, true);
+	const CharSet delimiterSet(pDelimiters);
+	bool          bSpaceIsDelimiter = false;
 
-	if(val > UINT32_MAX)
+	for(const char* pDelimiter = pDelimiters; *pDelimiter; ++pDelimiter)
+		bSpaceIsDelimiter |= IsArraySpace(*pDelimiter);
+
+	if(nTextLength == kSizeTypeUnset)
+		nTextLength = Strlen(pText);
+
+	const char* const pTextEnd = pText + nTextLength;
+	const char*       p = pText;
+	size_t            nCount = 0;
+
+	for(;;)
 	{
-		if(EA::StdC::GetAssertionsEnabled())
-			{ EA_FAIL_MSG("StrtoU32: Range overflow. You may need to use StrtoU64 instead."); }
-		errno = ERANGE;
-		return UINT32_MAX;
-	}
+		while((p < pTextEnd) && IsArraySpace(*p)) // Spaces around a field are ignored.
+			++p;
 
-	return (uint32_t)val;
-}
+		if((p == pTextEnd) || (nCount == nValueCapacity))
+			break;
 
+		const char* const pField = p;
+		T                 value;
 
+		if(!ParseValue(pField, pTextEnd, p, value))
+			p = NULL;
+		else
+		{
+			// The number must be followed by the end of the text, a delimiter, or spaces if spaces are delimiters.
+			const char* const pNumberEnd = p;
 
+			while((p < pTextEnd) && IsArraySpace(*p))
+				++p;
 
-EASTDC_API int64_t StrtoI64(const char* pString, char** ppStringEnd, int nBase)
-{
-	return (int64_t)StrtoU64Common(pString, ppStringEnd, nBase, false);
-}
+			if(p < pTextEnd)
+			{
+				if(!IsArraySpace(*p) && delimiterSet.Contains(*p))
+					++p;
+				else if(!bSpaceIsDelimiter || (p == pNumberEnd))
+					p = NULL;
+			}
+		}
 
-EASTDC_API int64_t StrtoI64(const char16_t* pString, char16_t** ppStringEnd, int nBase)
-{
-	return (int64_t)StrtoU64Common(pString, ppStringEnd, nBase, false);
-}
+		if(!p) // If the field isn't a valid number...
+		{
+			nTextPosition = (size_t)(pField - pText);
+			return nCount;
+		}
 
-EASTDC_API int64_t StrtoI64(const char32_t* pString, char32_t** ppStringEnd, int nBase)
-{
-	return (int64_t)StrtoU64Common(pString, ppStringEnd, nBase, false);
+		pValues[nCount++] = value;
+	}
+
+	nTextPosition = (size_t)(p - pText);
+	return nCount;
 }
 
 
+EASTDC_API size_t ParseInt32Array(const char* pText, size_t nTextLength, const char* pDelimiters, int32_t* pValues, size_t nValueCapacity, size_t& nTextPosition)
+{
+	return ParseNumberArray<int32_t, ParseArrayInt32>(pText, nTextLength, pDelimiters, pValues, nValueCapacity, nTextPosition);
+}
 
-EASTDC_API uint64_t StrtoU64(const char* pString, char** ppStringEnd, int nBase)
+EASTDC_API size_t ParseInt64Array(const char* pText, size_t nTextLength, const char* pDelimiters, int64_t* pValues, size_t nValueCapacity, size_t& nTextPosition)
 {
-	return StrtoU64Common(pString, ppStringEnd, nBase, true);
+	return ParseNumberArray<int64_t, ParseArrayInt64>(pText, nTextLength, pDelimiters, pValues, nValueCapacity, nTextPosition);
 }
 
-EASTDC_API uint64_t StrtoU64(const char16_t* pString, char16_t** ppStringEnd, int nBase)
+EASTDC_API size_t ParseFloatArray(const char* pText, size_t nTextLength, const char* pDelimiters, float* pValues, size_t nValueCapacity, size_t& nTextPosition)
 {
-	return StrtoU64Common(pString, ppStringEnd, nBase, true);
+	return ParseNumberArray<float, ParseArrayFloat>(pText, nTextLength, pDelimiters, pValues, nValueCapacity, nTextPosition);
 }
 
-EASTDC_API uint64_t StrtoU64(const char32_t* pString, char32_t** ppStringEnd, int nBase)
+EASTDC_API size_t ParseDoubleArray(const char* pText, size_t nTextLength, const char* pDelimiters, double* pValues, size_t nValueCapacity, size_t& nTextPosition)
 {
-	return StrtoU64Common(pString, ppStringEnd, nBase, true);
+	return ParseNumberArray<double, ParseArrayDouble>(pText, nTextLength, pDelimiters, pValues, nValueCapacity, nTextPosition);
 }
 
 
@@ -5929,6 +7405,621 @@ EASTDC_API char32_t* FtoaEnglish(double dValue, char32_t* pResult, int nResultCa
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// FtoaShortest
+//
+// DoubleToShortestDecimal is an implementation of the Ryu algorithm. See 
+// Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018, which has 
+// the proofs of the bounds the code below relies on.
+//
+namespace Internal
+{
+	// 5^i * 2^(125 - bits(5^i)) rounded down, for i in [0, 326). Used for negative binary exponents.
+	static const uint64_t kDoublePow5Split[326][2] =
+	{
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1000000000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1400000000000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1900000000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1f40000000000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1388000000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x186a000000000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1e84800000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1312d00000000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x17d7840000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1dcd650000000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x12a05f2000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x174876e800000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1d1a94a200000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x12309ce540000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x16bcc41e90000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1c6bf52634000000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x11c37937e0800000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x16345785d8a00000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1bc16d674ec80000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1158e460913d0000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x15af1d78b58c4000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1b1ae4d6e2ef5000) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x10f0cf064dd59200) }, { UINT64_C(0x0000000000000000), UINT64_C(0x152d02c7e14af680) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x1a784379d99db420) }, { UINT64_C(0x0000000000000000), UINT64_C(0x108b2a2c28029094) },
+		{ UINT64_C(0x0000000000000000), UINT64_C(0x14adf4b7320334b9) }, { UINT64_C(0x4000000000000000), UINT64_C(0x19d971e4fe8401e7) },
+		{ UINT64_C(0x8800000000000000), UINT64_C(0x1027e72f1f128130) }, { UINT64_C(0xaa00000000000000), UINT64_C(0x1431e0fae6d7217c) },
+		{ UINT64_C(0xd480000000000000), UINT64_C(0x193e5939a08ce9db) }, { UINT64_C(0xc9a0000000000000), UINT64_C(0x1f8def8808b02452) },
+		{ UINT64_C(0xbe04000000000000), UINT64_C(0x13b8b5b5056e16b3) }, { UINT64_C(0xad85000000000000), UINT64_C(0x18a6e32246c99c60) },
+		{ UINT64_C(0xd8e6400000000000), UINT64_C(0x1ed09bead87c0378) }, { UINT64_C(0x878fe80000000000), UINT64_C(0x13426172c74d822b) },
+		{ UINT64_C(0x6973e20000000000), UINT64_C(0x1812f9cf7920e2b6) }, { UINT64_C(0x03d0da8000000000), UINT64_C(0x1e17b84357691b64) },
+		{ UINT64_C(0x8262889000000000), UINT64_C(0x12ced32a16a1b11e) }, { UINT64_C(0x22fb2ab400000000), UINT64_C(0x178287f49c4a1d66) },
+		{ UINT64_C(0xabb9f56100000000), UINT64_C(0x1d6329f1c35ca4bf) }, { UINT64_C(0xcb54395ca0000000), UINT64_C(0x125dfa371a19e6f7) },
+		{ UINT64_C(0xbe2947b3c8000000), UINT64_C(0x16f578c4e0a060b5) }, { UINT64_C(0x2db399a0ba000000), UINT64_C(0x1cb2d6f618c878e3) },
+		{ UINT64_C(0xfc90400474400000), UINT64_C(0x11efc659cf7d4b8d) }, { UINT64_C(0x7bb4500591500000), UINT64_C(0x166bb7f0435c9e71) },
+		{ UINT64_C(0xdaa16406f5a40000), UINT64_C(0x1c06a5ec5433c60d) }, { UINT64_C(0xa8a4de8459868000), UINT64_C(0x118427b3b4a05bc8) },
+		{ UINT64_C(0xd2ce16256fe82000), UINT64_C(0x15e531a0a1c872ba) }, { UINT64_C(0x87819baecbe22800), UINT64_C(0x1b5e7e08ca3a8f69) },
+		{ UINT64_C(0xf4b1014d3f6d5900), UINT64_C(0x111b0ec57e6499a1) }, { UINT64_C(0x71dd41a08f48af40), UINT64_C(0x1561d276ddfdc00a) },
+		{ UINT64_C(0x0e549208b31adb10), UINT64_C(0x1aba4714957d300d) }, { UINT64_C(0x28f4db456ff0c8ea), UINT64_C(0x10b46c6cdd6e3e08) },
+		{ UINT64_C(0x33321216cbecfb24), UINT64_C(0x14e1878814c9cd8a) }, { UINT64_C(0xbffe969c7ee839ed), UINT64_C(0x1a19e96a19fc40ec) },
+		{ UINT64_C(0xf7ff1e21cf512434), UINT64_C(0x105031e2503da893) }, { UINT64_C(0xf5fee5aa43256d41), UINT64_C(0x14643e5ae44d12b8) },
+		{ UINT64_C(0x337e9f14d3eec892), UINT64_C(0x197d4df19d605767) }, { UINT64_C(0x005e46da08ea7ab6), UINT64_C(0x1fdca16e04b86d41) },
+		{ UINT64_C(0xa03aec4845928cb2), UINT64_C(0x13e9e4e4c2f34448) }, { UINT64_C(0xc849a75a56f72fde), UINT64_C(0x18e45e1df3b0155a) },
+		{ UINT64_C(0x7a5c1130ecb4fbd6), UINT64_C(0x1f1d75a5709c1ab1) }, { UINT64_C(0xec798abe93f11d65), UINT64_C(0x13726987666190ae) },
+		{ UINT64_C(0xa797ed6e38ed64bf), UINT64_C(0x184f03e93ff9f4da) }, { UINT64_C(0x517de8c9c728bdef), UINT64_C(0x1e62c4e38ff87211) },
+		{ UINT64_C(0xd2eeb17e1c7976b5), UINT64_C(0x12fdbb0e39fb474a) }, { UINT64_C(0x87aa5ddda397d462), UINT64_C(0x17bd29d1c87a191d) },
+		{ UINT64_C(0xe994f5550c7dc97b), UINT64_C(0x1dac74463a989f64) }, { UINT64_C(0x11fd195527ce9ded), UINT64_C(0x128bc8abe49f639f) },
+		{ UINT64_C(0xd67c5faa71c24568), UINT64_C(0x172ebad6ddc73c86) }, { UINT64_C(0x8c1b77950e32d6c2), UINT64_C(0x1cfa698c95390ba8) },
+		{ UINT64_C(0x57912abd28dfc639), UINT64_C(0x121c81f7dd43a749) }, { UINT64_C(0xad75756c7317b7c8), UINT64_C(0x16a3a275d494911b) },
+		{ UINT64_C(0x98d2d2c78fdda5ba), UINT64_C(0x1c4c8b1349b9b562) }, { UINT64_C(0x9f83c3bcb9ea8794), UINT64_C(0x11afd6ec0e14115d) },
+		{ UINT64_C(0x0764b4abe8652979), UINT64_C(0x161bcca7119915b5) }, { UINT64_C(0x493de1d6e27e73d7), UINT64_C(0x1ba2bfd0d5ff5b22) },
+		{ UINT64_C(0x6dc6ad264d8f0866), UINT64_C(0x1145b7e285bf98f5) }, { UINT64_C(0xc938586fe0f2ca80), UINT64_C(0x159725db272f7f32) },
+		{ UINT64_C(0x7b866e8bd92f7d20), UINT64_C(0x1afcef51f0fb5eff) }, { UINT64_C(0xad34051767bdae34), UINT64_C(0x10de1593369d1b5f) },
+		{ UINT64_C(0x9881065d41ad19c1), UINT64_C(0x15159af804446237) }, { UINT64_C(0x7ea147f492186032), UINT64_C(0x1a5b01b605557ac5) },
+		{ UINT64_C(0x6f24ccf8db4f3c1f), UINT64_C(0x1078e111c3556cbb) }, { UINT64_C(0x4aee003712230b27), UINT64_C(0x14971956342ac7ea) },
+		{ UINT64_C(0xdda98044d6abcdf0), UINT64_C(0x19bcdfabc13579e4) }, { UINT64_C(0x0a89f02b062b60b6), UINT64_C(0x10160bcb58c16c2f) },
+		{ UINT64_C(0xcd2c6c35c7b638e4), UINT64_C(0x141b8ebe2ef1c73a) }, { UINT64_C(0x8077874339a3c71d), UINT64_C(0x1922726dbaae3909) },
+		{ UINT64_C(0xe0956914080cb8e4), UINT64_C(0x1f6b0f092959c74b) }, { UINT64_C(0x6c5d61ac8507f38e), UINT64_C(0x13a2e965b9d81c8f) },
+		{ UINT64_C(0x4774ba17a649f072), UINT64_C(0x188ba3bf284e23b3) }, { UINT64_C(0x1951e89d8fdc6c8f), UINT64_C(0x1eae8caef261aca0) },
+		{ UINT64_C(0x0fd3316279e9c3d9), UINT64_C(0x132d17ed577d0be4) }, { UINT64_C(0x13c7fdbb186434cf), UINT64_C(0x17f85de8ad5c4edd) },
+		{ UINT64_C(0x58b9fd29de7d4203), UINT64_C(0x1df67562d8b36294) }, { UINT64_C(0xb7743e3a2b0e4942), UINT64_C(0x12ba095dc7701d9c) },
+		{ UINT64_C(0xe5514dc8b5d1db92), UINT64_C(0x17688bb5394c2503) }, { UINT64_C(0xdea5a13ae3465277), UINT64_C(0x1d42aea2879f2e44) },
+		{ UINT64_C(0x0b2784c4ce0bf38a), UINT64_C(0x1249ad2594c37ceb) }, { UINT64_C(0xcdf165f6018ef06d), UINT64_C(0x16dc186ef9f45c25) },
+		{ UINT64_C(0x416dbf7381f2ac88), UINT64_C(0x1c931e8ab871732f) }, { UINT64_C(0x88e497a83137abd5), UINT64_C(0x11dbf316b346e7fd) },
+		{ UINT64_C(0xeb1dbd923d8596ca), UINT64_C(0x1652efdc6018a1fc) }, { UINT64_C(0x25e52cf6cce6fc7d), UINT64_C(0x1be7abd3781eca7c) },
+		{ UINT64_C(0x97af3c1a40105dce), UINT64_C(0x1170cb642b133e8d) }, { UINT64_C(0xfd9b0b20d0147542), UINT64_C(0x15ccfe3d35d80e30) },
+		{ UINT64_C(0x3d01cde904199292), UINT64_C(0x1b403dcc834e11bd) }, { UINT64_C(0x462120b1a28ffb9b), UINT64_C(0x1108269fd210cb16) },
+		{ UINT64_C(0xd7a968de0b33fa82), UINT64_C(0x154a3047c694fddb) }, { UINT64_C(0xcd93c3158e00f923), UINT64_C(0x1a9cbc59b83a3d52) },
+		{ UINT64_C(0xc07c59ed78c09bb6), UINT64_C(0x10a1f5b813246653) }, { UINT64_C(0xb09b7068d6f0c2a3), UINT64_C(0x14ca732617ed7fe8) },
+		{ UINT64_C(0xdcc24c830cacf34c), UINT64_C(0x19fd0fef9de8dfe2) }, { UINT64_C(0xc9f96fd1e7ec180f), UINT64_C(0x103e29f5c2b18bed) },
+		{ UINT64_C(0x3c77cbc661e71e13), UINT64_C(0x144db473335deee9) }, { UINT64_C(0x8b95beb7fa60e598), UINT64_C(0x1961219000356aa3) },
+		{ UINT64_C(0x6e7b2e65f8f91efe), UINT64_C(0x1fb969f40042c54c) }, { UINT64_C(0xc50cfcffbb9bb35f), UINT64_C(0x13d3e2388029bb4f) },
+		{ UINT64_C(0xb6503c3faa82a037), UINT64_C(0x18c8dac6a0342a23) }, { UINT64_C(0xa3e44b4f95234844), UINT64_C(0x1efb1178484134ac) },
+		{ UINT64_C(0xe66eaf11bd360d2b), UINT64_C(0x135ceaeb2d28c0eb) }, { UINT64_C(0xe00a5ad62c839075), UINT64_C(0x183425a5f872f126) },
+		{ UINT64_C(0x980cf18bb7a47493), UINT64_C(0x1e412f0f768fad70) }, { UINT64_C(0x5f0816f752c6c8dc), UINT64_C(0x12e8bd69aa19cc66) },
+		{ UINT64_C(0xf6ca1cb527787b13), UINT64_C(0x17a2ecc414a03f7f) }, { UINT64_C(0xf47ca3e2715699d7), UINT64_C(0x1d8ba7f519c84f5f) },
+		{ UINT64_C(0xf8cde66d86d62026), UINT64_C(0x127748f9301d319b) }, { UINT64_C(0xf7016008e88ba830), UINT64_C(0x17151b377c247e02) },
+		{ UINT64_C(0xb4c1b80b22ae923c), UINT64_C(0x1cda62055b2d9d83) }, { UINT64_C(0x50f91306f5ad1b65), UINT64_C(0x12087d4358fc8272) },
+		{ UINT64_C(0xe53757c8b318623f), UINT64_C(0x168a9c942f3ba30e) }, { UINT64_C(0x9e852dbadfde7acf), UINT64_C(0x1c2d43b93b0a8bd2) },
+		{ UINT64_C(0xa3133c94cbeb0cc1), UINT64_C(0x119c4a53c4e69763) }, { UINT64_C(0x8bd80bb9fee5cff1), UINT64_C(0x16035ce8b6203d3c) },
+		{ UINT64_C(0xaece0ea87e9f43ee), UINT64_C(0x1b843422e3a84c8b) }, { UINT64_C(0x4d40c9294f238a75), UINT64_C(0x1132a095ce492fd7) },
+		{ UINT64_C(0x2090fb73a2ec6d12), UINT64_C(0x157f48bb41db7bcd) }, { UINT64_C(0x68b53a508ba78856), UINT64_C(0x1adf1aea12525ac0) },
+		{ UINT64_C(0x417144725748b536), UINT64_C(0x10cb70d24b7378b8) }, { UINT64_C(0x51cd958eed1ae283), UINT64_C(0x14fe4d06de5056e6) },
+		{ UINT64_C(0xe640faf2a8619b24), UINT64_C(0x1a3de04895e46c9f) }, { UINT64_C(0xefe89cd7a93d00f7), UINT64_C(0x1066ac2d5daec3e3) },
+		{ UINT64_C(0xebe2c40d938c4134), UINT64_C(0x14805738b51a74dc) }, { UINT64_C(0x26db7510f86f5181), UINT64_C(0x19a06d06e2611214) },
+		{ UINT64_C(0x9849292a9b4592f1), UINT64_C(0x100444244d7cab4c) }, { UINT64_C(0xbe5b73754216f7ad), UINT64_C(0x1405552d60dbd61f) },
+		{ UINT64_C(0xadf25052929cb598), UINT64_C(0x1906aa78b912cba7) }, { UINT64_C(0x996ee4673743e2ff), UINT64_C(0x1f485516e7577e91) },
+		{ UINT64_C(0xffe54ec0828a6ddf), UINT64_C(0x138d352e5096af1a) }, { UINT64_C(0xbfdea270a32d0957), UINT64_C(0x18708279e4bc5ae1) },
+		{ UINT64_C(0x2fd64b0ccbf84bad), UINT64_C(0x1e8ca3185deb719a) }, { UINT64_C(0x5de5eee7ff7b2f4c), UINT64_C(0x1317e5ef3ab32700) },
+		{ UINT64_C(0x755f6aa1ff59fb1f), UINT64_C(0x17dddf6b095ff0c0) }, { UINT64_C(0x92b7454a7f3079e7), UINT64_C(0x1dd55745cbb7ecf0) },
+		{ UINT64_C(0x5bb28b4e8f7e4c30), UINT64_C(0x12a5568b9f52f416) }, { UINT64_C(0xf29f2e22335ddf3c), UINT64_C(0x174eac2e8727b11b) },
+		{ UINT64_C(0xef46f9aac035570b), UINT64_C(0x1d22573a28f19d62) }, { UINT64_C(0xd58c5c0ab8215667), UINT64_C(0x123576845997025d) },
+		{ UINT64_C(0x4aef730d6629ac01), UINT64_C(0x16c2d4256ffcc2f5) }, { UINT64_C(0x9dab4fd0bfb41701), UINT64_C(0x1c73892ecbfbf3b2) },
+		{ UINT64_C(0xa28b11e277d08e60), UINT64_C(0x11c835bd3f7d784f) }, { UINT64_C(0x8b2dd65b15c4b1f9), UINT64_C(0x163a432c8f5cd663) },
+		{ UINT64_C(0x6df94bf1db35de77), UINT64_C(0x1bc8d3f7b3340bfc) }, { UINT64_C(0xc4bbcf772901ab0a), UINT64_C(0x115d847ad000877d) },
+		{ UINT64_C(0x35eac354f34215cd), UINT64_C(0x15b4e5998400a95d) }, { UINT64_C(0x8365742a30129b40), UINT64_C(0x1b221effe500d3b4) },
+		{ UINT64_C(0xd21f689a5e0ba108), UINT64_C(0x10f5535fef208450) }, { UINT64_C(0x06a742c0f58e894a), UINT64_C(0x1532a837eae8a565) },
+		{ UINT64_C(0x4851137132f22b9d), UINT64_C(0x1a7f5245e5a2cebe) }, { UINT64_C(0xed32ac26bfd75b42), UINT64_C(0x108f936baf85c136) },
+		{ UINT64_C(0xa87f57306fcd3212), UINT64_C(0x14b378469b673184) }, { UINT64_C(0xd29f2cfc8bc07e97), UINT64_C(0x19e056584240fde5) },
+		{ UINT64_C(0xa3a37c1dd7584f1e), UINT64_C(0x102c35f729689eaf) }, { UINT64_C(0x8c8c5b254d2e62e6), UINT64_C(0x14374374f3c2c65b) },
+		{ UINT64_C(0x6faf71eea079fb9f), UINT64_C(0x1945145230b377f2) }, { UINT64_C(0x0b9b4e6a48987a87), UINT64_C(0x1f965966bce055ef) },
+		{ UINT64_C(0x674111026d5f4c94), UINT64_C(0x13bdf7e0360c35b5) }, { UINT64_C(0xc111554308b71fba), UINT64_C(0x18ad75d8438f4322) },
+		{ UINT64_C(0x7155aa93cae4e7a8), UINT64_C(0x1ed8d34e547313eb) }, { UINT64_C(0x26d58a9c5ecf10c9), UINT64_C(0x13478410f4c7ec73) },
+		{ UINT64_C(0xf08aed437682d4fb), UINT64_C(0x1819651531f9e78f) }, { UINT64_C(0xecada89454238a3a), UINT64_C(0x1e1fbe5a7e786173) },
+		{ UINT64_C(0x73ec895cb4963664), UINT64_C(0x12d3d6f88f0b3ce8) }, { UINT64_C(0x90e7abb3e1bbc3fd), UINT64_C(0x1788ccb6b2ce0c22) },
+		{ UINT64_C(0x352196a0da2ab4fd), UINT64_C(0x1d6affe45f818f2b) }, { UINT64_C(0x0134fe24885ab11e), UINT64_C(0x1262dfeebbb0f97b) },
+		{ UINT64_C(0xc1823dadaa715d65), UINT64_C(0x16fb97ea6a9d37d9) }, { UINT64_C(0x31e2cd19150db4bf), UINT64_C(0x1cba7de5054485d0) },
+		{ UINT64_C(0x1f2dc02fad2890f7), UINT64_C(0x11f48eaf234ad3a2) }, { UINT64_C(0xa6f9303b9872b535), UINT64_C(0x1671b25aec1d888a) },
+		{ UINT64_C(0x50b77c4a7e8f6282), UINT64_C(0x1c0e1ef1a724eaad) }, { UINT64_C(0x5272adae8f199d91), UINT64_C(0x1188d357087712ac) },
+		{ UINT64_C(0x670f591a32e004f6), UINT64_C(0x15eb082cca94d757) }, { UINT64_C(0x40d32f60bf980633), UINT64_C(0x1b65ca37fd3a0d2d) },
+		{ UINT64_C(0x4883fd9c77bf03e0), UINT64_C(0x111f9e62fe44483c) }, { UINT64_C(0x5aa4fd0395aec4d8), UINT64_C(0x156785fbbdd55a4b) },
+		{ UINT64_C(0x314e3c447b1a760e), UINT64_C(0x1ac1677aad4ab0de) }, { UINT64_C(0xded0e5aaccf089c9), UINT64_C(0x10b8e0acac4eae8a) },
+		{ UINT64_C(0x96851f15802cac3b), UINT64_C(0x14e718d7d7625a2d) }, { UINT64_C(0xfc2666dae037d74a), UINT64_C(0x1a20df0dcd3af0b8) },
+		{ UINT64_C(0x9d980048cc22e68e), UINT64_C(0x10548b68a044d673) }, { UINT64_C(0x84fe005aff2ba032), UINT64_C(0x1469ae42c8560c10) },
+		{ UINT64_C(0xa63d8071bef6883e), UINT64_C(0x198419d37a6b8f14) }, { UINT64_C(0xcfcce08e2eb42a4e), UINT64_C(0x1fe52048590672d9) },
+		{ UINT64_C(0x21e00c58dd309a70), UINT64_C(0x13ef342d37a407c8) }, { UINT64_C(0x2a580f6f147cc10d), UINT64_C(0x18eb0138858d09ba) },
+		{ UINT64_C(0xb4ee134ad99bf150), UINT64_C(0x1f25c186a6f04c28) }, { UINT64_C(0x7114cc0ec80176d2), UINT64_C(0x137798f428562f99) },
+		{ UINT64_C(0xcd59ff127a01d486), UINT64_C(0x18557f31326bbb7f) }, { UINT64_C(0xc0b07ed7188249a8), UINT64_C(0x1e6adefd7f06aa5f) },
+		{ UINT64_C(0xd86e4f466f516e09), UINT64_C(0x1302cb5e6f642a7b) }, { UINT64_C(0xce89e3180b25c98b), UINT64_C(0x17c37e360b3d351a) },
+		{ UINT64_C(0x822c5bde0def3bee), UINT64_C(0x1db45dc38e0c8261) }, { UINT64_C(0xf15bb96ac8b58575), UINT64_C(0x1290ba9a38c7d17c) },
+		{ UINT64_C(0x2db2a7c57ae2e6d2), UINT64_C(0x1734e940c6f9c5dc) }, { UINT64_C(0x391f51b6d99ba086), UINT64_C(0x1d022390f8b83753) },
+		{ UINT64_C(0x03b3931248014454), UINT64_C(0x1221563a9b732294) }, { UINT64_C(0x04a077d6da019569), UINT64_C(0x16a9abc9424feb39) },
+		{ UINT64_C(0x45c895cc9081fac3), UINT64_C(0x1c5416bb92e3e607) }, { UINT64_C(0x8b9d5d9fda513cba), UINT64_C(0x11b48e353bce6fc4) },
+		{ UINT64_C(0xae84b507d0e58be8), UINT64_C(0x1621b1c28ac20bb5) }, { UINT64_C(0x1a25e249c51eeee3), UINT64_C(0x1baa1e332d728ea3) },
+		{ UINT64_C(0xf057ad6e1b33554d), UINT64_C(0x114a52dffc679925) }, { UINT64_C(0x6c6d98c9a2002aa1), UINT64_C(0x159ce797fb817f6f) },
+		{ UINT64_C(0x4788fefc0a803549), UINT64_C(0x1b04217dfa61df4b) }, { UINT64_C(0x0cb59f5d8690214e), UINT64_C(0x10e294eebc7d2b8f) },
+		{ UINT64_C(0xcfe30734e83429a1), UINT64_C(0x151b3a2a6b9c7672) }, { UINT64_C(0x83dbc9022241340a), UINT64_C(0x1a6208b50683940f) },
+		{ UINT64_C(0xb2695da15568c086), UINT64_C(0x107d457124123c89) }, { UINT64_C(0x1f03b509aac2f0a7), UINT64_C(0x149c96cd6d16cbac) },
+		{ UINT64_C(0x26c4a24c1573acd1), UINT64_C(0x19c3bc80c85c7e97) }, { UINT64_C(0x783ae56f8d684c03), UINT64_C(0x101a55d07d39cf1e) },
+		{ UINT64_C(0x16499ecb70c25f03), UINT64_C(0x1420eb449c8842e6) }, { UINT64_C(0x9bdc067e4cf2f6c4), UINT64_C(0x19292615c3aa539f) },
+		{ UINT64_C(0x82d3081de02fb476), UINT64_C(0x1f736f9b3494e887) }, { UINT64_C(0xb1c3e512ac1dd0c9), UINT64_C(0x13a825c100dd1154) },
+		{ UINT64_C(0xde34de57572544fc), UINT64_C(0x18922f31411455a9) }, { UINT64_C(0x55c215ed2cee963b), UINT64_C(0x1eb6bafd91596b14) },
+		{ UINT64_C(0xb5994db43c151de5), UINT64_C(0x133234de7ad7e2ec) }, { UINT64_C(0xe2ffa1214b1a655e), UINT64_C(0x17fec216198ddba7) },
+		{ UINT64_C(0xdbbf89699de0feb6), UINT64_C(0x1dfe729b9ff15291) }, { UINT64_C(0x2957b5e202ac9f31), UINT64_C(0x12bf07a143f6d39b) },
+		{ UINT64_C(0xf3ada35a8357c6fe), UINT64_C(0x176ec98994f48881) }, { UINT64_C(0x70990c31242db8bd), UINT64_C(0x1d4a7bebfa31aaa2) },
+		{ UINT64_C(0x865fa79eb69c9376), UINT64_C(0x124e8d737c5f0aa5) }, { UINT64_C(0xe7f791866443b854), UINT64_C(0x16e230d05b76cd4e) },
+		{ UINT64_C(0xa1f575e7fd54a669), UINT64_C(0x1c9abd04725480a2) }, { UINT64_C(0xa53969b0fe54e801), UINT64_C(0x11e0b622c774d065) },
+		{ UINT64_C(0x0e87c41d3dea2202), UINT64_C(0x1658e3ab7952047f) }, { UINT64_C(0xd229b5248d64aa82), UINT64_C(0x1bef1c9657a6859e) },
+		{ UINT64_C(0x435a1136d85eea91), UINT64_C(0x117571ddf6c81383) }, { UINT64_C(0x143095848e76a536), UINT64_C(0x15d2ce55747a1864) },
+		{ UINT64_C(0x193cbae5b2144e83), UINT64_C(0x1b4781ead1989e7d) }, { UINT64_C(0x2fc5f4cf8f4cb112), UINT64_C(0x110cb132c2ff630e) },
+		{ UINT64_C(0xbbb77203731fdd56), UINT64_C(0x154fdd7f73bf3bd1) }, { UINT64_C(0x2aa54e844fe7d4ac), UINT64_C(0x1aa3d4df50af0ac6) },
+		{ UINT64_C(0xdaa75112b1f0e4eb), UINT64_C(0x10a6650b926d66bb) }, { UINT64_C(0xd15125575e6d1e26), UINT64_C(0x14cffe4e7708c06a) },
+		{ UINT64_C(0x85a56ead360865b0), UINT64_C(0x1a03fde214caf085) }, { UINT64_C(0x7387652c41c53f8e), UINT64_C(0x10427ead4cfed653) },
+		{ UINT64_C(0x50693e7752368f71), UINT64_C(0x14531e58a03e8be8) }, { UINT64_C(0x64838e1526c4334e), UINT64_C(0x1967e5eec84e2ee2) },
+		{ UINT64_C(0xfda4719a70754022), UINT64_C(0x1fc1df6a7a61ba9a) }, { UINT64_C(0xde86c70086494815), UINT64_C(0x13d92ba28c7d14a0) },
+		{ UINT64_C(0x162878c0a7db9a1a), UINT64_C(0x18cf768b2f9c59c9) }, { UINT64_C(0x5bb296f0d1d280a1), UINT64_C(0x1f03542dfb83703b) },
+		{ UINT64_C(0x194f9e5683239064), UINT64_C(0x1362149cbd322625) }, { UINT64_C(0x5fa385ec23ec747e), UINT64_C(0x183a99c3ec7eafae) },
+		{ UINT64_C(0xf78c67672ce7919d), UINT64_C(0x1e494034e79e5b99) }, { UINT64_C(0x3ab7c0a07c10bb02), UINT64_C(0x12edc82110c2f940) },
+		{ UINT64_C(0x4965b0c89b14e9c3), UINT64_C(0x17a93a2954f3b790) }, { UINT64_C(0x5bbf1cfac1da2433), UINT64_C(0x1d9388b3aa30a574) },
+		{ UINT64_C(0xb957721cb92856a0), UINT64_C(0x127c35704a5e6768) }, { UINT64_C(0xe7ad4ea3e7726c48), UINT64_C(0x171b42cc5cf60142) },
+		{ UINT64_C(0xa198a24ce14f075a), UINT64_C(0x1ce2137f74338193) }, { UINT64_C(0x44ff65700cd16498), UINT64_C(0x120d4c2fa8a030fc) },
+		{ UINT64_C(0x563f3ecc1005bdbe), UINT64_C(0x16909f3b92c83d3b) }, { UINT64_C(0x2bcf0e7f14072d2e), UINT64_C(0x1c34c70a777a4c8a) },
+		{ UINT64_C(0x5b61690f6c847c3d), UINT64_C(0x11a0fc668aac6fd6) }, { UINT64_C(0xf239c35347a59b4c), UINT64_C(0x16093b802d578bcb) },
+		{ UINT64_C(0xeec83428198f021f), UINT64_C(0x1b8b8a6038ad6ebe) }, { UINT64_C(0x553d20990ff96153), UINT64_C(0x1137367c236c6537) },
+		{ UINT64_C(0x2a8c68bf53f7b9a8), UINT64_C(0x1585041b2c477e85) }, { UINT64_C(0x752f82ef28f5a812), UINT64_C(0x1ae64521f7595e26) },
+		{ UINT64_C(0x093db1d57999890b), UINT64_C(0x10cfeb353a97dad8) }, { UINT64_C(0x0b8d1e4ad7ffeb4e), UINT64_C(0x1503e602893dd18e) },
+		{ UINT64_C(0x8e7065dd8dffe622), UINT64_C(0x1a44df832b8d45f1) }, { UINT64_C(0xf9063faa78bfefd5), UINT64_C(0x106b0bb1fb384bb6) },
+		{ UINT64_C(0xb747cf9516efebca), UINT64_C(0x1485ce9e7a065ea4) }, { UINT64_C(0xe519c37a5cabe6bd), UINT64_C(0x19a742461887f64d) },
+		{ UINT64_C(0xaf301a2c79eb7036), UINT64_C(0x1008896bcf54f9f0) }, { UINT64_C(0xdafc20b798664c43), UINT64_C(0x140aabc6c32a386c) },
+		{ UINT64_C(0x11bb28e57e7fdf54), UINT64_C(0x190d56b873f4c688) }, { UINT64_C(0x1629f31ede1fd72a), UINT64_C(0x1f50ac6690f1f82a) },
+		{ UINT64_C(0x4dda37f34ad3e67a), UINT64_C(0x13926bc01a973b1a) }, { UINT64_C(0xe150c5f01d88e019), UINT64_C(0x187706b0213d09e0) },
+		{ UINT64_C(0x19a4f76c24eb181f), UINT64_C(0x1e94c85c298c4c59) }, { UINT64_C(0xb0071aa39712ef13), UINT64_C(0x131cfd3999f7afb7) },
+		{ UINT64_C(0x9c08e14c7cd7aad8), UINT64_C(0x17e43c8800759ba5) }, { UINT64_C(0x030b199f9c0d958e), UINT64_C(0x1ddd4baa0093028f) },
+		{ UINT64_C(0x61e6f003c1887d79), UINT64_C(0x12aa4f4a405be199) }, { UINT64_C(0xba60ac04b1ea9cd7), UINT64_C(0x1754e31cd072d9ff) },
+		{ UINT64_C(0xa8f8d705de65440d), UINT64_C(0x1d2a1be4048f907f) }, { UINT64_C(0xc99b8663aaff4a88), UINT64_C(0x123a516e82d9ba4f) },
+		{ UINT64_C(0xbc0267fc95bf1d2a), UINT64_C(0x16c8e5ca239028e3) }, { UINT64_C(0xab0301fbbb2ee474), UINT64_C(0x1c7b1f3cac74331c) },
+		{ UINT64_C(0xeae1e13d54fd4ec9), UINT64_C(0x11ccf385ebc89ff1) }, { UINT64_C(0x659a598caa3ca27b), UINT64_C(0x1640306766bac7ee) },
+		{ UINT64_C(0xff00efefd4cbcb1a), UINT64_C(0x1bd03c81406979e9) }, { UINT64_C(0x3f6095f5e4ff5ef0), UINT64_C(0x116225d0c841ec32) },
+		{ UINT64_C(0xcf38bb735e3f36ac), UINT64_C(0x15baaf44fa52673e) }, { UINT64_C(0x8306ea5035cf0457), UINT64_C(0x1b295b1638e7010e) },
+		{ UINT64_C(0x11e4527221a162b6), UINT64_C(0x10f9d8ede39060a9) }, { UINT64_C(0x565d670eaa09bb64), UINT64_C(0x15384f295c7478d3) },
+		{ UINT64_C(0x2bf4c0d2548c2a3d), UINT64_C(0x1a8662f3b3919708) }, { UINT64_C(0x1b78f88374d79a66), UINT64_C(0x1093fdd8503afe65) },
+		{ UINT64_C(0x625736a4520d8100), UINT64_C(0x14b8fd4e6449bdfe) }, { UINT64_C(0xfaed044d6690e140), UINT64_C(0x19e73ca1fd5c2d7d) },
+		{ UINT64_C(0xbcd422b0601a8cc8), UINT64_C(0x103085e53e599c6e) }, { UINT64_C(0x6c092b5c78212ffa), UINT64_C(0x143ca75e8df0038a) },
+		{ UINT64_C(0x070b763396297bf8), UINT64_C(0x194bd136316c046d) }, { UINT64_C(0x48ce53c07bb3daf6), UINT64_C(0x1f9ec583bdc70588) },
+		{ UINT64_C(0x2d80f4584d5068da), UINT64_C(0x13c33b72569c6375) }, { UINT64_C(0x78e1316e60a48310), UINT64_C(0x18b40a4eec437c52) }
+	};
+
+	// 2^(bits(5^i) - 1 + 125) / 5^i rounded up, for i in [0, 342). Used for non-negative binary exponents.
+	static const uint64_t kDoublePow5InvSplit[342][2] =
+	{
+		{ UINT64_C(0x0000000000000001), UINT64_C(0x2000000000000000) }, { UINT64_C(0x999999999999999a), UINT64_C(0x1999999999999999) },
+		{ UINT64_C(0x47ae147ae147ae15), UINT64_C(0x147ae147ae147ae1) }, { UINT64_C(0x6c8b4395810624de), UINT64_C(0x10624dd2f1a9fbe7) },
+		{ UINT64_C(0x7a786c226809d496), UINT64_C(0x1a36e2eb1c432ca5) }, { UINT64_C(0x61f9f01b866e43ab), UINT64_C(0x14f8b588e368f084) },
+		{ UINT64_C(0xb4c7f34938583622), UINT64_C(0x10c6f7a0b5ed8d36) }, { UINT64_C(0x87a6520ec08d236a), UINT64_C(0x1ad7f29abcaf4857) },
+		{ UINT64_C(0x9fb841a566d74f88), UINT64_C(0x15798ee2308c39df) }, { UINT64_C(0xe62d01511f12a607), UINT64_C(0x112e0be826d694b2) },
+		{ UINT64_C(0xd6ae6881cb5109a4), UINT64_C(0x1b7cdfd9d7bdbab7) }, { UINT64_C(0xdef1ed34a2a73aea), UINT64_C(0x15fd7fe17964955f) },
+		{ UINT64_C(0x7f27f0f6e885c8bb), UINT64_C(0x119799812dea1119) }, { UINT64_C(0x650cb4be40d60df8), UINT64_C(0x1c25c268497681c2) },
+		{ UINT64_C(0xea70909833de7193), UINT64_C(0x16849b86a12b9b01) }, { UINT64_C(0x21f3a6e0297ec143), UINT64_C(0x1203af9ee756159b) },
+		{ UINT64_C(0x6985d7cd0f313537), UINT64_C(0x1cd2b297d889bc2b) }, { UINT64_C(0x2137dfd73f5a90f9), UINT64_C(0x170ef54646d49689) },
+		{ UINT64_C(0xe75fe645cc4873fa), UINT64_C(0x12725dd1d243aba0) }, { UINT64_C(0xa5663d3c7a0d865d), UINT64_C(0x1d83c94fb6d2ac34) },
+		{ UINT64_C(0x511e976394d79eb1), UINT64_C(0x179ca10c9242235d) }, { UINT64_C(0xda7edf82dd794bc1), UINT64_C(0x12e3b40a0e9b4f7d) },
+		{ UINT64_C(0x2a6498d1625bac68), UINT64_C(0x1e392010175ee596) }, { UINT64_C(0xeeb6e0a781e2f053), UINT64_C(0x182db34012b25144) },
+		{ UINT64_C(0x58924d52ce4f26a9), UINT64_C(0x1357c299a88ea76a) }, { UINT64_C(0x27507bb7b07ea441), UINT64_C(0x1ef2d0f5da7dd8aa) },
+		{ UINT64_C(0x52a6c95fc0655034), UINT64_C(0x18c240c4aecb13bb) }, { UINT64_C(0x0eebd44c99eaa690), UINT64_C(0x13ce9a36f23c0fc9) },
+		{ UINT64_C(0xb17953adc3110a80), UINT64_C(0x1fb0f6be50601941) }, { UINT64_C(0xc12ddc8b02740867), UINT64_C(0x195a5efea6b34767) },
+		{ UINT64_C(0x3424b06f3529a052), UINT64_C(0x14484bfeebc29f86) }, { UINT64_C(0x901d59f290ee19db), UINT64_C(0x1039d66589687f9e) },
+		{ UINT64_C(0x4cfbc31db4b0295f), UINT64_C(0x19f623d5a8a73297) }, { UINT64_C(0x3d9635b15d59bab2), UINT64_C(0x14c4e977ba1f5bac) },
+		{ UINT64_C(0x97ab5e277de16228), UINT64_C(0x109d8792fb4c4956) }, { UINT64_C(0xf2abc9d8c9689d0d), UINT64_C(0x1a95a5b7f87a0ef0) },
+		{ UINT64_C(0x5bbca17a3aba173e), UINT64_C(0x154484932d2e725a) }, { UINT64_C(0xafca1ac82efb45cb), UINT64_C(0x11039d428a8b8eae) },
+		{ UINT64_C(0xb2dcf7a6b1920945), UINT64_C(0x1b38fb9daa78e44a) }, { UINT64_C(0xf57d92ebc141a104), UINT64_C(0x15c72fb1552d836e) },
+		{ UINT64_C(0xc46475896767b403), UINT64_C(0x116c262777579c58) }, { UINT64_C(0x6d6d88dbd8a5ecd2), UINT64_C(0x1be03d0bf225c6f4) },
+		{ UINT64_C(0x8abe071646eb23db), UINT64_C(0x164cfda3281e38c3) }, { UINT64_C(0x6efe6c11d255b649), UINT64_C(0x11d7314f534b609c) },
+		{ UINT64_C(0xb197134fb6ef8a0e), UINT64_C(0x1c8b821885456760) }, { UINT64_C(0x27ac0f72f8bfa1a5), UINT64_C(0x16d601ad376ab91a) },
+		{ UINT64_C(0xb95672c260994e1e), UINT64_C(0x1244ce242c5560e1) }, { UINT64_C(0xf5571e03cdc21695), UINT64_C(0x1d3ae36d13bbce35) },
+		{ UINT64_C(0x2aac18030b01abab), UINT64_C(0x17624f8a762fd82b) }, { UINT64_C(0xbbbce0026f348956), UINT64_C(0x12b50c6ec4f31355) },
+		{ UINT64_C(0x92c7ccd0b1eda889), UINT64_C(0x1dee7a4ad4b81eef) }, { UINT64_C(0xdbd30a408e57ba07), UINT64_C(0x17f1fb6f10934bf2) },
+		{ UINT64_C(0x7ca8d50071dfc806), UINT64_C(0x1327fc58da0f6ff5) }, { UINT64_C(0xfaa7bb33e9660cd6), UINT64_C(0x1ea6608e29b24cbb) },
+		{ UINT64_C(0x9552fc298784d711), UINT64_C(0x18851a0b548ea3c9) }, { UINT64_C(0xaaa8c9bad2d0ac0e), UINT64_C(0x139dae6f76d88307) },
+		{ UINT64_C(0xdddadc5e1e1aace3), UINT64_C(0x1f62b0b257c0d1a5) }, { UINT64_C(0x7e48b04b4b488a4f), UINT64_C(0x191bc08eac9a4151) },
+		{ UINT64_C(0xcb6d59d5d5d3a1d9), UINT64_C(0x141633a556e1cdda) }, { UINT64_C(0x3c577b1177dc817b), UINT64_C(0x1011c2eaabe7d7e2) },
+		{ UINT64_C(0xc6f25e825960cf2a), UINT64_C(0x19b604aaaca62636) }, { UINT64_C(0x6bf518684780a5bb), UINT64_C(0x14919d5556eb51c5) },
+		{ UINT64_C(0x232a79ed06008496), UINT64_C(0x10747ddddf22a7d1) }, { UINT64_C(0xd1dd8fe1a3340756), UINT64_C(0x1a53fc9631d10c81) },
+		{ UINT64_C(0xa7e4731ae8f66c45), UINT64_C(0x150ffd44f4a73d34) }, { UINT64_C(0x531d28e253f8569e), UINT64_C(0x10d9976a5d52975d) },
+		{ UINT64_C(0xeb61db03b98d5762), UINT64_C(0x1af5bf109550f22e) }, { UINT64_C(0xbc4e48cfc7a445e8), UINT64_C(0x159165a6ddda5b58) },
+		{ UINT64_C(0x6371d3d96c836b20), UINT64_C(0x11411e1f17e1e2ad) }, { UINT64_C(0x9f1c8628ad9f11cd), UINT64_C(0x1b9b6364f3030448) },
+		{ UINT64_C(0xe5b06b53be18db0b), UINT64_C(0x1615e91d8f359d06) }, { UINT64_C(0xeaf3890fcb4715a2), UINT64_C(0x11ab20e472914a6b) },
+		{ UINT64_C(0x44b8db4c7871bc37), UINT64_C(0x1c45016d841baa46) }, { UINT64_C(0x03c715d6c6c1635f), UINT64_C(0x169d9abe03495505) },
+		{ UINT64_C(0x3638de456bcde919), UINT64_C(0x1217aefe69077737) }, { UINT64_C(0x56c163a2461641c1), UINT64_C(0x1cf2b1970e725858) },
+		{ UINT64_C(0xdf011c81d1ab67ce), UINT64_C(0x17288e1271f51379) }, { UINT64_C(0x7f3416ce4155eca5), UINT64_C(0x1286d80ec190dc61) },
+		{ UINT64_C(0x6520247d3556476e), UINT64_C(0x1da48ce468e7c702) }, { UINT64_C(0xea801d30f7783925), UINT64_C(0x17b6d71d20b96c01) },
+		{ UINT64_C(0xbb99b0f3f92cfa84), UINT64_C(0x12f8ac174d612334) }, { UINT64_C(0x5f5c4e532847f739), UINT64_C(0x1e5aacf215683854) },
+		{ UINT64_C(0x7f7d0b75b9d32c2e), UINT64_C(0x18488a5b44536043) }, { UINT64_C(0x9930d5f7c7dc2358), UINT64_C(0x136d3b7c36a919cf) },
+		{ UINT64_C(0x8eb4898c72f9d226), UINT64_C(0x1f152bf9f10e8fb2) }, { UINT64_C(0x722a07a38f2e41b8), UINT64_C(0x18ddbcc7f40ba628) },
+		{ UINT64_C(0xc1bb394fa5be9afa), UINT64_C(0x13e497065cd61e86) }, { UINT64_C(0x9c5ec2190930f7f6), UINT64_C(0x1fd424d6faf030d7) },
+		{ UINT64_C(0x49e56814075a5ff8), UINT64_C(0x197683df2f268d79) }, { UINT64_C(0x6e51201005e1e660), UINT64_C(0x145ecfe5bf520ac7) },
+		{ UINT64_C(0xf1da800cd181851a), UINT64_C(0x104bd984990e6f05) }, { UINT64_C(0x4fc400148268d4f5), UINT64_C(0x1a12f5a0f4e3e4d6) },
+		{ UINT64_C(0xd96999aa01ed772b), UINT64_C(0x14dbf7b3f71cb711) }, { UINT64_C(0xadee1488018ac5bc), UINT64_C(0x10aff95cc5b09274) },
+		{ UINT64_C(0x497ceda668de092c), UINT64_C(0x1ab328946f80ea54) }, { UINT64_C(0x3aca57b853e4d424), UINT64_C(0x155c2076bf9a5510) },
+		{ UINT64_C(0x623b7960431d7683), UINT64_C(0x1116805effaeaa73) }, { UINT64_C(0x9d2bf566d1c8bd9e), UINT64_C(0x1b5733cb32b110b8) },
+		{ UINT64_C(0x7dbcc452416d647f), UINT64_C(0x15df5ca28ef40d60) }, { UINT64_C(0xcafd69db678ab6cc), UINT64_C(0x117f7d4ed8c33de6) },
+		{ UINT64_C(0xab2f0fc572778adf), UINT64_C(0x1bff2ee48e052fd7) }, { UINT64_C(0x88f273045b92d580), UINT64_C(0x1665bf1d3e6a8cac) },
+		{ UINT64_C(0xd3f528d049424466), UINT64_C(0x11eaff4a98553d56) }, { UINT64_C(0xb988414d4203a0a3), UINT64_C(0x1cab3210f3bb9557) },
+		{ UINT64_C(0x6139cdd76802e6e9), UINT64_C(0x16ef5b40c2fc7779) }, { UINT64_C(0xe761717920025254), UINT64_C(0x125915cd68c9f92d) },
+		{ UINT64_C(0xa568b58e999d5086), UINT64_C(0x1d5b561574765b7c) }, { UINT64_C(0x5120913ee14aa6d2), UINT64_C(0x177c44ddf6c515fd) },
+		{ UINT64_C(0xa74d40ff1aa21f0e), UINT64_C(0x12c9d0b1923744ca) }, { UINT64_C(0x0baece64f769cb4a), UINT64_C(0x1e0fb44f50586e11) },
+		{ UINT64_C(0x3c8bd850c5ee3c3b), UINT64_C(0x180c903f7379f1a7) }, { UINT64_C(0xca0979da37f1c9c9), UINT64_C(0x133d4032c2c7f485) },
+		{ UINT64_C(0xa9a8c2f6bfe942db), UINT64_C(0x1ec866b79e0cba6f) }, { UINT64_C(0x2153cf2bccba9be3), UINT64_C(0x18a0522c7e709526) },
+		{ UINT64_C(0x1aa9728970954982), UINT64_C(0x13b374f06526ddb8) }, { UINT64_C(0xf775840f1a88759d), UINT64_C(0x1f8587e7083e2f8c) },
+		{ UINT64_C(0x5f9136727ba05e17), UINT64_C(0x19379fec0698260a) }, { UINT64_C(0x1940f85b9619e4df), UINT64_C(0x142c7ff0054684d5) },
+		{ UINT64_C(0xe100c6afab47ea4c), UINT64_C(0x1023998cd1053710) }, { UINT64_C(0xce67a44c453fdd47), UINT64_C(0x19d28f47b4d524e7) },
+		{ UINT64_C(0xd852e9d69dccb106), UINT64_C(0x14a8729fc3ddb71f) }, { UINT64_C(0x79dbee454b0a2738), UINT64_C(0x1086c219697e2c19) },
+		{ UINT64_C(0x295fe3a211a9d859), UINT64_C(0x1a71368f0f30468f) }, { UINT64_C(0xbab31c81a7bb137a), UINT64_C(0x15275ed8d8f36ba5) },
+		{ UINT64_C(0x6228e39aec95a92f), UINT64_C(0x10ec4be0ad8f8951) }, { UINT64_C(0x9d0e38f7e0ef7517), UINT64_C(0x1b13ac9aaf4c0ee8) },
+		{ UINT64_C(0xb0d82d931a592a79), UINT64_C(0x15a956e225d67253) }, { UINT64_C(0x8d79be0f4847552e), UINT64_C(0x11544581b7dec1dc) },
+		{ UINT64_C(0x158f967eda0bbb7c), UINT64_C(0x1bba08cf8c979c94) }, { UINT64_C(0x77a611ff14d62f97), UINT64_C(0x162e6d72d6dfb076) },
+		{ UINT64_C(0xf951a7ff43de8c79), UINT64_C(0x11bebdf578b2f391) }, { UINT64_C(0xc21c3ffed2fdad8e), UINT64_C(0x1c6463225ab7ec1c) },
+		{ UINT64_C(0x01b0333242648ad8), UINT64_C(0x16b6b5b5155ff017) }, { UINT64_C(0x0159c28e9b83a246), UINT64_C(0x122bc490dde659ac) },
+		{ UINT64_C(0xcef604175f3903a3), UINT64_C(0x1d12d41afca3c2ac) }, { UINT64_C(0x725e69ac4c2d9c83), UINT64_C(0x17424348ca1c9bbd) },
+		{ UINT64_C(0xf5185489d68ae39c), UINT64_C(0x129b69070816e2fd) }, { UINT64_C(0xee8d540fbdab05c6), UINT64_C(0x1dc574d80cf16b2f) },
+		{ UINT64_C(0xbed77672fe226b05), UINT64_C(0x17d12a4670c1228c) }, { UINT64_C(0xff12c528cb4ebc04), UINT64_C(0x130dbb6b8d674ed6) },
+		{ UINT64_C(0xcb513b74787df9a0), UINT64_C(0x1e7c5f127bd87e24) }, { UINT64_C(0x090dc929f9fe614d), UINT64_C(0x18637f41fcad31b7) },
+		{ UINT64_C(0xa0d7d42194cb810a), UINT64_C(0x1382cc34ca2427c5) }, { UINT64_C(0x67bfb9cf5478ce77), UINT64_C(0x1f37ad21436d0c6f) },
+		{ UINT64_C(0x1fcc94a5dd2d71f9), UINT64_C(0x18f9574dcf8a7059) }, { UINT64_C(0x7fd6dd517dbdf4c7), UINT64_C(0x13faac3e3fa1f37a) },
+		{ UINT64_C(0xffbe2ee8c92fee0b), UINT64_C(0x1ff779fd329cb8c3) }, { UINT64_C(0x6631bf20a0f324d6), UINT64_C(0x1992c7fdc216fa36) },
+		{ UINT64_C(0xb827cc1a1a5c1d78), UINT64_C(0x14756ccb01abfb5e) }, { UINT64_C(0x935309ae7b7ce460), UINT64_C(0x105df0a267bcc918) },
+		{ UINT64_C(0x1eeb42b0c594a099), UINT64_C(0x1a2fe76a3f9474f4) }, { UINT64_C(0xe58902270476e6e1), UINT64_C(0x14f31f8832dd2a5c) },
+		{ UINT64_C(0xb7a0ce859d2bebe7), UINT64_C(0x10c27fa028b0eeb0) }, { UINT64_C(0x59014a6f61dfdfd8), UINT64_C(0x1ad0cc33744e4ab4) },
+		{ UINT64_C(0xe0cdd525e7e64cad), UINT64_C(0x1573d68f903ea229) }, { UINT64_C(0x4d7177518651d6f1), UINT64_C(0x11297872d9cbb4ee) },
+		{ UINT64_C(0x7be8bee8d6e957e8), UINT64_C(0x1b758d848fac54b0) }, { UINT64_C(0xfcba3253df211320), UINT64_C(0x15f7a46a0c89dd59) },
+		{ UINT64_C(0x63c8284318e74280), UINT64_C(0x1192e9ee706e4aae) }, { UINT64_C(0x060d0d3827d86a66), UINT64_C(0x1c1e43171a4a1117) },
+		{ UINT64_C(0x6b3da42cecad21eb), UINT64_C(0x167e9c127b6e7412) }, { UINT64_C(0x88fe1cf0bd574e56), UINT64_C(0x11fee341fc585cdb) },
+		{ UINT64_C(0x419694b462254a23), UINT64_C(0x1ccb0536608d615f) }, { UINT64_C(0x67abaa29e81dd4e9), UINT64_C(0x1708d0f84d3de77f) },
+		{ UINT64_C(0xb95621bb2017dd87), UINT64_C(0x126d73f9d764b932) }, { UINT64_C(0xc223692b668c95a5), UINT64_C(0x1d7becc2f23ac1ea) },
+		{ UINT64_C(0xce82ba891ed6de1d), UINT64_C(0x179657025b6234bb) }, { UINT64_C(0xa53562074bdf1818), UINT64_C(0x12deac01e2b4f6fc) },
+		{ UINT64_C(0x3b889cd87964f359), UINT64_C(0x1e3113363787f194) }, { UINT64_C(0xfc6d4a46c783f5e1), UINT64_C(0x18274291c6065adc) },
+		{ UINT64_C(0x30576e9f06032b1a), UINT64_C(0x13529ba7d19eaf17) }, { UINT64_C(0x1a257dcb3cd1de90), UINT64_C(0x1eea92a61c311825) },
+		{ UINT64_C(0x481dfe3c30a7e540), UINT64_C(0x18bba884e35a79b7) }, { UINT64_C(0xd34b31c9c0865100), UINT64_C(0x13c9539d82aec7c5) },
+		{ UINT64_C(0x5211e942cda3b4cd), UINT64_C(0x1fa885c8d117a609) }, { UINT64_C(0x74db21023e1c90a4), UINT64_C(0x19539e3a40dfb807) },
+		{ UINT64_C(0xf715b401cb4a0d50), UINT64_C(0x1442e4fb67196005) }, { UINT64_C(0xf8de299b09080aa7), UINT64_C(0x103583fc527ab337) },
+		{ UINT64_C(0x8e304291a80cddd7), UINT64_C(0x19ef3993b72ab859) }, { UINT64_C(0x3e8d020e200a4b13), UINT64_C(0x14bf6142f8eef9e1) },
+		{ UINT64_C(0x653d9b3e80083c0f), UINT64_C(0x10991a9bfa58c7e7) }, { UINT64_C(0x6ec8f864000d2ce4), UINT64_C(0x1a8e90f9908e0ca5) },
+		{ UINT64_C(0x8bd3f9e999a423ea), UINT64_C(0x153eda614071a3b7) }, { UINT64_C(0x3ca994bae1501cbb), UINT64_C(0x10ff151a99f482f9) },
+		{ UINT64_C(0xc775bac49bb3612b), UINT64_C(0x1b31bb5dc320d18e) }, { UINT64_C(0xd2c4956a16291a89), UINT64_C(0x15c162b168e70e0b) },
+		{ UINT64_C(0xdbd0778811ba7ba1), UINT64_C(0x11678227871f3e6f) }, { UINT64_C(0x2c80bf401c5d929b), UINT64_C(0x1bd8d03f3e9863e6) },
+		{ UINT64_C(0xbd33cc3349e47549), UINT64_C(0x16470cff6546b651) }, { UINT64_C(0xca8fd68f6e505dd4), UINT64_C(0x11d270cc51055ea7) },
+		{ UINT64_C(0x4419574be3b3c953), UINT64_C(0x1c83e7ad4e6efdd9) }, { UINT64_C(0x0347790982f63aa9), UINT64_C(0x16cfec8aa52597e1) },
+		{ UINT64_C(0xcf6c60d468c4fbba), UINT64_C(0x123ff06eea847980) }, { UINT64_C(0xe57a34870e07f92a), UINT64_C(0x1d331a4b10d3f59a) },
+		{ UINT64_C(0x512e906c0b399422), UINT64_C(0x175c1508da432ae2) }, { UINT64_C(0xda8ba6bcd5c7a9b5), UINT64_C(0x12b010d3e1cf5581) },
+		{ UINT64_C(0x90df712e22d90f87), UINT64_C(0x1de6815302e5559c) }, { UINT64_C(0xda4c5a8b4f140c6c), UINT64_C(0x17eb9aa8cf1dde16) },
+		{ UINT64_C(0xaea37ba2a5a9a38a), UINT64_C(0x1322e220a5b17e78) }, { UINT64_C(0x7dd25f6aa2a905a9), UINT64_C(0x1e9e369aa2b59727) },
+		{ UINT64_C(0x97db7f888220d154), UINT64_C(0x187e92154ef7ac1f) }, { UINT64_C(0x797c6606ce80a777), UINT64_C(0x139874ddd8c6234c) },
+		{ UINT64_C(0x8f2d700ae4010bf1), UINT64_C(0x1f5a549627a36bad) }, { UINT64_C(0x0c2459a25000d65a), UINT64_C(0x191510781fb5efbe) },
+		{ UINT64_C(0x701d1481d99a4515), UINT64_C(0x1410d9f9b2f7f2fe) }, { UINT64_C(0xc017439b147b6a77), UINT64_C(0x100d7b2e28c65bfe) },
+		{ UINT64_C(0xccf205c4ed9243f2), UINT64_C(0x19af2b7d0e0a2cca) }, { UINT64_C(0x0a5b37d0be0e9cc2), UINT64_C(0x148c22ca71a1bd6f) },
+		{ UINT64_C(0x0848f973cb3ee3ce), UINT64_C(0x10701bd527b4978c) }, { UINT64_C(0xda0e5bec78649fb0), UINT64_C(0x1a4cf9550c5425ac) },
+		{ UINT64_C(0x7b3eaff060507fc0), UINT64_C(0x150a6110d6a9b7bd) }, { UINT64_C(0x95cbbff380406633), UINT64_C(0x10d51a73deee2c97) },
+		{ UINT64_C(0xefac665266cd7052), UINT64_C(0x1aee90b964b04758) }, { UINT64_C(0x2623850eb8a459db), UINT64_C(0x158ba6fab6f36c47) },
+		{ UINT64_C(0x1e82d0d893b6ae49), UINT64_C(0x113c85955f29236c) }, { UINT64_C(0xfd9e1af41f8ab075), UINT64_C(0x1b9408eefea838ac) },
+		{ UINT64_C(0x97b1af29b2d559f7), UINT64_C(0x16100725988693bd) }, { UINT64_C(0xac8e25baf5777b2c), UINT64_C(0x11a66c1e139edc97) },
+		{ UINT64_C(0x7a7d092b2258c513), UINT64_C(0x1c3d79c9b8fe2dbf) }, { UINT64_C(0x61fda0ef4ead6a76), UINT64_C(0x169794a160cb57cc) },
+		{ UINT64_C(0xe7fe1a590bbdeec5), UINT64_C(0x1212dd4de7091309) }, { UINT64_C(0xa6635d5b45fcb13a), UINT64_C(0x1ceafbafd80e84dc) },
+		{ UINT64_C(0x851c4aaf6b308dc8), UINT64_C(0x172262f3133ed0b0) }, { UINT64_C(0xd0e36ef2bc26d7d4), UINT64_C(0x1281e8c275cbda26) },
+		{ UINT64_C(0xb49f17eac6a48c86), UINT64_C(0x1d9ca79d894629d7) }, { UINT64_C(0x2a18dfef0550706b), UINT64_C(0x17b08617a104ee46) },
+		{ UINT64_C(0x54e0b3259dd9f389), UINT64_C(0x12f39e794d9d8b6b) }, { UINT64_C(0x87cdeb6f62f65274), UINT64_C(0x1e5297287c2f4578) },
+		{ UINT64_C(0xd30b22bf825ea85d), UINT64_C(0x18421286c9bf6ac6) }, { UINT64_C(0x0f3c1bcc684bb9e4), UINT64_C(0x13680ed23aff889f) },
+		{ UINT64_C(0x18602c7a4079296d), UINT64_C(0x1f0ce4839198da98) }, { UINT64_C(0x46b356c833942124), UINT64_C(0x18d71d360e13e213) },
+		{ UINT64_C(0x388f78a029434db6), UINT64_C(0x13df4a91a4dcb4dc) }, { UINT64_C(0x5a7f2766a86baf8a), UINT64_C(0x1fcbaa82a1612160) },
+		{ UINT64_C(0x153285ebb9efbfa2), UINT64_C(0x196fbb9bb44db44d) }, { UINT64_C(0xaa8ed189618c994e), UINT64_C(0x145962e2f6a4903d) },
+		{ UINT64_C(0xeed8a7a11ad6e10c), UINT64_C(0x1047824f2bb6d9ca) }, { UINT64_C(0x7e27729b5e249b45), UINT64_C(0x1a0c03b1df8af611) },
+		{ UINT64_C(0xfe85f549181d4904), UINT64_C(0x14d6695b193bf80d) }, { UINT64_C(0xcb9e5dd4134aa0d0), UINT64_C(0x10ab877c142ff9a4) },
+		{ UINT64_C(0xdf63c9535211014d), UINT64_C(0x1aac0bf9b9e65c3a) }, { UINT64_C(0x191ca10f74da6771), UINT64_C(0x15566ffafb1eb02f) },
+		{ UINT64_C(0xadb080d92a4852c1), UINT64_C(0x1111f32f2f4bc025) }, { UINT64_C(0x15e7348eaa0d5134), UINT64_C(0x1b4feb7eb212cd09) },
+		{ UINT64_C(0xab1f5d3eee710dc4), UINT64_C(0x15d98932280f0a6d) }, { UINT64_C(0xbc1917658b8da49d), UINT64_C(0x117ad428200c0857) },
+		{ UINT64_C(0x2cf4f23c127c3a94), UINT64_C(0x1bf7b9d9cce00d59) }, { UINT64_C(0xf0c3f4fcdb969543), UINT64_C(0x165fc7e170b33de0) },
+		{ UINT64_C(0x5a365d9716121103), UINT64_C(0x11e6398126f5cb1a) }, { UINT64_C(0x9056fc24f01ce804), UINT64_C(0x1ca38f350b22de90) },
+		{ UINT64_C(0xd9df301d8ce3ecd0), UINT64_C(0x16e93f5da2824ba6) }, { UINT64_C(0xe17f59b13d8323da), UINT64_C(0x125432b14ecea2eb) },
+		{ UINT64_C(0x68cbc2b52f38395c), UINT64_C(0x1d53844ee47dd179) }, { UINT64_C(0x53d6355dbf602de3), UINT64_C(0x177603725064a794) },
+		{ UINT64_C(0xa9782ab165e68b1c), UINT64_C(0x12c4cf8ea6b6ec76) }, { UINT64_C(0x0f26aab56fd744fa), UINT64_C(0x1e07b27dd78b13f1) },
+		{ UINT64_C(0x3f52222abfdf6a62), UINT64_C(0x18062864ac6f4327) }, { UINT64_C(0x65db4e88997f884e), UINT64_C(0x1338205089f29c1f) },
+		{ UINT64_C(0x6fc54a7428cc0d4a), UINT64_C(0x1ec033b40fea9365) }, { UINT64_C(0x596aa1f68709a43b), UINT64_C(0x1899c2f673220f84) },
+		{ UINT64_C(0xadeee7f86c07b696), UINT64_C(0x13ae3591f5b4d936) }, { UINT64_C(0x497e3ff3e00c5756), UINT64_C(0x1f7d228322baf524) },
+		{ UINT64_C(0xd464fff64cd6ac45), UINT64_C(0x1930e868e89590e9) }, { UINT64_C(0x4383fff83d7889d1), UINT64_C(0x14272053ed4473ee) },
+		{ UINT64_C(0xcf9cccc69793a174), UINT64_C(0x101f4d0ff1038ff1) }, { UINT64_C(0x7f6147a425b90252), UINT64_C(0x19cbae7fe805b31c) },
+		{ UINT64_C(0xcc4dd2e9b7c7350f), UINT64_C(0x14a2f1ffecd15c16) }, { UINT64_C(0x3d0b0f215fd290d9), UINT64_C(0x10825b3323dab012) },
+		{ UINT64_C(0x61ab4b689950e7c1), UINT64_C(0x1a6a2b85062ab350) }, { UINT64_C(0x4e22a2ba1440b967), UINT64_C(0x1521bc6a6b555c40) },
+		{ UINT64_C(0x0b4ee894dd009453), UINT64_C(0x10e7c9eebc4449cd) }, { UINT64_C(0x1217da87c800ed51), UINT64_C(0x1b0c764ac6d3a948) },
+		{ UINT64_C(0xdb46486ca000bdda), UINT64_C(0x15a391d56bdc876c) }, { UINT64_C(0x490506bd4ccd64af), UINT64_C(0x114fa7ddefe39f8a) },
+		{ UINT64_C(0xa8080ac87ae23ab1), UINT64_C(0x1bb2a62fe638ff43) }, { UINT64_C(0x5339a239fbe82ef4), UINT64_C(0x162884f31e93ff69) },
+		{ UINT64_C(0x75c7b4fb2fecf25d), UINT64_C(0x11ba03f5b20fff87) }, { UINT64_C(0x22d92191e647ea2e), UINT64_C(0x1c5cd322b67fff3f) },
+		{ UINT64_C(0xb57a8141850654f2), UINT64_C(0x16b0a8e891ffff65) }, { UINT64_C(0xc4620101373843f5), UINT64_C(0x1226ed86db3332b7) },
+		{ UINT64_C(0x3a366801f1f39fee), UINT64_C(0x1d0b15a491eb8459) }, { UINT64_C(0xfb5eb99b27f6198b), UINT64_C(0x173c115074bc69e0) },
+		{ UINT64_C(0x2f7efae2865e7ad6), UINT64_C(0x129674405d6387e7) }, { UINT64_C(0xe597f7d0d6fd9156), UINT64_C(0x1dbd86cd6238d971) },
+		{ UINT64_C(0x8479930d78cadaab), UINT64_C(0x17cad23de82d7ac1) }, { UINT64_C(0xd06142712d6f1556), UINT64_C(0x1308a831868ac89a) },
+		{ UINT64_C(0x4d686a4eaf182222), UINT64_C(0x1e74404f3daada91) }, { UINT64_C(0xa453883ef279b4e8), UINT64_C(0x185d003f6488aeda) },
+		{ UINT64_C(0xe9dc6cff28615d87), UINT64_C(0x137d99cc506d58ae) }, { UINT64_C(0xa960ae650d6895a4), UINT64_C(0x1f2f5c7a1a488de4) },
+		{ UINT64_C(0xbab3beb73ded4483), UINT64_C(0x18f2b061aea07183) }, { UINT64_C(0x2ef6322c318a9d36), UINT64_C(0x13f559e7bee6c136) },
+		{ UINT64_C(0xe4bd1d13827761f0), UINT64_C(0x1feef63f97d79b89) }, { UINT64_C(0x83ca7da9352c4e5a), UINT64_C(0x198bf832dfdfafa1) },
+		{ UINT64_C(0x9ca1fe20f756a515), UINT64_C(0x146ff9c24cb2f2e7) }, { UINT64_C(0x4a1b31b3f9121daa), UINT64_C(0x1059949b708f28b9) },
+		{ UINT64_C(0x435eb5ecc1b695dd), UINT64_C(0x1a28edc580e50df5) }, { UINT64_C(0x35e55e57015ede4a), UINT64_C(0x14ed8b04671da4c4) },
+		{ UINT64_C(0xc4b77eac0118b1d5), UINT64_C(0x10be08d0527e1d69) }, { UINT64_C(0xa12597799b5ab622), UINT64_C(0x1ac9a7b3b7302f0f) },
+		{ UINT64_C(0x4db7ac6149155e81), UINT64_C(0x156e1fc2f8f358d9) }, { UINT64_C(0xd7c6238107444b9b), UINT64_C(0x1124e63593f5e0ad) },
+		{ UINT64_C(0x593d059b3ed3ac2b), UINT64_C(0x1b6e3d2286563449) }, { UINT64_C(0xe0fd9e15cbdc89bc), UINT64_C(0x15f1ca820511c36d) },
+		{ UINT64_C(0xb3fe18116fe3a163), UINT64_C(0x118e3b9b37416924) }, { UINT64_C(0x866359b57fd29bd1), UINT64_C(0x1c16c5c525357507) },
+		{ UINT64_C(0xd1e91491330ee30e), UINT64_C(0x16789e3750f790d2) }, { UINT64_C(0x74ba76da8f3f1c0b), UINT64_C(0x11fa182c40c60d75) },
+		{ UINT64_C(0xedf72490e531c678), UINT64_C(0x1cc359e067a348bb) }, { UINT64_C(0x8b2c1d40b75b052d), UINT64_C(0x1702ae4d1fb5d3c9) },
+		{ UINT64_C(0x6f567dcd5f7c0424), UINT64_C(0x12688b70e62b0fd4) }, { UINT64_C(0x7ef0c94898c66d06), UINT64_C(0x1d74124e3d11b2ed) },
+		{ UINT64_C(0x98c0a106e09ebd9f), UINT64_C(0x17900ea4fda7c257) }, { UINT64_C(0x470080d24d4bcae6), UINT64_C(0x12d9a550caec9b79) },
+		{ UINT64_C(0xd800ce1d487944a2), UINT64_C(0x1e29088144adc58e) }, { UINT64_C(0x1333d8176d2dd082), UINT64_C(0x1820d39a9d57d13f) },
+		{ UINT64_C(0xa8f646792424a6ce), UINT64_C(0x134d76154aaca765) }, { UINT64_C(0x74bd3d8ea03aa47d), UINT64_C(0x1ee25688777aa56f) },
+		{ UINT64_C(0x5d64313ee6955064), UINT64_C(0x18b51206c5fbb78c) }, { UINT64_C(0x4ab68dcbebaaa6b7), UINT64_C(0x13c40e6bd1962c70) },
+		{ UINT64_C(0x1124161312aaa457), UINT64_C(0x1fa01712e8f0471a) }, { UINT64_C(0xda8344dc0eeee9df), UINT64_C(0x194cdf4253f36c14) },
+		{ UINT64_C(0xe2029d7cd8bf2180), UINT64_C(0x143d7f6843292343) }, { UINT64_C(0x4e687dfd7a328133), UINT64_C(0x103132b9cf541c36) },
+		{ UINT64_C(0x4a40c9959050ceb8), UINT64_C(0x19e851294bb9c6bd) }, { UINT64_C(0x0833d477a6a70bc6), UINT64_C(0x14b9da876fc7d231) },
+		{ UINT64_C(0xa02976c61eec096b), UINT64_C(0x1094aed2bfd30e8d) }, { UINT64_C(0x004257a364acdbdf), UINT64_C(0x1a877e1dffb81749) },
+		{ UINT64_C(0xcd01dfb5ea23e319), UINT64_C(0x153931b1996012a0) }, { UINT64_C(0x70ce4c91881cb5ae), UINT64_C(0x10fa8e27ade6754d) },
+		{ UINT64_C(0x1ae3adb5a69455e2), UINT64_C(0x1b2a7d0c4970bbaf) }, { UINT64_C(0x7be957c4854377e8), UINT64_C(0x15bb973d078d62f2) },
+		{ UINT64_C(0xc987796a0435f987), UINT64_C(0x1162df64060ab58e) }, { UINT64_C(0x75a58f1006bcc271), UINT64_C(0x1bd1656cd67788e4) },
+		{ UINT64_C(0xf7b7a5a66bca3527), UINT64_C(0x16411df0ab92d3e9) }, { UINT64_C(0x5fc61e1ebca1c41f), UINT64_C(0x11cdb18d560f0fee) },
+		{ UINT64_C(0xffa363646102d365), UINT64_C(0x1c7c4f4889b1b316) }, { UINT64_C(0x32e91c504d9bdc51), UINT64_C(0x16c9d906d48e28df) },
+		{ UINT64_C(0x8f20e37371497d0e), UINT64_C(0x123b140576d820b2) }, { UINT64_C(0x7e9b0585820f2e7c), UINT64_C(0x1d2b533bf159cdea) },
+		{ UINT64_C(0xcbaf379e01a5beca), UINT64_C(0x1755dc2ff447d7ee) }, { UINT64_C(0x0958f94b348498a1), UINT64_C(0x12ab168cc36cacbf) }
+	};
+
+	static const int kDoublePow5BitCount    = 125;
+	static const int kDoublePow5InvBitCount = 125;
+
+
+	// Returns ceil(log2(5^e)) for e in [1, 3528], and 1 for e of 0.
+	static inline int32_t DoublePow5Bits(int32_t e)
+	{
+		return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+	}
+
+	// Returns floor(log10(2^e)) for e in [0, 1650].
+	static inline uint32_t DoubleLog10Pow2(int32_t e)
+	{
+		return ((uint32_t)e * 78913) >> 18;
+	}
+
+	// Returns floor(log10(5^e)) for e in [0, 2620].
+	static inline uint32_t DoubleLog10Pow5(int32_t e)
+	{
+		return ((uint32_t)e * 732923) >> 20;
+	}
+
+	static inline bool IsMultipleOfPowerOf5(uint64_t nValue, uint32_t nPower)
+	{
+		uint32_t nCount = 0;
+
+		while((nValue % 5) == 0)
+		{
+			nValue /= 5;
+			++nCount;
+		}
+
+		return nCount >= nPower;
+	}
+
+	static inline bool IsMultipleOfPowerOf2(uint64_t nValue, uint32_t nPower)
+	{
+		return (nValue & (((uint64_t)1 << nPower) - 1)) == 0;
+	}
+
+	// Returns (m * pMultiplier) >> nShift, where pMultiplier is a 128 bit value and nShift is in [64, 128).
+	static inline uint64_t MultiplyShift64(uint64_t m, const uint64_t* pMultiplier, int32_t nShift)
+	{
+		uint64_t nLow0, nLow1;
+		const uint64_t nHigh0 = Multiply64To128(m, pMultiplier[0], nLow0);
+		const uint64_t nHigh1 = Multiply64To128(m, pMultiplier[1], nLow1);
+		const uint64_t nSum   = nHigh0 + nLow1;
+		const uint64_t nHigh  = nHigh1 + (nSum < nHigh0); // Add the carry.
+
+		return (nSum >> (nShift - 64)) | ((nHigh << 1) << (127 - nShift)); // Two shifts, as nHigh << (128 - nShift) is undefined for a shift of 64.
+	}
+
+
+	EASTDC_API uint64_t DoubleToShortestDecimal(double dValue, int& nExponent)
+	{
+		uint64_t nBits;
+		memcpy(&nBits, &dValue, sizeof(nBits));
+
+		const uint64_t nIEEEMantissa = nBits & ((UINT64_C(1) << 52) - 1);
+		const uint32_t nIEEEExponent = (uint32_t)(nBits >> 52) & 0x7ff;
+
+		if((nIEEEExponent == 0) && (nIEEEMantissa == 0))
+		{
+			nExponent = 0;
+			return 0;
+		}
+
+		// Decode the value as m2 * 2^e2, with two extra bits of exponent so that the
+		// half way points to the neighboring doubles are integers too.
+		int32_t  e2;
+		uint64_t m2;
+
+		if(nIEEEExponent == 0) // If denormalized...
+		{
+			e2 = 1 - 1023 - 52 - 2;
+			m2 = nIEEEMantissa;
+		}
+		else
+		{
+			e2 = (int32_t)nIEEEExponent - 1023 - 52 - 2;
+			m2 = (UINT64_C(1) << 52) | nIEEEMantissa;
+		}
+
+		const bool bAcceptBounds = (m2 & 1) == 0; // Round to even means the interval includes its bounds when m2 is even.
+
+		// The interval of values that round to dValue is [mm, mp], the halfway points to the neighboring doubles.
+		const uint64_t mv      = 4 * m2;
+		const uint32_t mmShift = (nIEEEMantissa != 0) || (nIEEEExponent <= 1); // The lower neighbor is closer if m2 is a power of two.
+
+		// Convert mm, mv and mp to the decimal vm, vr and vp * 10^e10.
+		uint64_t vr, vp, vm;
+		int32_t  e10;
+		bool     bVmIsTrailingZeros = false;
+		bool     bVrIsTrailingZeros = false;
+
+		if(e2 >= 0)
+		{
+			const uint32_t q = DoubleLog10Pow2(e2) - (e2 > 3);
+			const int32_t  k = kDoublePow5InvBitCount + DoublePow5Bits((int32_t)q) - 1;
+			const int32_t  i = -e2 + (int32_t)q + k;
+
+			e10 = (int32_t)q;
+			vr  = MultiplyShift64(4 * m2,               kDoublePow5InvSplit[q], i);
+			vp  = MultiplyShift64(4 * m2 + 2,           kDoublePow5InvSplit[q], i);
+			vm  = MultiplyShift64(4 * m2 - 1 - mmShift, kDoublePow5InvSplit[q], i);
+
+			if(q <= 21)
+			{
+				// Only one of mp, mv and mm can be a multiple of 5, if any.
+				if((mv % 5) == 0)
+					bVrIsTrailingZeros = IsMultipleOfPowerOf5(mv, q);
+				else if(bAcceptBounds)
+					bVmIsTrailingZeros = IsMultipleOfPowerOf5(mv - 1 - mmShift, q);
+				else
+					vp -= IsMultipleOfPowerOf5(mv + 2, q);
+			}
+		}
+		else
+		{
+			const uint32_t q = DoubleLog10Pow5(-e2) - (-e2 > 1);
+			const int32_t  i = -e2 - (int32_t)q;
+			const int32_t  k = DoublePow5Bits(i) - kDoublePow5BitCount;
+			const int32_t  j = (int32_t)q - k;
+
+			e10 = (int32_t)q + e2;
+			vr  = MultiplyShift64(4 * m2,               kDoublePow5Split[i], j);
+			vp  = MultiplyShift64(4 * m2 + 2,           kDoublePow5Split[i], j);
+			vm  = MultiplyShift64(4 * m2 - 1 - mmShift, kDoublePow5Split[i], j);
+
+			if(q <= 1)
+			{
+				// mv = 4 * m2 always has at least two trailing zero bits.
+				bVrIsTrailingZeros = true;
+
+				if(bAcceptBounds)
+					bVmIsTrailingZeros = (mmShift == 1); // mm = mv - 1 - mmShift has a trailing zero bit iff mmShift is 1.
+				else
+					--vp; // mp = mv + 2 always has at least one trailing zero bit.
+			}
+			else if(q < 63)
+				bVrIsTrailingZeros = IsMultipleOfPowerOf2(mv, q);
+		}
+
+		// Remove as many digits as possible while vp and vm still differ, and round vr.
+		int32_t  nRemoved = 0;
+		uint32_t nLastRemovedDigit = 0;
+		uint64_t nOutput;
+
+		if(bVmIsTrailingZeros || bVrIsTrailingZeros) // Rare case, in which exact ties and the interval bounds matter.
+		{
+			while((vp / 10) > (vm / 10))
+			{
+				bVmIsTrailingZeros &= ((vm % 10) == 0);
+				bVrIsTrailingZeros &= (nLastRemovedDigit == 0);
+				nLastRemovedDigit = (uint32_t)(vr % 10);
+				vr /= 10; vp /= 10; vm /= 10;
+				++nRemoved;
+			}
+
+			if(bVmIsTrailingZeros)
+			{
+				while((vm % 10) == 0)
+				{
+					bVrIsTrailingZeros &= (nLastRemovedDigit == 0);
+					nLastRemovedDigit = (uint32_t)(vr % 10);
+					vr /= 10; vp /= 10; vm /= 10;
+					++nRemoved;
+				}
+			}
+
+			if(bVrIsTrailingZeros && (nLastRemovedDigit == 5) && ((vr % 2) == 0))
+				nLastRemovedDigit = 4; // Round to even if the exact value is ...50000.
+
+			nOutput = vr + (((vr == vm) && (!bAcceptBounds || !bVmIsTrailingZeros)) || (nLastRemovedDigit >= 5));
+		}
+		else // Common case.
+		{
+			bool bRoundUp = false;
+
+			if((vp / 100) > (vm / 100))
+			{
+				bRoundUp = (vr % 100) >= 50;
+				vr /= 100; vp /= 100; vm /= 100;
+				nRemoved += 2;
+			}
+
+			while((vp / 10) > (vm / 10))
+			{
+				bRoundUp = (vr % 10) >= 5;
+				vr /= 10; vp /= 10; vm /= 10;
+				++nRemoved;
+			}
+
+			nOutput = vr + ((vr == vm) || bRoundUp);
+		}
+
+		// Rounding up can produce trailing zeroes, as with 9.5 -> 10.
+		nExponent = e10 + nRemoved;
+
+		while((nOutput % 10) == 0)
+		{
+			nOutput /= 10;
+			++nExponent;
+		}
+
+		return nOutput;
+	}
+
+} // namespace Internal
+
+
+template <typename CharT>
+static CharT* FtoaShortestCommon(double dValue, CharT* pResult, int nResultCapacity)
+{
+	CharT    buffer[Internal::kShortestDoubleLengthMax];
+	CharT*   pEnd = buffer;
+	uint64_t nBits;
+
+	memcpy(&nBits, &dValue, sizeof(nBits));
+	if(nBits >> 63) // Test the sign bit rather than dValue < 0, so that -0 is written as "-0" and reads back as -0.
+		*pEnd++ = '-';
+
+	if(IsNAN(dValue))
+	{
+		*pEnd++ = 'n'; *pEnd++ = 'a'; *pEnd++ = 'n';
+	}
+	else if(IsInfinite(dValue))
+	{
+		*pEnd++ = 'i'; *pEnd++ = 'n'; *pEnd++ = 'f';
+	}
+	else
+		pEnd = Internal::WriteShortestDouble(dValue, pEnd, (CharT)'.', (CharT)'e');
+
+	const int nLength = (int)(pEnd - buffer);
+
+	if(nLength >= nResultCapacity)
+		return NULL;
+
+	for(int i = 0; i < nLength; i++)
+		pResult[i] = buffer[i];
+	pResult[nLength] = 0;
+
+	return pResult;
+}
+
+
+EASTDC_API char* FtoaShortest(double dValue, char* pResult, int nResultCapacity)
+{
+	return FtoaShortestCommon(dValue, pResult, nResultCapacity);
+}
+
+EASTDC_API char16_t* FtoaShortest(double dValue, char16_t* pResult, int nResultCapacity)
+{
+	return FtoaShortestCommon(dValue, pResult, nResultCapacity);
+}
+
+EASTDC_API char32_t* FtoaShortest(double dValue, char32_t* pResult, int nResultCapacity)
+{
+	return FtoaShortestCommon(dValue, pResult, nResultCapacity);
+}
+
+
 
 EASTDC_API size_t ReduceFloatString(char* pString, size_t nLength)
 {
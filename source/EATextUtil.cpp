@@ -6,6 +6,9 @@
 #include <EAStdC/internal/Config.h>
 #include <EAStdC/EATextUtil.h>
 #include <EAStdC/EAString.h>
+#include <EAStdC/EABitTricks.h>
+#include <EAStdC/internal/CPUDispatch.h>
+#include <string.h>
 
 
 
@@ -53,92 +56,525 @@ extern uint8_t utf8lengthTable[256];
 // See 'http://www.cl.cam.ac.uk/~mgk25/unicode.html' or search for "UTF8 FAQ"
 // on the Internet for more details on UTF8 and Unicode.
 //
-EASTDC_API bool UTF8Validate(const char* pText, size_t nLength)
+// Returns the position after the UTF8 char at pSource8, or NULL if the char is invalid 
+// or the input string is not long enough to finish reading it.
+static const uint8_t* UTF8ValidateChar(const uint8_t* pSource8, const uint8_t* const pSource8End)
+{
+	if(pSource8[0] < 0x80)
+		++pSource8;
+	else if(pSource8[0] < 0xC2)
+		return NULL; // The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
+	else if(pSource8[0] < 0xE0) // If 2 input chars result in 1 output char...
+	{
+		if(pSource8End - pSource8 >= 2)
+		{
+			if(!((pSource8[1] ^ 0x80) < 0x40))
+				return NULL; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
+			pSource8 += 2;
+		}
+		else
+			return NULL; //The input string is not long enough to finish reading the current character.
+	}
+	else if(pSource8[0] < 0xF0) // If 3 input chars result in 1 output char...
+	{
+		if((pSource8End - pSource8) >= 3)
+		{
+			if(!(((pSource8[1] ^ 0x80) < 0x40) &&
+				 ((pSource8[2] ^ 0x80) < 0x40) &&
+				  (pSource8[0] >= 0xE1 || pSource8[1] >= 0xA0)))
+				return NULL; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
+			pSource8 += 3;
+		}
+		else
+			return NULL; //The input string is not long enough to finish reading the current character.
+	}
+	else if(pSource8[0] < 0xF8) // If 4 input chars result in 1 output char...
+	{
+		if((pSource8End - pSource8) >= 4)
+		{
+			if(!(((pSource8[1] ^ 0x80) < 0x40) &&
+				 ((pSource8[2] ^ 0x80) < 0x40) &&
+				 ((pSource8[3] ^ 0x80) < 0x40) &&
+				  (pSource8[0] >= 0xF1 || pSource8[1] >= 0x90)))
+				return NULL; // The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
+			pSource8 += 4;
+		}
+		else
+			return NULL; //The input string is not long enough to finish reading the current character.
+	}
+	else if(pSource8[0] < 0xFC) // If 5 input chars result in 1 output char...
+	{
+		if((pSource8End - pSource8) >= 5)
+		{
+			if(!(((pSource8[1] ^ 0x80) < 0x40) &&
+				 ((pSource8[2] ^ 0x80) < 0x40) &&
+				 ((pSource8[3] ^ 0x80) < 0x40) &&
+				 ((pSource8[4] ^ 0x80) < 0x40) &&
+				  (pSource8[0] >= 0xf9 || pSource8[1] >= 0x88)))
+				return NULL; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
+			pSource8 += 5;
+		}
+		else
+			return NULL; //The input string is not long enough to finish reading the current character.
+	}
+	else if(pSource8[0] < 0xFE) // If 6 input chars result in 1 output char...
+	{
+		if((pSource8End - pSource8) >= 6)
+		{
+			if(!(((pSource8[1] ^ 0x80) < 0x40) &&
+				 ((pSource8[2] ^ 0x80) < 0x40) &&
+				 ((pSource8[3] ^ 0x80) < 0x40) &&
+				 ((pSource8[4] ^ 0x80) < 0x40) &&
+				 ((pSource8[5] ^ 0x80) < 0x40) &&
+				  (pSource8[0] >= 0xfd || pSource8[1] >= 0x84)))
+				return NULL; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
+			pSource8 += 6;
+		}
+		else
+			return NULL; //The input string is not long enough to finish reading the current character.
+	}
+	else //Else the current input char is invalid.
+		return NULL;
+
+	return pSource8;
+}
+
+
+// UTF8Validate kernels, called by UTF8ValidateEx via the CPU dispatch table. Each validates as 
+// long a prefix of the string as it can handle quickly and returns its length, which is always 
+// on a char boundary, along with the number of chars in it. Everything else is left to 
+// UTF8ValidateChar, so it's always correct for a kernel to validate less.
+//
+// The scalar version handles only ASCII. The SIMD versions classify 64 bytes at a time with 
+// range compares into bit masks of lead bytes, following bytes and invalid bytes, then check 
+// that following bytes are exactly where the lead bytes expect them and that E0 and F0 aren't 
+// overlong, carrying expectations over into the next block. Blocks with no high bit set and 
+// no carried expectation are skipped after a single test. The 5 and 6 byte sequences that 
+// UTF8ValidateChar accepts are classified as invalid and thus are left to it.
+namespace Internal
 {
+	size_t UTF8ValidateScalar(const char* p, size_t nLength, size_t& nCodePointCount)
+	{
+		size_t i = 0;
+
+		for(; (i + 8) <= nLength; i += 8)
+		{
+			uint64_t u;
+			memcpy(&u, p + i, sizeof(u));
+
+			if(u & UINT64_C(0x8080808080808080))
+				break;
+		}
+
+		nCodePointCount = i;
+		return i;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Bit i of each mask refers to byte i of a 64 byte block. mGeXX is the mask of bytes >= 0xXX.
+		struct UTF8ValidateMasks
+		{
+			uint64_t mNonASCII;
+			uint64_t mGe90;
+			uint64_t mGeA0;
+			uint64_t mGeC0;
+			uint64_t mGeC2;
+			uint64_t mGeE0;
+			uint64_t mGeF0;
+			uint64_t mGeF8;
+			uint64_t mE0;
+			uint64_t mF0;
+		};
+
+		struct UTF8ValidateState
+		{
+			size_t   mCount;            // Chars started in the blocks validated so far.
+			size_t   mResume;           // Length of the validated prefix, which ends on a char boundary.
+			size_t   mCountAtResume;    // Chars in the validated prefix.
+			uint64_t mCarryFollowing;   // Following bytes expected at the beginning of the next block.
+			uint64_t mCarryE0;          // Set if the previous block ended with 0xE0.
+			uint64_t mCarryF0;          // Set if the previous block ended with 0xF0.
+		};
+
+		EA_FORCE_INLINE void UTF8ValidateASCIIBlock(UTF8ValidateState& state, size_t i)
+		{
+			state.mCount        += 64;
+			state.mResume        = i + 64;
+			state.mCountAtResume = state.mCount;
+		}
+
+		// Returns false if the block at offset i isn't valid, in which case state is unchanged.
+		EA_FORCE_INLINE bool UTF8ValidateBlock(const UTF8ValidateMasks& m, UTF8ValidateState& state, size_t i)
+		{
+			const uint64_t following = m.mNonASCII & ~m.mGeC0;
+			const uint64_t lead2     = m.mGeC2 & ~m.mGeE0;
+			const uint64_t lead3     = m.mGeE0 & ~m.mGeF0;
+			const uint64_t lead4     = m.mGeF0 & ~m.mGeF8;
+			const uint64_t lead34    = lead3 | lead4;
+			const uint64_t leads     = lead2 | lead34;
+			const uint64_t expected  = (leads << 1) | (lead34 << 2) | (lead4 << 3) | state.mCarryFollowing;
+			const uint64_t invalid   = (m.mGeC0 & ~m.mGeC2) | m.mGeF8;
+			const uint64_t overlong  = (((m.mE0 << 1) | state.mCarryE0) & ~m.mGeA0) |  // E0 must be followed by >= A0
+									   (((m.mF0 << 1) | state.mCarryF0) & ~m.mGe90);   // F0 must be followed by >= 90
+
+			if(invalid | (expected ^ following) | overlong)
+				return false;
+
+			state.mCarryFollowing = (leads >> 63) | (lead34 >> 62) | (lead4 >> 61);
+			state.mCarryE0        = (m.mE0 >> 63);
+			state.mCarryF0        = (m.mF0 >> 63);
+			state.mCount         += (size_t)CountBits64(~following);
+
+			if(state.mCarryFollowing) // If the last char continues into the next block, the prefix ends before its lead byte.
+			{
+				state.mResume        = i + 63 - (size_t)CountLeading0Bits(leads);
+				state.mCountAtResume = state.mCount - 1;
+			}
+			else
+			{
+				state.mResume        = i + 64;
+				state.mCountAtResume = state.mCount;
+			}
+
+			return true;
+		}
+
+
+		// Returns the mask of the 64 chars in x (which have been xor'd with 0x80) that are greater than c.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE uint64_t UTF8ValidateGreaterSSE2(const __m128i* x, uint8_t c)
+		{
+			const __m128i v = _mm_set1_epi8((char)(c ^ 0x80));
+
+			return  (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(x[0], v))        |
+				   ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(x[1], v)) << 16) |
+				   ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(x[2], v)) << 32) |
+				   ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(x[3], v)) << 48);
+		}
+
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE uint64_t UTF8ValidateEqualSSE2(const __m128i* x, uint8_t c)
+		{
+			const __m128i v = _mm_set1_epi8((char)(c ^ 0x80));
+
+			return  (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x[0], v))        |
+				   ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x[1], v)) << 16) |
+				   ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x[2], v)) << 32) |
+				   ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x[3], v)) << 48);
+		}
+
+		EASTDC_TARGET_SSE2 size_t UTF8ValidateSSE2(const char* p, size_t nLength, size_t& nCodePointCount)
+		{
+			const __m128i     kHighBit = _mm_set1_epi8((char)0x80);
+			UTF8ValidateState state    = { 0, 0, 0, 0, 0, 0 };
+
+			for(size_t i = 0; (i + 64) <= nLength; i += 64)
+			{
+				__m128i x[4];
+
+				for(int j = 0; j < 4; j++)
+					x[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + (j * 16)));
+
+				UTF8ValidateMasks m;
+
+				m.mNonASCII =  (uint64_t)(uint32_t)_mm_movemask_epi8(x[0])        |
+							  ((uint64_t)(uint32_t)_mm_movemask_epi8(x[1]) << 16) |
+							  ((uint64_t)(uint32_t)_mm_movemask_epi8(x[2]) << 32) |
+							  ((uint64_t)(uint32_t)_mm_movemask_epi8(x[3]) << 48);
+
+				if((m.mNonASCII | state.mCarryFollowing) == 0)
+				{
+					UTF8ValidateASCIIBlock(state, i);
+					continue;
+				}
+
+				for(int j = 0; j < 4; j++) // Make unsigned order signed, for _mm_cmpgt_epi8.
+					x[j] = _mm_xor_si128(x[j], kHighBit);
+
+				m.mGe90 = UTF8ValidateGreaterSSE2(x, 0x8f);
+				m.mGeA0 = UTF8ValidateGreaterSSE2(x, 0x9f);
+				m.mGeC0 = UTF8ValidateGreaterSSE2(x, 0xbf);
+				m.mGeC2 = UTF8ValidateGreaterSSE2(x, 0xc1);
+				m.mGeE0 = UTF8ValidateGreaterSSE2(x, 0xdf);
+				m.mGeF0 = UTF8ValidateGreaterSSE2(x, 0xef);
+				m.mGeF8 = UTF8ValidateGreaterSSE2(x, 0xf7);
+				m.mE0   = UTF8ValidateEqualSSE2(x, 0xe0);
+				m.mF0   = UTF8ValidateEqualSSE2(x, 0xf0);
+
+				if(!UTF8ValidateBlock(m, state, i))
+					break;
+			}
+
+			nCodePointCount = state.mCountAtResume;
+			return state.mResume;
+		}
+
+
+		EASTDC_TARGET_AVX2 EA_FORCE_INLINE uint64_t UTF8ValidateGreaterAVX2(const __m256i* x, uint8_t c)
+		{
+			const __m256i v = _mm256_set1_epi8((char)(c ^ 0x80));
+
+			return  (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(x[0], v)) |
+				   ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(x[1], v)) << 32);
+		}
+
+		EASTDC_TARGET_AVX2 EA_FORCE_INLINE uint64_t UTF8ValidateEqualAVX2(const __m256i* x, uint8_t c)
+		{
+			const __m256i v = _mm256_set1_epi8((char)(c ^ 0x80));
+
+			return  (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x[0], v)) |
+				   ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x[1], v)) << 32);
+		}
+
+		EASTDC_TARGET_AVX2 size_t UTF8ValidateAVX2(const char* p, size_t nLength, size_t& nCodePointCount)
+		{
+			const __m256i     kHighBit = _mm256_set1_epi8((char)0x80);
+			UTF8ValidateState state    = { 0, 0, 0, 0, 0, 0 };
+
+			for(size_t i = 0; (i + 64) <= nLength; i += 64)
+			{
+				__m256i x[2];
+
+				x[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+				x[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32));
+
+				UTF8ValidateMasks m;
+
+				m.mNonASCII =  (uint64_t)(uint32_t)_mm256_movemask_epi8(x[0]) |
+							  ((uint64_t)(uint32_t)_mm256_movemask_epi8(x[1]) << 32);
+
+				if((m.mNonASCII | state.mCarryFollowing) == 0)
+				{
+					UTF8ValidateASCIIBlock(state, i);
+					continue;
+				}
+
+				x[0] = _mm256_xor_si256(x[0], kHighBit); // Make unsigned order signed, for _mm256_cmpgt_epi8.
+				x[1] = _mm256_xor_si256(x[1], kHighBit);
+
+				m.mGe90 = UTF8ValidateGreaterAVX2(x, 0x8f);
+				m.mGeA0 = UTF8ValidateGreaterAVX2(x, 0x9f);
+				m.mGeC0 = UTF8ValidateGreaterAVX2(x, 0xbf);
+				m.mGeC2 = UTF8ValidateGreaterAVX2(x, 0xc1);
+				m.mGeE0 = UTF8ValidateGreaterAVX2(x, 0xdf);
+				m.mGeF0 = UTF8ValidateGreaterAVX2(x, 0xef);
+				m.mGeF8 = UTF8ValidateGreaterAVX2(x, 0xf7);
+				m.mE0   = UTF8ValidateEqualAVX2(x, 0xe0);
+				m.mF0   = UTF8ValidateEqualAVX2(x, 0xf0);
+
+				if(!UTF8ValidateBlock(m, state, i))
+					break;
+			}
+
+			nCodePointCount = state.mCountAtResume;
+			return state.mResume;
+		}
+	#endif
+
+} // namespace Internal
+
+
+EASTDC_API bool UTF8ValidateEx(const char* pText, size_t nLength, size_t& nInvalidOffset, size_t& nCodePointCount)
+{
+	const Internal::CPUDispatchTable& table = Internal::GetCPUDispatchTable();
+
 	const uint8_t*       pSource8    = (const uint8_t*)pText;
 	const uint8_t* const pSource8End = pSource8 + nLength;
+	size_t               nCount      = 0;
 
 	while(pSource8 < pSource8End)
 	{
-		if(pSource8[0] < 0x80)
-			++pSource8;
-		else if(pSource8[0] < 0xC2)
-			break; // The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
-		else if(pSource8[0] < 0xE0) // If 2 input chars result in 1 output char...
+		size_t nKernelCount;
+
+		pSource8 += table.mpUTF8Validate((const char*)pSource8, (size_t)(pSource8End - pSource8), nKernelCount);
+		nCount   += nKernelCount;
+
+		// Validate at least a block's worth of what the kernel couldn't handle before trying it again.
+		const uint8_t* const pSource8Stop = pSource8 + EATEXTUTIL_MIN((size_t)(pSource8End - pSource8), (size_t)64);
+
+		while(pSource8 < pSource8Stop)
 		{
-			if(pSource8End - pSource8 >= 2)
+			const uint8_t* const pNext = UTF8ValidateChar(pSource8, pSource8End);
+
+			if(!pNext)
 			{
-				if(!((pSource8[1] ^ 0x80) < 0x40))
-					break; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
-				pSource8 += 2;
+				nInvalidOffset  = (size_t)(pSource8 - (const uint8_t*)pText);
+				nCodePointCount = nCount;
+				return false;
 			}
-			else
-				break; //The input string is not long enough to finish reading the current character.
+
+			pSource8 = pNext;
+			nCount++;
+		}
+	}
+
+	nInvalidOffset  = nLength;
+	nCodePointCount = nCount;
+	return true;
+}
+
+
+EASTDC_API bool UTF8Validate(const char* pText, size_t nLength)
+{
+	size_t nInvalidOffset, nCodePointCount;
+
+	return UTF8ValidateEx(pText, nLength, nInvalidOffset, nCodePointCount);
+}
+
+
+// UTF8CountChars kernels, called by UTF8Length via the CPU dispatch table. Each returns the 
+// number of chars in the string, which is the number of bytes that aren't following bytes 
+// (0x80-0xbf). Embedded 0 chars are counted like any other.
+//
+// UTF8Increment kernels, called by UTF8Increment via the CPU dispatch table. Each advances p 
+// over as many of the n chars as it can handle quickly, reducing n accordingly, and returns p. 
+// As with the general code, the string must be valid UTF8 and contain at least n chars, but the 
+// terminating 0 char need not be there. Thus the kernels read blocks of bytes only when there are 
+// more chars to go than there are bytes in the block, as each char is at least one byte, and 
+// they always leave at least one char for the general code.
+namespace Internal
+{
+	// Returns the number of bytes in the word which aren't following bytes.
+	EA_FORCE_INLINE size_t UTF8CountCharsWord(uint64_t u)
+	{
+		const uint64_t following = (u & ~(u << 1)) & UINT64_C(0x8080808080808080); // High bit set and next bit clear.
+
+		return 8 - (size_t)(((following >> 7) * UINT64_C(0x0101010101010101)) >> 56);
+	}
+
+	size_t UTF8CountCharsScalar(const char* p, size_t nLength)
+	{
+		size_t n = 0, i = 0;
+
+		for(; (i + 8) <= nLength; i += 8)
+		{
+			uint64_t u;
+			memcpy(&u, p + i, sizeof(u));
+			n += UTF8CountCharsWord(u);
+		}
+
+		for(; i < nLength; i++)
+		{
+			if((p[i] & 0xc0) != 0x80) // If this is a leading char...
+				++n;
+		}
+
+		return n;
+	}
+
+	const char* UTF8IncrementScalar(const char* p, size_t& n)
+	{
+		while(n > 8)
+		{
+			const size_t nBlockLength = EATEXTUTIL_MIN((n - 1) & ~(size_t)7, (size_t)4096); // < n
+
+			n -= UTF8CountCharsScalar(p, nBlockLength);
+			p += nBlockLength;
+
+			while((*p & 0xc0) == 0x80) // Skip the rest of the last char started in the block.
+				++p;
+		}
+
+		return p;
+	}
+
+
+	#if EASTDC_CPU_DISPATCH_ENABLED
+		// Returns the number of bytes in [p, p + nLength) which aren't following bytes. nLength must 
+		// be a multiple of 16 and no more than 255 * 16, so that the per lane counts don't overflow.
+		EASTDC_TARGET_SSE2 EA_FORCE_INLINE size_t UTF8CountCharsBlockSSE2(const char* p, size_t nLength)
+		{
+			const __m128i zero           = _mm_setzero_si128();
+			const __m128i kLastFollowing = _mm_set1_epi8((char)0xbf);
+			__m128i       counts         = zero;
+
+			for(size_t i = 0; i < nLength; i += 16) // Signed compares, for which only following bytes are <= 0xbf.
+				counts = _mm_sub_epi8(counts, _mm_cmpgt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), kLastFollowing));
+
+			counts = _mm_sad_epu8(counts, zero);
+			return (size_t)_mm_cvtsi128_si32(counts) + (size_t)_mm_extract_epi16(counts, 4);
 		}
-		else if(pSource8[0] < 0xF0) // If 3 input chars result in 1 output char...
+
+		EASTDC_TARGET_SSE2 size_t UTF8CountCharsSSE2(const char* p, size_t nLength)
 		{
-			if((pSource8End - pSource8) >= 3)
+			size_t n = 0, i = 0;
+
+			while((nLength - i) >= 16)
 			{
-				if(!(((pSource8[1] ^ 0x80) < 0x40) &&
-					 ((pSource8[2] ^ 0x80) < 0x40) &&
-					  (pSource8[0] >= 0xE1 || pSource8[1] >= 0xA0)))
-					break; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
-				pSource8 += 3;
+				const size_t nBlockLength = EATEXTUTIL_MIN((nLength - i) & ~(size_t)15, (size_t)(255 * 16));
+
+				n += UTF8CountCharsBlockSSE2(p + i, nBlockLength);
+				i += nBlockLength;
 			}
-			else
-				break; //The input string is not long enough to finish reading the current character.
+
+			return n + UTF8CountCharsScalar(p + i, nLength - i);
 		}
-		else if(pSource8[0] < 0xF8) // If 4 input chars result in 1 output char...
+
+		EASTDC_TARGET_SSE2 const char* UTF8IncrementSSE2(const char* p, size_t& n)
 		{
-			if((pSource8End - pSource8) >= 4)
+			while(n > 64)
 			{
-				if(!(((pSource8[1] ^ 0x80) < 0x40) &&
-					 ((pSource8[2] ^ 0x80) < 0x40) &&
-					 ((pSource8[3] ^ 0x80) < 0x40) &&
-					  (pSource8[0] >= 0xF1 || pSource8[1] >= 0x90)))
-					break; // The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
-				pSource8 += 4;
+				const size_t nBlockLength = EATEXTUTIL_MIN((n - 1) & ~(size_t)63, (size_t)(63 * 64)); // < n
+
+				n -= UTF8CountCharsBlockSSE2(p, nBlockLength);
+				p += nBlockLength;
+
+				while((*p & 0xc0) == 0x80) // Skip the rest of the last char started in the block.
+					++p;
 			}
-			else
-				break; //The input string is not long enough to finish reading the current character.
+
+			return UTF8IncrementScalar(p, n);
 		}
-		else if(pSource8[0] < 0xFC) // If 5 input chars result in 1 output char...
+
+
+		// Returns the number of bytes in [p, p + nLength) which aren't following bytes. nLength must 
+		// be a multiple of 32 and no more than 255 * 32, so that the per lane counts don't overflow.
+		EASTDC_TARGET_AVX2 EA_FORCE_INLINE size_t UTF8CountCharsBlockAVX2(const char* p, size_t nLength)
 		{
-			if((pSource8End - pSource8) >= 5)
+			const __m256i zero           = _mm256_setzero_si256();
+			const __m256i kLastFollowing = _mm256_set1_epi8((char)0xbf);
+			__m256i       counts         = zero;
+
+			for(size_t i = 0; i < nLength; i += 32) // Signed compares, for which only following bytes are <= 0xbf.
+				counts = _mm256_sub_epi8(counts, _mm256_cmpgt_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), kLastFollowing));
+
+			counts = _mm256_sad_epu8(counts, zero);
+			const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(counts), _mm256_extracti128_si256(counts, 1));
+			return (size_t)_mm_cvtsi128_si32(sum) + (size_t)_mm_extract_epi16(sum, 4);
+		}
+
+		EASTDC_TARGET_AVX2 size_t UTF8CountCharsAVX2(const char* p, size_t nLength)
+		{
+			size_t n = 0, i = 0;
+
+			while((nLength - i) >= 32)
 			{
-				if(!(((pSource8[1] ^ 0x80) < 0x40) &&
-					 ((pSource8[2] ^ 0x80) < 0x40) &&
-					 ((pSource8[3] ^ 0x80) < 0x40) &&
-					 ((pSource8[4] ^ 0x80) < 0x40) &&
-					  (pSource8[0] >= 0xf9 || pSource8[1] >= 0x88)))
-					break; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
-				pSource8 += 5;
+				const size_t nBlockLength = EATEXTUTIL_MIN((nLength - i) & ~(size_t)31, (size_t)(255 * 32));
+
+				n += UTF8CountCharsBlockAVX2(p + i, nBlockLength);
+				i += nBlockLength;
 			}
-			else
-				break; //The input string is not long enough to finish reading the current character.
+
+			return n + UTF8CountCharsScalar(p + i, nLength - i);
 		}
-		else if(pSource8[0] < 0xFE) // If 6 input chars result in 1 output char...
+
+		EASTDC_TARGET_AVX2 const char* UTF8IncrementAVX2(const char* p, size_t& n)
 		{
-			if((pSource8End - pSource8) >= 6)
+			while(n > 64)
 			{
-				if(!(((pSource8[1] ^ 0x80) < 0x40) &&
-					 ((pSource8[2] ^ 0x80) < 0x40) &&
-					 ((pSource8[3] ^ 0x80) < 0x40) &&
-					 ((pSource8[4] ^ 0x80) < 0x40) &&
-					 ((pSource8[5] ^ 0x80) < 0x40) &&
-					  (pSource8[0] >= 0xfd || pSource8[1] >= 0x84)))
-					break; //The character is invalid. It is important that we check for this because various security issues potentially arise if we don't.
-				pSource8 += 6;
+				const size_t nBlockLength = EATEXTUTIL_MIN((n - 1) & ~(size_t)63, (size_t)(127 * 64)); // < n
+
+				n -= UTF8CountCharsBlockAVX2(p, nBlockLength);
+				p += nBlockLength;
+
+				while((*p & 0xc0) == 0x80) // Skip the rest of the last char started in the block.
+					++p;
 			}
-			else
-				break; //The input string is not long enough to finish reading the current character.
+
+			return UTF8IncrementScalar(p, n);
 		}
-		else //Else the current input char is invalid.
-			break;
-	}
+	#endif
 
-	return (pSource8 == pSource8End); // The return value is OK if we successfully processed all characters.
-}
+} // namespace Internal
 
 
 // Returns the pointer p incremented by n multibyte characters.
@@ -147,6 +583,8 @@ EASTDC_API bool UTF8Validate(const char* pText, size_t nLength)
 // or a validating version of this function should be used instead.
 EASTDC_API char* UTF8Increment(const char* p, size_t n)
 {
+	p = Internal::GetCPUDispatchTable().mpUTF8Increment(p, n);
+
 	while(n--)
 	{
 		// To do: Change this code to instead use the utf8lengthTable fropm EAString.cpp
@@ -199,16 +637,20 @@ EASTDC_API char* UTF8Decrement(const char* p, size_t n)
 // or a validating version of this function should be used instead.
 EASTDC_API size_t UTF8Length(const char* p)
 {
-	size_t n = 0;
+	return Internal::GetCPUDispatchTable().mpUTF8CountChars(p, Strlen(p));
+}
 
-	while(*p)
-	{
-		if((*p & 0xc0) != 0x80) // If this is a leading char...
-			++n;
-		++p;
-	}
 
-	return n;
+// Returns number of Unicode characters are in the first nLength bytes of the UTF8-encoded string.
+// The string need not be 0-terminated, and any 0 chars in it are counted. If nLength is 
+// kLengthNull then this is the same as UTF8Length(p).
+// The string must be a valid UTF8 string or else the behavior is undefined.
+EASTDC_API size_t UTF8Length(const char* p, size_t nLength)
+{
+	if(nLength == kLengthNull)
+		nLength = Strlen(p);
+
+	return Internal::GetCPUDispatchTable().mpUTF8CountChars(p, nLength);
 }
 
 
@@ -7,6 +7,8 @@
 #define EASTDC_EASTDCTEST_H
 
 
+#include <EAStdC/EARandom.h>
+#include <EASTL/string.h>
 EA_DISABLE_ALL_VC_WARNINGS()
 EA_DISABLE_VC_WARNING(4530) // C++ exception handler used, but unwind semantics are not enabled.
 #include <stddef.h>
@@ -223,6 +225,53 @@ inline bool FloatEqual(float x1, float x2)
 		return FloatAbsoluteDifference((x1 - x2) / x1, 1e-7f) < 1e-5f;
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+// TestRandomCodePoint / TestAppendUTF8
+//
+// Random text for the tests of the UTF-8 functions. TestRandomCodePoint returns 
+// a random code point whose UTF-8 form is kind + 1 bytes long, for kind 0 to 3, 
+// or one beyond 0x10ffff for kind 4, whose legacy UTF-8 form is 4 to 6 bytes long. 
+// Tests which want runs of code points of the same length change kind now and 
+// then. TestAppendUTF8 appends c to s in UTF-8, including the legacy forms.
+///////////////////////////////////////////////////////////////////////////////
+
+inline uint32_t TestRandomCodePoint(EA::StdC::RandomFast& random, uint32_t kind)
+{
+	switch(kind)
+	{
+		case 0:  return 0x00001 + random.RandomUint32Uniform(0x7f);
+		case 1:  return 0x00080 + random.RandomUint32Uniform(0x780);
+		case 2:  return 0x00800 + random.RandomUint32Uniform(0xf800);
+		case 3:  return 0x10000 + random.RandomUint32Uniform(0x100000);
+		default:
+		{
+			const uint32_t nLengthKind = random.RandomUint32Uniform(3);
+
+			if(nLengthKind == 0)
+				return 0x110000 + random.RandomUint32Uniform(0xf0000);
+			if(nLengthKind == 1)
+				return 0x200000 + random.RandomUint32Uniform(0x3e00000);
+			return 0x4000000 + random.RandomUint32Uniform(0x7c000000);
+		}
+	}
+}
+
+inline void TestAppendUTF8(eastl::string& s, uint32_t c)
+{
+	if(c < 0x80)
+		s.push_back((char)c);
+	else
+	{
+		const int nLength = (c < 0x800) ? 2 : (c < 0x10000) ? 3 : (c < 0x200000) ? 4 : (c < 0x4000000) ? 5 : 6;
+
+		s.push_back((char)((0xff00 >> nLength) | (c >> (6 * (nLength - 1)))));
+		for(int i = nLength - 2; i >= 0; i--)
+			s.push_back((char)(0x80 | ((c >> (6 * i)) & 0x3f)));
+	}
+}
+
+
 #endif // Header include guard
 
 
@@ -7,6 +7,7 @@
 #include <EAStdC/EAHashString.h>
 #include <EAStdC/EAHashCRC.h>
 #include <EAStdC/EABitTricks.h>
+#include <EAStdC/EACPUDispatch.h>
 #include <EAStdCTest/EAStdCTest.h>
 #include <EATest/EATest.h>
 
@@ -287,6 +288,42 @@ int TestHash()
 	}
 
 
+	{ // Test CRC32Reverse at each CPU feature level, as it has runtime dispatched implementations.
+		using namespace EA::StdC;
+
+		const size_t kSize = 1100;
+		uint8_t      data[kSize];
+		uint32_t     expected[kSize + 1];
+
+		for(size_t i = 0; i < kSize; i++)
+			data[i] = (uint8_t)((i * 2654435761u) >> 13);
+
+		// This is the standard check value for the reflected CRC32 polynomial (as used by zlib and PNG).
+		EATEST_VERIFY(CRC32Reverse("123456789", 9) == 0xcbf43926);
+
+		SetCPUFeatureLevel(kCPUFeatureLevelScalar);
+		for(size_t size = 0; size <= kSize; size++)
+			expected[size] = CRC32Reverse(data, size);
+
+		for(int level = kCPUFeatureLevelScalar; level <= GetCPUFeatureLevelSupported(); level++)
+		{
+			EATEST_VERIFY(SetCPUFeatureLevel((CPUFeatureLevel)level) == level);
+			EATEST_VERIFY(CRC32Reverse("123456789", 9) == 0xcbf43926);
+
+			for(size_t size = 0; size <= kSize; size++)
+				EATEST_VERIFY(CRC32Reverse(data, size) == expected[size]);
+
+			for(size_t offset = 1; offset < 16; offset++) // Unaligned data, and iterative use with unfinalized values.
+			{
+				const uint32_t crc = CRC32Reverse(data, offset, kCRC32InitialValue, false);
+				EATEST_VERIFY(CRC32Reverse(data + offset, kSize - offset, crc, true) == expected[kSize]);
+			}
+		}
+
+		SetCPUFeatureLevel(kCPUFeatureLevelCount);
+	}
+
+
 	delete[] pDataA;
 	delete[] pDataB;
 	delete[] pData8A;
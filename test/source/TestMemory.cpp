@@ -10,11 +10,15 @@
 #include <EAStdC/EARandom.h>
 #include <EAStdC/EARandomDistribution.h>
 #include <EAStdC/EABitTricks.h>
+#include <EAStdC/EACPUDispatch.h>
 #include <EAStdCTest/EAStdCTest.h>
 #include <EATest/EATest.h>
 #include <string.h>
 #include <EAStdC/EAAlignment.h>
 #include <EASTL/vector.h>
+#if EASTDC_SYS_MMAN_H_AVAILABLE
+	#include <sys/mman.h>
+#endif
 
 #if defined(_MSC_VER)
 	#pragma warning(push)
@@ -188,6 +192,54 @@ static int TestMemset()
 	}
 
 
+	// uint8_t* Memset8_128(void* pDestination, uint8_t c, size_t uint8Count);
+	{
+		// Sizes on either side of EASTDC_MEMORY_STREAMING_THRESHOLD, above which non-temporal stores are used.
+		const size_t kSizes[] = { 0, 128, 4096, EASTDC_MEMORY_STREAMING_THRESHOLD - 128, EASTDC_MEMORY_STREAMING_THRESHOLD, EASTDC_MEMORY_STREAMING_THRESHOLD + 1280 };
+
+		for(size_t i = 0; i < EAArrayCount(kSizes); i++)
+		{
+			const size_t copySize = kSizes[i];
+			uint8_t*     pMem1    = gMem1;
+			const void*  pCheck;
+
+			EATEST_VERIFY(EA::StdC::Memset8_128(pMem1, kByte2, copySize) == pMem1);
+
+			pCheck = Memcheck8(pMem1 - 256, kByte1, 256);
+			EATEST_VERIFY(pCheck == NULL);
+
+			pCheck = Memcheck8(pMem1, kByte2, copySize);
+			EATEST_VERIFY(pCheck == NULL);
+
+			pCheck = Memcheck8(pMem1 + copySize, kByte1, 256);
+			EATEST_VERIFY(pCheck == NULL);
+
+			memset(pMem1, kByte1, copySize);
+		}
+
+		// The internal pathway itself has no alignment or size multiple requirements.
+		for(size_t offset = 0; offset < 20; offset++)
+		{
+			const size_t copySize = 1000 + (offset * 13);
+			uint8_t*     pMem1    = gMem1 + offset;
+			const void*  pCheck;
+
+			EA::StdC::Internal::MemsetNonTemporal(pMem1, kByte2, copySize);
+
+			pCheck = Memcheck8(pMem1 - 256, kByte1, 256);
+			EATEST_VERIFY(pCheck == NULL);
+
+			pCheck = Memcheck8(pMem1, kByte2, copySize);
+			EATEST_VERIFY(pCheck == NULL);
+
+			pCheck = Memcheck8(pMem1 + copySize, kByte1, 256);
+			EATEST_VERIFY(pCheck == NULL);
+
+			memset(pMem1, kByte1, copySize);
+		}
+	}
+
+
 	// uint16_t* Memset16(void* pDestination, uint16_t c, size_t count);
 	{
 		EA::StdC::Random r;
@@ -419,7 +471,24 @@ static int TestMemfill()
 
 	// void Memfill24(void* pDestination, uint32_t c, size_t byteCount);
 	{
-		// To do.
+		const uint8_t c24[3] = { 0x12, 0x34, 0x56 }; // Memfill24 writes the most significant byte first.
+		uint8_t buffer[300];
+
+		for(size_t i = 0; i < 34; i++)
+		{
+			for(size_t j = 0; j < 200; j += ((j < 70) ? 1 : 13))
+			{
+				memset(buffer, 0, sizeof(buffer));
+				Memfill24(buffer + i, 0x123456, j);
+
+				size_t k;
+				for(k = 0; (k < j) && (buffer[i + k] == c24[k % 3]); k++)
+					{ }
+				EATEST_VERIFY(k == j);
+				EATEST_VERIFY(Memcheck8(buffer, 0, i) == NULL);
+				EATEST_VERIFY(Memcheck8(buffer + i + j, 0, sizeof(buffer) - (i + j)) == NULL);
+			}
+		}
 	}
 
 	// void Memfill32(void* pDestination, uint32_t c, size_t byteCount);
@@ -429,12 +498,57 @@ static int TestMemfill()
 
 	// void Memfill64(void* pDestination, uint64_t c, size_t byteCount);
 	{
-		// To do.
+		const uint64_t c64 = UINT64_C(0x0123456789abcdef);
+		uint8_t c64Bytes[8];
+		uint8_t buffer[300];
+
+		memcpy(c64Bytes, &c64, sizeof(c64));
+
+		for(size_t i = 0; i < 34; i++)
+		{
+			for(size_t j = 0; j < 200; j += ((j < 70) ? 1 : 13))
+			{
+				memset(buffer, 0, sizeof(buffer));
+				Memfill64(buffer + i, c64, j);
+
+				size_t k;
+				for(k = 0; (k < j) && (buffer[i + k] == c64Bytes[k % 8]); k++)
+					{ }
+				EATEST_VERIFY(k == j);
+				EATEST_VERIFY(Memcheck8(buffer, 0, i) == NULL);
+				EATEST_VERIFY(Memcheck8(buffer + i + j, 0, sizeof(buffer) - (i + j)) == NULL);
+			}
+		}
 	}
 
 	// void MemfillSpecific(void* pDestination, const void* pSource, size_t destByteCount, size_t sourceByteCount);
 	{
-		// To do.
+		// Test all pattern sizes up to and somewhat beyond the 64 bytes that the SIMD implementations handle,
+		// with destination alignments that cover every head size for both 16 and 32 byte vectors.
+		uint8_t pattern[72];
+		uint8_t buffer[400];
+
+		for(size_t k = 0; k < sizeof(pattern); k++)
+			pattern[k] = (uint8_t)(k + 1); // Never zero, so the guard bytes below can't match.
+
+		for(size_t patternSize = 1; patternSize <= sizeof(pattern); patternSize++)
+		{
+			for(size_t i = 0; i < 34; i++)
+			{
+				for(size_t j = 0; j < 330; j += ((j < 140) ? 1 : 17))
+				{
+					memset(buffer, 0, sizeof(buffer));
+					MemfillSpecific(buffer + i, pattern, j, patternSize);
+
+					size_t k;
+					for(k = 0; (k < j) && (buffer[i + k] == pattern[k % patternSize]); k++)
+						{ }
+					EATEST_VERIFY(k == j);
+					EATEST_VERIFY(Memcheck8(buffer, 0, i) == NULL);
+					EATEST_VERIFY(Memcheck8(buffer + i + j, 0, sizeof(buffer) - (i + j)) == NULL);
+				}
+			}
+		}
 	}
 
 	return nErrorCount;
@@ -592,6 +706,55 @@ static int TestMemcheck()
 		}
 	}
 
+	// Larger sizes with every start alignment and mismatch position, which exercise the vectorized pathways.
+	{
+		const uint64_t c64 = UINT64_C(0x8899aabbccddeeff);
+		uint8_t* const pMem = gMem1;
+
+		Memfill64(pMem, c64, 512); // gMem1 is 64 KiB aligned, so the uint64_t value is naturally aligned.
+
+		for(size_t offset = 0; offset < 40; offset++)
+		{
+			for(size_t size = 0; size < 300; size += 7)
+			{
+				// The low half of c64 matches only the first four bytes of each uint64_t, so Memcheck32
+				// is expected to fail at the first address whose uint64_t-relative offset is >= 4.
+				const uint32_t c32       = (uint32_t)c64;
+				const uint8_t* pExpected = NULL;
+
+				for(size_t i = 0; (i < size) && !pExpected; i++)
+				{
+					if(pMem[offset + i] != ((const uint8_t*)&c32)[(offset + i) % 4])
+						pExpected = pMem + offset + i;
+				}
+
+				EATEST_VERIFY(Memcheck64(pMem + offset, c64,          size) == NULL);
+				EATEST_VERIFY(Memcheck32(pMem + offset, c32,          size) == pExpected);
+				EATEST_VERIFY(Memcheck8 (pMem + offset, pMem[offset], size) == ((size > 1) ? pMem + offset + 1 : NULL));
+
+				for(size_t i = 0; i < size; i += 3)
+				{
+					uint8_t* const pMismatch = pMem + offset + i;
+					*pMismatch ^= 0x10;
+					EATEST_VERIFY(Memcheck64(pMem + offset, c64, size) == pMismatch);
+					*pMismatch ^= 0x10;
+				}
+			}
+		}
+
+		memset(pMem, 0x5a, 512);
+		Memfill16(pMem + 512, 0x5b5a, 512);
+
+		for(size_t offset = 0; offset < 40; offset++)
+		{
+			EATEST_VERIFY(Memcheck8(pMem + offset, 0x5a, 512 - offset) == NULL);
+			EATEST_VERIFY(Memcheck8(pMem + offset, 0x5a, 600 - offset) == pMem + 512 + 1);
+			EATEST_VERIFY(Memcheck16(pMem + 512 + offset, 0x5b5a, 512 - offset) == NULL);
+		}
+
+		memset(pMem, kByte1, 1024);
+	}
+
 	return nErrorCount;
 }
 
@@ -611,6 +774,146 @@ static int TestMemchr()
 		EATEST_VERIFY((char*)Memchr(s, (char)'&', Strlen(s)) - s == 26);
 	}
 
+	{   // Memchr8 with every match position, for sizes and offsets that exercise the vectorized head, body and tail handling.
+		char buffer[300];
+
+		memset(buffer, 'a', sizeof(buffer));
+
+		for(size_t offset = 0; offset < 33; offset++)
+		{
+			for(size_t size = 0; (offset + size) <= sizeof(buffer); size += ((size < 70) ? 1 : 23))
+			{
+				EATEST_VERIFY(Memchr(buffer + offset, 'b', size) == NULL);
+
+				for(size_t i = 0; i < size; i++)
+				{
+					buffer[offset + i] = 'b';
+					EATEST_VERIFY(Memchr(buffer + offset, 'b', size) == (buffer + offset + i));
+					buffer[size - 1 + offset] = 'b'; // A later match must not affect the result.
+					EATEST_VERIFY(Memchr(buffer + offset, 'b', size) == (buffer + offset + i));
+					buffer[size - 1 + offset] = 'a';
+					buffer[offset + i] = 'a';
+				}
+			}
+		}
+	}
+
+	{   // Memchr16, Memchr32, Memrchr, Memrchr16, Memrchr32 with every match position.
+		char     buffer8[300];
+		char16_t buffer16[300];
+		char32_t buffer32[300];
+
+		for(size_t k = 0; k < 300; k++)
+		{
+			buffer8[k]  = 'a';
+			buffer16[k] = 0x1261; // The low byte of each unit matches the 8 bit pattern in 0x2612 and 0x6126 below, which must not be found.
+			buffer32[k] = 0x12610000;
+		}
+
+		for(size_t offset = 0; offset < 17; offset++)
+		{
+			for(size_t size = 0; (offset + size) <= 300; size += ((size < 70) ? 1 : 23))
+			{
+				EATEST_VERIFY(Memchr16 (buffer16 + offset, 0x2612, size) == NULL);
+				EATEST_VERIFY(Memchr32 (buffer32 + offset, 0x00001261, size) == NULL);
+				EATEST_VERIFY(Memrchr  (buffer8  + offset, 'b', size) == NULL);
+				EATEST_VERIFY(Memrchr16(buffer16 + offset, 0x6126, size) == NULL);
+				EATEST_VERIFY(Memrchr32(buffer32 + offset, 0x61000012, size) == NULL);
+
+				for(size_t i = 0; i < size; i++)
+				{
+					buffer8[offset + i]  = 'b';
+					buffer16[offset + i] = 0x2612;
+					buffer32[offset + i] = 0x00001261;
+
+					EATEST_VERIFY(Memchr16 (buffer16 + offset, 0x2612,     size) == (buffer16 + offset + i));
+					EATEST_VERIFY(Memchr32 (buffer32 + offset, 0x00001261, size) == (buffer32 + offset + i));
+					EATEST_VERIFY(Memrchr  (buffer8  + offset, 'b',        size) == (buffer8  + offset + i));
+					EATEST_VERIFY(Memrchr16(buffer16 + offset, 0x2612,     size) == (buffer16 + offset + i));
+					EATEST_VERIFY(Memrchr32(buffer32 + offset, 0x00001261, size) == (buffer32 + offset + i));
+
+					// Matches just outside the searched range must not be found.
+					const size_t before = (offset > 0) ? (offset - 1) : offset + i;
+					const size_t after  = ((offset + size) < 300) ? (offset + size) : offset + i;
+					buffer8[before]  = buffer8[after]  = 'b';
+					buffer16[before] = buffer16[after] = 0x2612;
+					buffer32[before] = buffer32[after] = 0x00001261;
+
+					// A later match must not affect the result of a forward search, and an earlier one that of a reverse search.
+					buffer16[offset + size - 1] = 0x2612;
+					buffer32[offset + size - 1] = 0x00001261;
+					EATEST_VERIFY(Memchr16(buffer16 + offset, 0x2612,     size) == (buffer16 + offset + i));
+					EATEST_VERIFY(Memchr32(buffer32 + offset, 0x00001261, size) == (buffer32 + offset + i));
+					if(i != (size - 1))
+					{
+						buffer16[offset + size - 1] = 0x1261;
+						buffer32[offset + size - 1] = 0x12610000;
+					}
+
+					buffer8[offset]  = 'b';
+					buffer16[offset] = 0x2612;
+					buffer32[offset] = 0x00001261;
+					EATEST_VERIFY(Memrchr  (buffer8  + offset, 'b',        size) == (buffer8  + offset + i));
+					EATEST_VERIFY(Memrchr16(buffer16 + offset, 0x2612,     size) == (buffer16 + offset + i));
+					EATEST_VERIFY(Memrchr32(buffer32 + offset, 0x00001261, size) == (buffer32 + offset + i));
+
+					const size_t modified[4] = { before, after, offset, offset + i };
+					for(size_t k = 0; k < 4; k++)
+					{
+						buffer8[modified[k]]  = 'a';
+						buffer16[modified[k]] = 0x1261;
+						buffer32[modified[k]] = 0x12610000;
+					}
+				}
+			}
+		}
+	}
+
+	{   // MemchrAny
+		const char* const s = "qwertyuiopASDFGHJKL:!@#$%^&*,=/";
+		const size_t      n = Strlen(s);
+
+		EATEST_VERIFY(MemchrAny(s, n, "", 0) == NULL);
+		EATEST_VERIFY(MemchrAny(s, n, "&", 1) == s + 26);
+		EATEST_VERIFY(MemchrAny(s, n, "&:", 2) == s + 19);
+		EATEST_VERIFY(MemchrAny(s, n, "Zz", 2) == NULL);
+		EATEST_VERIFY(MemchrAny(s, n + 1, "Zz", 3) == s + n); // The terminating 0 is included in the set and the searched memory.
+	}
+
+	{   // MemchrAny with every match position and various set sizes, including sets which contain bytes >= 0x80.
+		char buffer[300];
+		char set[200];
+
+		for(size_t k = 0; k < sizeof(set); k++)
+			set[k] = (char)(uint8_t)(0x80 + ((k * 7) % 0x80) - ((k & 1) ? 0x40 : 0)); // Bytes in [0x40, 0x100), with both top bit values.
+
+		for(size_t setCount = 1; setCount <= sizeof(set); setCount += ((setCount < 20) ? 1 : 60))
+		{
+			// Fill the buffer with bytes that aren't in the set.
+			for(size_t k = 0, b = 0; k < sizeof(buffer); b++)
+			{
+				if(!memchr(set, (int)(b & 0xff), setCount))
+					buffer[k++] = (char)(uint8_t)b;
+			}
+
+			for(size_t offset = 0; offset < 33; offset++)
+			{
+				for(size_t size = 0; (offset + size) <= sizeof(buffer); size += ((size < 70) ? 1 : 23))
+				{
+					EATEST_VERIFY(MemchrAny(buffer + offset, size, set, setCount) == NULL);
+
+					for(size_t i = 0; i < size; i++)
+					{
+						const char saved = buffer[offset + i];
+						buffer[offset + i] = set[(i * 13) % setCount];
+						EATEST_VERIFY(MemchrAny(buffer + offset, size, set, setCount) == (buffer + offset + i));
+						buffer[offset + i] = saved;
+					}
+				}
+			}
+		}
+	}
+
 	return nErrorCount;
 }
 
@@ -633,6 +936,36 @@ static int TestMemcmp()
 		EATEST_VERIFY(Memcmp(buffer1, buffer2, 9) <  0);
 	}
 
+	{   // Memcmp8 with every mismatch position, for sizes and offsets that exercise the vectorized head, body and tail handling.
+		uint8_t buffer1[300];
+		uint8_t buffer2[300];
+
+		for(size_t offset = 0; offset < 4; offset++)
+		{
+			for(size_t size = 0; size < 260; size++)
+			{
+				memset(buffer1, 0x7f, sizeof(buffer1));
+				memset(buffer2, 0x7f, sizeof(buffer2));
+
+				EATEST_VERIFY(Memcmp(buffer1 + offset, buffer2 + offset + 1, size) == 0);
+
+				for(size_t i = 0; i < size; i++)
+				{
+					buffer1[offset + i] = 0x80;        // Bytes are compared as uint8_t, so 0x80 > 0x7f.
+					if(i < (size - 1))
+						buffer1[offset + size - 1] = 0; // A later difference of the opposite sign must not affect the result.
+
+					EATEST_VERIFY(Memcmp(buffer1 + offset, buffer2 + offset + 1, size) > 0);
+					EATEST_VERIFY(Memcmp(buffer2 + offset + 1, buffer1 + offset, size) < 0);
+					EATEST_VERIFY(Memcmp(buffer1 + offset, buffer2 + offset + 1, i) == 0);
+
+					buffer1[offset + i]        = 0x7f;
+					buffer1[offset + size - 1] = 0x7f;
+				}
+			}
+		}
+	}
+
 	#if EASTDC_MEMCPY16_ENABLED
 		{   // Memcmp16
 			char16_t buffer1[] = EA_CHAR16("01234567a");
@@ -651,6 +984,113 @@ static int TestMemcmp()
 }
 
 
+static int TestMemFindDifference()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{   // size_t MemFindDifference(const void* p1, const void* p2, size_t n);
+		uint8_t buffer1[300];
+		uint8_t buffer2[300];
+
+		memset(buffer1, 0x33, sizeof(buffer1));
+		memset(buffer2, 0x33, sizeof(buffer2));
+
+		for(size_t offset = 0; offset < 33; offset++)
+		{
+			for(size_t size = 0; (offset + size) <= sizeof(buffer1); size += ((size < 70) ? 1 : 23))
+			{
+				EATEST_VERIFY(MemFindDifference(buffer1 + offset, buffer2 + offset, size) == size);
+				EATEST_VERIFY(MemFindDifference(buffer1 + offset, buffer2 + (sizeof(buffer2) - size), size) == size); // Different relative alignments.
+
+				for(size_t i = 0; i < size; i++)
+				{
+					buffer2[offset + i] = 0x34;
+					EATEST_VERIFY(MemFindDifference(buffer1 + offset, buffer2 + offset, size) == i);
+					buffer2[offset + size - 1] = 0x35; // A later difference must not affect the result.
+					EATEST_VERIFY(MemFindDifference(buffer1 + offset, buffer2 + offset, size) == i);
+					buffer2[offset + size - 1] = 0x33;
+					buffer2[offset + i] = 0x33;
+				}
+			}
+		}
+	}
+
+	{   // size_t MemDiffRanges(const void* p1, const void* p2, size_t n, MemDiffRange* pRangeArray, size_t rangeCapacity, size_t mergeGranularity);
+		const size_t     kSize = 2000;
+		EA::StdC::Random r(0x12345678);
+		uint8_t*         pBuffer1 = new uint8_t[kSize];
+		uint8_t*         pBuffer2 = new uint8_t[kSize];
+		MemDiffRange     rangeArray[kSize];
+		MemDiffRange     expectedArray[kSize];
+
+		EATEST_VERIFY(MemDiffRanges(pBuffer1, pBuffer1, 0, NULL, 0) == 0);
+
+		for(int iteration = 0; iteration < 200; iteration++)
+		{
+			const size_t size            = r.RandomUint32Uniform((uint32_t)kSize);
+			const uint32_t changeDensity = 1 + r.RandomUint32Uniform(64); // Average run lengths vary from 1 byte to many vectors.
+
+			for(size_t i = 0; i < size; i++)
+				pBuffer1[i] = pBuffer2[i] = (uint8_t)r.RandomUint32Uniform(256);
+
+			for(size_t i = 0; i < size; )
+			{
+				// Alternate between runs of equal and runs of changed bytes.
+				i += r.RandomUint32Uniform(changeDensity * 2);
+				for(size_t end = i + 1 + r.RandomUint32Uniform(changeDensity); (i < end) && (i < size); i++)
+					pBuffer2[i] ^= (uint8_t)(1 + r.RandomUint32Uniform(255));
+			}
+
+			const size_t kGranularities[] = { 0, 1, 2, 5, 16, 100 };
+
+			for(size_t g = 0; g < EAArrayCount(kGranularities); g++)
+			{
+				const size_t mergeGranularity = kGranularities[g];
+				size_t       expectedCount    = 0;
+
+				// Build the expected ranges one byte at a time.
+				for(size_t i = 0; i < size; i++)
+				{
+					if(pBuffer1[i] != pBuffer2[i])
+					{
+						if(expectedCount && ((i == expectedArray[expectedCount - 1].mEnd) || ((i - expectedArray[expectedCount - 1].mEnd) < mergeGranularity)))
+							expectedArray[expectedCount - 1].mEnd = i + 1;
+						else
+						{
+							expectedArray[expectedCount].mBegin = i;
+							expectedArray[expectedCount].mEnd   = i + 1;
+							expectedCount++;
+						}
+					}
+				}
+
+				const size_t rangeCount = MemDiffRanges(pBuffer1, pBuffer2, size, rangeArray, kSize, mergeGranularity);
+				EATEST_VERIFY(rangeCount == expectedCount);
+				EATEST_VERIFY(memcmp(rangeArray, expectedArray, expectedCount * sizeof(MemDiffRange)) == 0);
+
+				// Verify the counting of ranges beyond the capacity.
+				EATEST_VERIFY(MemDiffRanges(pBuffer1, pBuffer2, size, NULL, 0, mergeGranularity) == expectedCount);
+
+				if(expectedCount > 1)
+				{
+					MemDiffRange limitedArray[2] = { { 0, 0 }, { 7, 7 } };
+					EATEST_VERIFY(MemDiffRanges(pBuffer1, pBuffer2, size, limitedArray, 1, mergeGranularity) == expectedCount);
+					EATEST_VERIFY((limitedArray[0].mBegin == expectedArray[0].mBegin) && (limitedArray[0].mEnd == expectedArray[0].mEnd));
+					EATEST_VERIFY((limitedArray[1].mBegin == 7) && (limitedArray[1].mEnd == 7));
+				}
+			}
+		}
+
+		delete[] pBuffer1;
+		delete[] pBuffer2;
+	}
+
+	return nErrorCount;
+}
+
+
 static int TestMemmem()
 {
 	using namespace EA::StdC;
@@ -676,6 +1116,79 @@ static int TestMemmem()
 	EATEST_VERIFY(Memmem("\1\0",      2, "\1\0",        2) != NULL);
 	EATEST_VERIFY(Memmem("\1\1",      2, "\1\0",        2) == NULL);
 
+	{   // Compare against a brute force search, using a small alphabet so that partial matches are frequent.
+		EA::StdC::Random r(0x12345678);
+		uint8_t memory[600];
+		uint8_t find[40];
+
+		for(int i = 0; i < 3000; i++)
+		{
+			const size_t   memorySize = r.RandomUint32Uniform(sizeof(memory));
+			const size_t   findSize   = r.RandomUint32Uniform(sizeof(find));
+			const uint32_t alphabet   = 1 + r.RandomUint32Uniform(3);
+
+			for(size_t j = 0; j < memorySize; j++)
+				memory[j] = (uint8_t)(0xfe + r.RandomUint32Uniform(alphabet));
+			for(size_t j = 0; j < findSize; j++)
+				find[j] = (uint8_t)(0xfe + r.RandomUint32Uniform(alphabet));
+
+			const uint8_t* pExpected = NULL;
+			if(memorySize)
+			{
+				for(size_t j = 0; (j + findSize) <= memorySize; j++)
+				{
+					if(memcmp(memory + j, find, findSize) == 0)
+					{
+						pExpected = memory + j;
+						break;
+					}
+				}
+			}
+
+			EATEST_VERIFY(Memmem(memory, memorySize, find, findSize) == pExpected);
+			EATEST_VERIFY(MemmemSearcher(find, findSize).Search(memory, memorySize) == pExpected);
+		}
+	}
+
+	{   // Highly repetitive memory, which results in the pattern search switching to the two-way algorithm.
+		eastl::vector<uint8_t> memory((eastl_size_t)100000, (uint8_t)'a');
+		eastl::vector<uint8_t> find((eastl_size_t)1000, (uint8_t)'a');
+		find.back() = 'b';
+
+		EATEST_VERIFY(Memmem(memory.data(), memory.size(), find.data(), find.size()) == NULL);
+
+		memory[77777] = 'b';
+		EATEST_VERIFY(Memmem(memory.data(), memory.size(), find.data(), find.size()) == &memory[77777 - 999]);
+
+		find.back()  = 'a'; // Periodic pattern ("aaa...abaaa").
+		find[500]    = 'b';
+		EATEST_VERIFY(Memmem(memory.data(), memory.size(), find.data(), find.size()) == &memory[77777 - 500]);
+	}
+
+	{   // MemmemSearcher
+		const char* const pFind = "needle";
+		MemmemSearcher searcher(pFind, 6);
+		char buffer2[300];
+
+		EATEST_VERIFY(searcher.GetFind() == pFind);
+		EATEST_VERIFY(searcher.GetFindSize() == 6);
+
+		for(size_t i = 0; i + 6 <= sizeof(buffer2); i++) // Test the same searcher with many memory blocks.
+		{
+			memset(buffer2, 'n', sizeof(buffer2));
+			memcpy(buffer2 + i, pFind, 6);
+			EATEST_VERIFY(searcher.Search(buffer2, sizeof(buffer2)) == buffer2 + i);
+			EATEST_VERIFY(searcher.Search(buffer2, i + 5) == NULL);
+		}
+
+		searcher.Init("", 0);
+		EATEST_VERIFY(searcher.Search(buffer1, kSize) == buffer1);
+		EATEST_VERIFY(searcher.Search(buffer1, 0) == NULL);
+
+		MemmemSearcher searcherDefault;
+		EATEST_VERIFY(searcherDefault.Search(buffer1, kSize) == buffer1);
+	}
+
 	return nErrorCount;
 }
 
@@ -833,6 +1346,98 @@ static int TestMemcpy()
 		}
 	}
 
+	{   // char* MemcpyS(void* pDestination, const void* pSource, size_t nByteCount);
+		// Exercises the non-temporal pathway with unaligned sources and destinations, as well
+		// as Memcpy128 on either side of EASTDC_MEMORY_STREAMING_THRESHOLD.
+		const size_t kSizes[] = { 0, 1, 255, 256, 257, 1000, 65536 + 77, EASTDC_MEMORY_STREAMING_THRESHOLD - 128, EASTDC_MEMORY_STREAMING_THRESHOLD + 37 };
+		const void*  pCheck;
+
+		for(size_t i = 0; i < EAArrayCount(kSizes); i++)
+		{
+			for(size_t j = 0; j < 5; j++)
+			{
+				const size_t copySize = kSizes[i];
+				uint8_t*     pMem1    = gMem1 + (j * 7);
+				uint8_t*     pMem2    = gMem2 + (j * 3);
+
+				// Give the source a non-uniform pattern so that misplaced bytes would be detected.
+				for(size_t k = 0; k < copySize; k += 4093)
+					pMem2[k] = (uint8_t)k;
+
+				EATEST_VERIFY(EA::StdC::MemcpyS(pMem1, pMem2, copySize) == (char*)pMem1);
+
+				pCheck = Memcheck8(pMem1 - 256, kByte1, 256);
+				EATEST_VERIFY(pCheck == NULL);
+
+				EATEST_VERIFY(memcmp(pMem1, pMem2, copySize) == 0);
+
+				pCheck = Memcheck8(pMem1 + copySize, kByte1, 256);
+				EATEST_VERIFY(pCheck == NULL);
+
+				memset(pMem1, kByte1, copySize);
+
+				if(j == 0) // Memcpy128 requires 128 byte aligned destination and a 128 byte multiple size.
+				{
+					const size_t copySize128 = copySize & ~(size_t)127;
+
+					EATEST_VERIFY(EA::StdC::Memcpy128(pMem1, pMem2, copySize128) == (char*)pMem1);
+					EATEST_VERIFY(memcmp(pMem1, pMem2, copySize128) == 0);
+					pCheck = Memcheck8(pMem1 + copySize128, kByte1, 256);
+					EATEST_VERIFY(pCheck == NULL);
+
+					memset(pMem1, kByte1, copySize128);
+				}
+
+				memset(pMem2, kByte2, copySize);
+			}
+		}
+	}
+
+	{ // void MemcpyBatch(const MemcpyDesc* pDescArray, size_t descCount);
+		EA::StdC::Random r(0x12345678);
+		const size_t     kDescCount = 600;
+		const size_t     kDestSize  = 65536;
+		uint8_t          source[4096];
+		MemcpyDesc*      pDescArray = new MemcpyDesc[kDescCount];
+		uint8_t*         pDest      = new uint8_t[kDestSize];
+		uint8_t*         pExpected  = new uint8_t[kDestSize];
+
+		for(size_t i = 0; i < sizeof(source); i++)
+			source[i] = (uint8_t)r.RandomUint32Uniform(256);
+
+		memset(pDest,     0, kDestSize);
+		memset(pExpected, 0, kDestSize);
+
+		// The first entries cover every size up to 130 bytes, after which the sizes are random, 
+		// including some too large for the fixed width copy paths. Destinations are scattered
+		// with gaps between them, at random alignments.
+		for(size_t i = 0, destOffset = 0; i < kDescCount; i++)
+		{
+			const size_t size         = (i <= 130) ? i : ((i % 10) == 0) ? r.RandomUint32Uniform(1000) : r.RandomUint32Uniform(70);
+			const size_t sourceOffset = r.RandomUint32Uniform((uint32_t)(sizeof(source) - size));
+
+			destOffset += r.RandomUint32Uniform(16);
+
+			pDescArray[i].mpDestination = pDest + destOffset;
+			pDescArray[i].mpSource      = source + sourceOffset;
+			pDescArray[i].mnByteCount   = size;
+
+			memcpy(pExpected + destOffset, source + sourceOffset, size);
+			destOffset += size;
+			EATEST_VERIFY(destOffset < kDestSize);
+		}
+
+		MemcpyBatch(pDescArray, 0);
+		EATEST_VERIFY(Memcheck8(pDest, 0, kDestSize) == NULL);
+
+		MemcpyBatch(pDescArray, kDescCount);
+		EATEST_VERIFY(memcmp(pDest, pExpected, kDestSize) == 0);
+
+		delete[] pDescArray;
+		delete[] pDest;
+		delete[] pExpected;
+	}
+
 	return nErrorCount;
 }
 
@@ -891,6 +1496,230 @@ static int TestMemmove()
 }
 
 
+struct MemoryParallelTestRunner
+{
+	size_t mCallCount;
+	size_t mJobCount;
+};
+
+// Runs the jobs in reverse order, which verifies that the jobs are independent of each other.
+static void MemoryParallelTestRunnerFunction(EA::StdC::ParallelJobFunction pJobFunction, void* pJobContext, size_t jobCount, void* pRunnerContext)
+{
+	MemoryParallelTestRunner* pRunner = static_cast<MemoryParallelTestRunner*>(pRunnerContext);
+
+	pRunner->mCallCount++;
+	pRunner->mJobCount += jobCount;
+
+	for(size_t i = jobCount; i > 0; i--)
+		pJobFunction(pJobContext, i - 1);
+}
+
+
+static int TestMemoryParallel()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// char*    MemcpyParallel(void* pDestination, const void* pSource, size_t nByteCount);
+	// uint8_t* MemsetParallel(void* pDestination, uint8_t c, size_t uint8Count);
+	// void     MemTouchParallel(void* p, size_t n);
+	// void     SetParallelJobRunner(ParallelJobRunner pRunner, void* pRunnerContext, size_t concurrency);
+	{
+		const size_t kSize   = EASTDC_MEMORY_PARALLEL_THRESHOLD + 5000000;
+		uint8_t*     pSource = new uint8_t[kSize + 64];
+		uint8_t*     pDest   = new uint8_t[kSize + 64];
+
+		for(size_t i = 0; i < kSize + 64; i++)
+			pSource[i] = (uint8_t)((i * 7) + (i >> 12));
+
+		MemoryParallelTestRunner runner = { 0, 0 };
+
+		// Test the default configuration, the internal thread pool with a few threads (regardless of 
+		// the processor count), an external runner, and parallel processing disabled.
+		for(int configuration = 0; configuration < 4; configuration++)
+		{
+			if(configuration == 1)
+				SetParallelJobRunner(NULL, NULL, 4);
+			else if(configuration == 2)
+				SetParallelJobRunner(MemoryParallelTestRunnerFunction, &runner, 3);
+			else if(configuration == 3)
+				SetParallelJobRunner(NULL, NULL, 1);
+
+			const size_t kSizes[]   = { 0, 1, 4096, EASTDC_MEMORY_PARALLEL_THRESHOLD - 1, EASTDC_MEMORY_PARALLEL_THRESHOLD, kSize };
+			const size_t kOffsets[] = { 0, 1, 17, 4095 % 64 };
+
+			for(size_t i = 0; i < EAArrayCount(kSizes); i++)
+			{
+				for(size_t j = 0; j < EAArrayCount(kOffsets); j++)
+				{
+					const size_t size   = kSizes[i];
+					const size_t offset = kOffsets[j];
+
+					memset(pDest, 0, kSize + 64);
+					EATEST_VERIFY(MemcpyParallel(pDest + offset, pSource + (offset ^ 3), size) == (char*)(pDest + offset));
+					EATEST_VERIFY(memcmp(pDest + offset, pSource + (offset ^ 3), size) == 0);
+					EATEST_VERIFY(Memcheck8(pDest, 0, offset) == NULL);
+					EATEST_VERIFY(Memcheck8(pDest + offset + size, 0, (kSize + 64) - (offset + size)) == NULL);
+
+					EATEST_VERIFY(MemsetParallel(pDest + offset, 0x5c, size) == pDest + offset);
+					EATEST_VERIFY(Memcheck8(pDest + offset, 0x5c, size) == NULL);
+					EATEST_VERIFY(Memcheck8(pDest, 0, offset) == NULL);
+					EATEST_VERIFY(Memcheck8(pDest + offset + size, 0, (kSize + 64) - (offset + size)) == NULL);
+
+					MemTouchParallel(pDest + offset, size);
+					EATEST_VERIFY(Memcheck8(pDest + offset, 0x5c, size) == NULL);
+					EATEST_VERIFY(Memcheck8(pDest, 0, offset) == NULL);
+				}
+			}
+
+			if(configuration == 2) // The runner should have been used for each of the functions, for each size above the threshold.
+			{
+				EATEST_VERIFY(runner.mCallCount == (3 * 2 * EAArrayCount(kOffsets)));
+				EATEST_VERIFY(runner.mJobCount > runner.mCallCount);
+			}
+		}
+
+		SetParallelJobRunner(NULL, NULL, 0);
+		Internal::MemoryParallelShutdown();
+
+		delete[] pSource;
+		delete[] pDest;
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestMemTouch()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{   // void PrefetchRange(const void* p, size_t n, bool bForWrite, int locality);
+		// Prefetches have no visible effect, but we can verify that they don't disturb the memory.
+		uint8_t buffer[1000];
+
+		for(size_t i = 0; i < sizeof(buffer); i++)
+			buffer[i] = (uint8_t)i;
+
+		for(int locality = -1; locality <= 4; locality++)
+		{
+			PrefetchRange(buffer, 0, false, locality);
+			PrefetchRange(buffer + 1, sizeof(buffer) - 1, false, locality);
+			PrefetchRange(buffer + 3, 300, true, locality);
+		}
+
+		PrefetchRange(NULL, 64); // Prefetches of invalid addresses are allowed.
+
+		for(size_t i = 0; i < sizeof(buffer); i++)
+			EATEST_VERIFY(buffer[i] == (uint8_t)i);
+	}
+
+	{   // void MemTouch(void* p, size_t n);
+		const size_t kSize   = 100000;
+		uint8_t*     pBuffer = new uint8_t[kSize];
+
+		for(size_t i = 0; i < kSize; i++)
+			pBuffer[i] = (uint8_t)((i * 13) + (i >> 12));
+
+		const size_t kOffsets[] = { 0, 1, 4095, 4096, 4097, 70000 };
+
+		for(size_t j = 0; j < EAArrayCount(kOffsets); j++)
+		{
+			MemTouch(pBuffer + kOffsets[j], 0);
+			MemTouch(pBuffer + kOffsets[j], 1);
+			MemTouch(pBuffer + kOffsets[j], kSize - kOffsets[j]);
+		}
+
+		for(size_t i = 0; i < kSize; i++)
+			EATEST_VERIFY(pBuffer[i] == (uint8_t)((i * 13) + (i >> 12)));
+
+		delete[] pBuffer;
+	}
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+	{   // MemTouch / MemAdviseSequential / MemAdviseWillNeed with freshly mapped memory.
+		const size_t kSize   = 4 * 1024 * 1024;
+		void*        pMemory = mmap(NULL, kSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if(pMemory != MAP_FAILED)
+		{
+			uint8_t* const p8 = static_cast<uint8_t*>(pMemory);
+
+			EATEST_VERIFY(MemAdviseSequential(p8 + 100, kSize - 200)); // Unaligned ranges are extended to whole pages.
+			EATEST_VERIFY(MemAdviseWillNeed(p8 + 100, kSize - 200));
+			EATEST_VERIFY(MemAdviseWillNeed(p8, 0));
+
+			MemTouch(p8 + 1, kSize - 1);
+			EATEST_VERIFY(Memcheck8(p8, 0, kSize) == NULL);
+
+			munmap(pMemory, kSize);
+		}
+	}
+	#endif
+
+	return nErrorCount;
+}
+
+
+static int TestLargeBuffer()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// void* AllocLargeBuffer(size_t nSize, size_t alignment, int flags, LargeBufferInfo* pInfo);
+	// void  FreeLargeBuffer(void* p, size_t nSize);
+
+	EATEST_VERIFY(AllocLargeBuffer(0) == NULL);
+
+	const size_t kSizes[]      = { 1, 4096, 100000, 4 * 1024 * 1024 + 3 };
+	const size_t kAlignments[] = { 0, 64, 65536, 4 * 1024 * 1024 };
+	const int    kFlags[]      = { 0, kLargeBufferDefault, kLargeBufferHugePages, kLargeBufferTransparentHugePages | kLargeBufferNUMALocal | kLargeBufferPopulate };
+
+	for(size_t i = 0; i < EAArrayCount(kSizes); i++)
+	{
+		for(size_t j = 0; j < EAArrayCount(kAlignments); j++)
+		{
+			for(size_t k = 0; k < EAArrayCount(kFlags); k++)
+			{
+				LargeBufferInfo info;
+				const size_t    size = kSizes[i];
+				uint8_t* const  p    = static_cast<uint8_t*>(AllocLargeBuffer(size, kAlignments[j], kFlags[k], &info));
+
+				EATEST_VERIFY(p != NULL);
+
+				if(p)
+				{
+					EATEST_VERIFY((info.mPageSize >= 4096) && ((info.mPageSize & (info.mPageSize - 1)) == 0));
+					EATEST_VERIFY(((uintptr_t)p % info.mPageSize) == 0);
+					EATEST_VERIFY(((uintptr_t)p % (kAlignments[j] ? kAlignments[j] : 1)) == 0);
+
+					if(info.mPageSize > 4096)
+						EATEST_VERIFY(kFlags[k] & kLargeBufferHugePages);
+					if(info.mbTransparentHugePages)
+						EATEST_VERIFY(kFlags[k] & kLargeBufferTransparentHugePages);
+					if(info.mbNUMALocal)
+						EATEST_VERIFY(kFlags[k] & kLargeBufferNUMALocal);
+
+					EATEST_VERIFY(Memcheck8(p, 0, size) == NULL);
+					memset(p, 0xa5, size);
+					EATEST_VERIFY(Memcheck8(p, 0xa5, size) == NULL);
+
+					FreeLargeBuffer(p, size);
+				}
+			}
+		}
+	}
+
+	FreeLargeBuffer(NULL, 0);
+
+	return nErrorCount;
+}
+
+
 static int TestTimingSafe()
 {
 	using namespace EA::StdC;
@@ -928,6 +1757,63 @@ static int TestTimingSafe()
 			EATEST_VERIFY(TimingSafeMemIsClear(buffer4, 9) == true);
 		}
 
+		{   // Accuracy tests across sizes, alignments and mismatch positions.
+			uint8_t buffer1[200];
+			uint8_t buffer2[200];
+
+			for(size_t k = 0; k < sizeof(buffer1); k++)
+				buffer1[k] = buffer2[k] = (uint8_t)(k * 7);
+
+			for(size_t offset = 0; offset < 17; offset++)
+			{
+				for(size_t size = 0; (offset + size) <= sizeof(buffer1); size += ((size < 100) ? 1 : 13))
+				{
+					EATEST_VERIFY(TimingSafeMemEqual(buffer1 + offset, buffer2 + offset, size));
+					EATEST_VERIFY(TimingSafeMemcmp(buffer1 + offset, buffer2 + offset, size) == 0);
+					EATEST_VERIFY(TimingSafeMemIsClear(buffer1 + offset, size) == (Memcheck8(buffer1 + offset, 0, size) == NULL));
+
+					for(size_t i = 0; i < size; i++)
+					{
+						const uint8_t c = buffer2[offset + i];
+
+						// Verify a lesser and a greater byte, including differences in the high bit which a signed comparison would get wrong.
+						const uint8_t kDifferences[] = { 1, 0x80, 0xff };
+
+						for(size_t d = 0; d < EAArrayCount(kDifferences); d++)
+						{
+							buffer2[offset + i] = (uint8_t)(c + kDifferences[d]);
+							EATEST_VERIFY(!TimingSafeMemEqual(buffer1 + offset, buffer2 + offset, size));
+							EATEST_VERIFY(TimingSafeMemcmp(buffer1 + offset, buffer2 + offset, size) == Memcmp(buffer1 + offset, buffer2 + offset, size));
+							EATEST_VERIFY(TimingSafeMemcmp(buffer2 + offset, buffer1 + offset, size) == Memcmp(buffer2 + offset, buffer1 + offset, size));
+
+							if(i != (size - 1)) // A later difference must not affect the result.
+							{
+								buffer1[offset + size - 1]++;
+								EATEST_VERIFY(TimingSafeMemcmp(buffer1 + offset, buffer2 + offset, size) == Memcmp(buffer1 + offset, buffer2 + offset, size));
+								buffer1[offset + size - 1]--;
+							}
+						}
+
+						buffer2[offset + i] = c;
+					}
+				}
+			}
+
+			memset(buffer1, 0, sizeof(buffer1));
+
+			for(size_t size = 1; size < 100; size++)
+			{
+				for(size_t i = 0; i < size; i++)
+				{
+					buffer1[i] = 0x80;
+					EATEST_VERIFY(!TimingSafeMemIsClear(buffer1, size));
+					buffer1[i] = 0;
+				}
+
+				EATEST_VERIFY(TimingSafeMemIsClear(buffer1, size));
+			}
+		}
+
 
 		{   // Timing tests.
 			// It's not easy to fully validate the constant timing of these functions, due to the 
@@ -1012,6 +1898,57 @@ static int TestTimingSafe()
 
 			EATEST_VERIFY_MSG(success, "TimingSafeMemIsClear didn't seem to be able to execute in constant time.");
 		}
+
+
+		#if EASTDC_SYS_MMAN_H_AVAILABLE && defined(EA_PLATFORM_LINUX)
+		{   // Reading of the whole range regardless of the position of the first difference.
+			// A timing attack works by measuring how the time varies with the position of the first 
+			// difference, so the functions must not stop reading at it. Pages of fresh anonymous memory
+			// are mapped in on first access and mincore reports which ones have been, so we can check 
+			// that every page was read even though the buffers differ in their first byte.
+			const size_t kPageSize  = 4096;
+			const size_t kPageCount = 16;
+			const size_t kSize      = kPageSize * kPageCount;
+
+			for(int f = 0; f < 3; f++)
+			{
+				void* pMemory1 = mmap(NULL, kSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				void* pMemory2 = mmap(NULL, kSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if((pMemory1 != MAP_FAILED) && (pMemory2 != MAP_FAILED))
+				{
+					uint8_t* const p1 = static_cast<uint8_t*>(pMemory1);
+					uint8_t* const p2 = static_cast<uint8_t*>(pMemory2);
+					unsigned char  residency1[kPageCount];
+					unsigned char  residency2[kPageCount];
+
+					p1[0] = 0x80;
+
+					if(f == 0)
+						EATEST_VERIFY(!TimingSafeMemEqual(p1, p2, kSize));
+					else if(f == 1)
+						EATEST_VERIFY(TimingSafeMemcmp(p1, p2, kSize) == 1);
+					else
+						EATEST_VERIFY(!TimingSafeMemIsClear(p1, kSize));
+
+					if((mincore(pMemory1, kSize, residency1) == 0) && (mincore(pMemory2, kSize, residency2) == 0))
+					{
+						for(size_t i = 0; i < kPageCount; i++)
+						{
+							EATEST_VERIFY_F(residency1[i] & 1, "TimingSafe function %d didn't read page %u of its first argument.", f, (unsigned)i);
+							if(f != 2) // TimingSafeMemIsClear has only the one argument.
+								EATEST_VERIFY_F(residency2[i] & 1, "TimingSafe function %d didn't read page %u of its second argument.", f, (unsigned)i);
+						}
+					}
+				}
+
+				if(pMemory1 != MAP_FAILED)
+					munmap(pMemory1, kSize);
+				if(pMemory2 != MAP_FAILED)
+					munmap(pMemory2, kSize);
+			}
+		}
+		#endif
 	}
 
 	return nErrorCount;
@@ -1131,6 +2068,41 @@ static void TestMemsetSpeed()
 }
 
 
+static void TestMemfillSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares the portable MemfillSpecific implementation to the one selected for this CPU.
+	const size_t   kPatternSizes[] = { 3, 8, 12, 16, 24, 40, 64 };
+	const size_t   kFillSize = 16384;
+	uint8_t        pattern[64];
+	Stopwatch      s(Stopwatch::kUnitsCPUCycles);
+
+	for(size_t k = 0; k < sizeof(pattern); k++)
+		pattern[k] = (uint8_t)k;
+
+	for(size_t p = 0; p < EAArrayCount(kPatternSizes); p++)
+	{
+		uint64_t elapsedTime[2];
+
+		for(int t = 0; t < 2; t++)
+		{
+			SetCPUFeatureLevel((t == 0) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+			s.Restart();
+			for(size_t j = 0; j < 256; ++j)
+				MemfillSpecific(gMem1 + (j % 32), pattern, kFillSize, kPatternSizes[p]);
+			s.Stop();
+
+			elapsedTime[t] = s.GetElapsedTime();
+		}
+
+		EA::UnitTest::ReportVerbosity(1, "MemfillSpecific %u byte pattern: scalar: %I64u cycles; %s: %I64u cycles\n", 
+										(unsigned)kPatternSizes[p], elapsedTime[0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), elapsedTime[1]);
+	}
+}
+
+
 static void TestMemclearSpeed()
 {
 	using namespace EA::StdC;
@@ -1231,6 +2203,107 @@ static void TestMemclearSpeed()
 
 
 
+static void TestTimingSafeSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares the portable TimingSafe implementations to the ones selected for this CPU, and to Memcmp.
+	// The sizes are those of typical MACs, tokens and keys, plus a larger block.
+	const size_t kSizes[] = { 16, 20, 32, 64, 256, 4096 };
+	Stopwatch    s(Stopwatch::kUnitsCPUCycles);
+	int          result = 0;
+
+	for(size_t k = 0; k < EAArrayCount(kSizes); k++)
+	{
+		const size_t size = kSizes[k];
+		uint64_t     elapsedTime[3][2];
+
+		for(int t = 0; t < 2; t++)
+		{
+			SetCPUFeatureLevel((t == 0) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+			s.Restart();
+			for(size_t j = 0; j < 4096; ++j)
+				result += TimingSafeMemEqual(gMem1 + (j % 32), gMem1 + 64 + (j % 32), size) ? 1 : 0;
+			s.Stop();
+			elapsedTime[0][t] = s.GetElapsedTime();
+
+			s.Restart();
+			for(size_t j = 0; j < 4096; ++j)
+				result += TimingSafeMemcmp(gMem1 + (j % 32), gMem1 + 64 + (j % 32), size);
+			s.Stop();
+			elapsedTime[1][t] = s.GetElapsedTime();
+
+			s.Restart();
+			for(size_t j = 0; j < 4096; ++j)
+				result += TimingSafeMemIsClear(gMem1 + (j % 32), size) ? 1 : 0;
+			s.Stop();
+			elapsedTime[2][t] = s.GetElapsedTime();
+		}
+
+		s.Restart();
+		for(size_t j = 0; j < 4096; ++j)
+			result += Memcmp(gMem1 + (j % 32), gMem1 + 64 + (j % 32), size);
+		s.Stop();
+
+		EA::UnitTest::ReportVerbosity(1, "TimingSafe %u bytes: scalar: %I64u/%I64u/%I64u cycles; %s: %I64u/%I64u/%I64u cycles (MemEqual/Memcmp/MemIsClear); Memcmp: %I64u cycles\n", 
+										(unsigned)size, elapsedTime[0][0], elapsedTime[1][0], elapsedTime[2][0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), 
+										elapsedTime[0][1], elapsedTime[1][1], elapsedTime[2][1], s.GetElapsedTime());
+	}
+
+	{   // Time by the position of the first difference, which shouldn't make any difference.
+		// We use the minimum of a number of trials for each position in order to filter out interruptions.
+		const size_t kSize        = 4096;
+		const size_t kPositions[] = { kSize, 0, 1, kSize / 2, kSize - 1 }; // kSize means no difference.
+		const char*  kNames[]     = { "MemEqual", "Memcmp", "MemIsClear" };
+
+		eastl::vector<uint8_t> v1((eastl_size_t)kSize, (uint8_t)0);
+		eastl::vector<uint8_t> v2((eastl_size_t)kSize, (uint8_t)0);
+
+		for(int f = 0; f < 3; f++)
+		{
+			uint64_t positionTime[EAArrayCount(kPositions)];
+
+			for(size_t p = 0; p < EAArrayCount(kPositions); p++)
+				positionTime[p] = UINT64_MAX;
+
+			// We cycle through the positions within each trial, so that any slow period affects all positions alike.
+			for(int t = 0; t < 16; t++)
+			{
+				for(size_t p = 0; p < EAArrayCount(kPositions); p++)
+				{
+					if(kPositions[p] < kSize)
+						v1[(eastl_size_t)kPositions[p]] = 0x80;
+
+					s.Restart();
+					for(int c = 0; c < 16; c++)
+					{
+						if(f == 0)
+							result += TimingSafeMemEqual(v1.data(), v2.data(), kSize) ? 1 : 0;
+						else if(f == 1)
+							result += TimingSafeMemcmp(v1.data(), v2.data(), kSize);
+						else
+							result += TimingSafeMemIsClear(v1.data(), kSize) ? 1 : 0;
+					}
+					s.Stop();
+
+					if(kPositions[p] < kSize)
+						v1[(eastl_size_t)kPositions[p]] = 0;
+
+					if(s.GetElapsedTime() < positionTime[p])
+						positionTime[p] = s.GetElapsedTime();
+				}
+			}
+
+			EA::UnitTest::ReportVerbosity(1, "TimingSafe%s %u bytes, first difference at none/0/1/middle/last: %I64u/%I64u/%I64u/%I64u/%I64u cycles\n", 
+											kNames[f], (unsigned)kSize, positionTime[0], positionTime[1], positionTime[2], positionTime[3], positionTime[4]);
+		}
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%d\n", result); // Prevent the compiler from optimizing away the calls.
+}
+
+
 int TestMemory()
 {
 	int nErrorCount = 0;
@@ -1253,20 +2326,35 @@ int TestMemory()
 		nErrorCount += TestEAAlloca();
 		nErrorCount += TestEAMalloca();
 		nErrorCount += TestMemset();
-		nErrorCount += TestMemfill();
 		nErrorCount += TestMemclear();
-		nErrorCount += TestMemcheck();
-		nErrorCount += TestMemchr();
-		nErrorCount += TestMemcmp();
-		nErrorCount += TestMemmem();
+
+		// These cover functions with runtime CPU dispatched implementations, so we test each supported level.
+		for(int level = EA::StdC::kCPUFeatureLevelScalar; level <= EA::StdC::GetCPUFeatureLevelSupported(); level++)
+		{
+			EATEST_VERIFY(EA::StdC::SetCPUFeatureLevel((EA::StdC::CPUFeatureLevel)level) == level);
+
+			nErrorCount += TestMemfill();
+			nErrorCount += TestMemcheck();
+			nErrorCount += TestMemchr();
+			nErrorCount += TestMemcmp();
+			nErrorCount += TestMemFindDifference();
+			nErrorCount += TestMemmem();
+			nErrorCount += TestTimingSafe();
+		}
+		EA::StdC::SetCPUFeatureLevel(EA::StdC::kCPUFeatureLevelCount);
+
 		nErrorCount += TestMemcpy();
 		nErrorCount += TestMemmove();
-		nErrorCount += TestTimingSafe();
+		nErrorCount += TestMemoryParallel();
+		nErrorCount += TestMemTouch();
+		nErrorCount += TestLargeBuffer();
 
 		TestMemcpySpeed();
 		TestMemmoveSpeed();
 		TestMemsetSpeed();
+		TestMemfillSpeed();
 		TestMemclearSpeed();
+		TestTimingSafeSpeed();
 
 		EA_CACHE_PREFETCH_128(gMem1);
 		EA_CACHE_ZERO_128(gMem1);
@@ -4,6 +4,7 @@
 
 
 #include <EAStdC/EAScanf.h>
+#include <EAStdC/EASprintf.h>
 #include <EAStdC/EAString.h>
 #include <EAStdC/EAMathHelp.h>
 #include <EAStdC/Int128_t.h>
@@ -349,6 +350,24 @@ static int TestScanfLimits()
 			EA::UnitTest::Report("%f\n", f);
 	}
 
+	// %lf must read back exactly the double that was written with enough digits to identify it.
+	{
+		const double kValues[] = { 0.1, 0.3, 1.0 / 3.0, 123.456e-7, 9007199254740993.0, 2.2250738585072014e-308, 4.9406564584124654e-324,
+								   1.7976931348623157e+308, 5e-324 * 3, 1e23, 8.98846567431158e307, 0.000001234567890123456789 };
+		char buffer[32];
+
+		for(size_t i = 0; i < EAArrayCount(kValues); i++)
+		{
+			sprintf(buffer, "%.17g", kValues[i]);
+			n = Sscanf(buffer, "%lf", &v.double_[0]);
+			EATEST_VERIFY_F((n == 1) && (v.double_[0] == kValues[i]), "Sscanf %%lf failure: \"%s\" -> %.17g", buffer, v.double_[0]);
+
+			Sprintf(buffer, "%r", -kValues[i]);
+			n = Sscanf(buffer, "%lf", &v.double_[0]);
+			EATEST_VERIFY_F((n == 1) && (v.double_[0] == -kValues[i]), "Sscanf %%lf failure: \"%s\" -> %.17g", buffer, v.double_[0]);
+		}
+	}
+
 	// Test fractions
 	{
 		const int nErrorCountSaved = nErrorCount; // We use this to exit the loop below upon the first found error.
@@ -7,6 +7,7 @@
 #include <EAStdC/EASprintfOrdered.h>
 #include <EAStdC/EAString.h>
 #include <EAStdC/EADateTime.h>
+#include <EAStdC/EARandom.h>
 #include <EAStdCTest/EAStdCTest.h>
 #include <EASTL/string.h>
 #include <EASTL/unique_ptr.h>
@@ -14,6 +15,7 @@
 #include <float.h>
 #include <string.h>
 #include <stdarg.h>
+#include <stdio.h>
 
 
 static void TestCRTVsnprintf(char* pDestination, size_t n, const char* pFormat, ...)
@@ -2469,6 +2471,119 @@ static int TestSprintf32(int unused = 0, ...)
 }
 
 
+static int TestSprintfIntegers()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// Integer formatting with random values of all magnitudes, compared to the C runtime library's.
+	// Thousands separators aren't tested here, as the C runtime library's depend on the locale.
+	static const char* const kFormats8[] = { "%lld", "%llu", "%llx", "%llX", "%llo", "%#llo", "%+24lld", "% lld", "%-22.3llx|", "%024llu", "%.30lld", "%.0llx" };
+	static const char32_t* const kFormats32[] = { EA_CHAR32("%lld"), EA_CHAR32("%llu"), EA_CHAR32("%llx"), EA_CHAR32("%llX"), EA_CHAR32("%llo"), EA_CHAR32("%#llo"), 
+												  EA_CHAR32("%+24lld"), EA_CHAR32("% lld"), EA_CHAR32("%-22.3llx|"), EA_CHAR32("%024llu"), EA_CHAR32("%.30lld"), EA_CHAR32("%.0llx") };
+	RandomFast random(0x12345678);
+
+	for(int i = 0; i < 2000; i++)
+	{
+		const uint32_t  nBits  = random.RandomUint32Uniform(65);
+		const uint64_t  nRand  = ((uint64_t)random.RandomUint32Uniform() << 32) | random.RandomUint32Uniform();
+		const long long nValue = (long long)((nBits == 64) ? nRand : (nRand & (((uint64_t)1 << nBits) - 1)));
+
+		for(size_t f = 0; f < EAArrayCount(kFormats8); f++)
+		{
+			char     buffer8[64], bufferCRT[64];
+			char32_t buffer32[64];
+
+			const int result8   = Snprintf(buffer8, sizeof(buffer8), kFormats8[f], nValue);
+			const int resultCRT = snprintf(bufferCRT, sizeof(bufferCRT), kFormats8[f], nValue);
+
+			EATEST_VERIFY_F((result8 == resultCRT) && (Strcmp(buffer8, bufferCRT) == 0), "Snprintf(\"%s\") produced %s instead of %s", kFormats8[f], buffer8, bufferCRT);
+
+			const int result32 = Snprintf(buffer32, EAArrayCount(buffer32), kFormats32[f], nValue);
+			EATEST_VERIFY(result32 == result8);
+
+			for(int j = 0; (j < result8) && (j < result32); j++)
+				EATEST_VERIFY(buffer32[j] == (char32_t)(uint8_t)buffer8[j]);
+		}
+
+		if((nBits <= 32) && (i % 2)) // Also test the int pathway.
+		{
+			char buffer8[64], bufferCRT[64];
+
+			Snprintf(buffer8, sizeof(buffer8), "%d %u %x %X %o %08d", (int)nValue, (unsigned)nValue, (unsigned)nValue, (unsigned)nValue, (unsigned)nValue, (int)nValue);
+			snprintf(bufferCRT, sizeof(bufferCRT), "%d %u %x %X %o %08d", (int)nValue, (unsigned)nValue, (unsigned)nValue, (unsigned)nValue, (unsigned)nValue, (int)nValue);
+			EATEST_VERIFY(Strcmp(buffer8, bufferCRT) == 0);
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestSprintfShortest()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// %r writes the shortest representation that reads back as the value, as FtoaShortest does.
+	{
+		char buffer[128];
+
+		const double kFloat64PositiveInfinity = DoubleFromBitRepr(UINT64_C(0x7ff0000000000000));
+		const double kFloat64NegativeInfinity = DoubleFromBitRepr(UINT64_C(0xfff0000000000000));
+		const double kFloat64PositiveNaN      = DoubleFromBitRepr(UINT64_C(0x7fffffffffffffff));
+
+		Sprintf(buffer, "%r %r %r %r", 0.1, 0.1 + 0.2, 100.0, 1.0 / 3.0);
+		EATEST_VERIFY(Strcmp(buffer, "0.1 0.30000000000000004 100 0.3333333333333333") == 0);
+
+		Sprintf(buffer, "%r %R %r %R", 1e21, 1e21, 1.5e-7, 5e-324);
+		EATEST_VERIFY(Strcmp(buffer, "1e+21 1E+21 1.5e-7 5E-324") == 0);
+
+		Sprintf(buffer, "%r %r %r %R", -0.0, -2.5, kFloat64PositiveInfinity, kFloat64NegativeInfinity);
+		EATEST_VERIFY(Strcmp(buffer, "-0 -2.5 inf -INF") == 0);
+
+		Sprintf(buffer, "%r %R", kFloat64PositiveNaN, kFloat64PositiveNaN);
+		EATEST_VERIFY(Strcmp(buffer, "nan NAN") == 0);
+
+		// Flags and width apply as with %g, while the precision is ignored.
+		Sprintf(buffer, "|%8r|%-8r|%+r|% r|%08r|%.2r|", 0.5, 0.5, 2.5, 2.5, -1.5, 1.2345);
+		EATEST_VERIFY(Strcmp(buffer, "|     0.5|0.5     |+2.5| 2.5|-00001.5|1.2345|") == 0);
+
+		// The sign counts towards the width when zero filling, as it does for integers.
+		Sprintf(buffer, "%08.2f|%08g|%+08r|%08d", -1.5, -1.5, 1.5, -15);
+		EATEST_VERIFY(Strcmp(buffer, "-0001.50|-00001.5|+00001.5|-0000015") == 0);
+
+		Sprintf(buffer, "%Lr", (long double)0.25);
+		EATEST_VERIFY(Strcmp(buffer, "0.25") == 0);
+	}
+
+	{
+		char16_t buffer[64];
+
+		Sprintf(buffer, EA_CHAR16("%r %R"), 123.456, 1e-7);
+		EATEST_VERIFY(Strcmp(buffer, EA_CHAR16("123.456 1E-7")) == 0);
+	}
+
+	{
+		char32_t buffer[64];
+
+		Sprintf(buffer, EA_CHAR32("%r %R"), 123.456, 1e-7);
+		EATEST_VERIFY(Strcmp(buffer, EA_CHAR32("123.456 1E-7")) == 0);
+	}
+
+	{
+		char buffer[64];
+
+		OSprintf(buffer, "%1:r %0:d", 3, 0.1);
+		EATEST_VERIFY(Strcmp(buffer, "0.1 3") == 0);
+	}
+
+	return nErrorCount;
+}
+
+
 static int TestDrintf8()
 {
 	using namespace EA::StdC;
@@ -2723,6 +2838,8 @@ int TestSprintf()
 	nErrorCount += TestSprintf8();
 	nErrorCount += TestSprintf16();
 	nErrorCount += TestSprintf32();
+	nErrorCount += TestSprintfIntegers();
+	nErrorCount += TestSprintfShortest();
 
 	// Dprintf
 	nErrorCount += TestDrintf8();
@@ -5,10 +5,15 @@
 
 #include <EAStdC/EAStdC.h>
 #include <EAStdC/EAString.h>
+#include <EAStdC/EACType.h>
 #include <EAStdC/EASprintf.h>
 #include <EAStdC/EAMemory.h>
+#include <EAStdC/EAMathHelp.h>
 #include <EAStdC/EARandom.h>
 #include <EAStdC/EAStopwatch.h>
+#include <EAStdC/EACPUDispatch.h>
+#include <EAStdC/EAProcess.h>
+#include <EAStdC/internal/CPUDispatch.h>
 #include <EAStdCTest/EAStdCTest.h>
 #include <EATest/EATest.h>
 #include <EASTL/string.h>
@@ -17,6 +22,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#if EASTDC_SYS_MMAN_H_AVAILABLE
+	#include <sys/mman.h>
+#endif
+#if defined(EA_COMPILER_CPP17_ENABLED) && defined(__has_include)
+	#if __has_include(<charconv>)
+		#include <charconv>
+	#endif
+#endif
 
 
 #if defined(_MSC_VER)
@@ -39,6 +52,85 @@ static inline bool TestString_DoubleEqual(double x1, double x2)
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// EachCPUFeatureLevel
+//
+// Sets each CPU feature level that this CPU supports in turn, from the scalar 
+// level up, for testing the runtime CPU dispatched functions at each level. 
+// The default level is restored when it is destroyed.
+//
+// Example usage:
+//     for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+//         nErrorCount += TestStrlenT<char>();
+//
+class EachCPUFeatureLevel
+{
+public:
+	EachCPUFeatureLevel() : mLevel(EA::StdC::kCPUFeatureLevelScalar - 1) { }
+   ~EachCPUFeatureLevel() { EA::StdC::SetCPUFeatureLevel(EA::StdC::kCPUFeatureLevelCount); }
+
+	int GetLevel() const { return mLevel; }
+
+	// Sets the next level and returns true, or returns false if there are no more.
+	bool Next(int& nErrorCount)
+	{
+		using namespace EA::StdC;
+
+		if(++mLevel > GetCPUFeatureLevelSupported())
+			return false;
+
+		EATEST_VERIFY(SetCPUFeatureLevel((CPUFeatureLevel)mLevel) == mLevel);
+		return true;
+	}
+
+protected:
+	EachCPUFeatureLevel(const EachCPUFeatureLevel&);
+	void operator=(const EachCPUFeatureLevel&);
+
+	int mLevel;
+};
+
+
+#if EASTDC_SYS_MMAN_H_AVAILABLE
+	///////////////////////////////////////////////////////////////////////////////
+	// GuardedPage
+	//
+	// A page of memory followed by an inaccessible page, for testing that the 
+	// vector reads of a function don't go past the end of a string at the end 
+	// of the page into the next page.
+	//
+	class GuardedPage
+	{
+	public:
+		static const size_t kPageSize = 4096;
+
+		GuardedPage() : mpMemory(mmap(NULL, kPageSize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0))
+		{
+			if((mpMemory != MAP_FAILED) && (mprotect((char*)mpMemory + kPageSize, kPageSize, PROT_NONE) != 0))
+			{
+				munmap(mpMemory, kPageSize * 2);
+				mpMemory = MAP_FAILED;
+			}
+		}
+
+	   ~GuardedPage()
+		{
+			if(mpMemory != MAP_FAILED)
+				munmap(mpMemory, kPageSize * 2);
+		}
+
+		// Returns the accessible page, or NULL if the pages couldn't be set up.
+		void* GetPage() const { return (mpMemory != MAP_FAILED) ? mpMemory : NULL; }
+
+	protected:
+		GuardedPage(const GuardedPage&);
+		void operator=(const GuardedPage&);
+
+		void* mpMemory;
+	};
+#endif
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // CharTraits 
 //
@@ -1273,10 +1365,16 @@ static int TestStringCore()
 	// char16_t* Strrstr(const char16_t* pString, const char16_t* pSubString);
 	// char32_t* Strrstr(const char32_t* pString, const char32_t* pSubString);
 	{
-		// To do: Make a real test. For now we merely verify that we can call the function.
-		Strrstr("Hello", "world");
-		Strrstr(EA_CHAR16("Hello"), EA_CHAR16("world"));
-		Strrstr(EA_CHAR32("Hello"), EA_CHAR32("world"));
+		const char s8[] = "abcabcaaaa";
+
+		EATEST_VERIFY(Strrstr(s8, "bc")   == &s8[4]);
+		EATEST_VERIFY(Strrstr(s8, "aa")   == &s8[8]);
+		EATEST_VERIFY(Strrstr(s8, "")     == &s8[0]);
+		EATEST_VERIFY(Strrstr(s8, "aaaa") == &s8[6]);
+		EATEST_VERIFY(Strrstr(s8, "aaab") == NULL);
+		EATEST_VERIFY(Strrstr("ab", "abc") == NULL);
+		EATEST_VERIFY(Strrstr(EA_CHAR16("Hello"), EA_CHAR16("world")) == NULL);
+		EATEST_VERIFY(Strrstr(EA_CHAR32("Hello"), EA_CHAR32("world")) == NULL);
 	}
 
 
@@ -1284,10 +1382,14 @@ static int TestStringCore()
 	// char16_t* Strirstr(const char16_t* pString, const char16_t* pSubString);
 	// char32_t* Strirstr(const char32_t* pString, const char32_t* pSubString);
 	{
-		// To do: Make a real test. For now we merely verify that we can call the function.
-		Strirstr("Hello", "world");
-		Strirstr(EA_CHAR16("Hello"), EA_CHAR16("world"));
-		Strirstr(EA_CHAR32("Hello"), EA_CHAR32("world"));
+		const char s8[] = "abcABCaaaa";
+
+		EATEST_VERIFY(Strirstr(s8, "Bc")   == &s8[4]);
+		EATEST_VERIFY(Strirstr(s8, "CA")   == &s8[5]);
+		EATEST_VERIFY(Strirstr(s8, "")     == &s8[0]);
+		EATEST_VERIFY(Strirstr(s8, "AAAA") == &s8[6]);
+		EATEST_VERIFY(Strirstr(EA_CHAR16("Hello"), EA_CHAR16("world")) == NULL);
+		EATEST_VERIFY(Strirstr(EA_CHAR32("Hello"), EA_CHAR32("world")) == NULL);
 	}
 
 
@@ -2008,6 +2110,34 @@ static int TestEcvt()
 }
 
 
+// Writes nValue in the given base with one digit per division, which is what U64toa used to do for 
+// all bases but 10. Returns pBuffer.
+EA_NO_INLINE static char* TestItoaReference(uint64_t nValue, char* pBuffer, int nBase)
+{
+	char* pCurrent    = pBuffer;
+	char* pFirstDigit = pBuffer;
+
+	do{
+		const unsigned nDigit = (unsigned)(nValue % (unsigned)nBase);
+		nValue /= (unsigned)nBase;
+
+		*pCurrent++ = (char)((nDigit > 9) ? (nDigit - 10 + 'a') : (nDigit + '0'));
+	} while(nValue);
+
+	// Need to reverse the string.
+	*pCurrent-- = 0;
+
+	while(pFirstDigit < pCurrent)
+	{
+		const char cTemp = *pCurrent;
+		*pCurrent--      = *pFirstDigit;
+		*pFirstDigit++   = cTemp;
+	}
+
+	return pBuffer;
+}
+
+
 static int TestItoa()
 {
 	using namespace EA::StdC;
@@ -2279,10 +2409,383 @@ static int TestItoa()
 		EATEST_VERIFY(Strcmp(sn32, EA_CHAR32("1110111011101110")) == 0);
 	}
 
+	{   // Random values of all magnitudes in all bases, compared to a simple one digit per division conversion.
+		RandomFast random(0x12345678);
+
+		for(int i = 0; i < 20000; i++)
+		{
+			const uint32_t nBits  = random.RandomUint32Uniform(65);
+			const uint64_t nRand  = ((uint64_t)random.RandomUint32Uniform() << 32) | random.RandomUint32Uniform();
+			const uint64_t nValue = (nBits == 64) ? nRand : (nRand & (((uint64_t)1 << nBits) - 1));
+			const int      nBase  = (i % 2) ? 10 : (i % 4) ? 16 : (int)(2 + random.RandomUint32Uniform(35));
+
+			char     sn8[72], snReference[72];
+			char16_t sn16[72];
+			char32_t sn32[72];
+
+			TestItoaReference(nValue, snReference, nBase);
+
+			EATEST_VERIFY(U64toa(nValue, sn8, nBase) == sn8);
+			EATEST_VERIFY_F(Strcmp(sn8, snReference) == 0, "U64toa(%I64u, %d) produced %s instead of %s", nValue, nBase, sn8, snReference);
+			U64toa(nValue, sn16, nBase);
+			U64toa(nValue, sn32, nBase);
+			EATEST_VERIFY((Strlen(sn16) == Strlen(sn8)) && (Strlen(sn32) == Strlen(sn8)));
+
+			for(size_t j = 0; sn8[j]; j++)
+				EATEST_VERIFY((sn16[j] == (char16_t)sn8[j]) && (sn32[j] == (char32_t)sn8[j]));
+
+			if(nBase == 10) // Negative values are only written with a sign in base 10.
+			{
+				I64toa(-(int64_t)(nValue >> 1), sn8, 10);
+				TestItoaReference(nValue >> 1, snReference + 1, 10);
+				snReference[0] = '-';
+				EATEST_VERIFY(Strcmp(sn8, (nValue >> 1) ? snReference : "0") == 0);
+			}
+		}
+	}
+
 	return nErrorCount;
 }
 
 
+// The base 10 conversion of U64toa before the digit pair engine was shared with Sprintf, for 
+// comparison in TestItoaSpeed. It also writes two digits per division, from the end of the 
+// string, whose length it finds with a search of the powers of 10.
+static uint32_t TestItoaDigitCount10(uint64_t v)
+{
+	if(v < 10)
+		return 1;
+	if(v < 100)
+		return 2;
+	if(v < 1000)
+		return 3;
+	if(v < UINT64_C(1000000000000))
+	{
+		if(v < UINT64_C(100000000))
+		{
+			if(v < 1000000)
+			{
+				if(v < 10000)
+					return 4;
+				return (uint32_t)(5 + (v >= 100000));
+			}
+
+			return (uint32_t)(7 + (v >= 10000000));
+		}
+
+		if(v < UINT64_C(10000000000))
+			return (uint32_t)(9 + (v >= UINT64_C(1000000000)));
+
+		return (uint32_t)(11 + (v >= UINT64_C(100000000000)));
+	}
+
+	return 12 + TestItoaDigitCount10(v / UINT64_C(1000000000000));
+}
+
+EA_NO_INLINE static char* TestItoaDigitPairsReference(uint64_t nValue, char* pBuffer)
+{
+	static const char digits[201] =
+		"0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+		"5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+	const uint32_t length = TestItoaDigitCount10(nValue);
+	uint32_t       next   = length - 1;
+
+	pBuffer[length] = '\0';
+
+	while(nValue >= 100)
+	{
+		const uint64_t i = (nValue % 100) * 2;
+		nValue /= 100;
+		pBuffer[next]     = digits[i + 1];
+		pBuffer[next - 1] = digits[i];
+		next -= 2;
+	}
+
+	if(nValue < 10)
+		pBuffer[next] = (char)('0' + (uint32_t)nValue);
+	else
+	{
+		const uint32_t i  = (uint32_t)nValue * 2;
+		pBuffer[next]     = digits[i + 1];
+		pBuffer[next - 1] = digits[i];
+	}
+
+	return pBuffer;
+}
+
+
+static void TestItoaSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares U64toa to the conversion it used to do, which was the digit pair one in base 10 and 
+	// one digit per division in other bases, and to std::to_chars, with values of up to 3 digits, 
+	// 32 bit values and 64 bit values, in bases 10 and 16.
+	const char* const kValueNames[] = { "small", "32 bit", "64 bit" };
+	const int         kCount = 10000;
+	RandomFast        random;
+	Stopwatch         s(Stopwatch::kUnitsCPUCycles);
+	uint64_t          values[kCount];
+	char              buffer[72];
+	size_t            result = 0;
+
+	for(size_t t = 0; t < EAArrayCount(kValueNames); t++)
+	{
+		for(int i = 0; i < kCount; i++)
+		{
+			const uint64_t nRand = ((uint64_t)random.RandomUint32Uniform() << 32) | random.RandomUint32Uniform();
+			values[i] = (t == 0) ? (nRand % 1000) : (t == 1) ? (uint32_t)nRand : nRand;
+		}
+
+		for(int nBase = 10; nBase <= 16; nBase += 6)
+		{
+			uint64_t elapsedTime[3] = { 0, 0, 0 };
+
+			s.Restart();
+			for(int i = 0; i < kCount; i++)
+				result += (size_t)U64toa(values[i], buffer, nBase)[0];
+			s.Stop();
+			elapsedTime[0] = s.GetElapsedTime();
+
+			s.Restart();
+			for(int i = 0; i < kCount; i++)
+				result += (size_t)((nBase == 10) ? TestItoaDigitPairsReference(values[i], buffer) : TestItoaReference(values[i], buffer, nBase))[0];
+			s.Stop();
+			elapsedTime[1] = s.GetElapsedTime();
+
+			#if defined(__cpp_lib_to_chars)
+				s.Restart();
+				for(int i = 0; i < kCount; i++)
+					result += (size_t)(std::to_chars(buffer, buffer + sizeof(buffer), values[i], nBase).ptr - buffer);
+				s.Stop();
+				elapsedTime[2] = s.GetElapsedTime();
+			#endif
+
+			EA::UnitTest::ReportVerbosity(1, "U64toa %s values, base %d, %d values: %I64u cycles; previous (%s): %I64u cycles; std::to_chars: %I64u cycles\n", 
+											kValueNames[t], nBase, kCount, elapsedTime[0], (nBase == 10) ? "digit pairs" : "one digit per division", elapsedTime[1], elapsedTime[2]);
+		}
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%u\n", (unsigned)result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+static void TestFtoaShortestSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares FtoaShortest to Sprintf %.17g, the shortest fixed precision that is always lossless, 
+	// to the C runtime library's %.17g and to std::to_chars, which also writes the shortest representation.
+	const int  kCount = 10000;
+	RandomFast random;
+	Stopwatch  s(Stopwatch::kUnitsCPUCycles);
+	double     values[kCount];
+	char       buffer[40];
+	size_t     result = 0;
+	uint64_t   elapsedTime[4] = { 0, 0, 0, 0 };
+
+	for(int i = 0; i < kCount; i++) // Values of the kind found in data files, with two to eight digits after the decimal point.
+		values[i] = (double)(int32_t)random.RandomUint32Uniform() / pow(10.0, (double)(2 + random.RandomUint32Uniform(7)));
+
+	s.Restart();
+	for(int i = 0; i < kCount; i++)
+		result += (size_t)FtoaShortest(values[i], buffer, sizeof(buffer))[0];
+	s.Stop();
+	elapsedTime[0] = s.GetElapsedTime();
+
+	s.Restart();
+	for(int i = 0; i < kCount; i++)
+		result += (size_t)Snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+	s.Stop();
+	elapsedTime[1] = s.GetElapsedTime();
+
+	s.Restart();
+	for(int i = 0; i < kCount; i++)
+		result += (size_t)snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+	s.Stop();
+	elapsedTime[2] = s.GetElapsedTime();
+
+	#if defined(__cpp_lib_to_chars)
+		s.Restart();
+		for(int i = 0; i < kCount; i++)
+			result += (size_t)(std::to_chars(buffer, buffer + sizeof(buffer), values[i]).ptr - buffer);
+		s.Stop();
+		elapsedTime[3] = s.GetElapsedTime();
+	#endif
+
+	EA::UnitTest::ReportVerbosity(1, "FtoaShortest %d values: %I64u cycles; Snprintf %%.17g: %I64u cycles; C snprintf %%.17g: %I64u cycles; std::to_chars: %I64u cycles\n", 
+									kCount, elapsedTime[0], elapsedTime[1], elapsedTime[2], elapsedTime[3]);
+
+	EA::UnitTest::ReportVerbosity(2, "%u\n", (unsigned)result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+static void TestStrtodSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares StrtodEnglish to the C runtime library's strtod and to std::from_chars, reading 
+	// back the shortest representations of values of the kind found in data files.
+	const int  kCount = 10000;
+	RandomFast random;
+	Stopwatch  s(Stopwatch::kUnitsCPUCycles);
+	static char strings[kCount][32]; // Static because this is too big for some platforms' stacks.
+	double     result = 0;
+	uint64_t   elapsedTime[3] = { 0, 0, 0 };
+
+	for(int i = 0; i < kCount; i++)
+		FtoaShortest((double)(int32_t)random.RandomUint32Uniform() / pow(10.0, (double)(2 + random.RandomUint32Uniform(7))), strings[i], sizeof(strings[i]));
+
+	s.Restart();
+	for(int i = 0; i < kCount; i++)
+		result += StrtodEnglish(strings[i], NULL);
+	s.Stop();
+	elapsedTime[0] = s.GetElapsedTime();
+
+	s.Restart();
+	for(int i = 0; i < kCount; i++)
+		result += strtod(strings[i], NULL);
+	s.Stop();
+	elapsedTime[1] = s.GetElapsedTime();
+
+	#if defined(__cpp_lib_to_chars)
+		s.Restart();
+		for(int i = 0; i < kCount; i++)
+		{
+			double d = 0;
+			std::from_chars(strings[i], strings[i] + Strlen(strings[i]), d);
+			result += d;
+		}
+		s.Stop();
+		elapsedTime[2] = s.GetElapsedTime();
+	#endif
+
+	EA::UnitTest::ReportVerbosity(1, "StrtodEnglish %d values: %I64u cycles; C strtod: %I64u cycles; std::from_chars: %I64u cycles\n", 
+									kCount, elapsedTime[0], elapsedTime[1], elapsedTime[2]);
+
+	EA::UnitTest::ReportVerbosity(2, "%f\n", result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+static void TestStrtoiSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares StrtoU64, which converts eight digits at a time, to the one digit at a time 
+	// char16_t version of StrtoU64 and to the C runtime library's strtoull.
+	const int  kCount = 10000;
+	RandomFast random;
+	Stopwatch  s(Stopwatch::kUnitsCPUCycles);
+	static char     strings[kCount][24]; // Static because this is too big for some platforms' stacks.
+	static char16_t strings16[kCount][24];
+	uint64_t        result = 0;
+
+	for(int nBase = 10; nBase <= 16; nBase += 6)
+	{
+		uint64_t elapsedTime[3] = { 0, 0, 0 };
+
+		for(int i = 0; i < kCount; i++) // Values of 1 to 20 digits.
+		{
+			const uint64_t nValue = (((uint64_t)random.RandomUint32Uniform() << 32) | random.RandomUint32Uniform()) >> random.RandomUint32Uniform(64);
+
+			U64toa(nValue, strings[i], nBase);
+			Strlcpy(strings16[i], strings[i], EAArrayCount(strings16[i]));
+		}
+
+		s.Restart();
+		for(int i = 0; i < kCount; i++)
+			result += StrtoU64(strings[i], NULL, nBase);
+		s.Stop();
+		elapsedTime[0] = s.GetElapsedTime();
+
+		s.Restart();
+		for(int i = 0; i < kCount; i++)
+			result += StrtoU64(strings16[i], NULL, nBase);
+		s.Stop();
+		elapsedTime[1] = s.GetElapsedTime();
+
+		s.Restart();
+		for(int i = 0; i < kCount; i++)
+			result += strtoull(strings[i], NULL, nBase);
+		s.Stop();
+		elapsedTime[2] = s.GetElapsedTime();
+
+		EA::UnitTest::ReportVerbosity(1, "StrtoU64 base %d, %d values: %I64u cycles; char16_t StrtoU64: %I64u cycles; C strtoull: %I64u cycles\n", 
+										nBase, kCount, elapsedTime[0], elapsedTime[1], elapsedTime[2]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%u\n", (unsigned)result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+static void TestParseNumberArraySpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares ParseDoubleArray and ParseInt32Array to the loop of StrtodEnglish or StrtoI32 calls 
+	// and delimiter checks that they replace, reading a comma separated list of values.
+	const int   kCount = 10000;
+	RandomFast  random;
+	Stopwatch   s(Stopwatch::kUnitsCPUCycles);
+	static char    text[kCount * 32]; // Static because this is too big for some platforms' stacks.
+	static double  doubles[kCount];
+	static int32_t ints[kCount];
+	size_t      nLength;
+	size_t      nPosition;
+	double      result = 0;
+	uint64_t    elapsedTime[4] = { 0, 0, 0, 0 };
+
+	nLength = 0;
+	for(int i = 0; i < kCount; i++)
+	{
+		FtoaShortest((double)(int32_t)random.RandomUint32Uniform() / pow(10.0, (double)(2 + random.RandomUint32Uniform(7))), text + nLength, 32);
+		nLength += Strlen(text + nLength);
+		text[nLength++] = ',';
+	}
+	text[nLength] = 0;
+
+	s.Restart();
+	result += (double)ParseDoubleArray(text, nLength, ",", doubles, kCount, nPosition);
+	s.Stop();
+	elapsedTime[0] = s.GetElapsedTime();
+
+	s.Restart();
+	for(const char* p = text; *p; )
+	{
+		char* pEnd;
+		result += StrtodEnglish(p, &pEnd);
+		p = pEnd + (*pEnd == ',');
+	}
+	s.Stop();
+	elapsedTime[1] = s.GetElapsedTime();
+
+	nLength = 0;
+	for(int i = 0; i < kCount; i++)
+		nLength += (size_t)Sprintf(text + nLength, "%d,", (int32_t)random.RandomUint32Uniform() >> random.RandomUint32Uniform(32));
+
+	s.Restart();
+	result += (double)ParseInt32Array(text, nLength, ",", ints, kCount, nPosition);
+	s.Stop();
+	elapsedTime[2] = s.GetElapsedTime();
+
+	s.Restart();
+	for(const char* p = text; *p; )
+	{
+		char* pEnd;
+		result += StrtoI32(p, &pEnd, 10);
+		p = pEnd + (*pEnd == ',');
+	}
+	s.Stop();
+	elapsedTime[3] = s.GetElapsedTime();
+
+	EA::UnitTest::ReportVerbosity(1, "ParseDoubleArray %d values: %I64u cycles; StrtodEnglish loop: %I64u cycles\n", kCount, elapsedTime[0], elapsedTime[1]);
+	EA::UnitTest::ReportVerbosity(1, "ParseInt32Array %d values: %I64u cycles; StrtoI32 loop: %I64u cycles\n", kCount, elapsedTime[2], elapsedTime[3]);
+
+	EA::UnitTest::ReportVerbosity(2, "%f %f %d\n", result, doubles[kCount - 1], ints[kCount - 1]); // Prevent the compiler from optimizing away the calls.
+}
+
+
 static int TestStrtod()
 {
 	using namespace EA::StdC;
@@ -2462,6 +2965,118 @@ static int TestStrtod()
 	}
 
 
+	// StrtodEnglish must return the double closest to the decimal value, which is what FtoaShortest and 
+	// %.17g output reads back as, and what a correctly rounding C runtime strtod returns for any input.
+	{
+		struct StringTest { const char* mpString; double mValue; ptrdiff_t mnLength; };
+
+		const StringTest kTests[] = 
+		{
+			{ "0.1",                           0.1,                       3 },
+			{ "9007199254740993",              9007199254740992.0,       16 }, // 2^53 + 1 is halfway between two doubles and rounds to even.
+			{ "9007199254740995",              9007199254740996.0,       16 },
+			{ "9007199254740993.0000000001",   9007199254740994.0,       27 }, // Just above halfway, so rounds up.
+			{ "2.2250738585072011e-308",       2.2250738585072011e-308,  23 }, // The largest subnormal.
+			{ "2.2250738585072014e-308",       2.2250738585072014e-308,  23 }, // DBL_MIN.
+			{ "4.9406564584124654e-324",       4.9406564584124654e-324,  23 }, // The smallest subnormal.
+			{ "2.4703282292062328e-324",       4.9406564584124654e-324,  23 }, // Just above half the smallest subnormal.
+			{ "1.7976931348623157e308",        1.7976931348623157e308,   22 }, // DBL_MAX.
+			{ "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000001e84", 1.0, 89 },
+			{ "  -1.5e",                      -1.5,                       6 }, // An exponent with no digits isn't part of the number.
+			{ "1e+",                           1.0,                       1 },
+			{ "-.5x",                         -0.5,                       3 },
+			{ "1.",                            1.0,                       2 },
+			{ ".",                             0.0,                       0 }, // No digits means no number.
+			{ "-e5",                           0.0,                       0 },
+			{ "abc",                           0.0,                       0 }
+		};
+
+		for(size_t i = 0; i < EAArrayCount(kTests); i++)
+		{
+			char* pEnd = NULL;
+			const double d = StrtodEnglish(kTests[i].mpString, &pEnd);
+
+			EATEST_VERIFY_F((d == kTests[i].mValue) && ((pEnd - kTests[i].mpString) == kTests[i].mnLength), 
+							"StrtodEnglish failure: \"%s\" -> %.17g, length %d", kTests[i].mpString, d, (int)(pEnd - kTests[i].mpString));
+		}
+
+		// A value that doesn't fit in a double sets errno to ERANGE, like strtod.
+		char* pEnd = NULL;
+
+		errno = 0;
+		EATEST_VERIFY((StrtodEnglish("1e309", &pEnd) == HUGE_VAL) && (errno == ERANGE));
+		errno = 0;
+		EATEST_VERIFY((StrtodEnglish("-1e309", &pEnd) == -HUGE_VAL) && (errno == ERANGE));
+		errno = 0;
+		EATEST_VERIFY((StrtodEnglish("1e-400", &pEnd) == 0) && (errno == ERANGE));
+		errno = 0;
+		EATEST_VERIFY((StrtodEnglish("0e-400", &pEnd) == 0) && (errno == 0));
+		errno = 0;
+		EATEST_VERIFY((StrtodEnglish("1e-320", &pEnd) == 1e-320) && (errno == 0));
+
+		char16_t  s16[32]; Strlcpy(s16, "9007199254740993x", EAArrayCount(s16));
+		char16_t* pEnd16 = NULL;
+		EATEST_VERIFY((StrtodEnglish(s16, &pEnd16) == 9007199254740992.0) && (pEnd16 == (s16 + 16)));
+
+		char32_t  s32[32]; Strlcpy(s32, "-2.4703282292062328e-324x", EAArrayCount(s32));
+		char32_t* pEnd32 = NULL;
+		EATEST_VERIFY((StrtodEnglish(s32, &pEnd32) == -4.9406564584124654e-324) && (pEnd32 == (s32 + 24)));
+
+		// Random values written in several ways, compared to the C runtime strtod, which all the 
+		// platforms we test on implement with correct rounding. The long strings have more digits 
+		// than fit in 64 bits, which can require the slow path.
+		RandomFast random;
+		char       buffer[128];
+
+		for(int i = 0; i < 20000; i++)
+		{
+			uint64_t n64 = ((uint64_t)random.RandomUint32Uniform() << 32) | random.RandomUint32Uniform();
+			double   d;
+
+			switch(i % 4)
+			{
+				case 0: // Any finite double.
+					n64 &= UINT64_C(0x7fffffffffffffff);
+					if((n64 >> 52) == 0x7ff)
+						n64 ^= UINT64_C(0x4000000000000000);
+					memcpy(&d, &n64, sizeof(d));
+					Snprintf(buffer, sizeof(buffer), "%.17g", d);
+					break;
+
+				case 1: // Shortest representation of a value of the kind found in data files.
+					d = (double)(int32_t)n64 / pow(10.0, (double)random.RandomUint32Uniform(9));
+					FtoaShortest(d, buffer, sizeof(buffer));
+					break;
+
+				case 2: // 17 to 40 random digits with a random exponent.
+				{
+					const int nDigitCount = 17 + (int)random.RandomUint32Uniform(24);
+					int       j;
+
+					for(j = 0; j < nDigitCount; j++)
+						buffer[j] = (char)('0' + random.RandomUint32Uniform(10));
+					Snprintf(buffer + j, sizeof(buffer) - j, "e%d", (int)random.RandomUint32Uniform(660) - 340);
+					break;
+				}
+
+				default: // Exactly halfway between two doubles, which needs all the digits.
+					n64 = (n64 & UINT64_C(0x000fffffffffffff)) | UINT64_C(0x4330000000000000); // A double in [2^52, 2^53).
+					memcpy(&d, &n64, sizeof(d));
+					Snprintf(buffer, sizeof(buffer), "%.0f.5e-%u", d, random.RandomUint32Uniform(3));
+					break;
+			}
+
+			char*        pEndCRT     = NULL;
+			const double dExpected   = strtod(buffer, &pEndCRT);
+			const double dResult     = StrtodEnglish(buffer, &pEnd);
+
+			EATEST_VERIFY_F((memcmp(&dResult, &dExpected, sizeof(double)) == 0) && (pEnd == pEndCRT), 
+							"StrtodEnglish failure: \"%s\" -> %.17g, expected %.17g", buffer, dResult, dExpected);
+			EATEST_VERIFY(AtofEnglish(buffer) == dExpected);
+		}
+	}
+
+
 	// double Strtod(const char*  pString, char**  ppStringEnd);
 	// double Strtod(const char16_t* pString, char16_t** ppStringEnd);
 	// double Strtod(const char32_t* pString, char32_t** ppStringEnd);
@@ -2798,6 +3413,13 @@ static int TestStrtoi()
 
 		char32_t sn48[24]; Strlcpy(sn48, EA_CHAR32("eb59a646c232da81"), EAArrayCount(sn48)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
 		EATEST_VERIFY(UINT64_C(0xeb59a646c232da81) == StrtoU64(sn48, &pEnd, 16));
+
+		// Base 0 with a "0x" or "0X" prefix must auto-detect base 16 and skip the prefix.
+		char32_t sn58[24]; Strlcpy(sn58, EA_CHAR32("0x1f"), EAArrayCount(sn58)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
+		EATEST_VERIFY((StrtoU64(sn58, &pEnd, 0) == 0x1f) && (pEnd == (sn58 + 4)));
+
+		char32_t sn68[24]; Strlcpy(sn68, EA_CHAR32("0XFFFFFFFFFFFFFFFF"), EAArrayCount(sn68)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
+		EATEST_VERIFY((StrtoU64(sn68, &pEnd, 0) == UINT64_MAX) && (pEnd == (sn68 + 18)));
 	}
 
 
@@ -2903,6 +3525,12 @@ static int TestStrtoi()
 
 		char32_t sn58[16]; Strlcpy(sn58, EA_CHAR32("-BAEBEEC0DE"), EAArrayCount(sn58)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
 		EATEST_VERIFY(INT32_MIN == StrtoI32(sn58, &pEnd, 16));
+
+		char32_t sn68[16]; Strlcpy(sn68, EA_CHAR32("-0x10"), EAArrayCount(sn68)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
+		EATEST_VERIFY((StrtoI32(sn68, &pEnd, 0) == -16) && (pEnd == (sn68 + 5)));
+
+		char32_t sn78[16]; Strlcpy(sn78, EA_CHAR32("0X7fffabcdz"), EAArrayCount(sn78)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
+		EATEST_VERIFY((StrtoI32(sn78, &pEnd, 0) == 0x7fffabcd) && (*pEnd == 'z'));
 	}
 
 
@@ -3098,6 +3726,119 @@ static int TestStrtoi()
 		EATEST_VERIFY(UINT64_MAX == AtoU64(sn28));
 	}
 
+
+	// int64_t StrtoI64(const char* pString, size_t nLength, char** ppStringEnd, int nBase);
+	// (and the other versions with an nLength argument)
+	{
+		const char* p = "12345678901234567890";
+		char*       pEnd = NULL;
+
+		EATEST_VERIFY((StrtoU64(p, 3, &pEnd, 10) == 123) && (pEnd == (p + 3)));
+		EATEST_VERIFY((StrtoU64(p, 0, &pEnd, 10) == 0) && (pEnd == p));
+		EATEST_VERIFY((StrtoI32(p, 9, &pEnd, 10) == 123456789) && (pEnd == (p + 9)));
+		EATEST_VERIFY((StrtoI64(p, 19, &pEnd, 10) == INT64_C(1234567890123456789)) && (pEnd == (p + 19)));
+		EATEST_VERIFY((StrtoU64(p, 21, &pEnd, 10) == UINT64_C(12345678901234567890)) && (pEnd == (p + 20))); // The terminating 0 ends the string too.
+		EATEST_VERIFY((StrtoU32("  -", 3, &pEnd, 10) == 0));
+		EATEST_VERIFY((StrtoI64("-7fffffffffffffff1", 17, &pEnd, 16) == -INT64_MAX));
+		EATEST_VERIFY((StrtoI64("0x1f", 1, &pEnd, 0) == 0)  && (*pEnd == 'x')); // Base 8, and the 'x' is past the end.
+		EATEST_VERIFY((StrtoI64("0x1f", 3, &pEnd, 0) == 1)  && (*pEnd == 'f'));
+		EATEST_VERIFY(AtoI64("-123", 3) == -12);
+		EATEST_VERIFY(AtoU32("4294967295", 10) == UINT32_MAX);
+
+		char16_t s16[24]; Strlcpy(s16, EA_CHAR16("987654321"), EAArrayCount(s16)); // Can't do char16_t variable[64] = EA_CHAR16(...) because some compilers don't support 16 bit string literals.
+		EATEST_VERIFY(AtoI32(s16, 4) == 9876);
+		char32_t s32[24]; Strlcpy(s32, EA_CHAR32("987654321"), EAArrayCount(s32)); // Can't do char32_t variable[64] = EA_CHAR32(...) because some compilers don't support 32 bit string literals.
+		EATEST_VERIFY(AtoU64(s32, 5) == 98765);
+	}
+
+	// The char versions convert base 10 and base 16 digits eight at a time, while the char16_t 
+	// versions convert them one at a time. We compare them on random strings of digits with 
+	// a random terminator and every alignment, including lengths at the 64 bit overflow boundary.
+	{
+		const char* const kDigitChars = "0123456789abcdefABCDEF/:@G`g ~";
+		RandomFast random;
+		char       buffer[48];
+		char16_t   buffer16[48];
+
+		for(int i = 0; i < 100000; i++)
+		{
+			const int  nBase   = (i & 1) ? 16 : 10;
+			const int  nOffset = (int)random.RandomUint32Uniform(8);
+			const int  nLength = (int)random.RandomUint32Uniform(24);
+			char*      p       = buffer + nOffset;
+
+			for(int j = 0; j < nLength; j++)
+				p[j] = kDigitChars[random.RandomUint32Uniform((nBase == 10) ? 10 : 22)];
+			p[nLength] = kDigitChars[random.RandomUint32Uniform(8) + 22];
+			p[nLength + 1] = 0;
+
+			if((nLength > 2) && random.RandomUint32Uniform(2)) // Sometimes put the value right at the overflow boundary, after 0 to 7 leading zeroes.
+			{
+				const int nZeroCount = (int)random.RandomUint32Uniform(8);
+
+				memset(p, '0', (size_t)nZeroCount);
+				Strcpy(p + nZeroCount, random.RandomUint32Uniform(2) ? ((nBase == 10) ? "18446744073709551615" : "ffffffffffffffff") : ((nBase == 10) ? "18446744073709551616" : "10000000000000000"));
+			}
+
+			const size_t nBoundedLength = random.RandomUint32Uniform((uint32_t)Strlen(p) + 1);
+
+			Strlcpy(buffer16, p, EAArrayCount(buffer16));
+
+			char*     pEnd;
+			char16_t* pEnd16;
+
+			errno = 0;
+			const uint64_t nResult   = StrtoU64(p, &pEnd, nBase);
+			const int      nErrno    = errno;
+			errno = 0;
+			const uint64_t nResult16 = StrtoU64(buffer16, &pEnd16, nBase);
+
+			EATEST_VERIFY_F((nResult == nResult16) && ((pEnd - p) == (pEnd16 - buffer16)) && (nErrno == errno), "StrtoU64 failure: \"%s\" base %d", p, nBase);
+
+			buffer16[nBoundedLength] = 0;
+			errno = 0;
+			const uint64_t nResultBounded = StrtoU64(p, nBoundedLength, &pEnd, nBase);
+			const int      nErrnoBounded  = errno;
+			errno = 0;
+			const uint64_t nResultBounded16 = StrtoU64(buffer16, &pEnd16, nBase);
+
+			EATEST_VERIFY_F((nResultBounded == nResultBounded16) && ((pEnd - p) == (pEnd16 - buffer16)) && (nErrnoBounded == errno), 
+							"StrtoU64 failure: \"%s\" length %d base %d", p, (int)nBoundedLength, nBase);
+		}
+	}
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+	{   // Digits which end right before an inaccessible page, which the eight digit reads must not cross.
+		GuardedPage guardedPage;
+
+		if(guardedPage.GetPage())
+		{
+			char* const pPageEnd = static_cast<char*>(guardedPage.GetPage()) + GuardedPage::kPageSize;
+
+			uint64_t    nExpected10 = 0;
+			uint64_t    nExpected16 = 0;
+
+			memset(guardedPage.GetPage(), '1', GuardedPage::kPageSize);
+
+			for(size_t length = 1; length <= 16; length++)
+			{
+				char* pEnd = NULL;
+
+				pPageEnd[-1] = '1';
+				EATEST_VERIFY((StrtoU64(pPageEnd - length, length, &pEnd, 10) == ((nExpected10 * 10) + 1)) && (pEnd == pPageEnd));
+				EATEST_VERIFY((StrtoU64(pPageEnd - length, length, &pEnd, 16) == ((nExpected16 * 16) + 1)) && (pEnd == pPageEnd));
+
+				pPageEnd[-1] = 0;
+				EATEST_VERIFY((StrtoU64(pPageEnd - length, &pEnd, 10) == nExpected10) && (pEnd == (pPageEnd - 1)));
+				EATEST_VERIFY((StrtoU64(pPageEnd - length, &pEnd, 16) == nExpected16) && (pEnd == (pPageEnd - 1)));
+
+				nExpected10 = (nExpected10 * 10) + 1;
+				nExpected16 = (nExpected16 * 16) + 1;
+			}
+		}
+	}
+	#endif
+
 	return nErrorCount;
 }
 
@@ -3148,9 +3889,6 @@ static int TestAtof()
 	// double AtofEnglish(const char*  pString);
 	// double AtofEnglish(const char16_t* pString);
 	// double AtofEnglish(const char32_t* pString);
-	//
-	// AtofEnglish - this function fails on boundary values for double_t 
-	// as it performs some math inside that drives the values to infinity.
 	{
 		const char* kStrMin = "2.2250738585071e-307"; // DBL_MIN is usually 2.2250738585072014e-308, but some Standard Libraries have trouble converting 
 		const double   kValMin =  2.2250738585071e-307;  // to and from strings of that value. So we use -307 instead, which is pretty reliably supported.
@@ -3183,44 +3921,168 @@ static int TestAtof()
 }
 
 
-static int TestFtoa()
+static int TestParseNumberArray()
 {
 	using namespace EA::StdC;
 
 	int nErrorCount = 0;
 
-	// char*  Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
-	// char16_t* Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
-	// char32_t* Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
+	// size_t ParseInt32Array (const char* pText, size_t nTextLength, const char* pDelimiters, int32_t* pValues, size_t nValueCapacity, size_t& nTextPosition);
+	// size_t ParseInt64Array (const char* pText, size_t nTextLength, const char* pDelimiters, int64_t* pValues, size_t nValueCapacity, size_t& nTextPosition);
+	// size_t ParseFloatArray (const char* pText, size_t nTextLength, const char* pDelimiters, float*   pValues, size_t nValueCapacity, size_t& nTextPosition);
+	// size_t ParseDoubleArray(const char* pText, size_t nTextLength, const char* pDelimiters, double*  pValues, size_t nValueCapacity, size_t& nTextPosition);
 	{
-		char sn18[128];
+		struct ArrayTest { const char* mpText; const char* mpDelimiters; size_t mnCount; size_t mnPosition; int32_t mValues[4]; };
 
-		Ftoa(-1.7976931, sn18, 128, 7, false);
-		if(Strcmp("-1.7976931", sn18) != 0)
-		{
-			EA::UnitTest::Report("%s\n", sn18);
-			EATEST_VERIFY(Strcmp("-1.7976931", sn18) == 0);
-		}
-
-		Ftoa(10.7976931e299, sn18, 128, 5, true);
-		if(Strcmp("1.07977e+300", sn18) != 0)
+		const ArrayTest kTests[] = 
 		{
-			EA::UnitTest::Report("%s\n", sn18);
-			EATEST_VERIFY(Strcmp("1.07977e+300", sn18) == 0);
-		}
+			{ "1,2,3",               ",",     3,  5, { 1, 2, 3 } },
+			{ " 1 , -2 ,\t+3 ",      ",",     3, 13, { 1, -2, 3 } },
+			{ "1,2,3,",              ",",     3,  6, { 1, 2, 3 } },  // A trailing delimiter is ignored.
+			{ "",                    ",",     0,  0, { 0 } },
+			{ "  \r\n",              ",",     0,  4, { 0 } },
+			{ "1;2,3",               ",;",    3,  5, { 1, 2, 3 } },
+			{ "1 2\t3\n4",            " \t\n", 4,  7, { 1, 2, 3, 4 } },
+			{ "1  2\r\n\r\n3",         " \n",   3,  9, { 1, 2, 3 } },  // Runs of whitespace are one delimiter.
+			{ "1,,3",                ",",     1,  2, { 1 } },        // An empty field is an error.
+			{ "1,2x,3",              ",",     1,  2, { 1 } },        // So is a field with other chars after the number.
+			{ "1 2",                 ",",     0,  0, { 0 } },        // Spaces aren't delimiters here, so "1 2" is one invalid field.
+			{ "1,2147483648",        ",",     1,  2, { 1 } },        // So is a number out of range.
+			{ "-2147483648,2147483647", ",",  2, 22, { INT32_MIN, INT32_MAX } },
+			{ "1,2,3,4,5,6",         ",",     4,  8, { 1, 2, 3, 4 } }  // The output array is full after four values.
+		};
 
-		Ftoa(-1.7976931, sn18, 128, 4, false);
-		if(Strcmp("-1.7977", sn18) != 0)
+		for(size_t i = 0; i < EAArrayCount(kTests); i++)
 		{
-			EA::UnitTest::Report("%s\n", sn18);
-			EATEST_VERIFY(Strcmp("-1.7977", sn18) == 0);
-		}
+			int32_t values[4] = { 0, 0, 0, 0 };
+			size_t  nPosition = 9999;
+			size_t  nCount    = ParseInt32Array(kTests[i].mpText, kSizeTypeUnset, kTests[i].mpDelimiters, values, 4, nPosition);
 
-		Ftoa(0.107976931e-299, sn18, 128, 5, true);
-		if(Strcmp("1.07977e-300", sn18) != 0)
-		{
-			EA::UnitTest::Report("%s\n", sn18);
-			EATEST_VERIFY(Strcmp("1.07977e-300", sn18) == 0);
+			EATEST_VERIFY_F((nCount == kTests[i].mnCount) && (nPosition == kTests[i].mnPosition) && (memcmp(values, kTests[i].mValues, nCount * sizeof(int32_t)) == 0), 
+							"ParseInt32Array failure: \"%s\" -> %d values, position %d", kTests[i].mpText, (int)nCount, (int)nPosition);
+		}
+	}
+
+	{
+		const char* pText = "9223372036854775807 -9223372036854775808 9223372036854775808";
+		int64_t     values[4];
+		size_t      nPosition;
+
+		EATEST_VERIFY((ParseInt64Array(pText, kSizeTypeUnset, " ", values, 4, nPosition) == 2) && (nPosition == 41));
+		EATEST_VERIFY((values[0] == INT64_MAX) && (values[1] == INT64_MIN));
+
+		// The text needn't be 0-terminated.
+		EATEST_VERIFY((ParseInt64Array(pText, 22, " ", values, 4, nPosition) == 2) && (nPosition == 22) && (values[1] == -9));
+	}
+
+	{
+		const char* pText = "1.5, 2, 3.25e2 ,-.5, 1e-400";
+		double      values[8];
+		float       fvalues[8];
+		size_t      nPosition;
+
+		EATEST_VERIFY((ParseDoubleArray(pText, kSizeTypeUnset, ",", values, 8, nPosition) == 5) && (nPosition == Strlen(pText)));
+		EATEST_VERIFY((values[0] == 1.5) && (values[1] == 2) && (values[2] == 325) && (values[3] == -0.5) && (values[4] == 0)); // Underflow to zero isn't an error.
+		EATEST_VERIFY((ParseFloatArray(pText, 11, ",", fvalues, 8, nPosition) == 3) && (nPosition == 11) && (fvalues[2] == 3.2f)); // "3.25e2" is cut to "3.2".
+
+		EATEST_VERIFY((ParseDoubleArray("1,1e309", kSizeTypeUnset, ",", values, 8, nPosition) == 1) && (nPosition == 2)); // Overflow is an error.
+		EATEST_VERIFY((ParseDoubleArray("1,inf", kSizeTypeUnset, ",", values, 8, nPosition) == 1) && (nPosition == 2));
+		EATEST_VERIFY((ParseFloatArray("3.4028235e38,3.4028236e38", kSizeTypeUnset, ",", fvalues, 8, nPosition) == 1) && (nPosition == 13) && (fvalues[0] == FLT_MAX));
+	}
+
+	{   // Random values, compared to converting them one by one with StrtoI32 and StrtodEnglish. The text is 
+		// allocated with its exact length and no terminating 0 char, so reads past its end would be detected 
+		// by ASan and similar tools.
+		RandomFast   random;
+		const int    kCount  = 1000;
+		int32_t*     pInts   = new int32_t[kCount];
+		double*      pDouble = new double[kCount];
+		char*        pText   = new char[kCount * 32];
+		size_t       nLength = 0;
+
+		for(int i = 0; i < kCount; i++)
+		{
+			pInts[i]  = (int32_t)random.RandomUint32Uniform() >> random.RandomUint32Uniform(32);
+			nLength  += (size_t)Sprintf(pText + nLength, "%d%s", pInts[i], (i % 3) ? "," : " , ");
+		}
+
+		char* const pExact = new char[nLength];
+		memcpy(pExact, pText, nLength);
+
+		int32_t* const pIntsParsed = new int32_t[kCount];
+		size_t         nPosition;
+
+		EATEST_VERIFY((ParseInt32Array(pExact, nLength, ",", pIntsParsed, kCount, nPosition) == (size_t)kCount) && (nPosition == nLength));
+		EATEST_VERIFY(memcmp(pInts, pIntsParsed, kCount * sizeof(int32_t)) == 0);
+		delete[] pExact;
+
+		nLength = 0;
+		for(int i = 0; i < kCount; i++)
+		{
+			pDouble[i] = (double)(int32_t)random.RandomUint32Uniform() / pow(10.0, (double)random.RandomUint32Uniform(30));
+			FtoaShortest(pDouble[i], pText + nLength, 32);
+			nLength += Strlen(pText + nLength);
+			pText[nLength++] = (i % 2) ? '\t' : '\n';
+		}
+
+		char* const pExactDouble = new char[nLength - 1];
+		memcpy(pExactDouble, pText, nLength - 1); // Without the last delimiter, so the last number ends at the end of the text.
+
+		double* const pDoubleParsed = new double[kCount];
+
+		EATEST_VERIFY((ParseDoubleArray(pExactDouble, nLength - 1, "\t\n", pDoubleParsed, kCount, nPosition) == (size_t)kCount) && (nPosition == (nLength - 1)));
+		EATEST_VERIFY(memcmp(pDouble, pDoubleParsed, kCount * sizeof(double)) == 0);
+
+		delete[] pExactDouble;
+		delete[] pDoubleParsed;
+		delete[] pIntsParsed;
+		delete[] pText;
+		delete[] pDouble;
+		delete[] pInts;
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestFtoa()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// char*  Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
+	// char16_t* Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
+	// char32_t* Ftoa(double dValue, char_t* pResult, int nInputLength, int nPrecision, bool bExponentEnabled);
+	{
+		char sn18[128];
+
+		Ftoa(-1.7976931, sn18, 128, 7, false);
+		if(Strcmp("-1.7976931", sn18) != 0)
+		{
+			EA::UnitTest::Report("%s\n", sn18);
+			EATEST_VERIFY(Strcmp("-1.7976931", sn18) == 0);
+		}
+
+		Ftoa(10.7976931e299, sn18, 128, 5, true);
+		if(Strcmp("1.07977e+300", sn18) != 0)
+		{
+			EA::UnitTest::Report("%s\n", sn18);
+			EATEST_VERIFY(Strcmp("1.07977e+300", sn18) == 0);
+		}
+
+		Ftoa(-1.7976931, sn18, 128, 4, false);
+		if(Strcmp("-1.7977", sn18) != 0)
+		{
+			EA::UnitTest::Report("%s\n", sn18);
+			EATEST_VERIFY(Strcmp("-1.7977", sn18) == 0);
+		}
+
+		Ftoa(0.107976931e-299, sn18, 128, 5, true);
+		if(Strcmp("1.07977e-300", sn18) != 0)
+		{
+			EA::UnitTest::Report("%s\n", sn18);
+			EATEST_VERIFY(Strcmp("1.07977e-300", sn18) == 0);
 		}
 	}
 	{
@@ -3460,6 +4322,209 @@ static int TestFtoa()
 }
 
 
+// Writes the significant digits of the number in pString, without the sign, decimal point,
+// exponent and leading and trailing zeroes, to pDigits, and returns the number of them.
+static int TestFtoaShortestDigits(const char* pString, char* pDigits)
+{
+	int nCount = 0;
+
+	for(; *pString && (*pString != 'e'); ++pString)
+	{
+		if((*pString >= '0') && (*pString <= '9') && ((nCount > 0) || (*pString != '0')))
+			pDigits[nCount++] = *pString;
+	}
+
+	while((nCount > 0) && (pDigits[nCount - 1] == '0'))
+		--nCount;
+
+	pDigits[nCount] = 0;
+	return nCount;
+}
+
+
+// Verifies that FtoaShortest(dValue) reads back as dValue, that it has the digits of the C runtime 
+// library's correctly rounded %e output with the same number of digits if that reads back as dValue 
+// too, and that no decimal with one digit less reads back as dValue.
+static int TestFtoaShortestValue(double dValue)
+{
+	using namespace EA::StdC;
+
+	int  nErrorCount = 0;
+	char buffer[32], bufferCRT[40], digits[32], digitsCRT[40];
+
+	if(!FtoaShortest(dValue, buffer, sizeof(buffer)))
+	{
+		EATEST_VERIFY_F(false, "FtoaShortest failed for %.17g", dValue);
+		return nErrorCount;
+	}
+
+	const double dResult = strtod(buffer, NULL);
+	EATEST_VERIFY_F(memcmp(&dResult, &dValue, sizeof(double)) == 0, "FtoaShortest(%.17g) produced %s, which doesn't read back", dValue, buffer);
+
+	if(dValue != 0)
+	{
+		const int nDigitCount = TestFtoaShortestDigits(buffer, digits);
+
+		snprintf(bufferCRT, sizeof(bufferCRT), "%.*e", nDigitCount - 1, dValue);
+		if(strtod(bufferCRT, NULL) == dValue) // This isn't so for some powers of two, whose interval of values that read back is asymmetric.
+		{
+			TestFtoaShortestDigits(bufferCRT, digitsCRT);
+			EATEST_VERIFY_F(Strcmp(digits, digitsCRT) == 0, "FtoaShortest(%.17g) produced %s instead of %s", dValue, buffer, bufferCRT);
+		}
+
+		if(nDigitCount > 1)
+		{
+			// Neither the nearest decimal with one digit less nor its neighbors may read back as dValue.
+			const double dValueAbs = fabs(dValue);
+			long long    nMantissa = 0;
+			const char*  p         = bufferCRT;
+
+			snprintf(bufferCRT, sizeof(bufferCRT), "%.*e", nDigitCount - 2, dValueAbs);
+
+			for(; *p != 'e'; ++p)
+			{
+				if(*p != '.')
+					nMantissa = (nMantissa * 10) + (*p - '0');
+			}
+
+			const int nExponent = AtoI32(p + 1) - (nDigitCount - 2);
+
+			for(long long i = nMantissa - 1; i <= nMantissa + 1; i++)
+			{
+				snprintf(bufferCRT, sizeof(bufferCRT), "%llde%d", i, nExponent);
+				EATEST_VERIFY_F(strtod(bufferCRT, NULL) != dValueAbs, "FtoaShortest(%.17g) produced %s, though %s is shorter", dValue, buffer, bufferCRT);
+			}
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestFtoaShortest()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// char*     FtoaShortest(double dValue, char*  pResult, int nResultCapacity);
+	// char16_t* FtoaShortest(double dValue, char16_t* pResult, int nResultCapacity);
+	// char32_t* FtoaShortest(double dValue, char32_t* pResult, int nResultCapacity);
+	{
+		struct ShortestTest { double mValue; const char* mpExpected; };
+
+		const ShortestTest kTests[] = 
+		{
+			{ 0.0, "0" }, { -0.0, "-0" }, { 1.0, "1" }, { -1.0, "-1" }, { 0.1, "0.1" }, { 0.1 + 0.2, "0.30000000000000004" }, 
+			{ 1.0 / 3.0, "0.3333333333333333" }, { 2.0 / 3.0, "0.6666666666666666" }, { 123.456, "123.456" }, { -1234.5, "-1234.5" },
+			{ 100.0, "100" }, { 9.5, "9.5" }, { 9007199254740992.0, "9007199254740992" }, { 9007199254740993.0, "9007199254740992" },
+			{ 1e20, "100000000000000000000" }, { 123456789012345680000.0, "123456789012345680000" }, { 1e21, "1e+21" }, 
+			{ 1e23, "1e+23" }, { 1.2345e25, "1.2345e+25" }, { 1e-6, "0.000001" }, { 1.5e-6, "0.0000015" }, { 1.2345678901234567e-6, "0.0000012345678901234567" }, 
+			{ -1.2345678901234567e-6, "-0.0000012345678901234567" }, { 1e-7, "1e-7" }, { 1.5e-7, "1.5e-7" }, 
+			{ 1.7976931348623157e308, "1.7976931348623157e+308" }, { 2.2250738585072014e-308, "2.2250738585072014e-308" }, 
+			{ 2.225073858507201e-308, "2.225073858507201e-308" }, { 5e-324, "5e-324" }, { -5e-324, "-5e-324" }, { 9007199254740991.0, "9007199254740991" },
+			{ 4.35, "4.35" }, { 0.3, "0.3" }, { 2.5e-5, "0.000025" }, { 5.0e-324 * 3, "1.5e-323" }, { 1.0e16, "10000000000000000" }
+		};
+
+		for(size_t i = 0; i < EAArrayCount(kTests); i++)
+		{
+			char  buffer[32];
+			char* pResult = FtoaShortest(kTests[i].mValue, buffer, sizeof(buffer));
+
+			EATEST_VERIFY_F(pResult && (Strcmp(buffer, kTests[i].mpExpected) == 0), "FtoaShortest produced %s instead of %s", buffer, kTests[i].mpExpected);
+			nErrorCount += TestFtoaShortestValue(kTests[i].mValue);
+		}
+	}
+
+	{
+		char  buffer[32];
+		char* pResult;
+
+		pResult = FtoaShortest(HUGE_VAL, buffer, sizeof(buffer));
+		EATEST_VERIFY(pResult && (Strcmp(buffer, "inf") == 0));
+
+		pResult = FtoaShortest(-HUGE_VAL, buffer, sizeof(buffer));
+		EATEST_VERIFY(pResult && (Strcmp(buffer, "-inf") == 0));
+
+		const double dNaN = HUGE_VAL - HUGE_VAL;
+		pResult = FtoaShortest(dNaN, buffer, sizeof(buffer));
+		EATEST_VERIFY(pResult && ((Strcmp(buffer, "nan") == 0) || (Strcmp(buffer, "-nan") == 0)));
+
+		// The capacity includes the terminating 0, and the output is untouched if it's insufficient.
+		Strcpy(buffer, "xyz");
+		pResult = FtoaShortest(1e21, buffer, 5);
+		EATEST_VERIFY((pResult == NULL) && (Strcmp(buffer, "xyz") == 0));
+
+		pResult = FtoaShortest(1e21, buffer, 6);
+		EATEST_VERIFY(pResult && (Strcmp(buffer, "1e+21") == 0));
+
+		pResult = FtoaShortest(-1.2345678901234567e-6, buffer, 26);
+		EATEST_VERIFY(pResult && (Strlen(buffer) == 25));
+
+		pResult = FtoaShortest(1.0, buffer, 0);
+		EATEST_VERIFY(pResult == NULL);
+	}
+
+	{
+		char16_t  buffer[32];
+		char16_t* pResult = FtoaShortest(-0.0000123, buffer, 32);
+		EATEST_VERIFY(pResult && (Strcmp(buffer, EA_CHAR16("-0.0000123")) == 0));
+
+		pResult = FtoaShortest(6.02214076e23, buffer, 32);
+		EATEST_VERIFY(pResult && (Strcmp(buffer, EA_CHAR16("6.02214076e+23")) == 0));
+	}
+
+	{
+		char32_t  buffer[32];
+		char32_t* pResult = FtoaShortest(-0.0000123, buffer, 32);
+		EATEST_VERIFY(pResult && (Strcmp(buffer, EA_CHAR32("-0.0000123")) == 0));
+
+		pResult = FtoaShortest(6.02214076e23, buffer, 32);
+		EATEST_VERIFY(pResult && (Strcmp(buffer, EA_CHAR32("6.02214076e+23")) == 0));
+	}
+
+	{
+		// Random bit patterns, which cover all exponents, powers of two, whose lower neighbor is closer,
+		// denormals, and short decimals of the kind found in data files, which take the rarer paths
+		// where the interval bounds and exact ties matter.
+		RandomFast random(0x12345678);
+
+		for(int i = 0; i < 20000; i++)
+		{
+			const uint64_t nBits = ((uint64_t)random.RandomUint32Uniform() << 32) | random.RandomUint32Uniform();
+			uint64_t       nPattern;
+			double         dValue;
+
+			switch(i % 4)
+			{
+				case 0:
+					nPattern = nBits;
+					memcpy(&dValue, &nPattern, sizeof(dValue));
+					break;
+
+				case 1:
+					dValue = ldexp(1.0, (int)random.RandomUint32Uniform(2098) - 1074);
+					break;
+
+				case 2:
+					nPattern = nBits & ((UINT64_C(1) << (random.RandomUint32Uniform(52) + 1)) - 1);
+					memcpy(&dValue, &nPattern, sizeof(dValue));
+					break;
+
+				default:
+					dValue = (double)(int64_t)(nBits % 100000000) / pow(10.0, (double)random.RandomUint32Uniform(30)) * pow(10.0, (double)random.RandomUint32Uniform(30));
+					break;
+			}
+
+			if(!IsInfinite(dValue) && !IsNAN(dValue))
+				nErrorCount += TestFtoaShortestValue(dValue);
+		}
+	}
+
+	return nErrorCount;
+}
+
+
 static int TestReduceFloatString()
 {
 	using namespace EA::StdC;
@@ -4192,6 +5257,1267 @@ static int TestStrstart()
 
 
 
+template <typename T>
+static int TestStrlenT()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{   // Every combination of start alignment and length up to a few vectors, with non-zero characters that have zero bytes.
+		T buffer[160];
+
+		for(size_t i = 0; i < EAArrayCount(buffer); i++)
+			buffer[i] = (T)(((i % 2) && (sizeof(T) > 1)) ? 0x0100 : 0x0001);
+
+		for(size_t offset = 0; offset < 40; offset++)
+		{
+			for(size_t length = 0; (offset + length) < EAArrayCount(buffer); length++)
+			{
+				const T c = buffer[offset + length];
+
+				buffer[offset + length] = 0;
+				EATEST_VERIFY(Strlen(buffer + offset) == length);
+				EATEST_VERIFY(Strend(buffer + offset) == (buffer + offset + length));
+				buffer[offset + length] = c;
+			}
+		}
+	}
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+	{   // Strings which end right before an inaccessible page, which vector reads must not cross.
+		GuardedPage guardedPage;
+
+		if(guardedPage.GetPage())
+		{
+			T* const     pPage  = static_cast<T*>(guardedPage.GetPage());
+			const size_t kCount = GuardedPage::kPageSize / sizeof(T);
+
+			for(size_t i = 0; i < kCount; i++)
+				pPage[i] = (T)'a';
+			pPage[kCount - 1] = 0;
+
+			for(size_t length = 0; length < 100; length++)
+			{
+				EATEST_VERIFY(Strlen(pPage + (kCount - 1) - length) == length);
+				EATEST_VERIFY(Strend(pPage + (kCount - 1) - length) == (pPage + (kCount - 1)));
+			}
+		}
+	}
+	#endif
+
+	return nErrorCount;
+}
+
+
+// The simple char by char comparison which the Stricmp and Strnicmp kernels must agree with.
+template <typename T>
+static int StrnicmpReference(const T* pString1, const T* pString2, size_t n)
+{
+	for(; n; --n, ++pString1, ++pString2)
+	{
+		const T c1 = EA::StdC::Tolower(*pString1);
+		const T c2 = EA::StdC::Tolower(*pString2);
+
+		if(c1 != c2)
+		{
+			const uint32_t u1 = (sizeof(T) == 1) ? (uint8_t)c1 : (uint32_t)c1;
+			const uint32_t u2 = (sizeof(T) == 1) ? (uint8_t)c2 : (uint32_t)c2;
+
+			if(sizeof(T) == 4)
+				return (u1 > u2) ? 1 : -1;
+			return (int)u1 - (int)u2;
+		}
+		if(c1 == 0)
+			break;
+	}
+
+	return 0;
+}
+
+
+template <typename T>
+static int TestStricmpT()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{   // Random strings which differ in case and possibly in one char, at every start alignment and 
+		// many lengths. The chars are those at the edges of the ASCII letter ranges and some which 
+		// aren't ASCII, including ones whose low byte is an ASCII letter.
+		const T kChars[] = { (T)'a', (T)'A', (T)'z', (T)'Z', (T)'m', (T)'M', (T)'@', (T)'[', (T)'`', (T)'{', (T)'0', (T)0x7f, 
+							 (T)0xc1, (T)0xe1, (T)(sizeof(T) > 1 ? 0x0141 : 0x80), (T)(sizeof(T) > 1 ? 0xff5a : 0xda), (T)(sizeof(T) > 2 ? 0x10041 : 0xfe) };
+		RandomFast random;
+		T          buffer1[128];
+		T          buffer2[128];
+
+		for(int i = 0; i < 4000; i++)
+		{
+			const size_t nOffset1 = random.RandomUint32Uniform(4);
+			const size_t nOffset2 = random.RandomUint32Uniform(4);
+			const size_t nLength  = random.RandomUint32Uniform(100);
+			T* const     p1 = buffer1 + nOffset1;
+			T* const     p2 = buffer2 + nOffset2;
+
+			for(size_t j = 0; j < nLength; j++)
+			{
+				p1[j] = kChars[random.RandomUint32Uniform(EAArrayCount(kChars))];
+				p2[j] = ((p1[j] >= 'a') && (p1[j] <= 'z') && random.RandomUint32Uniform(2)) ? (T)(p1[j] - 0x20) : 
+						((p1[j] >= 'A') && (p1[j] <= 'Z') && random.RandomUint32Uniform(2)) ? (T)(p1[j] + 0x20) : p1[j];
+			}
+			p1[nLength] = 0;
+			p2[nLength] = 0;
+
+			if(nLength && random.RandomUint32Uniform(2)) // Make them differ at a random position, possibly by the length.
+			{
+				const size_t nPosition = random.RandomUint32Uniform((uint32_t)nLength);
+				(random.RandomUint32Uniform(2) ? p1 : p2)[nPosition] = random.RandomUint32Uniform(4) ? kChars[random.RandomUint32Uniform(EAArrayCount(kChars))] : (T)0;
+			}
+
+			const size_t n = random.RandomUint32Uniform(2) ? (size_t)random.RandomUint32Uniform(110) : kSizeTypeUnset;
+
+			EATEST_VERIFY(Stricmp(p1, p2)     == StrnicmpReference(p1, p2, kSizeTypeUnset));
+			EATEST_VERIFY(Stricmp(p2, p1)     == StrnicmpReference(p2, p1, kSizeTypeUnset));
+			EATEST_VERIFY(Strnicmp(p1, p2, n) == StrnicmpReference(p1, p2, n));
+			EATEST_VERIFY(Strnicmp(p2, p1, n) == StrnicmpReference(p2, p1, n));
+		}
+	}
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+	{   // Equal strings which end right before an inaccessible page, which vector reads must not cross.
+		GuardedPage guardedPage;
+
+		if(guardedPage.GetPage())
+		{
+			T* const     pPage  = static_cast<T*>(guardedPage.GetPage());
+			const size_t kCount = GuardedPage::kPageSize / sizeof(T);
+
+			for(size_t i = 0; i < kCount; i++)
+				pPage[i] = (T)((i % 2) ? 'a' : 'B');
+			pPage[kCount - 1] = 0;
+
+			T buffer[128];
+
+			for(size_t length = 0; length < 100; length++)
+			{
+				const T* const pString = pPage + (kCount - 1) - length;
+
+				for(size_t i = 0; i <= length; i++)
+					buffer[i] = (T)Toupper(pString[i]);
+
+				EATEST_VERIFY(Stricmp(pString, buffer) == 0);
+				EATEST_VERIFY(Stricmp(buffer, pString) == 0);
+				EATEST_VERIFY(Strnicmp(pString, buffer, length + 50) == 0);
+				EATEST_VERIFY(Stricmp(pString, pString - 1) != 0); // The chars alternate between 'a' and 'B'.
+			}
+		}
+	}
+	#endif
+
+	return nErrorCount;
+}
+
+
+static int TestStricmp()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// int Stricmp(const char16_t* pString1, const char16_t* pString2);
+	// int Stricmp(const char32_t* pString1, const char32_t* pString2);
+	// int Strnicmp(const char*  pString1, const char*  pString2, size_t n);
+	// int Strnicmp(const char16_t* pString1, const char16_t* pString2, size_t n);
+	// int Strnicmp(const char32_t* pString1, const char32_t* pString2, size_t n);
+
+	// These have runtime CPU dispatched implementations, so we test each supported level.
+	for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+	{
+		nErrorCount += TestStricmpT<char>();
+		nErrorCount += TestStricmpT<char16_t>();
+		nErrorCount += TestStricmpT<char32_t>();
+	}
+
+	{
+		// Resolving the dispatch table matches EASTDC_CPU_FEATURE_LEVEL against the level names case-insensitively.
+		// Stricmp itself may be dispatched (e.g. when EASTDC_STATIC_ANALYSIS_ENABLED disables the CRT version),
+		// so here the first call after the table is reset is the one which resolves it.
+		char       savedLevel[16];
+		const bool bLevelSaved = (GetEnvironmentVar("EASTDC_CPU_FEATURE_LEVEL", savedLevel, sizeof(savedLevel)) < sizeof(savedLevel));
+
+		if(SetEnvironmentVar("EASTDC_CPU_FEATURE_LEVEL", "SSE2"))
+		{
+			const CPUFeatureLevel expectedLevel = (GetCPUFeatureLevelSupported() < kCPUFeatureLevelSSE2) ? GetCPUFeatureLevelSupported() : kCPUFeatureLevelSSE2;
+
+			Internal::StoreCPUDispatchTable(&Internal::gpCPUDispatchTable, NULL);
+			EATEST_VERIFY(Stricmp("abc", "ABC") == 0);
+			EATEST_VERIFY(GetCPUFeatureLevel() == expectedLevel);
+
+			SetEnvironmentVar("EASTDC_CPU_FEATURE_LEVEL", bLevelSaved ? savedLevel : NULL);
+			SetCPUFeatureLevel(kCPUFeatureLevelCount);
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+// The simple position by position search which the Strstr family of functions must agree with.
+template <typename T>
+static T* StrstrReference(const T* pString, const T* pSubString, bool bFold, bool bReverse)
+{
+	const size_t nLength    = EA::StdC::Strlen(pString);
+	const size_t nSubLength = EA::StdC::Strlen(pSubString);
+	const T*     pResult    = NULL;
+
+	for(size_t i = 0; (i + nSubLength) <= nLength; i++)
+	{
+		size_t j = 0;
+
+		while((j < nSubLength) && ((bFold ? EA::StdC::Tolower(pString[i + j]) : pString[i + j]) == (bFold ? EA::StdC::Tolower(pSubString[j]) : pSubString[j])))
+			j++;
+
+		if(j == nSubLength)
+		{
+			pResult = pString + i;
+			if(!bReverse)
+				break;
+		}
+	}
+
+	if(nSubLength == 0) // All of them return pString for an empty pSubString.
+		pResult = pString;
+
+	return (T*)pResult;
+}
+
+
+template <typename T>
+static int TestStrstrT()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{   // Random haystacks over a small alphabet, so that there are many partial matches, and needles 
+		// which are taken from the haystack (with their case changed) or are random, at every start alignment.
+		const T kChars[] = { (T)'a', (T)'A', (T)'b', (T)'B', (T)'z', (T)'Z', (T)'@', (T)'[', (T)'`', (T)'{', 
+							 (T)0xc1, (T)0xe1, (T)(sizeof(T) > 1 ? 0x0141 : 0x80), (T)(sizeof(T) > 2 ? 0x10061 : 0xfe) };
+		RandomFast random;
+		T          string[160];
+		T          subString[48];
+
+		for(int i = 0; i < 6000; i++)
+		{
+			const size_t nLength    = random.RandomUint32Uniform(150);
+			const size_t nSubLength = random.RandomUint32Uniform(i % 10 ? 6 : 40);
+			const size_t nAlphabet  = 2 + random.RandomUint32Uniform(EAArrayCount(kChars) - 1);
+			T* const     p          = string + random.RandomUint32Uniform(8);
+
+			for(size_t j = 0; j < nLength; j++)
+				p[j] = kChars[random.RandomUint32Uniform((uint32_t)nAlphabet)];
+			p[nLength] = 0;
+
+			if((nSubLength < nLength) && random.RandomUint32Uniform(2))
+			{
+				const size_t nPosition = random.RandomUint32Uniform((uint32_t)(nLength - nSubLength));
+
+				for(size_t j = 0; j < nSubLength; j++)
+					subString[j] = random.RandomUint32Uniform(2) ? Toupper(p[nPosition + j]) : p[nPosition + j];
+			}
+			else
+			{
+				for(size_t j = 0; j < nSubLength; j++)
+					subString[j] = kChars[random.RandomUint32Uniform((uint32_t)nAlphabet)];
+			}
+			subString[nSubLength] = 0;
+
+			EATEST_VERIFY(Strstr  (p, subString) == StrstrReference(p, subString, false, false));
+			EATEST_VERIFY(Stristr (p, subString) == StrstrReference(p, subString, true,  false));
+			EATEST_VERIFY(Strrstr (p, subString) == StrstrReference(p, subString, false, true));
+			EATEST_VERIFY(Strirstr(p, subString) == StrstrReference(p, subString, true,  true));
+		}
+	}
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+	{   // Strings which end right before an inaccessible page, which vector reads must not cross.
+		GuardedPage guardedPage;
+
+		if(guardedPage.GetPage())
+		{
+			T* const     pPage  = static_cast<T*>(guardedPage.GetPage());
+			const size_t kCount = GuardedPage::kPageSize / sizeof(T);
+			const T      kABC[]  = { (T)'a', (T)'b', (T)'c', 0 };
+			const T      kAbC[]  = { (T)'A', (T)'b', (T)'C', 0 };
+			const T      kXyz[]  = { (T)'x', (T)'y', (T)'z', 0 };
+
+			for(size_t i = 0; i < kCount; i++)
+				pPage[i] = (T)('a' + (i % 3));
+			pPage[kCount - 1] = 0;
+
+			for(size_t length = 0; length < 100; length++)
+			{
+				const T* const pString = pPage + (kCount - 1) - length;
+
+				for(int f = 0; f < 2; f++) // The needle is last in the string, then it isn't there at all.
+				{
+					const T* const pSubString = f ? kXyz : kAbC;
+
+					EATEST_VERIFY(Strstr  (pString, pSubString) == StrstrReference(pString, pSubString, false, false));
+					EATEST_VERIFY(Stristr (pString, pSubString) == StrstrReference(pString, pSubString, true,  false));
+					EATEST_VERIFY(Strrstr (pString, pSubString) == StrstrReference(pString, pSubString, false, true));
+					EATEST_VERIFY(Strirstr(pString, pSubString) == StrstrReference(pString, pSubString, true,  true));
+				}
+				EATEST_VERIFY(Strstr(pString, kABC) == StrstrReference(pString, kABC, false, false));
+			}
+		}
+	}
+	#endif
+
+	return nErrorCount;
+}
+
+
+static int TestStrstr()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// char*     Strstr(const char* pString, const char* pSubString);
+	// char16_t* Strstr(const char16_t* pString, const char16_t* pSubString);
+	// char32_t* Strstr(const char32_t* pString, const char32_t* pSubString);
+	// And Stristr, Strrstr, Strirstr.
+
+	// These have runtime CPU dispatched implementations, so we test each supported level.
+	for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+	{
+		nErrorCount += TestStrstrT<char>();
+		nErrorCount += TestStrstrT<char16_t>();
+		nErrorCount += TestStrstrT<char32_t>();
+	}
+
+	return nErrorCount;
+}
+
+
+// The char by char scans which the CharSet functions must agree with. Returns the 
+// position of the first char of pString which is (if bInSet) or isn't in pChars.
+template <typename T>
+static const T* CharSetFindReference(const T* pString, const T* pChars, bool bInSet)
+{
+	for(; *pString; ++pString)
+	{
+		const T* pChar = pChars;
+
+		while(*pChar && (*pChar != *pString))
+			++pChar;
+
+		if((*pChar != 0) == bInSet)
+			break;
+	}
+
+	return pString;
+}
+
+
+template <typename T>
+static int TestCharSetT()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{   // Random strings and sets. The chars include ones with the top bit set, ones at the edges 
+		// of the nibble tables, and wide chars whose low 5 bits are the same, so that they share 
+		// the hash bit of the wide chars in the set.
+		const T kChars[] = { (T)'a', (T)'b', (T)',', (T)' ', (T)'\t', (T)0x01, (T)0x0f, (T)0x10, (T)0x70, (T)0x7f, (T)0x80, (T)0x8f, (T)0xf0, (T)0xff,
+							 (T)(sizeof(T) > 1 ? 0x0141 : 0x41), (T)(sizeof(T) > 1 ? 0x0161 : 0x61), (T)(sizeof(T) > 1 ? 0xff01 : 0xc1), (T)(sizeof(T) > 2 ? 0x10141 : 0xe1) };
+		RandomFast random;
+		T          string[160];
+		T          chars[24];
+
+		for(int i = 0; i < 4000; i++)
+		{
+			const size_t nLength     = random.RandomUint32Uniform(150);
+			const size_t nCharsCount = random.RandomUint32Uniform(8);
+			T* const     p           = string + random.RandomUint32Uniform(8);
+
+			for(size_t j = 0; j < nLength; j++)
+				p[j] = kChars[random.RandomUint32Uniform(EAArrayCount(kChars))];
+			p[nLength] = 0;
+
+			for(size_t j = 0; j < nCharsCount; j++)
+				chars[j] = kChars[random.RandomUint32Uniform(EAArrayCount(kChars))];
+			chars[nCharsCount] = 0;
+
+			const CharSet  charSet(chars);
+			const T* const pIn     = CharSetFindReference(p, chars, true);
+			const T* const pNotIn  = CharSetFindReference(p, chars, false);
+
+			for(size_t j = 0; j < EAArrayCount(kChars); j++)
+				EATEST_VERIFY(charSet.Contains(kChars[j]) == (Strchr(chars, kChars[j]) != NULL));
+
+			EATEST_VERIFY(Strcspn(p, chars)   == (size_t)(pIn - p));
+			EATEST_VERIFY(Strcspn(p, charSet) == (size_t)(pIn - p));
+			EATEST_VERIFY(Strspn (p, chars)   == (size_t)(pNotIn - p));
+			EATEST_VERIFY(Strspn (p, charSet) == (size_t)(pNotIn - p));
+			EATEST_VERIFY(Strpbrk(p, chars)   == (*pIn ? pIn : NULL));
+			EATEST_VERIFY(Strpbrk(p, charSet) == (*pIn ? pIn : NULL));
+
+			// Strtok and Strtok2 must find the same tokens as the reference scans.
+			T        copy[160];
+			T*       pContext   = NULL;
+			const T* pNext      = p;    // Where the reference scan continues.
+			const T* pPrevToken = p;    // What Strtok2 continues from.
+			size_t   nTokenLength;
+			Strcpy(copy, p);
+
+			for(int t = 0; t < 160; t++)
+			{
+				const T* const pTokenBegin = CharSetFindReference(pNext, chars, false);
+				const T* const pTokenEnd   = CharSetFindReference(pTokenBegin, chars, true);
+				T* const       pToken      = Strtok(t ? NULL : copy, charSet, &pContext);
+				const T* const pToken2     = Strtok2(pPrevToken, (nCharsCount & 1) ? charSet : CharSet(chars), &nTokenLength, t == 0);
+
+				if(pTokenBegin == pTokenEnd)
+				{
+					EATEST_VERIFY((pToken == NULL) && (pToken2 == NULL) && (nTokenLength == 0));
+					break;
+				}
+
+				EATEST_VERIFY((pToken == (copy + (pTokenBegin - p))) && (Strlen(pToken) == (size_t)(pTokenEnd - pTokenBegin)));
+				EATEST_VERIFY((pToken2 == pTokenBegin) && (nTokenLength == (size_t)(pTokenEnd - pTokenBegin)));
+				pNext      = pTokenEnd;
+				pPrevToken = pTokenBegin;
+			}
+		}
+	}
+
+	#if EASTDC_SYS_MMAN_H_AVAILABLE
+	{   // Strings which end right before an inaccessible page, which vector reads must not cross.
+		GuardedPage guardedPage;
+
+		if(guardedPage.GetPage())
+		{
+			T* const      pPage  = static_cast<T*>(guardedPage.GetPage());
+			const size_t  kCount = GuardedPage::kPageSize / sizeof(T);
+			const T       kAB[]  = { (T)'a', (T)'b', 0 };
+			const T       kXY[]  = { (T)'x', (T)'y', 0 };
+			const CharSet charSetAB(kAB);
+			const CharSet charSetXY(kXY);
+
+			for(size_t i = 0; i < kCount; i++)
+				pPage[i] = (T)((i % 2) ? 'a' : 'b');
+			pPage[kCount - 1] = 0;
+
+			for(size_t length = 0; length < 100; length++)
+			{
+				const T* const pString = pPage + (kCount - 1) - length;
+
+				EATEST_VERIFY(Strspn (pString, charSetAB) == length);
+				EATEST_VERIFY(Strcspn(pString, charSetXY) == length);
+				EATEST_VERIFY(Strpbrk(pString, charSetXY) == NULL);
+			}
+		}
+	}
+	#endif
+
+	return nErrorCount;
+}
+
+
+static int TestCharSet()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	{
+		const CharSet charSetEmpty;
+		const CharSet charSet("\x01\x7f\x80\xff");
+
+		for(uint32_t c = 0; c < 300; c++)
+		{
+			EATEST_VERIFY(!charSetEmpty.Contains(c));
+			EATEST_VERIFY(charSet.Contains(c) == ((c == 0x01) || (c == 0x7f) || (c == 0x80) || (c == 0xff)));
+		}
+	}
+
+	{   // Wide chars are held in the set, which doesn't refer to the string it was built from. 
+		// Chars beyond kWideCharCapacity are left out of the set, but not out of the string versions.
+		const uint32_t kCount = CharSet::kWideCharCapacity + 2;
+		char32_t       chars[kCount + 1];
+		uint32_t       i;
+
+		for(i = 0; i < kCount; i++)
+			chars[i] = (char32_t)(0x10000 - (i * 33)); // Decreasing, so that each is inserted at the front of the set.
+		chars[kCount] = 0;
+
+		CharSet charSet(chars + 2);
+		EATEST_VERIFY(charSet.IsComplete());
+
+		for(i = 0; i < kCount; i++)
+			chars[i] = (char32_t)0x0141;
+		for(i = 0; i < kCount; i++)
+			EATEST_VERIFY(charSet.Contains((char32_t)(0x10000 - (i * 33))) == (i >= 2));
+		EATEST_VERIFY(!charSet.Contains((char32_t)0x0141));
+
+		for(i = 0; i < kCount; i++)
+			chars[i] = (char32_t)(0x10000 - (i * 33));
+		charSet.Init(chars);
+		EATEST_VERIFY(!charSet.IsComplete());
+		EATEST_VERIFY(charSet.Contains(chars[0]) && charSet.Contains(chars[CharSet::kWideCharCapacity - 1]) && !charSet.Contains(chars[kCount - 1]));
+
+		const char32_t string[2] = { chars[kCount - 1], 0 };
+		EATEST_VERIFY(Strcspn(string, chars) == 0);
+		EATEST_VERIFY(Strspn (string, chars) == 1);
+		EATEST_VERIFY(Strpbrk(string, chars) == string);
+		EATEST_VERIFY(Strcspn(string, charSet) == 1);
+	}
+
+	// class CharSet
+	// size_t    Strcspn(const char_t* pString, const CharSet& charSet);
+	// char_t*   Strpbrk(const char_t* pString, const CharSet& charSet);
+	// size_t    Strspn(const char_t* pString, const CharSet& charSet);
+	// char_t*   Strtok(char_t* pString, const CharSet& delimiters, char_t** pContext);
+	// char_t*   Strtok2(const char_t* pString, const CharSet& delimiters, size_t* pResultLength, bool bFirst);
+
+	// These have runtime CPU dispatched implementations, so we test each supported level.
+	for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+	{
+		nErrorCount += TestCharSetT<char>();
+		nErrorCount += TestCharSetT<char16_t>();
+		nErrorCount += TestCharSetT<char32_t>();
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestStrlen()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// size_t    Strlen(const char16_t* pString);
+	// size_t    Strlen(const char32_t* pString);
+	// char16_t* Strend(const char16_t* pString);
+	// char32_t* Strend(const char32_t* pString);
+
+	// These have runtime CPU dispatched implementations, so we test each supported level.
+	for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+	{
+		nErrorCount += TestStrlenT<char>();
+		nErrorCount += TestStrlenT<char16_t>();
+		nErrorCount += TestStrlenT<char32_t>();
+	}
+
+	return nErrorCount;
+}
+
+
+template <typename InCharT, typename OutCharT>
+static int TestStrlcpyTranscodeT(const InCharT* pSource, size_t nSourceLength)
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// The results at each CPU feature level must be the same as those at the scalar level, including 
+	// the contents of the destination past the terminating 0. The source is at most 256 code points.
+	const size_t kCapacities[] = { 0, 1, 2, 3, 5, 9, 17, 33, 64, 200, 1100 };
+	const size_t kBufferSize   = 1100;
+
+	for(size_t k = 0; k < EAArrayCount(kCapacities); k++)
+	{
+		for(int bLength = 0; bLength < 2; bLength++)
+		{
+			const size_t nLength = bLength ? nSourceLength : kSizeTypeUnset;
+			OutCharT     expectedDest[2][kBufferSize];
+			int          expectedResult = 0, expectedCountResult = 0;
+			bool         bExpectedResult = false;
+			size_t       expectedDestUsed = 0, expectedSourceUsed = 0;
+
+			for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+			{
+				OutCharT dest[2][kBufferSize];
+				size_t   destUsed = 0, sourceUsed = 0;
+
+				memset(dest, 0xcc, sizeof(dest));
+
+				const int  result      = Strlcpy(dest[0], pSource, kCapacities[k], nLength);
+				const int  countResult = Strlcpy((OutCharT*)NULL, pSource, 0, nLength);
+				const bool bResult     = Strlcpy(dest[1], pSource, kCapacities[k], nLength, destUsed, sourceUsed);
+
+				if(level.GetLevel() == kCPUFeatureLevelScalar)
+				{
+					memcpy(expectedDest, dest, sizeof(dest));
+					expectedResult      = result;
+					expectedCountResult = countResult;
+					bExpectedResult     = bResult;
+					expectedDestUsed    = destUsed;
+					expectedSourceUsed  = sourceUsed;
+				}
+				else
+				{
+					EATEST_VERIFY(result == expectedResult);
+					EATEST_VERIFY(countResult == expectedCountResult);
+					EATEST_VERIFY(bResult == bExpectedResult);
+					EATEST_VERIFY(destUsed == expectedDestUsed);
+					EATEST_VERIFY(sourceUsed == expectedSourceUsed);
+					EATEST_VERIFY(memcmp(dest, expectedDest, sizeof(dest)) == 0);
+				}
+			}
+
+			EATEST_VERIFY((expectedResult < 0) || (expectedResult == expectedCountResult));
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestStrlcpyTranscode()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// int  Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength);
+	// int  Strlcpy(char32_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength);
+	// int  Strlcpy(char* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength);
+	// int  Strlcpy(char* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength);
+	// bool Strlcpy(char16_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed);
+	// bool Strlcpy(char32_t* pDest, const char* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed);
+	// bool Strlcpy(char* pDest, const char16_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed);
+	// bool Strlcpy(char* pDest, const char32_t* pSource, size_t nDestCapacity, size_t nSourceLength, size_t& nDestUsed, size_t& nSourceUsed);
+	//
+	// These have runtime CPU dispatched fast paths. Half of the strings have invalid encodings and 0 chars in them.
+
+	// Sequences which end the conversion or which are left to the general code. Some are valid.
+	static const char* const kUTF8Specials[] = 
+	{
+		"\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xc2", "\xe1\x80", "\xe0\x80\x80", "\xe0\x9f\xbf", "\xe0\xa0\x80", 
+		"\xed\xa0\x80", "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf8", "\xff", "\xc2\xc2", "" 
+	};
+
+	RandomFast random(0x12345678);
+
+	for(int i = 0; i < 400; i++)
+	{
+		const bool      bSpecials = (i % 2) != 0;
+		const size_t    nCount    = random.RandomUint32Uniform(257);
+		uint32_t        kind      = random.RandomUint32Uniform(4);
+		eastl::string   s8;
+		eastl::string16 s16;
+		eastl::string32 s32;
+
+		for(size_t j = 0; j < nCount; j++)
+		{
+			if(random.RandomUint32Uniform(8) == 0) // Mostly continue a run of code points of the same UTF-8 length, so that there are both uniform and mixed blocks.
+				kind = random.RandomUint32Uniform(4);
+
+			const uint32_t c        = TestRandomCodePoint(random, kind);
+			const bool     bSpecial = bSpecials && (random.RandomUint32Uniform(64) == 0);
+
+			if(bSpecial)
+			{
+				const char* pSpecial = kUTF8Specials[random.RandomUint32Uniform(EAArrayCount(kUTF8Specials))];
+				s8.append(pSpecial, pSpecial + Strlen(pSpecial) + (*pSpecial ? 0 : 1)); // The empty string stands for a 0 char.
+				s16.push_back((char16_t)((random.RandomUint32Uniform(2) == 0) ? 0 : 0xd800));
+				s32.push_back((char32_t)((random.RandomUint32Uniform(2) == 0) ? 0 : (0x10ffff + random.RandomUint32Uniform(0x7fffffff))));
+			}
+			else
+			{
+				TestAppendUTF8(s8, c);
+				s16.push_back((char16_t)c);
+				s32.push_back((char32_t)c);
+			}
+		}
+
+		// We copy the strings to exactly sized heap blocks, so that reading past them can be detected.
+		char*     p8  = new char[s8.size() + 1];
+		char16_t* p16 = new char16_t[s16.size() + 1];
+		char32_t* p32 = new char32_t[s32.size() + 1];
+
+		memcpy(p8, s8.data(), s8.size());
+		memcpy(p16, s16.data(), s16.size() * sizeof(char16_t));
+		memcpy(p32, s32.data(), s32.size() * sizeof(char32_t));
+		p8[s8.size()] = 0;
+		p16[s16.size()] = 0;
+		p32[s32.size()] = 0;
+
+		nErrorCount += TestStrlcpyTranscodeT<char, char16_t>(p8, s8.size());
+		nErrorCount += TestStrlcpyTranscodeT<char, char32_t>(p8, s8.size());
+		nErrorCount += TestStrlcpyTranscodeT<char16_t, char>(p16, s16.size());
+		nErrorCount += TestStrlcpyTranscodeT<char32_t, char>(p32, s32.size());
+
+		delete[] p8;
+		delete[] p16;
+		delete[] p32;
+	}
+
+	{   // Conversions in both directions reproduce the original text, for each kind of text.
+		for(uint32_t kind = 0; kind < 4; kind++)
+		{
+			eastl::string32 s32;
+
+			for(int j = 0; j < 1000; j++)
+				s32.push_back((char32_t)TestRandomCodePoint(random, kind));
+			s32.push_back(0);
+
+			for(EachCPUFeatureLevel level; level.Next(nErrorCount); )
+			{
+				char     s8[4100];
+				char32_t s32Copy[1001];
+
+				const int n8 = Strlcpy(s8, s32.data(), EAArrayCount(s8));
+				EATEST_VERIFY((n8 > 0) && (n8 < (int)EAArrayCount(s8)));
+				EATEST_VERIFY(Strlcpy(s32Copy, s8, EAArrayCount(s32Copy)) == 1000);
+				EATEST_VERIFY(memcmp(s32Copy, s32.data(), sizeof(s32Copy)) == 0);
+			}
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+static void TestStricmpSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares Stricmp and Strnicmp at the scalar level to those at the level selected for this CPU, 
+	// with pairs of asset paths like those of name lookups, which are equal but for letter case.
+	const size_t    kCount = 1000;
+	RandomFast      random;
+	Stopwatch       s(Stopwatch::kUnitsCPUCycles);
+	static char     strings8[2][kCount][96]; // Static because this is too big for some platforms' stacks.
+	static char16_t strings16[2][kCount][96];
+	static char32_t strings32[2][kCount][96];
+	int             result = 0;
+
+	for(size_t i = 0; i < kCount; i++)
+	{
+		const size_t nLength = 16 + random.RandomUint32Uniform(64);
+
+		for(size_t j = 0; j < nLength; j++)
+		{
+			const uint32_t r = random.RandomUint32Uniform(32);
+			const char     c = (r < 26) ? (char)('a' + r) : "/_.0129"[r - 26];
+
+			strings8[0][i][j] = c;
+			strings8[1][i][j] = (char)(random.RandomUint32Uniform(2) ? Toupper(c) : c);
+		}
+		strings8[0][i][nLength] = 0;
+		strings8[1][i][nLength] = 0;
+
+		for(int k = 0; k < 2; k++)
+		{
+			Strlcpy(strings16[k][i], strings8[k][i], EAArrayCount(strings16[k][i]));
+			Strlcpy(strings32[k][i], strings8[k][i], EAArrayCount(strings32[k][i]));
+		}
+	}
+
+	uint64_t elapsedTime[3][2];
+
+	for(int level = 0; level < 2; level++)
+	{
+		SetCPUFeatureLevel((level == 0) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += Strnicmp(strings8[0][i], strings8[1][i], 96);
+		s.Stop();
+		elapsedTime[0][level] = s.GetElapsedTime();
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += Stricmp(strings16[0][i], strings16[1][i]);
+		s.Stop();
+		elapsedTime[1][level] = s.GetElapsedTime();
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += Stricmp(strings32[0][i], strings32[1][i]);
+		s.Stop();
+		elapsedTime[2][level] = s.GetElapsedTime();
+	}
+
+	const char* const kFunctionNames[3] = { "char Strnicmp", "char16_t Stricmp", "char32_t Stricmp" };
+
+	for(int f = 0; f < 3; f++)
+	{
+		EA::UnitTest::ReportVerbosity(1, "%s %u strings: scalar: %I64u cycles; %s: %I64u cycles\n", 
+										kFunctionNames[f], (unsigned)kCount, elapsedTime[f][0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), elapsedTime[f][1]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%d\n", result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+// The nested loop searches of the Strstr family before the candidate scans, for comparison in 
+// TestStrstrSpeed. Each position of pString whose first char matches is compared with the whole 
+// of pSubString, so they take O(n*m) time.
+template <typename T>
+EA_NO_INLINE static T* StrstrNestedLoop(const T* pString, const T* pSubString)
+{
+	const T c0 = *pSubString;
+	T       c1, c2;
+
+	if(c0 == 0)
+		return (T*)pString;
+
+	for(const T* s1 = pString; (c1 = *s1) != 0; ++s1)
+	{
+		if(c1 == c0)
+		{
+			const T* s2 = s1;
+			const T* p2 = pSubString;
+
+			while((c1 = *++s2) == (c2 = *++p2) && c1){} // Do nothing
+
+			if(!c2)
+				return (T*)s1;
+		}
+	}
+	return NULL;
+}
+
+template <typename T>
+EA_NO_INLINE static T* StristrNestedLoop(const T* s1, const T* s2)
+{
+	const T* cp = s1;
+
+	if(!*s2)
+		return (T*)s1;
+
+	while(*cp)
+	{
+		const T* s = cp;
+		const T* t = s2;
+
+		while(*s && *t && (EA::StdC::Tolower(*s) == EA::StdC::Tolower(*t)))
+			++s, ++t;
+
+		if(*t == 0)
+			return (T*)cp;
+		++cp;
+	}
+
+	return NULL;
+}
+
+template <typename T>
+EA_NO_INLINE static T* StrrstrNestedLoop(const T* s1, const T* s2)
+{
+	if(!*s2)
+		return (T*)s1;
+
+	const T* ps1 = s1 + EA::StdC::Strlen(s1);
+
+	while(ps1 != s1)
+	{
+		const T* psc1 = --ps1;
+		const T* sc2  = s2;
+
+		for(;;)
+		{
+			if(*psc1++ != *sc2++)
+				break;
+			else if(!*sc2)
+				return (T*)ps1;
+		}
+	}
+
+	return NULL;
+}
+
+
+static void TestStrstrSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares the Strstr family at the scalar level and at the level selected for this CPU to the 
+	// nested loop search it used before, with a long log-like text which is searched for a needle 
+	// that's near its end (and for a case-folded one, and from the end for one near its beginning), 
+	// as with scanning a log or shader source.
+	const size_t     kLength = 65536;
+	const size_t     kCount  = 16;
+	RandomFast       random;
+	Stopwatch        s(Stopwatch::kUnitsCPUCycles);
+	static char      string8[kLength + 1];
+	static char16_t  string16[kLength + 1];
+	static char32_t  string32[kLength + 1];
+	const char* const kWords[] = { "texture ", "load ", "frame ", "warning: ", "shader ", "float4 ", "0x1f2e ", "mesh ", "[render] ", "\n" };
+	size_t           nLength = 0;
+
+	while(nLength < (kLength - 16))
+	{
+		const char* const pWord = kWords[random.RandomUint32Uniform(EAArrayCount(kWords))];
+
+		nLength += Strlcpy(string8 + nLength, pWord, kLength - nLength);
+	}
+	Strcpy(string8 + nLength - 12, "LastError 7");
+	Strcpy(string8 + 8, "FirstError 7 ");
+	string8[8 + 13] = ' ';
+	Strlcpy(string16, string8, EAArrayCount(string16));
+	Strlcpy(string32, string8, EAArrayCount(string32));
+
+	uint64_t elapsedTime[4][3];
+	size_t   result = 0;
+
+	for(int level = 0; level < 3; level++) // The nested loop search, then the scalar level and the level selected for this CPU.
+	{
+		SetCPUFeatureLevel((level == 1) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += (size_t)(level ? Strstr(string8, "LastError") : StrstrNestedLoop(string8, "LastError"));
+		s.Stop();
+		elapsedTime[0][level] = s.GetElapsedTime();
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += (size_t)(level ? Stristr(string8, "lasterror") : StristrNestedLoop(string8, "lasterror"));
+		s.Stop();
+		elapsedTime[1][level] = s.GetElapsedTime();
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += (size_t)(level ? Strrstr(string16, EA_CHAR16("FirstError")) : StrrstrNestedLoop(string16, EA_CHAR16("FirstError")));
+		s.Stop();
+		elapsedTime[2][level] = s.GetElapsedTime();
+
+		s.Restart();
+		for(size_t i = 0; i < kCount; i++)
+			result += (size_t)(level ? Strstr(string32, EA_CHAR32("LastError")) : StrstrNestedLoop(string32, EA_CHAR32("LastError")));
+		s.Stop();
+		elapsedTime[3][level] = s.GetElapsedTime();
+	}
+
+	const char* const kFunctionNames[4] = { "char Strstr", "char Stristr", "char16_t Strrstr", "char32_t Strstr" };
+
+	for(int f = 0; f < 4; f++)
+	{
+		EA::UnitTest::ReportVerbosity(1, "%s %u x %u chars: nested loop: %I64u cycles; scalar: %I64u cycles; %s: %I64u cycles\n", 
+										kFunctionNames[f], (unsigned)kCount, (unsigned)kLength, elapsedTime[f][0], elapsedTime[f][1], GetCPUFeatureLevelName(GetCPUFeatureLevel()), elapsedTime[f][2]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%u\n", (unsigned)result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+static void TestCharSetSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares the CharSet functions at the scalar level to those at the level selected for this CPU, 
+	// tokenizing a 64 KB text of comma and space separated fields with a delimiter string and with a 
+	// prebuilt CharSet, and scanning a text with long lines for the end of the line.
+	const size_t      kLength = 65536;
+	RandomFast        random;
+	Stopwatch         s(Stopwatch::kUnitsCPUCycles);
+	static char       text[kLength + 1];
+	static char       textCopy[kLength + 1];
+	static char16_t   text16[kLength + 1];
+	static char16_t   text16Copy[kLength + 1];
+	const char* const kDelimiters = ",; \t\r\n";
+	const CharSet     delimiters(kDelimiters);
+	const CharSet     lineEnds("\r\n");
+	size_t            result = 0;
+
+	for(size_t i = 0; i < kLength; i++)
+	{
+		const uint32_t r = random.RandomUint32Uniform(64);
+		text[i] = (r < 8) ? ", \n"[r % 3] : (char)('a' + (r % 26));
+	}
+	text[kLength] = 0;
+	Strlcpy(text16, text, EAArrayCount(text16));
+
+	uint64_t elapsedTime[4][2];
+
+	for(int level = 0; level < 2; level++)
+	{
+		SetCPUFeatureLevel((level == 0) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+		memcpy(textCopy, text, sizeof(text));
+		s.Restart();
+		{
+			char* pContext = NULL;
+			for(char* pToken = Strtok(textCopy, kDelimiters, &pContext); pToken; pToken = Strtok(NULL, kDelimiters, &pContext))
+				result += (size_t)pToken[0];
+		}
+		s.Stop();
+		elapsedTime[0][level] = s.GetElapsedTime();
+
+		memcpy(textCopy, text, sizeof(text));
+		s.Restart();
+		{
+			char* pContext = NULL;
+			for(char* pToken = Strtok(textCopy, delimiters, &pContext); pToken; pToken = Strtok(NULL, delimiters, &pContext))
+				result += (size_t)pToken[0];
+		}
+		s.Stop();
+		elapsedTime[1][level] = s.GetElapsedTime();
+
+		memcpy(text16Copy, text16, sizeof(text16));
+		s.Restart();
+		{
+			char16_t* pContext = NULL;
+			for(char16_t* pToken = Strtok(text16Copy, delimiters, &pContext); pToken; pToken = Strtok(NULL, delimiters, &pContext))
+				result += (size_t)pToken[0];
+		}
+		s.Stop();
+		elapsedTime[2][level] = s.GetElapsedTime();
+
+		s.Restart();
+		for(const char* p = text; *p; p += 1 + Strcspn(p + 1, lineEnds)) // About 150 chars per line.
+			result++;
+		s.Stop();
+		elapsedTime[3][level] = s.GetElapsedTime();
+	}
+
+	const char* const kFunctionNames[4] = { "char Strtok with a string", "char Strtok with a CharSet", "char16_t Strtok with a CharSet", "char Strcspn lines" };
+
+	for(int f = 0; f < 4; f++)
+	{
+		EA::UnitTest::ReportVerbosity(1, "%s %u chars: scalar: %I64u cycles; %s: %I64u cycles\n", 
+										kFunctionNames[f], (unsigned)kLength, elapsedTime[f][0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), elapsedTime[f][1]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%u\n", (unsigned)result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+// Code point by code point conversions like those of the transcoding Strlcpy functions before they 
+// got the dispatched kernels, for comparison in TestStrlcpyTranscodeSpeed. bStopWhenFull is for 
+// comparing to the bool returning Strlcpy functions, which stop when the destination is full, 
+// whereas the int returning ones go on to count the length of the rest of the source.
+static int StrlcpyUTF8ToUTF16Reference(char16_t* pDest, const char* pSource, size_t nDestCapacity, bool bStopWhenFull)
+{
+	static const uint32_t kDecodingOffset[5] = { 0, 0, (0xC0 << 6) + 0x80, (0xE0 << 12) + (0x80 << 6) + 0x80, (0xF0 << 18) + (0x80 << 12) + (0x80 << 6) + 0x80 };
+	static const uint32_t kMinimumValue[5]   = { 0, 0, 0x00000080, 0x00000800, 0x00010000 };
+	static const uint32_t kMaximumValue[5]   = { 0, 0x00000080, 0x00000800, 0x00010000, 0x00110000 };
+	size_t                destCount = 0;
+
+	for(;;)
+	{
+		uint32_t c = (uint8_t)*pSource++;
+
+		if(c == 0)
+			break;
+
+		if(c >= 128)
+		{
+			const uint32_t nLength = (c < 0xc2) ? 0 : (c < 0xe0) ? 2 : (c < 0xf0) ? 3 : (c < 0xf5) ? 4 : 0;
+
+			if(nLength == 0)
+				return -1;
+
+			for(uint32_t i = 0; i < nLength - 1; ++i) 
+			{
+				const uint8_t nByte = (uint8_t)*pSource++;
+
+				if((nByte < 0x80u) || (nByte > 0xbfu))
+					return -1;
+
+				c = (c << 6) + nByte;
+			}
+
+			c -= kDecodingOffset[nLength];
+
+			if((c < kMinimumValue[nLength]) || (c >= kMaximumValue[nLength]))
+				break;
+		}
+
+		if(pDest && ((destCount + 1) < nDestCapacity))
+			*pDest++ = static_cast<char16_t>(c);
+		else if(bStopWhenFull)
+			break;
+
+		destCount++;
+	}
+
+	if(pDest && (nDestCapacity != 0))
+		*pDest = 0;
+
+	return (int)(unsigned)destCount;
+}
+
+template <typename T>
+static int StrlcpyToUTF8Reference(char* pDest, const T* pSource, size_t nDestCapacity, bool bStopWhenFull)
+{
+	size_t destCount = 0;
+
+	for(;;)
+	{
+		uint32_t c = (uint32_t)*pSource++;
+
+		if(c == 0)
+			break;
+
+		if(c >= 0x00200000u)
+			c = 0x0000fffd;
+
+		if(c < 0x00000080u)
+		{
+			if(pDest && ((destCount + 1) < nDestCapacity))
+				*pDest++ = static_cast<char>(c);
+			else if(bStopWhenFull)
+				break;
+
+			destCount += 1;
+		}
+		else if(c < 0x00000800u)
+		{
+			if(pDest && ((destCount + 2) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 6) | 0xc0);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+			else if(bStopWhenFull)
+				break;
+
+			destCount += 2;
+		}
+		else if(c < 0x00010000u)
+		{
+			if(pDest && ((destCount + 3) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 12) | 0xe0);
+				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+			else if(bStopWhenFull)
+				break;
+
+			destCount += 3;
+		}
+		else
+		{
+			if(pDest && ((destCount + 4) < nDestCapacity))
+			{
+				*pDest++ = static_cast<char>((c >> 18) | 0xf0);
+				*pDest++ = static_cast<char>(((c >> 12) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>(((c >>  6) | 0x80) & 0xbf);
+				*pDest++ = static_cast<char>((c | 0x80) & 0xbf);
+			}
+			else if(bStopWhenFull)
+				break;
+
+			destCount += 4;
+		}
+	}
+
+	if(pDest && (nDestCapacity != 0))
+		*pDest = 0;
+
+	return (int)(unsigned)destCount;
+}
+
+
+static void TestStrlcpyTranscodeSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares the transcoding Strlcpy functions as they were before they had the dispatched kernels 
+	// to the current ones at the level selected for this CPU. The texts are ASCII, mostly ASCII with some 
+	// 2 byte UTF-8 (e.g. French), 2 byte (e.g. Russian), 3 byte (e.g. Japanese), and mixed with some 
+	// 4 byte UTF-8 (e.g. emoji). The last case copies only the first 64 chars of an ASCII text with 
+	// the bool returning functions, which mustn't take time proportional to the length of the text.
+	const char* const kTextNames[] = { "ascii", "latin", "cyrillic", "cjk", "mixed", "ascii prefix" };
+	const size_t      kCount = 65536;
+	RandomFast        random;
+	Stopwatch         s(Stopwatch::kUnitsCPUCycles);
+	eastl::string32   s32(kCount + 1, 0);
+	eastl::string16   s16(kCount + 1, 0);
+	eastl::string     s8(kCount * 4 + 1, 0);
+	eastl::string16   s16Dest(kCount + 1, 0);
+	eastl::string     s8Dest(kCount * 4 + 1, 0);
+	int               result = 0;
+
+	for(size_t t = 0; t < EAArrayCount(kTextNames); t++)
+	{
+		for(size_t i = 0; i < kCount; i++)
+		{
+			const uint32_t r = random.RandomUint32Uniform(100);
+
+			switch(t)
+			{
+				case 1:  s32[i] = (char32_t)((r < 95) ? (0x20 + random.RandomUint32Uniform(0x5f)) : (0xc0 + random.RandomUint32Uniform(0x40))); break;
+				case 2:  s32[i] = (char32_t)((r < 15) ? 0x20 : (0x410 + random.RandomUint32Uniform(0x40))); break;
+				case 3:  s32[i] = (char32_t)((r < 5)  ? 0x3002 : (0x4e00 + random.RandomUint32Uniform(0x5000))); break;
+				case 4:  s32[i] = (char32_t)((r < 50) ? (0x20 + random.RandomUint32Uniform(0x5f)) : (r < 70) ? (0x410 + random.RandomUint32Uniform(0x40)) : (r < 95) ? (0x4e00 + random.RandomUint32Uniform(0x5000)) : (0x1f600 + random.RandomUint32Uniform(0x50))); break;
+				default: s32[i] = (char32_t)(0x20 + random.RandomUint32Uniform(0x5f)); break;
+			}
+		}
+
+		Strlcpy(&s8[0], s32.data(), s8.size());
+		Strlcpy(&s16[0], s32.data(), s16.size());
+
+		const size_t   nDestCapacity16 = (t == 5) ? 64 : s16Dest.size();
+		const size_t   nDestCapacity8  = (t == 5) ? 64 : s8Dest.size();
+		const uint32_t nRepeatCount    = (t == 5) ? 1000 : 1; // A single short copy is too quick to time.
+		uint64_t       elapsedTime[3][2];
+		size_t         nDestUsed, nSourceUsed;
+
+		SetCPUFeatureLevel(kCPUFeatureLevelCount);
+
+		for(int impl = 0; impl < 2; impl++)
+		{
+			s.Restart();
+			for(uint32_t r = 0; r < nRepeatCount; r++)
+			{
+				if(impl == 0)
+					result += StrlcpyUTF8ToUTF16Reference(&s16Dest[0], s8.data(), nDestCapacity16, t == 5);
+				else if(t == 5) // The int returning Strlcpy functions must read the whole source to return its converted length, so we use the bool returning one.
+					result += Strlcpy(&s16Dest[0], s8.data(), nDestCapacity16, kSizeTypeUnset, nDestUsed, nSourceUsed) ? 1 : 0;
+				else
+					result += Strlcpy(&s16Dest[0], s8.data(), nDestCapacity16);
+			}
+			s.Stop();
+			elapsedTime[0][impl] = s.GetElapsedTime() / nRepeatCount;
+
+			s.Restart();
+			for(uint32_t r = 0; r < nRepeatCount; r++)
+			{
+				if(impl == 0)
+					result += StrlcpyToUTF8Reference(&s8Dest[0], s16.data(), nDestCapacity8, t == 5);
+				else if(t == 5)
+					result += Strlcpy(&s8Dest[0], s16.data(), nDestCapacity8, kSizeTypeUnset, nDestUsed, nSourceUsed) ? 1 : 0;
+				else
+					result += Strlcpy(&s8Dest[0], s16.data(), nDestCapacity8);
+			}
+			s.Stop();
+			elapsedTime[1][impl] = s.GetElapsedTime() / nRepeatCount;
+
+			s.Restart();
+			for(uint32_t r = 0; r < nRepeatCount; r++)
+			{
+				if(impl == 0)
+					result += StrlcpyToUTF8Reference(&s8Dest[0], s32.data(), nDestCapacity8, t == 5);
+				else if(t == 5)
+					result += Strlcpy(&s8Dest[0], s32.data(), nDestCapacity8, kSizeTypeUnset, nDestUsed, nSourceUsed) ? 1 : 0;
+				else
+					result += Strlcpy(&s8Dest[0], s32.data(), nDestCapacity8);
+			}
+			s.Stop();
+			elapsedTime[2][impl] = s.GetElapsedTime() / nRepeatCount;
+		}
+
+		EA::UnitTest::ReportVerbosity(1, "Strlcpy %s, %u code points: previous: %I64u/%I64u/%I64u cycles; %s: %I64u/%I64u/%I64u cycles (UTF-8 to UTF-16/UTF-16 to UTF-8/UTF-32 to UTF-8)\n", 
+										kTextNames[t], (unsigned)kCount, elapsedTime[0][0], elapsedTime[1][0], elapsedTime[2][0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), 
+										elapsedTime[0][1], elapsedTime[1][1], elapsedTime[2][1]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%d\n", result); // Prevent the compiler from optimizing away the calls.
+}
+
+
 static int TestStrend()
 {
 	using namespace EA::StdC;
@@ -4285,6 +6611,8 @@ int TestString()
 	nErrorCount += TestStrtoi();
 	nErrorCount += TestAtof();
 	nErrorCount += TestFtoa();
+	nErrorCount += TestParseNumberArray();
+	nErrorCount += TestFtoaShortest();
 	nErrorCount += TestReduceFloatString();
 	nErrorCount += TestConvertString();
 	nErrorCount += TestStringCore();    
@@ -4294,6 +6622,21 @@ int TestString()
 	nErrorCount += TestStrstrip();
 	nErrorCount += TestStrstart();
 	nErrorCount += TestStrend();
+	nErrorCount += TestStrlen();
+	nErrorCount += TestStricmp();
+	nErrorCount += TestStrstr();
+	nErrorCount += TestCharSet();
+	nErrorCount += TestStrlcpyTranscode();
+
+	TestItoaSpeed();
+	TestFtoaShortestSpeed();
+	TestStrtodSpeed();
+	TestStrtoiSpeed();
+	TestParseNumberArraySpeed();
+	TestStrlcpyTranscodeSpeed();
+	TestStricmpSpeed();
+	TestStrstrSpeed();
+	TestCharSetSpeed();
 	
 	EA::StdC::SetAssertionsEnabled(assertionsEnabled);
 
@@ -5,10 +5,14 @@
 
 #include <EAStdC/EATextUtil.h>
 #include <EAStdC/EAString.h>
+#include <EAStdC/EARandom.h>
+#include <EAStdC/EAStopwatch.h>
+#include <EAStdC/EACPUDispatch.h>
 #include <EAStdCTest/EAStdCTest.h>
 #include <EATest/EATest.h>
 #include <EASTL/fixed_string.h>
 #include <EASTL/string.h>
+#include <EASTL/vector.h>
 
 #include <string.h>
 
@@ -344,6 +348,303 @@ static int TestUTF8()
 
 
 
+// Verifies that UTF8ValidateEx gives the same results at every CPU feature level.
+static int TestUTF8ValidateLevels(const char* p, size_t nLength)
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// We copy the string to an exactly sized heap block, so that reading past it can be detected.
+	char* pCopy = new char[nLength + 1];
+	memcpy(pCopy, p, nLength);
+
+	size_t nInvalidOffsetScalar = 0, nCountScalar = 0;
+	SetCPUFeatureLevel(kCPUFeatureLevelScalar);
+	const bool bResultScalar = UTF8ValidateEx(pCopy, nLength, nInvalidOffsetScalar, nCountScalar);
+
+	EATEST_VERIFY(bResultScalar == (nInvalidOffsetScalar == nLength));
+	EATEST_VERIFY(bResultScalar == UTF8Validate(pCopy, nLength));
+
+	for(int level = kCPUFeatureLevelScalar + 1; level <= GetCPUFeatureLevelSupported(); level++)
+	{
+		EATEST_VERIFY(SetCPUFeatureLevel((CPUFeatureLevel)level) == level);
+
+		size_t     nInvalidOffset = 0, nCount = 0;
+		const bool bResult = UTF8ValidateEx(pCopy, nLength, nInvalidOffset, nCount);
+
+		EATEST_VERIFY((bResult == bResultScalar) && (nInvalidOffset == nInvalidOffsetScalar) && (nCount == nCountScalar));
+		EATEST_VERIFY(bResult == UTF8Validate(pCopy, nLength));
+	}
+	SetCPUFeatureLevel(kCPUFeatureLevelCount);
+
+	delete[] pCopy;
+
+	return nErrorCount;
+}
+
+
+static int TestUTF8Validate()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// bool UTF8ValidateEx(const char* p, size_t nLength, size_t& nInvalidOffset, size_t& nCodePointCount);
+	{
+		struct Result
+		{
+			const char* mpString;
+			size_t      mnLength;
+			bool        mbValid;
+			size_t      mnInvalidOffset;
+			size_t      mnCodePointCount;
+		};
+
+		const Result kResults[] =
+		{
+			{ "",                             0, true,  0, 0 },
+			{ "a\0b",                         3, true,  3, 3 },
+			{ "abc\xc0",                      4, false, 3, 3 },
+			{ "a\xc3\xa9z",                   4, true,  4, 3 },
+			{ "a\xc3z",                       3, false, 1, 1 },
+			{ "\xe0\x9f\xbf",                 3, false, 0, 0 },
+			{ "\xe0\xa0\x80",                 3, true,  3, 1 },
+			{ "x\xed\xa0\x80",                4, true,  4, 2 },
+			{ "ab\xf0\x8f\x80\x80",           6, false, 2, 2 },
+			{ "ab\xf0\x90\x80\x80",           6, true,  6, 3 },
+			{ "\xf8\x88\x80\x80\x80",         5, true,  5, 1 },
+			{ "\xf8\x87\xbf\xbf\xbf",         5, false, 0, 0 },
+			{ "\xfc\x84\x80\x80\x80\x80",     6, true,  6, 1 },
+			{ "\xc2\xa9\xe1\x80",             4, false, 2, 1 },
+			{ "\xc2\xa9\xfe",                 3, false, 2, 1 },
+			{ "\x80",                         1, false, 0, 0 }
+		};
+
+		for(size_t i = 0; i < EAArrayCount(kResults); i++)
+		{
+			const Result& r = kResults[i];
+			size_t        nInvalidOffset = 0, nCount = 0;
+
+			EATEST_VERIFY(UTF8ValidateEx(r.mpString, r.mnLength, nInvalidOffset, nCount) == r.mbValid);
+			EATEST_VERIFY((nInvalidOffset == r.mnInvalidOffset) && (nCount == r.mnCodePointCount));
+			nErrorCount += TestUTF8ValidateLevels(r.mpString, r.mnLength);
+		}
+	}
+
+	{   // Chars at and across 64 byte block boundaries, which are carried over from one block to the next.
+		static const char* const kChars[] = { "\xc2\xa9", "\xe0\xa0\x80", "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf4\x8f\xbf\xbf", "\xf8\x88\x80\x80\x80",
+		                                      "\xe0\x80\x80", "\xf0\x80\x80\x80", "\xc2", "\xe1\x80", "\x80", "\xc2\xc2", "\xff" };
+
+		for(size_t c = 0; c < EAArrayCount(kChars); c++)
+		{
+			const size_t nCharLength = strlen(kChars[c]);
+			const bool   bValid      = (c < 6);
+
+			for(size_t i = 56; i < 136; i++)
+			{
+				String8 s(i, 'a');
+				s += kChars[c];
+				s.append(200 - i, 'b');
+
+				size_t nInvalidOffset = 0, nCount = 0;
+
+				EATEST_VERIFY(UTF8ValidateEx(s.data(), s.size(), nInvalidOffset, nCount) == bValid);
+				EATEST_VERIFY(bValid ? ((nInvalidOffset == s.size()) && (nCount == (s.size() - nCharLength + 1))) : ((nInvalidOffset == i) && (nCount == i)));
+				nErrorCount += TestUTF8ValidateLevels(s.data(), s.size());
+				nErrorCount += TestUTF8ValidateLevels(s.data(), i + nCharLength - 1); // Truncated
+			}
+		}
+	}
+
+	{   // Random text, some of it with changed bytes.
+		RandomFast random(0x12345678);
+
+		for(int i = 0; i < 1000; i++)
+		{
+			const size_t nCount = random.RandomUint32Uniform(300);
+			uint32_t     kind   = random.RandomUint32Uniform(5);
+			String8      s;
+
+			for(size_t j = 0; j < nCount; j++)
+			{
+				if(random.RandomUint32Uniform(8) == 0) // Mostly continue a run of chars of the same size.
+					kind = random.RandomUint32Uniform(5);
+				TestAppendUTF8(s, TestRandomCodePoint(random, kind));
+			}
+
+			if(!s.empty() && ((i % 2) != 0))
+			{
+				for(uint32_t j = random.RandomUint32Uniform(3); j < 3; j++)
+					s[random.RandomUint32Uniform((uint32_t)s.size())] = (char)random.RandomUint32Uniform(256);
+			}
+
+			nErrorCount += TestUTF8ValidateLevels(s.data(), s.size());
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+static int TestUTF8LengthIncrement()
+{
+	using namespace EA::StdC;
+
+	int nErrorCount = 0;
+
+	// size_t UTF8Length(const char* p);
+	// size_t UTF8Length(const char* p, size_t nLength);
+	// char*  UTF8Increment(const char* p, size_t n);
+	{
+		EATEST_VERIFY(UTF8Length("a\xc3\xa9z", 4) == 3);
+		EATEST_VERIFY(UTF8Length("a\xc3\xa9z", kLengthNull) == 3);
+		EATEST_VERIFY(UTF8Length("a\0\xc3\xa9", 4) == 3);
+		EATEST_VERIFY(UTF8Length("a\xc3\xa9z", 0) == 0);
+	}
+
+	{   // Random text, of each kind and mixed. The chars are copied to an exactly sized heap block, 
+		// without a terminating 0, so that reading past them can be detected.
+		RandomFast random(0x12345678);
+
+		for(int i = 0; i < 300; i++)
+		{
+			const size_t          nCount = (i < 100) ? random.RandomUint32Uniform(100) : random.RandomUint32Uniform(3000);
+			const uint32_t        kind   = random.RandomUint32Uniform(6);
+			String8               s;
+			eastl::vector<size_t> positions; // positions[i] is the position of char i.
+
+			for(size_t j = 0; j < nCount; j++)
+			{
+				positions.push_back(s.size());
+				TestAppendUTF8(s, TestRandomCodePoint(random, (kind < 5) ? kind : random.RandomUint32Uniform(5)));
+			}
+			positions.push_back(s.size());
+
+			char* p = new char[s.size() + 1];
+			memcpy(p, s.data(), s.size());
+
+			for(int level = kCPUFeatureLevelScalar; level <= GetCPUFeatureLevelSupported(); level++)
+			{
+				EATEST_VERIFY(SetCPUFeatureLevel((CPUFeatureLevel)level) == level);
+
+				EATEST_VERIFY(UTF8Length(p, s.size()) == nCount);
+
+				for(int j = 0; j < 8; j++)
+				{
+					const size_t n = (j == 0) ? nCount : random.RandomUint32Uniform((uint32_t)nCount + 1);
+
+					EATEST_VERIFY(UTF8Increment(p, n) == (p + positions[n]));
+					EATEST_VERIFY(UTF8Length(p, positions[n]) == n);
+				}
+			}
+			SetCPUFeatureLevel(kCPUFeatureLevelCount);
+
+			delete[] p;
+
+			if(s.find('\0') == String8::npos)
+				EATEST_VERIFY(UTF8Length(s.c_str()) == nCount);
+		}
+	}
+
+	return nErrorCount;
+}
+
+
+static void TestUTF8LengthIncrementSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares UTF8Length and UTF8Increment at the scalar level, which is a word at a time, 
+	// to those at the level selected for this CPU, with ASCII and mixed text.
+	const char* const kTextNames[] = { "ascii", "mixed" };
+	const size_t      kCount = 65536;
+	RandomFast        random;
+	Stopwatch         s(Stopwatch::kUnitsCPUCycles);
+	size_t            result = 0;
+
+	for(size_t t = 0; t < EAArrayCount(kTextNames); t++)
+	{
+		String8 s8;
+
+		for(size_t i = 0; i < kCount; i++)
+		{
+			const uint32_t r = random.RandomUint32Uniform(100);
+			TestAppendUTF8(s8, TestRandomCodePoint(random, (t == 0) ? 0 : ((r < 50) ? 0 : (r < 70) ? 1 : (r < 95) ? 2 : 3)));
+		}
+
+		uint64_t elapsedTime[2][2];
+
+		for(int level = 0; level < 2; level++)
+		{
+			SetCPUFeatureLevel((level == 0) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+			s.Restart();
+			result += UTF8Length(s8.c_str());
+			s.Stop();
+			elapsedTime[0][level] = s.GetElapsedTime();
+
+			s.Restart();
+			result += (size_t)(UTF8Increment(s8.c_str(), kCount) - s8.c_str());
+			s.Stop();
+			elapsedTime[1][level] = s.GetElapsedTime();
+		}
+
+		EA::UnitTest::ReportVerbosity(1, "UTF8Length/UTF8Increment %s, %u chars: scalar: %I64u/%I64u cycles; %s: %I64u/%I64u cycles\n", 
+										kTextNames[t], (unsigned)kCount, elapsedTime[0][0], elapsedTime[1][0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), 
+										elapsedTime[0][1], elapsedTime[1][1]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%u\n", (unsigned)result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+static void TestUTF8ValidateSpeed()
+{
+	using namespace EA::StdC;
+
+	// Compares UTF8Validate at the scalar level, which is UTF8ValidateChar plus an ASCII run loop, 
+	// to that at the level selected for this CPU, with ASCII text, mostly ASCII text with some 
+	// 2 byte chars (e.g. French), and mixed text with 2 to 4 byte chars.
+	const char* const kTextNames[] = { "ascii", "latin", "mixed" };
+	const size_t      kCount = 65536;
+	RandomFast        random;
+	Stopwatch         s(Stopwatch::kUnitsCPUCycles);
+	int               result = 0;
+
+	for(size_t t = 0; t < EAArrayCount(kTextNames); t++)
+	{
+		String8 s8;
+
+		while(s8.size() < kCount)
+		{
+			const uint32_t r    = random.RandomUint32Uniform(100);
+			const uint32_t kind = (t == 0) ? 0 : (t == 1) ? ((r < 95) ? 0 : 1) : ((r < 50) ? 0 : (r < 70) ? 1 : (r < 95) ? 2 : 3);
+
+			TestAppendUTF8(s8, TestRandomCodePoint(random, kind));
+		}
+
+		uint64_t elapsedTime[2];
+
+		for(int level = 0; level < 2; level++)
+		{
+			SetCPUFeatureLevel((level == 0) ? kCPUFeatureLevelScalar : kCPUFeatureLevelCount);
+
+			s.Restart();
+			result += UTF8Validate(s8.data(), s8.size()) ? 1 : 0;
+			s.Stop();
+			elapsedTime[level] = s.GetElapsedTime();
+		}
+
+		EA::UnitTest::ReportVerbosity(1, "UTF8Validate %s, %u bytes: scalar: %I64u cycles; %s: %I64u cycles\n", 
+										kTextNames[t], (unsigned)s8.size(), elapsedTime[0], GetCPUFeatureLevelName(GetCPUFeatureLevel()), elapsedTime[1]);
+	}
+
+	EA::UnitTest::ReportVerbosity(2, "%d\n", result); // Prevent the compiler from optimizing away the calls.
+}
+
+
+
 int TestTextUtil()
 {
 	using namespace EA::StdC;
@@ -351,6 +652,10 @@ int TestTextUtil()
 	int nErrorCount(0);
 
 	nErrorCount += TestUTF8();
+	nErrorCount += TestUTF8Validate();
+	nErrorCount += TestUTF8LengthIncrement();
+	TestUTF8ValidateSpeed();
+	TestUTF8LengthIncrementSpeed();
 
 	// WildcardMatch
 	{